@@ -25,17 +25,29 @@
 // Drivers
 #include "drivers/peripheral/gpio/gpio.h"
 #include "drivers/peripheral/uart/uart.h"
+#include "drivers/peripheral/uart/uart_dbg.h"
 #include "drivers/peripheral/usb_cdc/usb_cdc.h"
 #include "drivers/peripheral/timer/timer.h"
 
 // HMI
 #include "drivers/hmi/button/button/src/button.h"
+#include "drivers/hmi/button/button_deb.h"
 #include "drivers/hmi/led/led/src/led.h"
+#include "drivers/hmi/led/led_seq.h"
 #include "drivers/peripheral/adc/adc.h"
 
 // Middleware
 #include "middleware/cli/cli/src/cli.h"
+#include "middleware/cli/cli_if.h"
+#include "middleware/cli/cli_log.h"
 #include "middleware/parameters/parameters/src/par.h"
+#include "middleware/parameters/par_batch.h"
+#include "middleware/parameters/par_proto.h"
+#include "middleware/nvm/nvm.h"
+#include "middleware/scheduler/scheduler.h"
+#include "middleware/watchdog/wdt_sup.h"
+#include "middleware/journal/journal.h"
+#include "middleware/trace/trace.h"
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -56,11 +68,37 @@ static void app_btn_4_pressed	(void);
 static void app_btn_4_released	(void);
 
 static void app_update_adc_pars (void);
+static void app_update_usb_pars (void);
+static void app_update_uart_pars(void);
+static void app_update_sched_pars(void);
+static void app_report_journal	(void);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ *  Fault names, indexed by journal_fault_t
+ */
+static const char * const gp_app_fault_str[] =
+{
+    "none", "assert", "app error", "hard fault", "watchdog",
+};
+
+/**
+ *  Scheduler profiling parameters, indexed by sched_task_t
+ */
+static const par_num_t g_app_sched_par[][3] =
+{
+    //                          Average                         Maximum                         Deadline misses
+    [eSCHED_TASK_COMM]      = { ePAR_SCHED_COMM_EXEC_AVG,       ePAR_SCHED_COMM_EXEC_MAX,       ePAR_SCHED_COMM_MISS    },
+    [eSCHED_TASK_10MS]      = { ePAR_SCHED_10MS_EXEC_AVG,       ePAR_SCHED_10MS_EXEC_MAX,       ePAR_SCHED_10MS_MISS    },
+    [eSCHED_TASK_100MS]     = { ePAR_SCHED_100MS_EXEC_AVG,      ePAR_SCHED_100MS_EXEC_MAX,      ePAR_SCHED_100MS_MISS   },
+    [eSCHED_TASK_1000MS]    = { ePAR_SCHED_1000MS_EXEC_AVG,     ePAR_SCHED_1000MS_EXEC_MAX,     ePAR_SCHED_1000MS_MISS  },
+};
+
+_Static_assert(( sizeof( g_app_sched_par ) / sizeof( g_app_sched_par[0] )) == eSCHED_TASK_NUM_OF, "Scheduler profiling parameters do not match task list!" );
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -85,6 +123,12 @@ void app_init(void)
         PROJECT_CONFIG_ASSERT( 0 );
     }
 
+    // Init deferred logging
+    if ( eCLI_OK != cli_log_init())
+    {
+        PROJECT_CONFIG_ASSERT( 0 );
+    }
+
     // Init timer
     if ( eTIMER_OK != timer_init())
     {
@@ -100,7 +144,8 @@ void app_init(void)
     }
 
     // Init LEDs
-    if ( eLED_OK != led_init())
+    if  (   ( eLED_OK != led_init())
+        ||  ( eLED_OK != led_seq_init()))
     {
     cli_printf_ch( eCLI_CH_APP, "LED init error!" );
         PROJECT_CONFIG_ASSERT( 0 );
@@ -111,10 +156,25 @@ void app_init(void)
         app_led_fade_setup();
 
         // Hearthbeat
-        led_blink_smooth( eLED_1, 1.0f, 2.0f, eLED_BLINK_CONTINUOUS );
+        led_seq_blink_smooth( eLED_1, 1.0f, 2.0f, eLED_BLINK_CONTINUOUS );
     }
 
     // Init buttons
+#if ( 1 == BUTTON_CFG_FIXED_DEB_EN )
+    if ( eBUTTON_OK != button_deb_init())
+    {
+        cli_printf_ch( eCLI_CH_APP, "BUTTON init error!" );
+        PROJECT_CONFIG_ASSERT( 0 );
+    }
+    else
+    {
+        // Register btn event callbacks
+        (void) button_deb_register_callback( eBUTTON_1, &app_btn_1_pressed, &app_btn_1_released );
+        (void) button_deb_register_callback( eBUTTON_2, &app_btn_2_pressed, &app_btn_2_released );
+        (void) button_deb_register_callback( eBUTTON_3, &app_btn_3_pressed, &app_btn_3_released );
+        (void) button_deb_register_callback( eBUTTON_4, &app_btn_4_pressed, &app_btn_4_released );
+    }
+#else
     if ( eBUTTON_OK != button_init())
     {
         cli_printf_ch( eCLI_CH_APP, "BUTTON init error!" );
@@ -128,25 +188,75 @@ void app_init(void)
         button_register_callback( eBUTTON_3, &app_btn_3_pressed, &app_btn_3_released );
         button_register_callback( eBUTTON_4, &app_btn_4_pressed, &app_btn_4_released );
     }
+#endif
 
 	// Init device paramters
-	if ( ePAR_OK != par_init())
+	if 	(	( ePAR_OK != par_init())
+		||	( ePAR_OK != par_batch_init()))
 	{
         cli_printf_ch( eCLI_CH_APP, "PAR init error!" );
 		PROJECT_CONFIG_ASSERT( 0 );
 	}
 
+	// Report and publish reset journal of previous run
+	app_report_journal();
+
+	// Init binary parameter protocol
+	if ( ePAR_OK != par_proto_init())
+	{
+        cli_printf_ch( eCLI_CH_APP, "PAR protocol init error!" );
+		PROJECT_CONFIG_ASSERT( 0 );
+	}
+
     if ( eUSB_CDC_OK != usb_cdc_init())
     {
         cli_printf_ch( eCLI_CH_APP, "USB CDC init error!" );
 		PROJECT_CONFIG_ASSERT( 0 );
     }
+    else
+    {
+        // Fast console for bulk operations
+        (void) cli_if_set_en( eCLI_IF_TRANSPORT_USB_CDC, true );
+    }
 
 	if ( eUART_OK != uart_1_init())
 	{
         cli_printf_ch( eCLI_CH_APP, "UART1 init error!" );
 		PROJECT_CONFIG_ASSERT( 0 );
 	}
+	else
+	{
+		(void) cli_if_set_en( eCLI_IF_TRANSPORT_UART_1, true );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*         Application communication function
+*
+* @note     Runs every 10ms and additionally on each debug UART reception
+*           and USB event posted from ISR.
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void app_hndl_comm(void)
+{
+	TP_ENTER( APP_COMM );
+
+	// Handle CLI
+	cli_hndl();
+
+	// Handle USB CDC
+	usb_cdc_hndl();
+
+	// Binary parameter streaming
+	par_proto_hndl();
+
+	// Handle debug UART reception timeout
+	uart_dbg_hndl();
+
+	TP_EXIT( APP_COMM );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,18 +268,21 @@ void app_init(void)
 ////////////////////////////////////////////////////////////////////////////////
 void app_hndl_10ms(void)
 {
+    TP_ENTER( APP_10MS );
+
     // Handle HMI
     led_hndl();
-    button_hndl();
 
-	// Handle CLI
-	cli_hndl();
+#if ( 1 == BUTTON_CFG_FIXED_DEB_EN )
+    (void) button_deb_hndl();
+#else
+    button_hndl();
+#endif
 
 	// Update ADC raw values
 	app_update_adc_pars();
 
-	// Handle USB CDC
-	usb_cdc_hndl();
+    TP_EXIT( APP_10MS );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -181,7 +294,11 @@ void app_hndl_10ms(void)
 ////////////////////////////////////////////////////////////////////////////////
 void app_hndl_100ms(void)
 {
+    TP_ENTER( APP_100MS );
+
     // Further actions here...
+
+    TP_EXIT( APP_100MS );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -193,7 +310,23 @@ void app_hndl_100ms(void)
 ////////////////////////////////////////////////////////////////////////////////
 void app_hndl_1000ms(void)
 {
+    TP_ENTER( APP_1000MS );
+
+	// Update USB CDC statistics
+	app_update_usb_pars();
+
+	// Update UART1 statistics
+	app_update_uart_pars();
+
+	// Update scheduler profiling
+	app_update_sched_pars();
+
+	// Flush persistent parameters
+	nvm_hndl();
+
     // Further actions here...
+
+    TP_EXIT( APP_1000MS );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -211,10 +344,10 @@ static void app_led_fade_setup(void)
         .fade_out_time  = 0.1f,
         .max_duty       = 1.0f,
     };
-    led_set_fade_cfg( eLED_1, &led_cfg ); 
-    led_set_fade_cfg( eLED_2, &led_cfg ); 
-    led_set_fade_cfg( eLED_3, &led_cfg ); 
-    led_set_fade_cfg( eLED_4, &led_cfg );    
+    led_seq_set_fade_cfg( eLED_1, &led_cfg ); 
+    led_seq_set_fade_cfg( eLED_2, &led_cfg ); 
+    led_seq_set_fade_cfg( eLED_3, &led_cfg ); 
+    led_seq_set_fade_cfg( eLED_4, &led_cfg );    
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -226,11 +359,11 @@ static void app_led_fade_setup(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_1_pressed(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 1 pressed!" );
-    led_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 1 pressed!" );
+    led_seq_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
 	
 	// Set parameter
-	par_set( ePAR_BTN_1, (uint8_t*) &(uint8_t){1} );
+	par_set_tracked( ePAR_BTN_1, (uint8_t*) &(uint8_t){1} );
 
 	// Further actions here...
 
@@ -247,10 +380,10 @@ static void app_btn_1_pressed(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_1_released(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 1 releassed!" );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 1 releassed!" );
 
 	// Set parameter
-	par_set( ePAR_BTN_1, (uint8_t*) &(uint8_t){0} );
+	par_set_tracked( ePAR_BTN_1, (uint8_t*) &(uint8_t){0} );
 
 	// Further actions here...
 
@@ -266,11 +399,11 @@ static void app_btn_1_released(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_2_pressed(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 2 pressed!" );
-    led_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 2 pressed!" );
+    led_seq_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
 
 	// Set parameter
-	par_set( ePAR_BTN_2, (uint8_t*) &(uint8_t){1} );
+	par_set_tracked( ePAR_BTN_2, (uint8_t*) &(uint8_t){1} );
 
 	// Further actions here...
 
@@ -285,10 +418,10 @@ static void app_btn_2_pressed(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_2_released(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 2 releassed!" );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 2 releassed!" );
 
 	// Set parameter
-	par_set( ePAR_BTN_2, (uint8_t*) &(uint8_t){0} );
+	par_set_tracked( ePAR_BTN_2, (uint8_t*) &(uint8_t){0} );
 
 	// Further actions here...
 }
@@ -302,11 +435,11 @@ static void app_btn_2_released(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_3_pressed(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 3 pressed!" );
-    led_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 3 pressed!" );
+    led_seq_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
 
 	// Set parameter
-	par_set( ePAR_BTN_3, (uint8_t*) &(uint8_t){1} );
+	par_set_tracked( ePAR_BTN_3, (uint8_t*) &(uint8_t){1} );
 
 	// Further actions here...
 }
@@ -320,10 +453,10 @@ static void app_btn_3_pressed(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_3_released(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 3 releassed!" );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 3 releassed!" );
 
 	// Set parameter
-	par_set( ePAR_BTN_3, (uint8_t*) &(uint8_t){0} );
+	par_set_tracked( ePAR_BTN_3, (uint8_t*) &(uint8_t){0} );
 
 	// Further actions here...
 }
@@ -337,11 +470,11 @@ static void app_btn_3_released(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_4_pressed(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 4 pressed!" );
-    led_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 4 pressed!" );
+    led_seq_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X );
 
 	// Set parameter
-	par_set( ePAR_BTN_4, (uint8_t*) &(uint8_t){1} );
+	par_set_tracked( ePAR_BTN_4, (uint8_t*) &(uint8_t){1} );
 
 	// Further actions here...
 }
@@ -355,10 +488,10 @@ static void app_btn_4_pressed(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_btn_4_released(void)
 {
-	cli_printf_ch( eCLI_CH_APP, "User btn 4 releassed!" );
+	CLI_LOG_CH( eCLI_CH_APP, "User btn 4 releassed!" );
 
 	// Set parameter
-	par_set( ePAR_BTN_4, (uint8_t*) &(uint8_t){0} );
+	par_set_tracked( ePAR_BTN_4, (uint8_t*) &(uint8_t){0} );
 
 	// Further actions here...
 }
@@ -372,25 +505,150 @@ static void app_btn_4_released(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void app_update_adc_pars(void)
 {
-	uint16_t adc_val;
+	uint16_t adc_val[6];
 
-	adc_val = adc_get_raw( eADC_AIN_1 );
-	par_set( ePAR_AIN_1, (uint16_t*) &adc_val );
+	const par_batch_item_t items[6] =
+	{
+		{ .par_num = ePAR_AIN_1, .p_val = &adc_val[0] },
+		{ .par_num = ePAR_AIN_2, .p_val = &adc_val[1] },
+		{ .par_num = ePAR_AIN_4, .p_val = &adc_val[2] },
+		{ .par_num = ePAR_AIN_5, .p_val = &adc_val[3] },
+		{ .par_num = ePAR_AIN_6, .p_val = &adc_val[4] },
+		{ .par_num = ePAR_AIN_7, .p_val = &adc_val[5] },
+	};
+
+	adc_val[0] = adc_get_raw( eADC_AIN_1 );
+	adc_val[1] = adc_get_raw( eADC_AIN_2 );
+	adc_val[2] = adc_get_raw( eADC_AIN_4 );
+	adc_val[3] = adc_get_raw( eADC_AIN_5 );
+	adc_val[4] = adc_get_raw( eADC_AIN_6 );
+	adc_val[5] = adc_get_raw( eADC_AIN_7 );
+
+	// Single lock, only changed values are written
+	(void) par_set_batch( items, 6U );
+}
 
-	adc_val = adc_get_raw( eADC_AIN_2 );
-	par_set( ePAR_AIN_2, (uint16_t*) &adc_val );
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update USB CDC parameters
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void app_update_usb_pars(void)
+{
+	usb_cdc_rx_stats_t stats;
 
-	adc_val = adc_get_raw( eADC_AIN_4 );
-	par_set( ePAR_AIN_4, (uint16_t*) &adc_val );
+	if ( eUSB_CDC_OK == usb_cdc_get_rx_stats( &stats ))
+	{
+		par_set_tracked( ePAR_USB_RX_RATE, (uint32_t*) &stats.rate );
+		par_set_tracked( ePAR_USB_RX_OVERRUN, (uint32_t*) &stats.overruns );
+	}
+}
 
-	adc_val = adc_get_raw( eADC_AIN_5 );
-	par_set( ePAR_AIN_5, (uint16_t*) &adc_val );
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update UART1 parameters
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void app_update_uart_pars(void)
+{
+	uint32_t lost = 0;
 
-	adc_val = adc_get_raw( eADC_AIN_6 );
-	par_set( ePAR_AIN_6, (uint16_t*) &adc_val );
+	if ( eUART_OK == uart_1_get_rx_overrun( &lost ))
+	{
+		par_set_tracked( ePAR_UART1_RX_OVERRUN, (uint32_t*) &lost );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update scheduler profiling parameters
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void app_update_sched_pars(void)
+{
+	sched_stats_t 		stats[eSCHED_TASK_NUM_OF];
+	par_batch_item_t	items[ 2U + ( 3U * eSCHED_TASK_NUM_OF )];
+	uint32_t			num_of	= 0;
+	float32_t 			load;
+	uint8_t				load_u8;
+	uint8_t				idle_u8;
+
+	if ( eSCHED_OK == sched_get_load( &load ))
+	{
+		load_u8 = ( load < 100.0f ) ? (uint8_t)( load + 0.5f ) : 100U;
+		idle_u8 = (uint8_t)( 100U - load_u8 );
+
+		items[num_of++] = (par_batch_item_t){ .par_num = ePAR_SCHED_CPU_LOAD, .p_val = &load_u8 };
+		items[num_of++] = (par_batch_item_t){ .par_num = ePAR_SCHED_CPU_IDLE, .p_val = &idle_u8 };
+	}
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		if ( eSCHED_OK == sched_get_stats( task, &stats[task] ))
+		{
+			items[num_of++] = (par_batch_item_t){ .par_num = g_app_sched_par[task][0], .p_val = &stats[task].exec_avg_us };
+			items[num_of++] = (par_batch_item_t){ .par_num = g_app_sched_par[task][1], .p_val = &stats[task].exec_max_us };
+			items[num_of++] = (par_batch_item_t){ .par_num = g_app_sched_par[task][2], .p_val = &stats[task].deadline_miss };
+		}
+	}
 
-	adc_val = adc_get_raw( eADC_AIN_7 );
-	par_set( ePAR_AIN_7, (uint16_t*) &adc_val );
+	(void) par_set_batch( items, num_of );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Print reset journal of previous run and publish it to parameters
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void app_report_journal(void)
+{
+	journal_info_t info;
+
+	if ( eJOURNAL_OK == journal_get_last( &info ))
+	{
+		const uint8_t fault = (uint8_t) info.fault;
+
+		par_set_tracked( ePAR_RST_REASON,   (uint32_t*) &info.resetreas );
+		par_set_tracked( ePAR_RST_FAULT,    (uint8_t*)  &fault );
+		par_set_tracked( ePAR_RST_PC,       (uint32_t*) &info.pc );
+		par_set_tracked( ePAR_RST_LINE,     (uint32_t*) &info.line );
+		par_set_tracked( ePAR_RST_BOOT_CNT, (uint32_t*) &info.boot_cnt );
+
+		cli_printf_ch( eCLI_CH_APP, "Boot #%u, RESETREAS: 0x%08X", info.boot_cnt, info.resetreas );
+
+		if (( eJOURNAL_FAULT_NONE != info.fault ) && ( info.fault <= eJOURNAL_FAULT_WDT ))
+		{
+			cli_printf_ch( eCLI_CH_APP, "Fault: %s at %u ms, PC: 0x%08X, LR: 0x%08X, info: 0x%08X", gp_app_fault_str[info.fault], info.time_ms, info.pc, info.lr, info.info );
+
+			if ( eJOURNAL_FAULT_WDT == info.fault )
+			{
+				if ( WDT_SUP_INFO_TASK( info.info ) < eWDT_TASK_NUM_OF )
+				{
+					const wdt_cfg_t * p_wdt_cfg = (const wdt_cfg_t*) wdt_cfg_get_table();
+
+					cli_printf_ch( eCLI_CH_APP, "  Stalled task: %s, no report for %u ms", p_wdt_cfg[ WDT_SUP_INFO_TASK( info.info ) ].p_name, WDT_SUP_INFO_STALLED_MS( info.info ));
+				}
+			}
+			else
+			{
+				cli_printf_ch( eCLI_CH_APP, "  %s:%u", ( NULL != info.p_file ) ? info.p_file : "?", info.line );
+				cli_printf_ch( eCLI_CH_APP, "  CFSR: 0x%08X, HFSR: 0x%08X, MMFAR: 0x%08X, BFAR: 0x%08X", info.cfsr, info.hfsr, info.mmfar, info.bfar );
+			}
+		}
+
+		for ( uint32_t i = 0; i < info.evt_num_of; i++ )
+		{
+			cli_printf_ch( eCLI_CH_APP, "  %u ms: evt %u, arg %u", info.evt[i].time_ms, info.evt[i].id, info.evt[i].arg );
+		}
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -402,7 +660,8 @@ static void app_update_adc_pars(void)
 ////////////////////////////////////////////////////////////////////////////////
 void usb_cdc_plugged_cb(void)
 {
-    led_blink_smooth( eLED_3, 0.20f, 0.50f, eLED_BLINK_CONTINUOUS );
+    journal_event( eJOURNAL_EVT_USB_PLUG, 0U );
+    led_seq_blink_smooth( eLED_3, 0.20f, 0.50f, eLED_BLINK_CONTINUOUS );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -414,7 +673,8 @@ void usb_cdc_plugged_cb(void)
 ////////////////////////////////////////////////////////////////////////////////
 void usb_cdc_unplugged_cb(void)
 {
-    led_set_smooth( eLED_3, eLED_OFF );
+    journal_event( eJOURNAL_EVT_USB_UNPLUG, 0U );
+    led_seq_set_smooth( eLED_3, eLED_OFF );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -426,7 +686,7 @@ void usb_cdc_unplugged_cb(void)
 ////////////////////////////////////////////////////////////////////////////////
 void usb_cdc_port_open_cb(void)
 {
-    led_set_smooth( eLED_3, eLED_ON );
+    led_seq_set_smooth( eLED_3, eLED_ON );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -438,7 +698,35 @@ void usb_cdc_port_open_cb(void)
 ////////////////////////////////////////////////////////////////////////////////
 void usb_cdc_port_close_cb(void)
 {
-    led_blink_smooth( eLED_3, 0.20f, 0.50f, eLED_BLINK_CONTINUOUS );
+    led_seq_blink_smooth( eLED_3, 0.20f, 0.50f, eLED_BLINK_CONTINUOUS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       USB event queued callback
+*
+* @note     Called from USBD ISR!
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void usb_cdc_event_isr_cb(void)
+{
+	(void) sched_post( eSCHED_TASK_COMM );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debug UART reception callback
+*
+* @note     Called from UART ISR!
+*
+* @return   void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void uart_dbg_rx_cb(void)
+{
+	(void) sched_post( eSCHED_TASK_COMM );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
 void app_init			(void);
+void app_hndl_comm		(void);
 void app_hndl_10ms		(void);
 void app_hndl_100ms		(void);
 void app_hndl_1000ms		(void);
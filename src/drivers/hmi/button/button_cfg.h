@@ -83,6 +83,33 @@ typedef enum
  */
 #define BUTTON_CFG_FILTER_EN					( 1 )
 
+/**
+ * 	Enable/Disable fixed-point debouncer
+ *
+ * 	@note	When enabled, application uses integer integrator debouncer
+ * 			from "button_deb.h" instead of float LPF of button module.
+ */
+#define BUTTON_CFG_FIXED_DEB_EN					( 1 )
+
+/**
+ * 	Debouncer integrator length
+ *
+ * 	@note	Press/release is detected after that many consecutive
+ * 			samples of new state. 5 samples at 10 ms match LPF with
+ * 			fc = 10 Hz compared at 5%/95% (3 Tao = 47.7 ms).
+ *
+ * 	Unit: sample
+ */
+#define BUTTON_CFG_DEB_SAMPLES					( 5U )
+
+/**
+ * 	Enable/Disable GPIOTE wake of debouncer
+ *
+ * 	@note	When enabled, sampling stops once all buttons are released
+ * 			and settled, and resumes on GPIOTE port event.
+ */
+#define BUTTON_CFG_DEB_WAKE_EN					( 1 )
+
 /**
  * 	Enable/Disable debug mode
  *
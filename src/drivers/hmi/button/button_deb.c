@@ -0,0 +1,479 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_deb.c
+* @brief    Fixed-point button debouncer
+* @author   Ziga Miklosic
+* @date     05.12.2022
+* @version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_DEB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	With GPIOTE wake enabled, handler stops sampling when all buttons
+* 	are released and settled. Any pin change raises GPIOTE port event
+* 	(low power sense), which resumes sampling on next handler call.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+
+#include "button_deb.h"
+#include "drivers/peripheral/gpio/gpio.h"
+
+#include "nrf_atomic.h"
+
+#if ( 1 == BUTTON_CFG_DEB_WAKE_EN )
+	#include "nrf_drv_gpiote.h"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Integrators
+ */
+static uint8_t gu8_button_deb_cnt[eBUTTON_NUM_OF] = {0};
+
+/**
+ * 	Debounced states, bit per button, 1 - pressed
+ */
+static uint32_t gu32_button_deb_state = 0;
+
+/**
+ * 	Button pin masks inside GPIO_BTN_PORT
+ */
+static uint32_t gu32_button_deb_pin_mask[eBUTTON_NUM_OF] = {0};
+
+/**
+ * 	Pins of active low buttons, inverted after port read
+ */
+static uint32_t gu32_button_deb_inv_mask = 0;
+
+/**
+ * 	Callbacks
+ */
+static pf_button_deb_cb_t gpf_button_deb_pressed[eBUTTON_NUM_OF]	= {0};
+static pf_button_deb_cb_t gpf_button_deb_released[eBUTTON_NUM_OF]	= {0};
+
+/**
+ * 	Pin change since last handler call, set from GPIOTE interrupt
+ */
+static nrf_atomic_flag_t gu32_button_deb_wake = 1UL;
+
+/**
+ * 	Sampling active
+ */
+static bool gb_button_deb_active = true;
+
+/**
+ * 	Pointer to configuration table
+ */
+static const button_cfg_t * gp_button_deb_cfg = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_deb_sample(uint32_t * const p_raw);
+static button_status_t button_deb_pins_init(void);
+
+#if ( 1 == BUTTON_CFG_DEB_WAKE_EN )
+	static button_status_t 	button_deb_wake_init	(void);
+	static void 			button_deb_wake_hndl	(nrf_drv_gpiote_pin_t pin, nrf_gpiote_polarity_t action);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sample all buttons
+*
+* @note		If pins can not be read, debounced states are returned as
+* 			raw, thus integrators hold.
+*
+* @param[out]	p_raw	- Raw states, bit per button, 1 - pressed
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_deb_sample(uint32_t * const p_raw)
+{
+	button_status_t status	= eBUTTON_OK;
+	uint32_t		pins	= 0;
+	uint32_t		raw		= 0;
+
+	// All buttons in single port read, pressed pins read as 1
+	if ( eGPIO_OK == gpio_read_mask( GPIO_BTN_PORT, GPIO_BTN_MASK, &pins ))
+	{
+		pins ^= gu32_button_deb_inv_mask;
+
+		for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+		{
+			if ( 0UL != ( pins & gu32_button_deb_pin_mask[num] ))
+			{
+				raw |= ( 1UL << num );
+			}
+		}
+	}
+	else
+	{
+		raw		= gu32_button_deb_state;
+		status	= eBUTTON_ERROR;
+	}
+
+	*p_raw = raw;
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Resolve button pin masks
+*
+* @note		All buttons must be part of GPIO_BTN_MASK.
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_deb_pins_init(void)
+{
+	button_status_t status = eBUTTON_OK;
+
+	gu32_button_deb_inv_mask = 0;
+
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		const uint32_t pin_num 	= gpio_get_pin_num( gp_button_deb_cfg[num].gpio_pin );
+		const uint32_t mask		= ( 1UL << ( pin_num & 0x1FUL ));
+
+		BUTTON_ASSERT(( GPIO_BTN_PORT == ( pin_num >> 5U )) && ( 0UL != ( GPIO_BTN_MASK & mask )));
+
+		if	(	( GPIO_BTN_PORT == ( pin_num >> 5U ))
+			&&	( 0UL != ( GPIO_BTN_MASK & mask )))
+		{
+			gu32_button_deb_pin_mask[num] = mask;
+
+			if ( eBUTTON_POL_ACTIVE_LOW == gp_button_deb_cfg[num].polarity )
+			{
+				gu32_button_deb_inv_mask |= mask;
+			}
+		}
+		else
+		{
+			status = eBUTTON_ERROR;
+		}
+	}
+
+	return status;
+}
+
+#if ( 1 == BUTTON_CFG_DEB_WAKE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Configure GPIOTE port events on button pins
+	*
+	* @note		Low power (sense) events are used, thus no GPIOTE channel
+	* 			is taken and no high frequency clock is needed.
+	*
+	* @return		status	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static button_status_t button_deb_wake_init(void)
+	{
+		button_status_t status = eBUTTON_OK;
+
+		if ( false == nrf_drv_gpiote_is_init())
+		{
+			if ( NRF_SUCCESS != nrf_drv_gpiote_init())
+			{
+				status = eBUTTON_ERROR;
+			}
+		}
+
+		for ( uint32_t num = 0; ( num < eBUTTON_NUM_OF ) && ( eBUTTON_OK == status ); num++ )
+		{
+			const uint32_t 			pin = gpio_get_pin_num( gp_button_deb_cfg[num].gpio_pin );
+			nrf_drv_gpiote_in_config_t	cfg = GPIOTE_CONFIG_IN_SENSE_TOGGLE( false );
+
+			// Keep pull as in GPIO configuration table
+			cfg.pull = gpio_get_pin_pull( gp_button_deb_cfg[num].gpio_pin );
+
+			if ( NRF_SUCCESS == nrf_drv_gpiote_in_init( pin, &cfg, button_deb_wake_hndl ))
+			{
+				nrf_drv_gpiote_in_event_enable( pin, true );
+			}
+			else
+			{
+				status = eBUTTON_ERROR;
+			}
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		GPIOTE event handler
+	*
+	* @param[in]	pin		- Pin that triggered event
+	* @param[in]	action	- Pin transition
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void button_deb_wake_hndl(nrf_drv_gpiote_pin_t pin, nrf_gpiote_polarity_t action)
+	{
+		(void) pin;
+		(void) action;
+
+		(void) nrf_atomic_flag_set( &gu32_button_deb_wake );
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BUTTON_DEB_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of button debouncer API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize button debouncer
+*
+* @note		GPIO must be initialized before.
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_deb_init(void)
+{
+	button_status_t status = eBUTTON_OK;
+
+	gp_button_deb_cfg = (const button_cfg_t*) button_cfg_get_table();
+
+	BUTTON_ASSERT( NULL != gp_button_deb_cfg );
+
+	if ( NULL != gp_button_deb_cfg )
+	{
+		status = button_deb_pins_init();
+
+		#if ( 1 == BUTTON_CFG_DEB_WAKE_EN )
+			if ( eBUTTON_OK == status )
+			{
+				status = button_deb_wake_init();
+			}
+		#endif
+
+		if ( eBUTTON_OK == status )
+		{
+			gb_is_init = true;
+		}
+	}
+	else
+	{
+		status = eBUTTON_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Debouncer handler
+*
+* @note		Call with BUTTON_CFG_HNDL_PERIOD_S period. Callbacks are
+* 			raised from within this function.
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_deb_hndl(void)
+{
+	button_status_t status = eBUTTON_OK;
+
+	BUTTON_ASSERT( true == gb_is_init );
+
+	if ( true == gb_is_init )
+	{
+		// Pin changed - resume sampling
+		if ( 0UL != nrf_atomic_flag_clear_fetch( &gu32_button_deb_wake ))
+		{
+			gb_button_deb_active = true;
+		}
+
+		if ( true == gb_button_deb_active )
+		{
+			uint32_t 		raw 	= 0;
+			const uint32_t	prev	= gu32_button_deb_state;
+
+			if ( eBUTTON_OK != button_deb_sample( &raw ))
+			{
+				status = eBUTTON_ERROR;
+			}
+
+			bool settled = ( 0UL == raw );
+
+			// Saturating integrators
+			for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+			{
+				if ( 0UL != ( raw & ( 1UL << num )))
+				{
+					if ( gu8_button_deb_cnt[num] < BUTTON_CFG_DEB_SAMPLES )
+					{
+						gu8_button_deb_cnt[num]++;
+					}
+
+					if ( BUTTON_CFG_DEB_SAMPLES == gu8_button_deb_cnt[num] )
+					{
+						gu32_button_deb_state |= ( 1UL << num );
+					}
+				}
+				else
+				{
+					if ( gu8_button_deb_cnt[num] > 0U )
+					{
+						gu8_button_deb_cnt[num]--;
+					}
+
+					if ( 0U == gu8_button_deb_cnt[num] )
+					{
+						gu32_button_deb_state &= ~( 1UL << num );
+					}
+				}
+
+				if ( 0U != gu8_button_deb_cnt[num] )
+				{
+					settled = false;
+				}
+			}
+
+			// Raise callbacks of changed buttons
+			const uint32_t changed = gu32_button_deb_state ^ prev;
+
+			for ( uint32_t num = 0; ( num < eBUTTON_NUM_OF ) && ( 0UL != changed ); num++ )
+			{
+				if ( 0UL != ( changed & ( 1UL << num )))
+				{
+					if ( 0UL != ( gu32_button_deb_state & ( 1UL << num )))
+					{
+						if ( NULL != gpf_button_deb_pressed[num] )
+						{
+							gpf_button_deb_pressed[num]();
+						}
+					}
+					else
+					{
+						if ( NULL != gpf_button_deb_released[num] )
+						{
+							gpf_button_deb_released[num]();
+						}
+					}
+				}
+			}
+
+			// All released and settled - wait for pin change
+			#if ( 1 == BUTTON_CFG_DEB_WAKE_EN )
+				if ( true == settled )
+				{
+					gb_button_deb_active = false;
+				}
+			#else
+				(void) settled;
+			#endif
+		}
+	}
+	else
+	{
+		status = eBUTTON_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Register button callbacks
+*
+* @param[in]	num			- Button
+* @param[in]	pf_pressed	- Pressed callback, can be NULL
+* @param[in]	pf_released	- Released callback, can be NULL
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_deb_register_callback(const button_num_t num, pf_button_deb_cb_t pf_pressed, pf_button_deb_cb_t pf_released)
+{
+	button_status_t status = eBUTTON_OK;
+
+	BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+
+	if ( num < eBUTTON_NUM_OF )
+	{
+		gpf_button_deb_pressed[num] 	= pf_pressed;
+		gpf_button_deb_released[num] 	= pf_released;
+	}
+	else
+	{
+		status = eBUTTON_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get debounced button state
+*
+* @param[in]	num			- Button
+* @param[out]	p_pressed	- True if button is pressed
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_deb_get_state(const button_num_t num, bool * const p_pressed)
+{
+	button_status_t status = eBUTTON_OK;
+
+	BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+	BUTTON_ASSERT( NULL != p_pressed );
+
+	if 	(	( num < eBUTTON_NUM_OF )
+		&&	( NULL != p_pressed ))
+	{
+		*p_pressed = ( 0UL != ( gu32_button_deb_state & ( 1UL << num )));
+	}
+	else
+	{
+		status = eBUTTON_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_deb.h
+* @brief    Fixed-point button debouncer
+* @author   Ziga Miklosic
+* @date     05.12.2022
+* @version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_DEB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Fixed-point button debouncer
+*
+* 	Each button has saturating integrator counting from 0 (released)
+* 	to BUTTON_CFG_DEB_SAMPLES (pressed). Debounced states of all buttons
+* 	are packed into single word, thus change detection is single XOR.
+*
+* 	Uses button configuration table from "button_cfg.c".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BUTTON_DEB_H_
+#define __BUTTON_DEB_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button_cfg.h"
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Button event callback
+ */
+typedef void (*pf_button_deb_cb_t)(void);
+
+/**
+ * 	Invalid configuration catcher
+ */
+#if (( BUTTON_CFG_DEB_SAMPLES < 1 ) || ( BUTTON_CFG_DEB_SAMPLES > 255 ))
+	#error "Invalid debouncer length! Adjust <BUTTON_CFG_DEB_SAMPLES> macro inside button_cfg.h file!"
+#endif
+
+#if ( eBUTTON_NUM_OF > 32 )
+	#error "Debouncer supports up to 32 buttons!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_deb_init					(void);
+button_status_t button_deb_hndl					(void);
+button_status_t button_deb_register_callback	(const button_num_t num, pf_button_deb_cb_t pf_pressed, pf_button_deb_cb_t pf_released);
+button_status_t button_deb_get_state			(const button_num_t num, bool * const p_pressed);
+
+#endif // __BUTTON_DEB_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,6 @@
+# Fixed-point button debouncer compared with float filter model
+BUTTON_DIR := $(ROOT)/src/drivers/hmi/button
+
+TESTS += button_deb
+
+button_deb_SRC	:= $(BUTTON_DIR)/test/test_button_deb.c $(BUTTON_DIR)/button_deb.c $(BUTTON_DIR)/button_cfg.c
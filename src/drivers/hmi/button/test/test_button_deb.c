@@ -0,0 +1,640 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_button_deb.c
+*@brief     Fixed-point button debouncer host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup BUTTON_DEB_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Debouncer runs on simulated button port next to model of button core
+* 	float filter: RC 1st order IIR per button with "lpf_fc" from button
+* 	configuration table, output compared between 5% and 95%. Filter is
+* 	discretized exactly, thus its step response is 1 - e^(-t/Tao) as
+* 	described in "button_cfg.c".
+*
+* 	Both get the same samples and must report the same edges. Clean
+* 	edges and short glitches must match sample by sample. Edges with
+* 	random bounce shorter than detection time must settle the same and
+* 	match within BUTTON_CFG_DEB_SAMPLES / 2 samples.
+*
+* 	GPIOTE stand-in records input configuration and raises pin events
+* 	on port change, so that wake mode can be checked.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <math.h>
+
+#include "test.h"
+#include "drivers/hmi/button/button_deb.h"
+#include "drivers/peripheral/gpio/gpio.h"
+#include "nrf_drv_gpiote.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Float filter comparison thresholds
+ */
+#define TEST_BTN_LPF_HIGH				( 0.95f )
+#define TEST_BTN_LPF_LOW				( 0.05f )
+
+/**
+ * 	Number of random bouncy strokes
+ */
+#define TEST_BTN_STROKES				( 2000U )
+
+/**
+ * 	Handler calls per benchmark
+ */
+#define TEST_BTN_BENCH_TICKS			( 2000000UL )
+
+/**
+ * 	Float filter model of single button
+ */
+typedef struct
+{
+	float	y;			/**<Filter output */
+	float	alpha;		/**<Filter coefficient */
+	bool	pressed;	/**<Compared output */
+} test_btn_lpf_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated button port input register
+ */
+static uint32_t gu32_test_port = 0;
+
+/**
+ * 	Number of port reads
+ */
+static uint32_t gu32_test_reads = 0;
+
+/**
+ * 	Port read fails
+ */
+static bool gb_test_gpio_err = false;
+
+/**
+ * 	Pull mode of GPIO table stand-in
+ */
+static const nrf_gpio_pin_pull_t g_test_pull[eBUTTON_NUM_OF] =
+{
+	NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_NOPULL
+};
+
+/**
+ * 	Recorded GPIOTE input configuration
+ */
+static nrf_drv_gpiote_in_config_t 	g_test_gpiote_cfg[64]		= {0};
+static bool							gb_test_gpiote_en[64]		= {0};
+static nrf_drv_gpiote_evt_handler_t	gpf_test_gpiote_hndl		= NULL;
+static uint32_t						gu32_test_gpiote_evt		= 0;
+
+/**
+ * 	Float filter models
+ */
+static test_btn_lpf_t g_test_lpf[eBUTTON_NUM_OF] = {0};
+
+/**
+ * 	Number of callbacks of first button
+ */
+static uint32_t gu32_test_pressed_cb	= 0;
+static uint32_t gu32_test_released_cb	= 0;
+
+/**
+ * 	Random generator state
+ */
+static uint32_t gu32_test_rand = 12345;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		GPIO stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_read_mask(const gpio_port_t port, const uint32_t mask, uint32_t * const p_value)
+{
+	gu32_test_reads++;
+
+	*p_value = (( GPIO_BTN_PORT == port ) ? ( gu32_test_port & mask ) : 0UL );
+
+	return (( true == gb_test_gpio_err ) ? eGPIO_ERROR : eGPIO_OK );
+}
+
+uint32_t gpio_get_pin_num(const gpio_pins_t pin)
+{
+	uint32_t pin_num = 0;
+
+	switch( pin )
+	{
+		case eGPIO_BTN_1:	pin_num = NRF_GPIO_PIN_MAP( BTN_1__PORT, BTN_1__PIN );	break;
+		case eGPIO_BTN_2:	pin_num = NRF_GPIO_PIN_MAP( BTN_2__PORT, BTN_2__PIN );	break;
+		case eGPIO_BTN_3:	pin_num = NRF_GPIO_PIN_MAP( BTN_3__PORT, BTN_3__PIN );	break;
+		case eGPIO_BTN_4:	pin_num = NRF_GPIO_PIN_MAP( BTN_4__PORT, BTN_4__PIN );	break;
+		default:			TEST_ASSERT( false );									break;
+	}
+
+	return pin_num;
+}
+
+nrf_gpio_pin_pull_t gpio_get_pin_pull(const gpio_pins_t pin)
+{
+	TEST_ASSERT(( pin >= eGPIO_BTN_1 ) && ( pin <= eGPIO_BTN_4 ));
+
+	return g_test_pull[ pin - eGPIO_BTN_1 ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		GPIOTE stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nrf_drv_gpiote_is_init(void)
+{
+	return false;
+}
+
+ret_code_t nrf_drv_gpiote_init(void)
+{
+	return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_gpiote_in_init(nrf_drv_gpiote_pin_t pin, nrf_drv_gpiote_in_config_t const * p_config, nrf_drv_gpiote_evt_handler_t evt_handler)
+{
+	TEST_ASSERT( pin < 64U );
+
+	g_test_gpiote_cfg[pin] 	= *p_config;
+	gpf_test_gpiote_hndl	= evt_handler;
+
+	return NRF_SUCCESS;
+}
+
+void nrf_drv_gpiote_in_event_enable(nrf_drv_gpiote_pin_t pin, bool int_enable)
+{
+	gb_test_gpiote_en[pin] = int_enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Button callbacks
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_btn_pressed(void)
+{
+	gu32_test_pressed_cb++;
+}
+
+static void test_btn_released(void)
+{
+	gu32_test_released_cb++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Pseudo random number
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_rand(void)
+{
+	gu32_test_rand = ( gu32_test_rand * 1103515245UL ) + 12345UL;
+
+	return ( gu32_test_rand >> 16U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Drive button pins
+*
+* @note	Active low, pressed button pulls pin low. Changed pins raise
+* 		GPIOTE toggle event, as sense mechanism would.
+*
+* @param[in]	pressed	- Bit per button, 1 - pressed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_btn_set(const uint32_t pressed)
+{
+	uint32_t port = 0;
+
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		const uint32_t pin = gpio_get_pin_num( eGPIO_BTN_1 + num );
+
+		if ( 0UL == ( pressed & ( 1UL << num )))
+		{
+			port |= ( 1UL << ( pin & 0x1FUL ));
+		}
+	}
+
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		const uint32_t pin 	= gpio_get_pin_num( eGPIO_BTN_1 + num );
+		const uint32_t mask	= ( 1UL << ( pin & 0x1FUL ));
+
+		if 	(	( 0UL != (( port ^ gu32_test_port ) & mask ))
+			&&	( true == gb_test_gpiote_en[pin] ))
+		{
+			gu32_test_gpiote_evt++;
+			gpf_test_gpiote_hndl( pin, NRF_GPIOTE_POLARITY_TOGGLE );
+		}
+	}
+
+	gu32_test_port = port;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Step float filter models
+*
+* @param[in]	pressed	- Bit per button, 1 - pressed
+* @return		states	- Compared filter outputs, bit per button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_lpf_step(const uint32_t pressed)
+{
+	uint32_t states = 0;
+
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		test_btn_lpf_t * const p_lpf = &g_test_lpf[num];
+		const float x = ( 0UL != ( pressed & ( 1UL << num ))) ? 1.0f : 0.0f;
+
+		p_lpf->y += ( p_lpf->alpha * ( x - p_lpf->y ));
+
+		if (( false == p_lpf->pressed ) && ( p_lpf->y >= TEST_BTN_LPF_HIGH ))
+		{
+			p_lpf->pressed = true;
+		}
+		else if (( true == p_lpf->pressed ) && ( p_lpf->y <= TEST_BTN_LPF_LOW ))
+		{
+			p_lpf->pressed = false;
+		}
+		else
+		{
+			// No change
+		}
+
+		if ( true == p_lpf->pressed )
+		{
+			states |= ( 1UL << num );
+		}
+	}
+
+	return states;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get debounced states
+*
+* @return		states	- Bit per button, 1 - pressed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_deb_states(void)
+{
+	uint32_t states = 0;
+
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		bool pressed = false;
+
+		TEST_ASSERT_EQ( button_deb_get_state( num, &pressed ), eBUTTON_OK );
+
+		if ( true == pressed )
+		{
+			states |= ( 1UL << num );
+		}
+	}
+
+	return states;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Single handler period of both debouncers
+*
+* @param[in]	pressed	- Bit per button, 1 - pressed
+* @param[out]	p_lpf	- Float filter states
+* @return		states	- Debouncer states
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_tick(const uint32_t pressed, uint32_t * const p_lpf)
+{
+	test_btn_set( pressed );
+
+	TEST_ASSERT_EQ( button_deb_hndl(), eBUTTON_OK );
+	*p_lpf = test_lpf_step( pressed );
+
+	return test_deb_states();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run both debouncers for number of periods
+*
+* @return		mismatch - Number of periods with different states
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_run(const uint32_t pressed, const uint32_t ticks)
+{
+	uint32_t mismatch = 0;
+
+	for ( uint32_t t = 0; t < ticks; t++ )
+	{
+		uint32_t lpf = 0;
+
+		if ( test_tick( pressed, &lpf ) != lpf )
+		{
+			mismatch++;
+		}
+	}
+
+	return mismatch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization and GPIOTE configuration
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init_btn(void)
+{
+	const button_cfg_t * const p_cfg = (const button_cfg_t*) button_cfg_get_table();
+
+	// Float filter models from configuration table
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		const float tao = 1.0f / ( 2.0f * (float) M_PI * p_cfg[num].lpf_fc );
+
+		g_test_lpf[num].alpha = 1.0f - expf( -BUTTON_CFG_HNDL_PERIOD_S / tao );
+	}
+
+	test_btn_set( 0 );
+
+	TEST_ASSERT_EQ( button_deb_init(), eBUTTON_OK );
+	TEST_ASSERT_EQ( button_deb_register_callback( eBUTTON_1, test_btn_pressed, test_btn_released ), eBUTTON_OK );
+
+	// Pull as in GPIO table
+	for ( uint32_t num = 0; num < eBUTTON_NUM_OF; num++ )
+	{
+		const uint32_t pin = gpio_get_pin_num( eGPIO_BTN_1 + num );
+
+		TEST_ASSERT_EQ( g_test_gpiote_cfg[pin].pull, g_test_pull[num] );
+		TEST_ASSERT_EQ( g_test_gpiote_cfg[pin].sense, NRF_GPIOTE_POLARITY_TOGGLE );
+		TEST_ASSERT( true == gb_test_gpiote_en[pin] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clean edges and short glitches
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_clean(void)
+{
+	const uint32_t cb_pressed 	= gu32_test_pressed_cb;
+	const uint32_t cb_released 	= gu32_test_released_cb;
+
+	// Each button alone, then all together
+	for ( uint32_t num = 0; num <= eBUTTON_NUM_OF; num++ )
+	{
+		const uint32_t mask = ( num < eBUTTON_NUM_OF ) ? ( 1UL << num ) : (( 1UL << eBUTTON_NUM_OF ) - 1UL );
+
+		TEST_ASSERT_EQ( test_run( mask, 40 ), 0 );
+		TEST_ASSERT_EQ( test_deb_states(), mask );
+		TEST_ASSERT_EQ( test_run( 0, 40 ), 0 );
+		TEST_ASSERT_EQ( test_deb_states(), 0 );
+	}
+
+	TEST_ASSERT_EQ( gu32_test_pressed_cb - cb_pressed, 2 );
+	TEST_ASSERT_EQ( gu32_test_released_cb - cb_released, 2 );
+
+	// Glitches shorter than detection time are ignored by both
+	for ( uint32_t len = 1; len < BUTTON_CFG_DEB_SAMPLES; len++ )
+	{
+		TEST_ASSERT_EQ( test_run( 0x1, len ), 0 );
+		TEST_ASSERT_EQ( test_run( 0, 40 ), 0 );
+		TEST_ASSERT_EQ( test_deb_states(), 0 );
+
+		TEST_ASSERT_EQ( test_run( 0x1, 40 ), 0 );
+		TEST_ASSERT_EQ( test_run( 0, len ), 0 );
+		TEST_ASSERT_EQ( test_run( 0x1, 40 ), 0 );
+		TEST_ASSERT_EQ( test_deb_states(), 0x1 );
+		TEST_ASSERT_EQ( test_run( 0, 40 ), 0 );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Random bouncy strokes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bouncy(void)
+{
+	uint32_t 	pressed		= 0;
+	uint32_t	deb_edges	= 0;
+	uint32_t	lpf_edges	= 0;
+	int32_t		max_diff	= 0;
+	int64_t		sum_diff	= 0;
+
+	for ( uint32_t s = 0; s < TEST_BTN_STROKES; s++ )
+	{
+		const uint32_t 	bounce	= test_rand() % BUTTON_CFG_DEB_SAMPLES;
+		const uint32_t	hold	= 20U + ( test_rand() % 40U );
+		uint32_t		deb_t	= 0;
+		uint32_t		lpf_t	= 0;
+		uint32_t		deb		= 0;
+		uint32_t		lpf		= 0;
+
+		pressed ^= 0x1;
+
+		for ( uint32_t t = 1; t <= ( bounce + hold ); t++ )
+		{
+			const uint32_t	in 		= ( t <= bounce ) ? ( test_rand() & 0x1 ) : pressed;
+			const uint32_t	deb_p	= deb;
+			const uint32_t	lpf_p	= lpf;
+
+			deb = test_tick( in, &lpf );
+
+			// Last edge of stroke
+			if ( deb != deb_p )
+			{
+				deb_edges++;
+				deb_t = t;
+			}
+
+			if ( lpf != lpf_p )
+			{
+				lpf_edges++;
+				lpf_t = t;
+			}
+		}
+
+		// Both settle to the same state
+		TEST_ASSERT_EQ( deb, pressed );
+		TEST_ASSERT_EQ( lpf, pressed );
+
+		if (( 0U != deb_t ) && ( 0U != lpf_t ))
+		{
+			const int32_t diff = (int32_t) deb_t - (int32_t) lpf_t;
+
+			sum_diff += diff;
+
+			if ( abs( diff ) > max_diff )
+			{
+				max_diff = abs( diff );
+			}
+		}
+	}
+
+	TEST_ASSERT( max_diff <= (int32_t)( BUTTON_CFG_DEB_SAMPLES / 2U ));
+	TEST_ASSERT( deb_edges >= TEST_BTN_STROKES );
+	TEST_ASSERT( lpf_edges >= TEST_BTN_STROKES );
+
+	TEST_BENCH( "bouncy edges: %u debouncer, %u float filter, max latency diff %d, mean %+.2f samples",
+			(unsigned) deb_edges, (unsigned) lpf_edges, (int) max_diff, (double) sum_diff / TEST_BTN_STROKES );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sampling stops while idle, GPIOTE event resumes it
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_wake(void)
+{
+	uint32_t reads 	= 0;
+	uint32_t evt	= 0;
+
+	TEST_ASSERT_EQ( test_run( 0, 40 ), 0 );
+
+	reads = gu32_test_reads;
+	TEST_ASSERT_EQ( test_run( 0, 100 ), 0 );
+
+	#if ( 1 == BUTTON_CFG_DEB_WAKE_EN )
+		TEST_ASSERT_EQ( gu32_test_reads, reads );
+	#else
+		TEST_ASSERT_EQ( gu32_test_reads, reads + 100U );
+	#endif
+
+	evt = gu32_test_gpiote_evt;
+	TEST_ASSERT_EQ( test_run( 0x2, 40 ), 0 );
+	TEST_ASSERT_EQ( test_deb_states(), 0x2 );
+	TEST_ASSERT_EQ( gu32_test_gpiote_evt, evt + 1U );
+	TEST_ASSERT( gu32_test_reads > reads );
+	TEST_ASSERT_EQ( test_run( 0, 40 ), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Failed port read holds debounced states
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_gpio_err(void)
+{
+	const uint32_t cb_released = gu32_test_released_cb;
+
+	TEST_ASSERT_EQ( test_run( 0x1, 40 ), 0 );
+	TEST_ASSERT_EQ( test_deb_states(), 0x1 );
+
+	// Released while port can not be read
+	gb_test_gpio_err = true;
+	test_btn_set( 0 );
+
+	for ( uint32_t t = 0; t < 40; t++ )
+	{
+		TEST_ASSERT_EQ( button_deb_hndl(), eBUTTON_ERROR );
+	}
+
+	TEST_ASSERT_EQ( test_deb_states(), 0x1 );
+	TEST_ASSERT_EQ( gu32_test_released_cb, cb_released );
+
+	// Release detected once port is readable again
+	gb_test_gpio_err = false;
+
+	for ( uint32_t t = 0; t < 40; t++ )
+	{
+		TEST_ASSERT_EQ( button_deb_hndl(), eBUTTON_OK );
+	}
+
+	TEST_ASSERT_EQ( test_deb_states(), 0 );
+	TEST_ASSERT_EQ( gu32_test_released_cb, cb_released + 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cost of single handler period, all buttons sampled
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	uint64_t start 	= 0;
+	uint64_t deb	= 0;
+	uint64_t lpf	= 0;
+
+	// Keep sampling active
+	test_btn_set( 0x1 );
+
+	start = test_now_cycles();
+
+	for ( uint32_t t = 0; t < TEST_BTN_BENCH_TICKS; t++ )
+	{
+		(void) button_deb_hndl();
+	}
+
+	deb 	= test_now_cycles() - start;
+	start 	= test_now_cycles();
+
+	for ( uint32_t t = 0; t < TEST_BTN_BENCH_TICKS; t++ )
+	{
+		(void) test_lpf_step( t & 0x1 );
+	}
+
+	lpf = test_now_cycles() - start;
+
+	TEST_BENCH( "debouncer %6.2f cycles, float filter %6.2f cycles per period",
+			(double) deb / TEST_BTN_BENCH_TICKS, (double) lpf / TEST_BTN_BENCH_TICKS );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_init_btn();
+	test_clean();
+	test_bouncy();
+	test_wake();
+	test_gpio_err();
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
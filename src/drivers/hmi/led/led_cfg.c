@@ -80,6 +80,33 @@ const void * led_cfg_get_table(void)
 	return (led_cfg_t*) &g_led_cfg;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set LED timer PWM duty
+*
+* @note		LED core timer PWM hook, see LED_CFG_SET_PWM. Duty is
+*			gamma corrected by "timer_set_pwm_fix()".
+*
+*			Channel played by PWM sequence (see "led_seq.c") is left
+*			untouched, sequence owns it until finished or stopped.
+*
+* @param[in] 	ch 		- Timer channel
+* @param[in] 	duty 	- Duty cycle in range 0-LED_CFG_PWM_DUTY_MAX
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+timer_status_t led_cfg_set_pwm(const timer_ch_t ch, const uint16_t duty)
+{
+	timer_status_t status = eTIMER_OK;
+
+	if ( false == timer_pwm_seq_is_active( ch ))
+	{
+		status = timer_set_pwm_fix( ch, duty );
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /*!
  * @} <!-- END GROUP -->
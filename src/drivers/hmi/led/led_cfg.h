@@ -36,6 +36,9 @@
 
 #include "project_config.h"
 
+// LED timer driver
+#include "drivers/peripheral/timer/timer.h"
+
 // Debug communication port
 #include "middleware/cli/cli/src/cli.h"
 
@@ -89,6 +92,28 @@ typedef enum
  */
 #define LED_CFG_GPIO_USE_EN						( 0 )
 
+/**
+ * 	Enable/Disable hardware PWM sequence fades
+ *
+ * 	@note	Smooth calls of "led_seq.h" are played by PWM peripheral
+ * 			whenever timing and timer allow it, otherwise by LED core.
+ */
+#define LED_CFG_SEQ_EN							( 1 )
+
+/**
+ * 	Full scale of LED timer PWM duty
+ */
+#define LED_CFG_PWM_DUTY_MAX					( TIMER_PWM_FIX_MAX )
+
+/**
+ * 	LED core timer PWM hook
+ *
+ * 	@note	LED core sets duty of timer PWM LEDs through this hook only.
+ * 			Duty is fixed-point in range 0-LED_CFG_PWM_DUTY_MAX and goes
+ * 			straight to timer gamma table, no float math.
+ */
+#define LED_CFG_SET_PWM( ch, duty )				led_cfg_set_pwm( ch, duty )
+
 /**
  * 	Enable/Disable debug mode
  *
@@ -139,10 +164,15 @@ typedef enum
 	#error "Select either GPIO or TIMER PWM LED driver!"
 #endif
 
+#if (( 1 == LED_CFG_SEQ_EN ) && ( 0 == LED_CFG_TIMER_USE_EN ))
+	#error "LED sequences need TIMER PWM LED driver!"
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
-const void * led_cfg_get_table(void);
+const void * 	led_cfg_get_table	(void);
+timer_status_t 	led_cfg_set_pwm		(const timer_ch_t ch, const uint16_t duty);
 
 #endif // __LED_CFG_H_
 
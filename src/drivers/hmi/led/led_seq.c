@@ -0,0 +1,483 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     led_seq.c
+* @brief    LED fades by PWM sequences
+* @author   Ziga Miklosic
+* @date     14.12.2022
+* @version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup LED_SEQ
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Blink is played as two ramps: rise over fade in time followed by
+* 	hold until on time, fall over fade out time followed by hold until
+* 	period. Continuous blink loops, single blink and smooth set are
+* 	played once and LED stays at last step.
+*
+* 	Ramp has up to TIMER_PWM_RAMP_MAX_STEPS steps of whole PWM periods,
+* 	remainder of fade time is added to following hold, thus total period
+* 	is exact.
+*
+* 	After ramp is started LED core is set to final state, so it drops
+* 	its own fade. Its timer writes are ignored while sequence plays
+* 	("led_cfg_set_pwm()").
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+
+#include "led_seq.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Pointer to configuration table
+ */
+static const led_cfg_t * gp_led_seq_cfg = NULL;
+
+/**
+ * 	Fade configurations, valid only when set
+ */
+static led_fade_cfg_t 	g_led_seq_fade[eLED_NUM_OF]		= {{0}};
+static bool				gb_led_seq_fade_set[eLED_NUM_OF]	= {0};
+
+/**
+ * 	Brightness left by last call
+ */
+static uint16_t gu16_led_seq_level[eLED_NUM_OF] = {0};
+
+/**
+ * 	Ramp brightness, converted by timer on start
+ */
+static uint16_t gu16_led_seq_ramp[2][TIMER_PWM_RAMP_MAX_STEPS] = {{0}};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t 	led_seq_periods		(const float32_t time);
+static uint16_t 	led_seq_max			(const led_num_t num);
+static void 		led_seq_ramp		(timer_pwm_ramp_t * const p_ramp, uint16_t * const p_buf, const uint16_t from, const uint16_t to, const uint32_t periods, const uint32_t hold);
+static bool 		led_seq_is_avail	(const led_num_t num);
+static void 		led_seq_release		(const led_num_t num);
+static bool 		led_seq_blink_start	(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+static bool 		led_seq_set_start	(const led_num_t num, const led_state_t state);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert time to number of PWM periods
+*
+* @param[in]	time	- Time, negative as zero - Unit: sec
+* @return		periods	- Number of PWM periods, rounded
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t led_seq_periods(const float32_t time)
+{
+	uint32_t periods = 0;
+
+	if ( time > 0.0f )
+	{
+		periods = (uint32_t)(( time * (float32_t) timer_get_pwm_freq()) + 0.5f );
+	}
+
+	return periods;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get LED on brightness
+*
+* @param[in]	num		- LED number
+* @return		max		- Brightness of max duty, full scale if not set
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t led_seq_max(const led_num_t num)
+{
+	uint16_t max = TIMER_PWM_FIX_MAX;
+
+	if ( true == gb_led_seq_fade_set[num] )
+	{
+		max = (uint16_t)(( g_led_seq_fade[num].max_duty * (float32_t) TIMER_PWM_FIX_MAX ) + 0.5f );
+	}
+
+	return max;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Build brightness ramp
+*
+* @note		Ramp lasts at least one PWM period. Steps are spread evenly
+*			over ramp, last one reaches target brightness.
+*
+* @param[out]	p_ramp	- Ramp
+* @param[out]	p_buf	- Step brightness buffer
+* @param[in]	from	- Start brightness
+* @param[in]	to		- Target brightness
+* @param[in]	periods	- Ramp duration - Unit: PWM period
+* @param[in]	hold	- Target hold after ramp - Unit: PWM period
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_seq_ramp(timer_pwm_ramp_t * const p_ramp, uint16_t * const p_buf, const uint16_t from, const uint16_t to, const uint32_t periods, const uint32_t hold)
+{
+	const uint32_t 	dur		= ( periods > 0UL ) ? periods : 1UL;
+	const uint32_t	num_of	= ( dur < TIMER_PWM_RAMP_MAX_STEPS ) ? dur : TIMER_PWM_RAMP_MAX_STEPS;
+	const int32_t	delta	= (int32_t) to - (int32_t) from;
+
+	for ( uint32_t i = 0; i < num_of; i++ )
+	{
+		p_buf[i] = (uint16_t)((int32_t) from + (( delta * (int32_t)( i + 1UL )) / (int32_t) num_of ));
+	}
+
+	p_ramp->p_brightness	= p_buf;
+	p_ramp->num_of			= (uint16_t) num_of;
+	p_ramp->step			= ( dur / num_of );
+	p_ramp->end_delay		= hold + ( dur - ( p_ramp->step * num_of ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if LED can be played by PWM sequence
+*
+* @note		Timer outputs are active low, as are compare values of
+*			timer gamma table. PWM sequence must be free or already
+*			playing this LED.
+*
+* @param[in]	num			- LED number
+* @return		is_avail	- True if LED can be played by PWM sequence
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_seq_is_avail(const led_num_t num)
+{
+	bool is_avail = false;
+
+	#if ( 1 == LED_CFG_SEQ_EN )
+
+		if 	(	( eLED_DRV_TIMER_PWM == gp_led_seq_cfg[num].drv_type )
+			&&	( eLED_POL_ACTIVE_LOW == gp_led_seq_cfg[num].polarity )
+			&&	( true == gb_led_seq_fade_set[num] ))
+		{
+			is_avail = true;
+
+			for ( uint32_t ch = 0; ch < eTIMER_CH_NUM_OF; ch++ )
+			{
+				if 	(	( ch != (uint32_t) gp_led_seq_cfg[num].drv_ch.tim_ch )
+					&&	( true == timer_pwm_seq_is_active((timer_ch_t) ch )))
+				{
+					is_avail = false;
+				}
+			}
+		}
+
+	#endif
+
+	return is_avail;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Take LED back from PWM sequence
+*
+* @note		Must be called before LED core takes LED over, otherwise its
+*			timer writes are ignored.
+*
+* @param[in]	num	- LED number
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_seq_release(const led_num_t num)
+{
+	if 	(	( eLED_DRV_TIMER_PWM == gp_led_seq_cfg[num].drv_type )
+		&&	( true == timer_pwm_seq_is_active( gp_led_seq_cfg[num].drv_ch.tim_ch )))
+	{
+		(void) timer_pwm_seq_stop();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start smooth blink by PWM sequence
+*
+* @note		Only continuous and single blink are supported. Fade in
+*			must fit into on time and fade out into off time.
+*
+* @param[in]	num			- LED number
+* @param[in]	on_time		- LED on time - Unit: sec
+* @param[in]	period		- Blink period - Unit: sec
+* @param[in]	blink		- Blink mode
+* @return		is_started	- True if blink is played by PWM sequence
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_seq_blink_start(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+{
+	bool is_started = false;
+
+	if 	(	( true == led_seq_is_avail( num ))
+		&&	(( eLED_BLINK_CONTINUOUS == blink ) || ( eLED_BLINK_1X == blink )))
+	{
+		const uint16_t		max			= led_seq_max( num );
+		const uint32_t		in_p		= led_seq_periods( g_led_seq_fade[num].fade_in_time );
+		const uint32_t		out_p		= led_seq_periods( g_led_seq_fade[num].fade_out_time );
+		const uint32_t		on_p		= led_seq_periods( on_time );
+		const uint32_t		period_p	= led_seq_periods( period );
+
+		// Ramps last at least one period
+		const uint32_t		rise_p		= ( in_p > 0UL ) ? in_p : 1UL;
+		const uint32_t		fall_p		= ( out_p > 0UL ) ? out_p : 1UL;
+		timer_pwm_ramp_t	rise		= {0};
+		timer_pwm_ramp_t	fall		= {0};
+
+		if 	(	( rise_p <= on_p )
+			&&	(( on_p + fall_p ) <= period_p ))
+		{
+			led_seq_ramp( &rise, gu16_led_seq_ramp[0], 0U, max, rise_p, ( on_p - rise_p ));
+			led_seq_ramp( &fall, gu16_led_seq_ramp[1], max, 0U, fall_p, ( period_p - on_p - fall_p ));
+
+			if ( eTIMER_OK == timer_pwm_seq_start( gp_led_seq_cfg[num].drv_ch.tim_ch, &rise, &fall, ( eLED_BLINK_CONTINUOUS == blink )))
+			{
+				is_started = true;
+			}
+		}
+	}
+
+	return is_started;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start smooth set by PWM sequence
+*
+* @note		Ramp starts at brightness left by last call.
+*
+* @param[in]	num			- LED number
+* @param[in]	state		- Target state
+* @return		is_started	- True if ramp is played by PWM sequence
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_seq_set_start(const led_num_t num, const led_state_t state)
+{
+	bool is_started = false;
+
+	if ( true == led_seq_is_avail( num ))
+	{
+		timer_pwm_ramp_t ramp = {0};
+
+		if ( eLED_ON == state )
+		{
+			led_seq_ramp( &ramp, gu16_led_seq_ramp[0], gu16_led_seq_level[num], led_seq_max( num ), led_seq_periods( g_led_seq_fade[num].fade_in_time ), 0UL );
+		}
+		else
+		{
+			led_seq_ramp( &ramp, gu16_led_seq_ramp[0], gu16_led_seq_level[num], 0U, led_seq_periods( g_led_seq_fade[num].fade_out_time ), 0UL );
+		}
+
+		if ( eTIMER_OK == timer_pwm_seq_start( gp_led_seq_cfg[num].drv_ch.tim_ch, &ramp, NULL, false ))
+		{
+			is_started = true;
+		}
+	}
+
+	return is_started;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup LED_SEQ_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of LED sequence API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize LED sequences
+*
+* @note		LED core and timer must be initialized before.
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_seq_init(void)
+{
+	led_status_t status = eLED_OK;
+
+	gp_led_seq_cfg = (const led_cfg_t*) led_cfg_get_table();
+
+	LED_ASSERT( NULL != gp_led_seq_cfg );
+
+	if ( NULL != gp_led_seq_cfg )
+	{
+		for ( uint32_t num = 0; num < eLED_NUM_OF; num++ )
+		{
+			gb_led_seq_fade_set[num]	= false;
+			gu16_led_seq_level[num]		= ( eLED_ON == gp_led_seq_cfg[num].initial_state ) ? TIMER_PWM_FIX_MAX : 0U;
+		}
+
+		gb_is_init = true;
+	}
+	else
+	{
+		status = eLED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set LED fade configuration
+*
+* @note		Configuration is passed to LED core as well. LED without
+*			configuration set here is always played by LED core.
+*
+* @param[in]	num			- LED number
+* @param[in]	p_fade_cfg	- Fade configuration
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_seq_set_fade_cfg(const led_num_t num, const led_fade_cfg_t * const p_fade_cfg)
+{
+	led_status_t status = eLED_OK;
+
+	LED_ASSERT( true == gb_is_init );
+	LED_ASSERT( num < eLED_NUM_OF );
+	LED_ASSERT( NULL != p_fade_cfg );
+
+	if 	(	( true == gb_is_init )
+		&&	( num < eLED_NUM_OF )
+		&&	( NULL != p_fade_cfg ))
+	{
+		status = led_set_fade_cfg( num, p_fade_cfg );
+
+		if ( eLED_OK == status )
+		{
+			g_led_seq_fade[num] 		= *p_fade_cfg;
+			gb_led_seq_fade_set[num]	= (( p_fade_cfg->max_duty >= 0.0f ) && ( p_fade_cfg->max_duty <= 1.0f ));
+		}
+	}
+	else
+	{
+		status = eLED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Blink LED smoothly
+*
+* @note		Played by PWM sequence when possible, otherwise by
+*			"led_blink_smooth()" of LED core.
+*
+* @param[in]	num			- LED number
+* @param[in]	on_time		- LED on time, including fade in - Unit: sec
+* @param[in]	period		- Blink period - Unit: sec
+* @param[in]	blink		- Blink mode
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_seq_blink_smooth(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+{
+	led_status_t status = eLED_OK;
+
+	LED_ASSERT( true == gb_is_init );
+	LED_ASSERT( num < eLED_NUM_OF );
+
+	if 	(	( true == gb_is_init )
+		&&	( num < eLED_NUM_OF ))
+	{
+		// Blink ends with LED off
+		gu16_led_seq_level[num] = 0U;
+
+		if ( true == led_seq_blink_start( num, on_time, period, blink ))
+		{
+			(void) led_set( num, eLED_OFF );
+		}
+		else
+		{
+			led_seq_release( num );
+			status = led_blink_smooth( num, on_time, period, blink );
+		}
+	}
+	else
+	{
+		status = eLED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set LED smoothly
+*
+* @note		Played by PWM sequence when possible, otherwise by
+*			"led_set_smooth()" of LED core.
+*
+* @param[in]	num			- LED number
+* @param[in]	state		- Target state
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_seq_set_smooth(const led_num_t num, const led_state_t state)
+{
+	led_status_t status = eLED_OK;
+
+	LED_ASSERT( true == gb_is_init );
+	LED_ASSERT( num < eLED_NUM_OF );
+
+	if 	(	( true == gb_is_init )
+		&&	( num < eLED_NUM_OF ))
+	{
+		if ( true == led_seq_set_start( num, state ))
+		{
+			(void) led_set( num, state );
+		}
+		else
+		{
+			led_seq_release( num );
+			status = led_set_smooth( num, state );
+		}
+
+		gu16_led_seq_level[num] = ( eLED_ON == state ) ? led_seq_max( num ) : 0U;
+	}
+	else
+	{
+		status = eLED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
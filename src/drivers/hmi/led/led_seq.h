@@ -0,0 +1,55 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     led_seq.h
+* @brief    LED fades by PWM sequences
+* @author   Ziga Miklosic
+* @date     14.12.2022
+* @version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup LED_SEQ
+* @{ <!-- BEGIN GROUP -->
+*
+* 	LED fades by PWM sequences
+*
+* 	Smooth blink and smooth set of timer PWM LEDs are converted to
+* 	brightness ramps and played by PWM peripheral (EasyDMA), thus LED
+* 	handler has nothing to do while fading. PWM peripheral plays single
+* 	channel at a time, calls that cannot be played by it are passed to
+* 	LED core.
+*
+* 	Same arguments and timing as LED core smooth functions.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __LED_SEQ_H_
+#define __LED_SEQ_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "led_cfg.h"
+#include "led/src/led.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_seq_init			(void);
+led_status_t led_seq_set_fade_cfg	(const led_num_t num, const led_fade_cfg_t * const p_fade_cfg);
+led_status_t led_seq_blink_smooth	(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+led_status_t led_seq_set_smooth		(const led_num_t num, const led_state_t state);
+
+#endif // __LED_SEQ_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
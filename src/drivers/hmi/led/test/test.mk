@@ -0,0 +1,8 @@
+# LED fades by PWM sequences compared with fade configuration timing
+LED_DIR		:= $(ROOT)/src/drivers/hmi/led
+LED_TIMER_DIR	:= $(ROOT)/src/drivers/peripheral/timer
+
+TESTS += led_seq
+
+led_seq_SRC	:= $(LED_DIR)/test/test_led_seq.c $(LED_DIR)/led_seq.c $(LED_DIR)/led_cfg.c $(LED_TIMER_DIR)/timer.c $(LED_TIMER_DIR)/test/nrf_drv_pwm_mock.c
+led_seq_CFLAGS	:= -I$(LED_TIMER_DIR)/test
@@ -0,0 +1,542 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_led_seq.c
+*@brief     LED PWM sequence fades host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup LED_SEQ_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	LED sequences run on top of timer and legacy PWM driver mock, played
+* 	sequences are rendered period by period and compared with fade model
+* 	of "led_fade_cfg_t": linear brightness rise over fade in time, on
+* 	until on time, linear fall over fade out time, off until period.
+*
+* 	Period, on and off parts must be exact. Ramps may lead model by one
+* 	step plus remainder of fade time, never lag it.
+*
+* 	LED core stand-in records calls, so that fallback to software fades
+* 	can be checked.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "test.h"
+#include "nrf_drv_pwm_mock.h"
+#include "drivers/hmi/led/led_seq.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Fade times
+ *
+ * 	Unit: sec
+ */
+#define TEST_LED_FADE_IN				( 0.1f )
+#define TEST_LED_FADE_OUT				( 0.15f )
+
+/**
+ * 	Max duty
+ */
+#define TEST_LED_MAX_DUTY				( 0.8f )
+
+/**
+ * 	Spare channel, used to read back gamma of brightness
+ */
+#define TEST_LED_SPARE_CH				( eTIMER_PWM0_CH4 )
+
+/**
+ * 	Render buffer size
+ *
+ * 	Unit: PWM period
+ */
+#define TEST_LED_RENDER_SIZE			( 32000UL )
+
+/**
+ * 	LED core calls
+ */
+typedef enum
+{
+	eTEST_LED_CALL_NONE = 0,
+	eTEST_LED_CALL_SET,
+	eTEST_LED_CALL_SET_SMOOTH,
+	eTEST_LED_CALL_BLINK_SMOOTH,
+	eTEST_LED_CALL_FADE_CFG,
+} test_led_call_t;
+
+/**
+ * 	Last LED core call
+ */
+typedef struct
+{
+	test_led_call_t	call;
+	led_num_t		num;
+	led_state_t		state;
+	float32_t		on_time;
+	float32_t		period;
+	led_blink_t		blink;
+	uint32_t		count;
+} test_led_core_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Last LED core call
+ */
+static test_led_core_t g_test_core = {0};
+
+/**
+ * 	Rendered compare values
+ */
+static uint16_t gu16_test_render[TEST_LED_RENDER_SIZE] = {0};
+
+/**
+ * 	PWM period and frequency
+ */
+static uint32_t gu32_test_top	= 0;
+static uint32_t gu32_test_freq	= 0;
+
+/**
+ * 	Fade configuration
+ */
+static const led_fade_cfg_t g_test_fade =
+{
+	.fade_in_time	= TEST_LED_FADE_IN,
+	.fade_out_time	= TEST_LED_FADE_OUT,
+	.max_duty		= TEST_LED_MAX_DUTY,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		LED core stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_set(const led_num_t num, const led_state_t state)
+{
+	g_test_core.call	= eTEST_LED_CALL_SET;
+	g_test_core.num		= num;
+	g_test_core.state	= state;
+	g_test_core.count++;
+
+	// Core drives timer right away
+	(void) LED_CFG_SET_PWM( ((const led_cfg_t*) led_cfg_get_table())[num].drv_ch.tim_ch, ( eLED_ON == state ) ? LED_CFG_PWM_DUTY_MAX : 0U );
+
+	return eLED_OK;
+}
+
+led_status_t led_set_smooth(const led_num_t num, const led_state_t state)
+{
+	g_test_core.call	= eTEST_LED_CALL_SET_SMOOTH;
+	g_test_core.num		= num;
+	g_test_core.state	= state;
+	g_test_core.count++;
+
+	return eLED_OK;
+}
+
+led_status_t led_blink_smooth(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+{
+	g_test_core.call	= eTEST_LED_CALL_BLINK_SMOOTH;
+	g_test_core.num		= num;
+	g_test_core.on_time	= on_time;
+	g_test_core.period	= period;
+	g_test_core.blink	= blink;
+	g_test_core.count++;
+
+	return eLED_OK;
+}
+
+led_status_t led_set_fade_cfg(const led_num_t num, const led_fade_cfg_t * const p_fade_cfg)
+{
+	g_test_core.call	= eTEST_LED_CALL_FADE_CFG;
+	g_test_core.num		= num;
+	g_test_core.count++;
+
+	return eLED_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert time to PWM periods, as sequence engine does
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_periods(const float32_t time)
+{
+	return (uint32_t)(( time * (float32_t) gu32_test_freq ) + 0.5f );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get LED on time of brightness
+*
+* @note		Gamma is read back through spare channel.
+*
+* @return		on time - Unit: count
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_gamma(const uint32_t brightness)
+{
+	TEST_ASSERT_EQ( timer_set_pwm_fix( TEST_LED_SPARE_CH, (uint16_t) brightness ), eTIMER_OK );
+
+	return ( gu32_test_top - nrf_drv_pwm_mock_get_compare( TEST_LED_SPARE_CH ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Model brightness of fade
+*
+* @param[in]	from	- Start brightness
+* @param[in]	to		- Target brightness
+* @param[in]	t		- Time since fade start - Unit: PWM period
+* @param[in]	dur		- Fade duration - Unit: PWM period
+* @return		brightness
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_model(const uint32_t from, const uint32_t to, const uint32_t t, const uint32_t dur)
+{
+	uint32_t b = to;
+
+	if ( t < dur )
+	{
+		b = (uint32_t)((int32_t) from + ((( (int32_t) to - (int32_t) from ) * (int32_t) t ) / (int32_t) dur ));
+	}
+
+	return b;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check rendered ramp against model
+*
+* @note		Ramp must be monotonic and between model at same time and
+*			model one step plus remainder later.
+*
+* @param[in]	p_on	- Rendered LED on time per period, ramp start
+* @param[in]	from	- Start brightness
+* @param[in]	to		- Target brightness
+* @param[in]	dur		- Fade duration - Unit: PWM period
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_ramp(const uint32_t * const p_on, const uint32_t from, const uint32_t to, const uint32_t dur)
+{
+	const uint32_t num_of	= ( dur < TIMER_PWM_RAMP_MAX_STEPS ) ? dur : TIMER_PWM_RAMP_MAX_STEPS;
+	const uint32_t lead		= ( dur / num_of ) + ( dur % num_of );
+
+	for ( uint32_t t = 0; t < dur; t++ )
+	{
+		const uint32_t now	= test_gamma( test_model( from, to, t, dur ));
+		const uint32_t next	= test_gamma( test_model( from, to, t + lead, dur ));
+
+		if ( to >= from )
+		{
+			TEST_ASSERT(( now <= p_on[t] ) && ( p_on[t] <= next ));
+			TEST_ASSERT(( 0 == t ) || ( p_on[t] >= p_on[t-1] ));
+		}
+		else
+		{
+			TEST_ASSERT(( next <= p_on[t] ) && ( p_on[t] <= now ));
+			TEST_ASSERT(( 0 == t ) || ( p_on[t] <= p_on[t-1] ));
+		}
+	}
+
+	TEST_ASSERT_EQ( p_on[dur-1], test_gamma( to ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Render channel to LED on time per period
+*
+* @return		num_of	- Number of rendered periods
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_render(const timer_ch_t ch, uint32_t * const p_on, const uint32_t size)
+{
+	const uint32_t num_of = nrf_drv_pwm_mock_render( ch, gu16_test_render, size );
+
+	for ( uint32_t i = 0; i < num_of; i++ )
+	{
+		p_on[i] = gu32_test_top - gu16_test_render[i];
+	}
+
+	return num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init_led(void)
+{
+	TEST_ASSERT_EQ( timer_init(), eTIMER_OK );
+	TEST_ASSERT_EQ( led_seq_init(), eLED_OK );
+
+	gu32_test_top	= nrf_drv_pwm_mock_get_cfg()->top_value;
+	gu32_test_freq	= timer_get_pwm_freq();
+
+	// LED 4 stays without fade configuration
+	for ( uint32_t num = eLED_1; num <= eLED_3; num++ )
+	{
+		TEST_ASSERT_EQ( led_seq_set_fade_cfg((led_num_t) num, &g_test_fade ), eLED_OK );
+		TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_FADE_CFG );
+		TEST_ASSERT_EQ( g_test_core.num, num );
+	}
+
+	TEST_ASSERT_EQ( led_seq_set_fade_cfg( eLED_NUM_OF, &g_test_fade ), eLED_ERROR );
+	TEST_ASSERT_EQ( test_assert_hits(), 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Continuous smooth blink
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_heartbeat(void)
+{
+	static uint32_t	on[TEST_LED_RENDER_SIZE];
+	const timer_ch_t ch			= eTIMER_PWM0_CH1;
+	const uint32_t	max			= (uint32_t)(( TEST_LED_MAX_DUTY * TIMER_PWM_FIX_MAX ) + 0.5f );
+	const uint32_t	in_p		= test_periods( TEST_LED_FADE_IN );
+	const uint32_t	out_p		= test_periods( TEST_LED_FADE_OUT );
+	const uint32_t	on_p		= test_periods( 1.0f );
+	const uint32_t	period_p	= test_periods( 2.0f );
+	uint32_t		num_of		= 0;
+
+	g_test_core.count = 0;
+
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_1, 1.0f, 2.0f, eLED_BLINK_CONTINUOUS ), eLED_OK );
+
+	// Core only dropped its own blink
+	TEST_ASSERT_EQ( g_test_core.count, 1 );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_SET );
+	TEST_ASSERT_EQ( g_test_core.state, eLED_OFF );
+	TEST_ASSERT( true == timer_pwm_seq_is_active( ch ));
+	TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_flags(), NRFX_PWM_FLAG_LOOP | NRFX_PWM_FLAG_NO_EVT_FINISHED );
+
+	num_of = test_render( ch, on, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT_EQ( num_of, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT( num_of >= ( 2UL * period_p ));
+
+	// Exact period
+	for ( uint32_t t = 0; ( t + period_p ) < num_of; t++ )
+	{
+		TEST_ASSERT_EQ( on[t], on[ t + period_p ] );
+	}
+
+	// On and off parts exact, ramps within one step
+	test_ramp( &on[0], 0, max, in_p );
+
+	for ( uint32_t t = in_p; t < on_p; t++ )
+	{
+		TEST_ASSERT_EQ( on[t], test_gamma( max ));
+	}
+
+	test_ramp( &on[on_p], max, 0, out_p );
+
+	for ( uint32_t t = ( on_p + out_p ); t < period_p; t++ )
+	{
+		TEST_ASSERT_EQ( on[t], 0 );
+	}
+
+	// Loop end raises no event
+	TEST_ASSERT( false == nrf_drv_pwm_mock_finish());
+	TEST_ASSERT( true == timer_pwm_seq_is_active( ch ));
+
+	TEST_BENCH( "heartbeat: %u periods, %u+%u ramp steps, no CPU per step",
+			(unsigned) period_p, (unsigned) TIMER_PWM_RAMP_MAX_STEPS, (unsigned) TIMER_PWM_RAMP_MAX_STEPS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Other channels and LED core writes during sequence
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_other_ch(void)
+{
+	static uint32_t	on[TEST_LED_RENDER_SIZE];
+	static uint32_t	ref[TEST_LED_RENDER_SIZE];
+	uint32_t		num_of	= 0;
+	uint32_t		exp		= 0;
+
+	(void) test_render( eTIMER_PWM0_CH1, ref, TEST_LED_RENDER_SIZE );
+
+	// Other channel is patched into sequence
+	TEST_ASSERT_EQ( LED_CFG_SET_PWM( eTIMER_PWM0_CH2, LED_CFG_PWM_DUTY_MAX / 2U ), eTIMER_OK );
+	exp = test_gamma( LED_CFG_PWM_DUTY_MAX / 2U );
+
+	num_of = test_render( eTIMER_PWM0_CH2, on, TEST_LED_RENDER_SIZE );
+
+	for ( uint32_t t = 0; t < num_of; t++ )
+	{
+		TEST_ASSERT_EQ( on[t], exp );
+	}
+
+	// LED core write to sequenced channel is ignored
+	TEST_ASSERT_EQ( LED_CFG_SET_PWM( eTIMER_PWM0_CH1, LED_CFG_PWM_DUTY_MAX ), eTIMER_OK );
+	TEST_ASSERT( true == timer_pwm_seq_is_active( eTIMER_PWM0_CH1 ));
+
+	num_of = test_render( eTIMER_PWM0_CH1, on, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT_EQ( memcmp( on, ref, num_of * sizeof( on[0] )), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fallback to LED core
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fallback(void)
+{
+	// Sequence busy with other LED
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_3, 0.2f, 0.5f, eLED_BLINK_1X ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_BLINK_SMOOTH );
+	TEST_ASSERT_EQ( g_test_core.num, eLED_3 );
+	TEST_ASSERT_EQ( g_test_core.blink, eLED_BLINK_1X );
+	TEST_ASSERT( true == timer_pwm_seq_is_active( eTIMER_PWM0_CH1 ));
+
+	TEST_ASSERT_EQ( led_seq_set_smooth( eLED_2, eLED_ON ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_SET_SMOOTH );
+	TEST_ASSERT_EQ( g_test_core.num, eLED_2 );
+
+	// No fade configuration
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_4, 0.1f, 0.2f, eLED_BLINK_1X ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_BLINK_SMOOTH );
+	TEST_ASSERT_EQ( g_test_core.num, eLED_4 );
+
+	// Fade in longer than on time, sequence handed back to core
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_1, 0.05f, 1.0f, eLED_BLINK_CONTINUOUS ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_BLINK_SMOOTH );
+	TEST_ASSERT_EQ( g_test_core.num, eLED_1 );
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH1 ));
+
+	// Fade out longer than off time
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_1, 0.5f, 0.6f, eLED_BLINK_CONTINUOUS ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_BLINK_SMOOTH );
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH1 ));
+
+	// Unsupported blink mode
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_1, 1.0f, 2.0f, eLED_BLINK_3X ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_BLINK_SMOOTH );
+	TEST_ASSERT_EQ( g_test_core.blink, eLED_BLINK_3X );
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH1 ));
+
+	// Core writes pass again
+	TEST_ASSERT_EQ( LED_CFG_SET_PWM( eTIMER_PWM0_CH1, LED_CFG_PWM_DUTY_MAX ), eTIMER_OK );
+	TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_compare( eTIMER_PWM0_CH1 ), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Smooth set and single blink
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_once(void)
+{
+	static uint32_t	on[TEST_LED_RENDER_SIZE];
+	const uint32_t	max			= (uint32_t)(( TEST_LED_MAX_DUTY * TIMER_PWM_FIX_MAX ) + 0.5f );
+	const uint32_t	in_p		= test_periods( TEST_LED_FADE_IN );
+	const uint32_t	out_p		= test_periods( TEST_LED_FADE_OUT );
+	uint32_t		num_of		= 0;
+
+	// Off to on
+	TEST_ASSERT_EQ( led_seq_set_smooth( eLED_3, eLED_ON ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_SET );
+	TEST_ASSERT_EQ( g_test_core.state, eLED_ON );
+	TEST_ASSERT( true == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+	TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_flags() & NRFX_PWM_FLAG_LOOP, 0 );
+
+	num_of = test_render( eTIMER_PWM0_CH3, on, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT_EQ( num_of, in_p );
+	test_ramp( on, 0, max, in_p );
+
+	// LED stays at last step
+	TEST_ASSERT( true == nrf_drv_pwm_mock_finish());
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+	TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_flags(), NRFX_PWM_FLAG_LOOP | NRFX_PWM_FLAG_NO_EVT_FINISHED );
+	TEST_ASSERT_EQ( gu32_test_top - nrf_drv_pwm_mock_get_compare( eTIMER_PWM0_CH3 ), test_gamma( max ));
+
+	// On to off
+	TEST_ASSERT_EQ( led_seq_set_smooth( eLED_3, eLED_OFF ), eLED_OK );
+	num_of = test_render( eTIMER_PWM0_CH3, on, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT_EQ( num_of, out_p );
+	test_ramp( on, max, 0, out_p );
+	TEST_ASSERT( true == nrf_drv_pwm_mock_finish());
+	TEST_ASSERT_EQ( gu32_test_top - nrf_drv_pwm_mock_get_compare( eTIMER_PWM0_CH3 ), 0 );
+
+	// Restart while finished ramp interrupt is held off
+	TEST_ASSERT_EQ( led_seq_set_smooth( eLED_3, eLED_ON ), eLED_OK );
+	nrf_drv_pwm_mock_loops_done();
+	TEST_ASSERT_EQ( led_seq_set_smooth( eLED_3, eLED_OFF ), eLED_OK );
+	TEST_ASSERT_EQ( gu32_stub_critical_nest, 0 );
+	TEST_ASSERT( false == nrf_drv_pwm_mock_irq());
+	TEST_ASSERT( true == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+	num_of = test_render( eTIMER_PWM0_CH3, on, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT_EQ( num_of, out_p );
+	test_ramp( on, max, 0, out_p );
+	TEST_ASSERT( true == nrf_drv_pwm_mock_finish());
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+
+	// Single blink lasts one period
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_3, 0.2f, 0.5f, eLED_BLINK_1X ), eLED_OK );
+	TEST_ASSERT_EQ( g_test_core.call, eTEST_LED_CALL_SET );
+	num_of = test_render( eTIMER_PWM0_CH3, on, TEST_LED_RENDER_SIZE );
+	TEST_ASSERT_EQ( num_of, test_periods( 0.5f ));
+	test_ramp( &on[0], 0, max, in_p );
+	test_ramp( &on[test_periods( 0.2f )], max, 0, out_p );
+	TEST_ASSERT_EQ( on[num_of-1], 0 );
+	TEST_ASSERT( true == nrf_drv_pwm_mock_finish());
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+
+	// Direct timer write takes channel back
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_3, 0.2f, 0.5f, eLED_BLINK_CONTINUOUS ), eLED_OK );
+	TEST_ASSERT( true == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+	TEST_ASSERT_EQ( timer_set_pwm_fix( eTIMER_PWM0_CH3, TIMER_PWM_FIX_MAX ), eTIMER_OK );
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+	TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_compare( eTIMER_PWM0_CH3 ), 0 );
+
+	// Stop
+	TEST_ASSERT_EQ( led_seq_blink_smooth( eLED_3, 0.2f, 0.5f, eLED_BLINK_CONTINUOUS ), eLED_OK );
+	TEST_ASSERT_EQ( timer_pwm_seq_stop(), eTIMER_OK );
+	TEST_ASSERT( false == timer_pwm_seq_is_active( eTIMER_PWM0_CH3 ));
+	TEST_ASSERT_EQ( gu32_test_top - nrf_drv_pwm_mock_get_compare( eTIMER_PWM0_CH3 ), 0 );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_init_led();
+	test_heartbeat();
+	test_other_ch();
+	test_fallback();
+	test_once();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 1 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
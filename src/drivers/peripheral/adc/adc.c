@@ -26,10 +26,13 @@
 #include "nrf_drv_saadc.h"
 #include "nrf_drv_timer.h"
 #include "nrf_drv_ppi.h"
+#include "app_util_platform.h"
 
 #include "adc.h"
 #include "pin_mapper.h"
+#include "drivers/peripheral/systick/systick.h"
 #include "project_config.h"
+#include "middleware/trace/trace.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -61,8 +64,48 @@
   *  Max: 2000 Hz
   *  Min: 1 Hz
   */
-#define ADC_SAMPLE_RATE_HZ              ( 100 )
+#define ADC_SAMPLE_RATE_HZ              ( 1000 )
 
+/**
+ *      Number of scans (samples of all channels) per stream block
+ *
+ * @note    SAADC alternates between two blocks of this size, thus
+ *          block completion rate is ADC_SAMPLE_RATE_HZ / ADC_STREAM_SCANS.
+ *
+ *  Unit: scan
+ */
+#define ADC_STREAM_SCANS                ( 10 )
+
+/**
+ *      Size of single stream block
+ *
+ *  Unit: sample
+ */
+#define ADC_STREAM_BLOCK_SIZE           ( ADC_STREAM_SCANS * eADC_NUM_OF )
+
+
+/**
+ *      ADC supply voltage
+ *
+ * @note    Used for conversion when channel reference is VDD/4.
+ *
+ *  Unit: V
+ */
+#define ADC_VDD_V                       ( 3.0f )
+
+/**
+ *      ADC internal reference voltage
+ *
+ *  Unit: V
+ */
+#define ADC_REF_INTERNAL_V              ( 0.6f )
+
+/**
+ *      ADC offset calibration timeout
+ *
+ *  Unit: ms
+ */
+#define ADC_CALIBRATION_TIMEOUT_MS      ( 10UL )
 
 /**
  *		ADC asserts
@@ -82,6 +125,10 @@
     #error "Invalid sample rate settings! Change <ADC_SAMPLE_RATE_HZ> configuration!!!"
  #endif
 
+ #if (( ADC_STREAM_SCANS < 1 ) || ( ADC_STREAM_BLOCK_SIZE > 0x7FFF ))
+    #error "Invalid stream block settings! Change <ADC_STREAM_SCANS> configuration!!!"
+ #endif
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
@@ -119,8 +166,56 @@ static const nrf_saadc_channel_config_t g_adc_channel[eADC_NUM_OF] =
 
 /**
  *      ADC Raw Samples buffer
+ *
+ * @note    Holds latest scan of completed stream block.
+ */
+static volatile int16_t gi16_adc_raw[eADC_NUM_OF] = {0};
+
+/**
+ *      ADC stream blocks
+ *
+ * @note    Double buffered - while SAADC EasyDMA fills one block the other
+ *          one is handed to consumer.
+ */
+static int16_t gi16_adc_block[2][ADC_STREAM_BLOCK_SIZE] = {0};
+
+/**
+ *      ADC stream statistics
+ */
+static volatile adc_stream_stats_t g_adc_stream_stats = {0};
+
+/**
+ *      Per channel software calibration
+ *
+ * @note    Applied on top of SAADC offset calibration: real = gain * raw_volt + offset
+ */
+static adc_cal_t g_adc_cal[eADC_NUM_OF] =
+{
+    // USER CODE BEGIN...
+
+    [eADC_AIN_1] = { .offset = 0.0f, .gain = 1.0f },
+    [eADC_AIN_2] = { .offset = 0.0f, .gain = 1.0f },
+    [eADC_AIN_4] = { .offset = 0.0f, .gain = 1.0f },
+    [eADC_AIN_5] = { .offset = 0.0f, .gain = 1.0f },
+    [eADC_AIN_6] = { .offset = 0.0f, .gain = 1.0f },
+    [eADC_AIN_7] = { .offset = 0.0f, .gain = 1.0f },
+
+    // USER CODE END...
+};
+
+/**
+ *      Raw to real conversion coefficients
+ *
+ * @note    Kept as separate flat arrays (structure of arrays) so that
+ *          conversion loop is a plain multiply-add over contiguous memory.
+ */
+static float32_t gf32_adc_k[eADC_NUM_OF] = {0};
+static float32_t gf32_adc_n[eADC_NUM_OF] = {0};
+
+/**
+ *      SAADC offset calibration done flag
  */
-static int16_t gi16_adc_raw[eADC_NUM_OF] = {0};
+static volatile bool gb_adc_cal_done = false;
 
 /**
  *      ADC Timer handler
@@ -137,6 +232,10 @@ static nrf_ppi_channel_t g_adc_ppi_channel = 0;
 ////////////////////////////////////////////////////////////////////////////////
 static adc_status_t adc_init_channels   (void);
 static adc_status_t adc_init_timer      (void);
+static void         adc_block_done      (int16_t * const p_block);
+static adc_status_t adc_calibrate       (void);
+static float32_t    adc_calc_lsb        (const nrf_saadc_channel_config_t * const p_cfg);
+static void         adc_calc_coeff      (const adc_pins_t pin);
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +266,114 @@ static adc_status_t adc_init_channels(void)
     return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run SAADC offset calibration
+*
+* @note     Must be called while SAADC is idle, thus before conversion starts.
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static adc_status_t adc_calibrate(void)
+{
+    adc_status_t status = eADC_OK;
+
+    gb_adc_cal_done = false;
+
+    if ( NRF_SUCCESS == nrf_drv_saadc_calibrate_offset())
+    {
+        const uint32_t start_ms = systick_get_ms();
+
+        // Wait for NRFX_SAADC_EVT_CALIBRATEDONE
+        while ( false == gb_adc_cal_done )
+        {
+            if ((uint32_t)( systick_get_ms() - start_ms ) >= ADC_CALIBRATION_TIMEOUT_MS )
+            {
+                status = eADC_ERROR;
+                break;
+            }
+        }
+    }
+    else
+    {
+        status = eADC_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate voltage of single LSB for channel configuration
+*
+* @param[in]    p_cfg   - Pointer to channel configuration
+* @return 		lsb     - Voltage of single LSB in V
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t adc_calc_lsb(const nrf_saadc_channel_config_t * const p_cfg)
+{
+    float32_t ref    = 0.0f;
+    float32_t gain   = 1.0f;
+    uint32_t  bits   = 0U;
+
+    // Reference
+    if ( NRF_SAADC_REFERENCE_VDD4 == p_cfg->reference )
+    {
+        ref = ( ADC_VDD_V / 4.0f );
+    }
+    else
+    {
+        ref = ADC_REF_INTERNAL_V;
+    }
+
+    // Input gain
+    switch ( p_cfg->gain )
+    {
+        case NRF_SAADC_GAIN1_6: gain = ( 1.0f / 6.0f ); break;
+        case NRF_SAADC_GAIN1_5: gain = ( 1.0f / 5.0f ); break;
+        case NRF_SAADC_GAIN1_4: gain = ( 1.0f / 4.0f ); break;
+        case NRF_SAADC_GAIN1_3: gain = ( 1.0f / 3.0f ); break;
+        case NRF_SAADC_GAIN1_2: gain = ( 1.0f / 2.0f ); break;
+        case NRF_SAADC_GAIN2:   gain = 2.0f;            break;
+        case NRF_SAADC_GAIN4:   gain = 4.0f;            break;
+        case NRF_SAADC_GAIN1:
+        default:                gain = 1.0f;            break;
+    }
+
+    // Resolution: 8, 10, 12 or 14 bits
+    switch ( ADC_RESOLUTION )
+    {
+        case NRF_SAADC_RESOLUTION_8BIT:     bits = 8U;  break;
+        case NRF_SAADC_RESOLUTION_10BIT:    bits = 10U; break;
+        case NRF_SAADC_RESOLUTION_12BIT:    bits = 12U; break;
+        case NRF_SAADC_RESOLUTION_14BIT:
+        default:                            bits = 14U; break;
+    }
+
+    // Differential mode uses one bit for sign
+    if ( NRF_SAADC_MODE_DIFFERENTIAL == p_cfg->mode )
+    {
+        bits--;
+    }
+
+    return (( ref / gain ) / (float32_t)( 1UL << bits ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate raw to real conversion coefficients for channel
+*
+* @param[in]    pin - ADC pin
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void adc_calc_coeff(const adc_pins_t pin)
+{
+    gf32_adc_k[pin] = g_adc_cal[pin].gain * adc_calc_lsb( &g_adc_channel[pin] );
+    gf32_adc_n[pin] = g_adc_cal[pin].offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		ADC timer event handler
@@ -238,6 +445,45 @@ static adc_status_t adc_init_timer(void)
     return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Handle completed ADC stream block
+*
+* @note     Called from SAADC ISR! Block is returned to SAADC as next
+*           secondary buffer after consumer is done with it.
+*
+* @param[in]    p_block - Pointer to completed block
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void adc_block_done(int16_t * const p_block)
+{
+    // No block left in SAADC, conversion stopped before this block was
+    // handled and scans taken until re-arm are lost
+    if ( false == nrf_drv_saadc_is_busy())
+    {
+        g_adc_stream_stats.overruns++;
+    }
+
+    // Latest scan is at the end of block
+    for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+    {
+        gi16_adc_raw[ ch ] = p_block[ ADC_STREAM_BLOCK_SIZE - eADC_NUM_OF + ch ];
+    }
+
+    g_adc_stream_stats.blocks++;
+
+    // Hand over to consumer
+    adc_stream_cb( p_block, ADC_STREAM_SCANS );
+
+    // Re-arm block as secondary buffer
+    if ( NRF_SUCCESS != nrf_drv_saadc_buffer_convert( p_block, ADC_STREAM_BLOCK_SIZE ))
+    {
+        // Block was refused, stream continues single buffered
+        g_adc_stream_stats.overruns++;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		ADC event handler
@@ -249,20 +495,15 @@ static adc_status_t adc_init_timer(void)
 ////////////////////////////////////////////////////////////////////////////////
 void adc_event_hndl(nrf_drv_saadc_evt_t const *p_event) 
 {
+    TP_ENTER( ADC_ISR );
+
     // Check event
     switch ( p_event->type )
     {
         // Event generated when the buffer is filled with samples
         case NRF_DRV_SAADC_EVT_DONE:
 
-           // Get raw samples
-            if ( NRF_SUCCESS == nrf_drv_saadc_buffer_convert( p_event->data.done.p_buffer, eADC_NUM_OF ))
-            {
-                for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
-                {
-                    gi16_adc_raw[ ch ] = p_event->data.done.p_buffer[ ch ];
-                }
-            }
+            adc_block_done( p_event->data.done.p_buffer );
 
             break;
 
@@ -276,7 +517,7 @@ void adc_event_hndl(nrf_drv_saadc_evt_t const *p_event)
         // Event generated when the calibration is complete
         case NRFX_SAADC_EVT_CALIBRATEDONE:
 
-            // TBD ...
+            gb_adc_cal_done = true;
 
             break;
 
@@ -284,6 +525,8 @@ void adc_event_hndl(nrf_drv_saadc_evt_t const *p_event)
             // No actions...
             break;
     }
+
+    TP_EXIT( ADC_ISR );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -320,7 +563,11 @@ adc_status_t adc_init(void)
             .resolution         = ADC_RESOLUTION,
             .oversample         = NRF_SAADC_OVERSAMPLE_DISABLED,
             .interrupt_priority = ADC_IRQ_PRIORITY,
-            .low_power_mode     = true
+
+            // NOTE: Low power mode restarts SAADC on every scan and would
+            // interrupt per scan. Keep it disabled so that EasyDMA fills
+            // complete stream block.
+            .low_power_mode     = false
         };
 
         // Init SAR ADC
@@ -330,12 +577,24 @@ adc_status_t adc_init(void)
         }
 
         // Init ADC channels
-        status = adc_init_channels();
+        status |= adc_init_channels();
+
+        // Prepare conversion coefficients
+        for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+        {
+            adc_calc_coeff( ch );
+        }
+
+        // Compensate SAADC offset
+        status |= adc_calibrate();
 
-        // Start conversion
-        if ( NRF_SUCCESS != nrf_drv_saadc_buffer_convert((int16_t*) &gi16_adc_raw, eADC_NUM_OF ))
+        // Start conversion on both stream blocks
+        for ( uint32_t i = 0; i < 2; i++ )
         {
-            PROJECT_CONFIG_ASSERT( 0 );
+            if ( NRF_SUCCESS != nrf_drv_saadc_buffer_convert((int16_t*) &gi16_adc_block[i], ADC_STREAM_BLOCK_SIZE ))
+            {
+                PROJECT_CONFIG_ASSERT( 0 );
+            }
         }
 
         // Init ADC triggering timer
@@ -412,12 +671,147 @@ float32_t adc_get_real(const adc_pins_t pin)
     if  (   ( true == gb_is_init )
         &&  ( pin < eADC_NUM_OF ))
     {   
-           // TODO: ...
+        real = ( gf32_adc_k[pin] * (float32_t) gi16_adc_raw[pin] ) + gf32_adc_n[pin];
     }
 
     return real;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get real ADC values of all channels
+*
+* @note     All channels are taken from the same scan. Conversion is a single
+*           multiply-add pass over flat arrays, which maps to FPU VMLA (or
+*           arm_mult_f32() + arm_add_f32() from CMSIS-DSP).
+*
+* @param[out] 	p_real	- Pointer to eADC_NUM_OF real values in V
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+adc_status_t adc_get_real_all(float32_t * const p_real)
+{
+    adc_status_t    status = eADC_OK;
+    int16_t         raw[eADC_NUM_OF];
+
+    ADC_ASSERT( true == gb_is_init );
+    ADC_ASSERT( NULL != p_real );
+
+    if  (   ( true == gb_is_init )
+        &&  ( NULL != p_real ))
+    {
+        // Take consistent snapshot of latest scan
+        CRITICAL_REGION_ENTER();
+        for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+        {
+            raw[ch] = gi16_adc_raw[ch];
+        }
+        CRITICAL_REGION_EXIT();
+
+        for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+        {
+            p_real[ch] = ( gf32_adc_k[ch] * (float32_t) raw[ch] ) + gf32_adc_n[ch];
+        }
+    }
+    else
+    {
+        status = eADC_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set software calibration of ADC channel
+*
+* @note     Calibrated value: real = gain * raw_volt + offset
+*
+* @param[in] 	pin		- ADC pin
+* @param[in] 	p_cal	- Pointer to calibration
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+adc_status_t adc_set_cal(const adc_pins_t pin, const adc_cal_t * const p_cal)
+{
+    adc_status_t status = eADC_OK;
+
+    ADC_ASSERT( pin < eADC_NUM_OF );
+    ADC_ASSERT( NULL != p_cal );
+
+    if  (   ( pin < eADC_NUM_OF )
+        &&  ( NULL != p_cal ))
+    {
+        CRITICAL_REGION_ENTER();
+        g_adc_cal[pin] = *p_cal;
+        adc_calc_coeff( pin );
+        CRITICAL_REGION_EXIT();
+    }
+    else
+    {
+        status = eADC_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get ADC stream statistics
+*
+* @note     Block counter increments for each completed block, any gap in
+*           stream is reported as overrun.
+*
+* @param[out] 	p_stats	- Pointer to statistics
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+adc_status_t adc_get_stream_stats(adc_stream_stats_t * const p_stats)
+{
+    adc_status_t status = eADC_OK;
+
+    ADC_ASSERT( true == gb_is_init );
+    ADC_ASSERT( NULL != p_stats );
+
+    if  (   ( true == gb_is_init )
+        &&  ( NULL != p_stats ))
+    {
+        // Blocks and overruns are written from ISR
+        CRITICAL_REGION_ENTER();
+        p_stats->blocks   = g_adc_stream_stats.blocks;
+        p_stats->overruns = g_adc_stream_stats.overruns;
+        CRITICAL_REGION_EXIT();
+    }
+    else
+    {
+        status = eADC_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       ADC stream block callback
+*
+* @note     Called from SAADC ISR context on each completed block. Samples are
+*           interleaved by channel: p_block[ scan * eADC_NUM_OF + ch ]. Block
+*           is valid only for the duration of the callback!
+*
+* @note     User shall define its own implementation!
+*
+* @param[in] 	p_block	- Pointer to block of samples
+* @param[in] 	scans	- Number of scans in block
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((weak)) void adc_stream_cb(const int16_t * const p_block, const uint32_t scans)
+{
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
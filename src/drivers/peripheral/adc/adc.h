@@ -62,12 +62,34 @@ typedef enum
 	eADC_NUM_OF
 } adc_pins_t;
 
+/**
+ *  ADC stream statistics
+ */
+typedef struct
+{
+    uint32_t    blocks;     /**<Number of completed stream blocks */
+    uint32_t    overruns;   /**<Number of stream stalls, scans may be lost */
+} adc_stream_stats_t;
+
+/**
+ *  ADC channel software calibration
+ */
+typedef struct
+{
+    float32_t   offset;     /**<Offset added after gain. Unit: V */
+    float32_t   gain;       /**<Gain correction factor. Unit: / */
+} adc_cal_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 adc_status_t 	adc_init		(void);
 uint16_t		adc_get_raw		(const adc_pins_t pin);
 float32_t		adc_get_real	(const adc_pins_t pin);
+adc_status_t    adc_get_real_all(float32_t * const p_real);
+adc_status_t    adc_set_cal     (const adc_pins_t pin, const adc_cal_t * const p_cal);
+adc_status_t    adc_get_stream_stats(adc_stream_stats_t * const p_stats);
+void            adc_stream_cb   (const int16_t * const p_block, const uint32_t scans);
 
 #endif // __ADC_H
 
@@ -0,0 +1,264 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_saadc_mock.c
+*@brief     Legacy SAADC driver mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NRF_DRV_SAADC_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	First "nrf_drv_saadc_buffer_convert()" sets active block, second one
+* 	secondary block, third one is refused as busy. Full active block is
+* 	replaced by secondary one without losing a scan. With no block
+* 	armed driver is idle and scans are lost.
+*
+* 	Offset calibration completes at once.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "nrf_drv_saadc_mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Max number of pending done events
+ */
+#define NRF_DRV_SAADC_MOCK_PENDING			( 4U )
+
+/**
+ * 	Pending done event
+ */
+typedef struct
+{
+	int16_t *	p_block;
+	uint16_t	size;
+	uint32_t	delay;
+} nrf_drv_saadc_mock_pending_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Driver event handler
+ */
+static nrf_drv_saadc_event_handler_t g_saadc_mock_handler = NULL;
+
+/**
+ * 	Number of channels in scan
+ */
+static uint32_t gu32_saadc_mock_ch = 0;
+
+/**
+ * 	Active and secondary block
+ */
+static int16_t *	gp_saadc_mock_active		= NULL;
+static uint16_t		gu16_saadc_mock_active_size	= 0;
+static uint16_t		gu16_saadc_mock_cnt			= 0;
+static int16_t *	gp_saadc_mock_next			= NULL;
+static uint16_t		gu16_saadc_mock_next_size	= 0;
+
+/**
+ * 	Pending done events
+ */
+static nrf_drv_saadc_mock_pending_t g_saadc_mock_pending[NRF_DRV_SAADC_MOCK_PENDING];
+static uint32_t gu32_saadc_mock_pending = 0;
+
+/**
+ * 	Interrupt latency. Unit: scan
+ */
+static uint32_t gu32_saadc_mock_delay = 0;
+
+/**
+ * 	Number of lost scans
+ */
+static uint32_t gu32_saadc_mock_lost = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void nrf_drv_saadc_mock_deliver(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Deliver done events whose delay expired, in order
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nrf_drv_saadc_mock_deliver(void)
+{
+	while 	(	( gu32_saadc_mock_pending > 0U )
+			&&	( 0U == g_saadc_mock_pending[0].delay ))
+	{
+		nrf_drv_saadc_evt_t event = { .type = NRF_DRV_SAADC_EVT_DONE };
+
+		event.data.done.p_buffer	= g_saadc_mock_pending[0].p_block;
+		event.data.done.size		= g_saadc_mock_pending[0].size;
+
+		gu32_saadc_mock_pending--;
+		memmove( &g_saadc_mock_pending[0], &g_saadc_mock_pending[1], gu32_saadc_mock_pending * sizeof( g_saadc_mock_pending[0] ));
+
+		g_saadc_mock_handler( &event );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Driver API
+*/
+////////////////////////////////////////////////////////////////////////////////
+ret_code_t nrf_drv_saadc_init(const nrf_drv_saadc_config_t * p_config, nrf_drv_saadc_event_handler_t event_handler)
+{
+	g_saadc_mock_handler = event_handler;
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_saadc_channel_init(uint8_t channel, const nrf_saadc_channel_config_t * const p_config)
+{
+	if ( channel >= gu32_saadc_mock_ch )
+	{
+		gu32_saadc_mock_ch = channel + 1U;
+	}
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_saadc_calibrate_offset(void)
+{
+	const nrf_drv_saadc_evt_t event = { .type = NRFX_SAADC_EVT_CALIBRATEDONE };
+
+	g_saadc_mock_handler( &event );
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_saadc_buffer_convert(int16_t * buffer, uint16_t size)
+{
+	ret_code_t status = NRF_SUCCESS;
+
+	if ( NULL == gp_saadc_mock_active )
+	{
+		gp_saadc_mock_active		= buffer;
+		gu16_saadc_mock_active_size	= size;
+		gu16_saadc_mock_cnt			= 0;
+	}
+	else if ( NULL == gp_saadc_mock_next )
+	{
+		gp_saadc_mock_next			= buffer;
+		gu16_saadc_mock_next_size	= size;
+	}
+	else
+	{
+		status = NRF_ERROR_BUSY;
+	}
+
+	return status;
+}
+
+uint32_t nrf_drv_saadc_sample_task_get(void)
+{
+	return 0UL;
+}
+
+bool nrf_drv_saadc_is_busy(void)
+{
+	return ( NULL != gp_saadc_mock_active );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert single scan
+*
+* @param[in]	p_scan	- Sample of each channel
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_drv_saadc_mock_scan(const int16_t * const p_scan)
+{
+	// Time passes for pending events
+	for ( uint32_t i = 0; i < gu32_saadc_mock_pending; i++ )
+	{
+		if ( g_saadc_mock_pending[i].delay > 0U )
+		{
+			g_saadc_mock_pending[i].delay--;
+		}
+	}
+
+	if ( NULL != gp_saadc_mock_active )
+	{
+		memcpy( &gp_saadc_mock_active[gu16_saadc_mock_cnt], p_scan, gu32_saadc_mock_ch * sizeof( int16_t ));
+		gu16_saadc_mock_cnt += gu32_saadc_mock_ch;
+
+		// Block full, continue in secondary block
+		if ( gu16_saadc_mock_cnt >= gu16_saadc_mock_active_size )
+		{
+			if ( gu32_saadc_mock_pending < NRF_DRV_SAADC_MOCK_PENDING )
+			{
+				g_saadc_mock_pending[gu32_saadc_mock_pending].p_block	= gp_saadc_mock_active;
+				g_saadc_mock_pending[gu32_saadc_mock_pending].size		= gu16_saadc_mock_active_size;
+				g_saadc_mock_pending[gu32_saadc_mock_pending].delay		= gu32_saadc_mock_delay;
+				gu32_saadc_mock_pending++;
+			}
+
+			gp_saadc_mock_active		= gp_saadc_mock_next;
+			gu16_saadc_mock_active_size	= gu16_saadc_mock_next_size;
+			gu16_saadc_mock_cnt			= 0;
+			gp_saadc_mock_next			= NULL;
+		}
+	}
+	else
+	{
+		gu32_saadc_mock_lost++;
+	}
+
+	nrf_drv_saadc_mock_deliver();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set interrupt latency
+*
+* @param[in]	scans	- Done event delay. Unit: scan
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_drv_saadc_mock_set_delay(const uint32_t scans)
+{
+	gu32_saadc_mock_delay = scans;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of scans lost while no block was armed
+*
+* @return		number of lost scans
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_saadc_mock_get_lost(void)
+{
+	return gu32_saadc_mock_lost;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,48 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_saadc_mock.h
+*@brief     Legacy SAADC driver mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NRF_DRV_SAADC_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Legacy SAADC driver mock
+*
+* 	Models double buffered conversion of nrfx SAADC driver. Tests feed
+* 	synthetic scans, as PPI triggered sampling would. Interrupt latency
+* 	is modelled by delaying block done event for a number of scans.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_SAADC_MOCK_H
+#define __NRF_DRV_SAADC_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_drv_saadc.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void		nrf_drv_saadc_mock_scan			(const int16_t * const p_scan);
+void		nrf_drv_saadc_mock_set_delay	(const uint32_t scans);
+uint32_t	nrf_drv_saadc_mock_get_lost		(void);
+
+#endif // __NRF_DRV_SAADC_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,14 @@
+# ADC driver on top of legacy SAADC driver mock
+ADC_DIR := $(ROOT)/src/drivers/peripheral/adc
+
+TESTS += adc_stream
+
+adc_stream_SRC		:= $(ADC_DIR)/test/test_adc_stream.c $(ADC_DIR)/test/nrf_drv_saadc_mock.c $(ADC_DIR)/adc.c \
+					   $(ROOT)/src/middleware/trace/trace_vcd.c
+adc_stream_CFLAGS	:= -I$(ADC_DIR)/test
+
+TESTS += adc_real
+
+adc_real_SRC		:= $(ADC_DIR)/test/test_adc_real.c $(ADC_DIR)/test/nrf_drv_saadc_mock.c $(ADC_DIR)/adc.c \
+					   $(ROOT)/src/middleware/trace/trace_vcd.c
+adc_real_CFLAGS		:= -I$(ADC_DIR)/test
@@ -0,0 +1,229 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_adc_real.c
+*@brief     ADC raw to real conversion against reference
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup ADC_REAL_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Reference is computed in double precision straight from SAADC
+* 	transfer function: V = ( VDD/4 / gain ) * raw / 2^12, with
+* 	calibration applied as real = cal_gain * V + cal_offset.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <math.h>
+
+#include "test.h"
+#include "nrf_drv_saadc_mock.h"
+#include "drivers/peripheral/adc/adc.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Reference LSB of all channels: VDD/4 reference, 1/4 gain, 12 bit
+ *
+ * 	Unit: V
+ */
+#define TEST_ADC_LSB_V				(( 3.0 / 4.0 ) / 0.25 / 4096.0 )
+
+/**
+ * 	Scans per stream block, whole block carries same scan
+ */
+#define TEST_ADC_BLOCK_SCANS		( 10U )
+
+/**
+ * 	Allowed error, single precision rounding
+ *
+ * 	Unit: V
+ */
+#define TEST_ADC_TOL_V				( 1e-5 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Calibrations under test
+ */
+static const adc_cal_t g_test_cal[eADC_NUM_OF] =
+{
+	{ .offset =  0.000f,	.gain = 1.000f },
+	{ .offset =  0.012f,	.gain = 0.987f },
+	{ .offset = -0.050f,	.gain = 1.020f },
+	{ .offset =  0.250f,	.gain = 0.500f },
+	{ .offset = -1.000f,	.gain = 2.000f },
+	{ .offset =  0.001f,	.gain = 1.001f },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Time base stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert one block of same scan
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_adc_feed(const int16_t * const p_scan)
+{
+	for ( uint32_t i = 0; i < TEST_ADC_BLOCK_SCANS; i++ )
+	{
+		nrf_drv_saadc_mock_scan( p_scan );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Compare conversion of all channels with reference
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_adc_check(const int16_t * const p_scan, const adc_cal_t * const p_cal)
+{
+	float32_t	real[eADC_NUM_OF];
+	double		err_max	= 0.0;
+
+	test_adc_feed( p_scan );
+
+	TEST_ASSERT_EQ( adc_get_real_all( real ), eADC_OK );
+
+	for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+	{
+		const double ref = ( p_cal[ch].gain * TEST_ADC_LSB_V * p_scan[ch] ) + p_cal[ch].offset;
+		const double err = fabs( real[ch] - ref );
+
+		if ( err > err_max )
+		{
+			err_max = err;
+		}
+
+		// Single channel path is the same conversion
+		TEST_ASSERT( real[ch] == adc_get_real( ch ));
+		// Raw getter clamps negative noise to zero, real value keeps sign
+		TEST_ASSERT_EQ( adc_get_raw( ch ), ( p_scan[ch] > 0 ) ? p_scan[ch] : 0 );
+	}
+
+	TEST_ASSERT( err_max < TEST_ADC_TOL_V );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sweep input range with default and custom calibration
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_real(void)
+{
+	adc_cal_t	unity[eADC_NUM_OF];
+	int16_t		scan[eADC_NUM_OF];
+
+	for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+	{
+		unity[ch].offset	= 0.0f;
+		unity[ch].gain		= 1.0f;
+	}
+
+	// Default calibration
+	for ( int32_t raw = 0; raw < 4096; raw += 17 )
+	{
+		for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+		{
+			scan[ch] = (int16_t)(( raw + ( 701 * ch )) % 4096 );
+		}
+
+		test_adc_check( scan, unity );
+	}
+
+	// Full scale and negative noise around zero
+	for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+	{
+		scan[ch] = (int16_t)( 4095 - ( 4 * ch ));
+	}
+	test_adc_check( scan, unity );
+
+	for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+	{
+		scan[ch] = (int16_t)( -(int16_t) ch );
+	}
+	test_adc_check( scan, unity );
+
+	// Per channel calibration
+	for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+	{
+		TEST_ASSERT_EQ( adc_set_cal( ch, &g_test_cal[ch] ), eADC_OK );
+	}
+
+	for ( int32_t raw = 0; raw < 4096; raw += 13 )
+	{
+		for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+		{
+			scan[ch] = (int16_t)(( raw + ( 331 * ch )) % 4096 );
+		}
+
+		test_adc_check( scan, g_test_cal );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Invalid arguments
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_args(void)
+{
+	const uint32_t hits = test_assert_hits();
+
+	TEST_ASSERT_EQ( adc_get_real_all( NULL ), eADC_ERROR );
+	TEST_ASSERT_EQ( adc_set_cal( eADC_NUM_OF, &g_test_cal[0] ), eADC_ERROR );
+	TEST_ASSERT_EQ( adc_set_cal( eADC_AIN_1, NULL ), eADC_ERROR );
+	TEST_ASSERT_EQ( test_assert_hits() - hits, 3 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	TEST_ASSERT_EQ( adc_init(), eADC_OK );
+
+	test_real();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	test_args();
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
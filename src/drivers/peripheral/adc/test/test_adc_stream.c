@@ -0,0 +1,245 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_adc_stream.c
+*@brief     ADC block streaming host simulation
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup ADC_STREAM_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Synthetic scans carry running sequence number, channel n of scan
+* 	holds sequence + n. Consumer checks that blocks arrive in order,
+* 	channels are interleaved correctly and no scan is missing.
+*
+* 	Double buffering must hide interrupt latency shorter than one
+* 	block. Longer latency loses scans and must show up as stall.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "test.h"
+#include "nrf_drv_saadc_mock.h"
+#include "drivers/peripheral/adc/adc.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Sequence number range, keeps samples positive
+ */
+#define TEST_ADC_SEQ_MASK			( 0x0FFFU )
+
+/**
+ * 	Number of simulated scans per run
+ */
+#define TEST_ADC_RUN_SCANS			( 10000U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Sequence of next scan to convert
+ */
+static uint32_t gu32_test_seq = 0;
+
+/**
+ * 	Expected sequence of next received scan
+ */
+static uint32_t gu32_test_expected = 0;
+
+/**
+ * 	Consumer results
+ */
+static uint32_t gu32_test_blocks	= 0;
+static uint32_t gu32_test_scans		= 0;
+static uint32_t gu32_test_gaps		= 0;
+static uint32_t gu32_test_missing	= 0;
+static uint32_t gu32_test_bad		= 0;
+static uint32_t gu32_test_block_scans = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Time base stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stream consumer
+*/
+////////////////////////////////////////////////////////////////////////////////
+void adc_stream_cb(const int16_t * const p_block, const uint32_t scans)
+{
+	gu32_test_blocks++;
+	gu32_test_block_scans = scans;
+
+	for ( uint32_t s = 0; s < scans; s++ )
+	{
+		const int16_t * const	p_scan	= &p_block[ s * eADC_NUM_OF ];
+		const uint32_t			seq		= (uint32_t) p_scan[0];
+
+		// Scans missing in between
+		if ( seq != ( gu32_test_expected & TEST_ADC_SEQ_MASK ))
+		{
+			gu32_test_gaps++;
+			gu32_test_missing += (( seq - gu32_test_expected ) & TEST_ADC_SEQ_MASK );
+		}
+
+		for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+		{
+			if ((uint32_t) p_scan[ch] != ( seq + ch ))
+			{
+				gu32_test_bad++;
+			}
+		}
+
+		gu32_test_expected = seq + 1U;
+		gu32_test_scans++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert number of synthetic scans
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_adc_run(const uint32_t scans)
+{
+	int16_t scan[eADC_NUM_OF];
+
+	for ( uint32_t i = 0; i < scans; i++ )
+	{
+		const uint32_t seq = ( gu32_test_seq++ ) & TEST_ADC_SEQ_MASK;
+
+		for ( uint32_t ch = 0; ch < eADC_NUM_OF; ch++ )
+		{
+			scan[ch] = (int16_t)( seq + ch );
+		}
+
+		nrf_drv_saadc_mock_scan( scan );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear consumer results
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_adc_clear(void)
+{
+	gu32_test_blocks	= 0;
+	gu32_test_scans		= 0;
+	gu32_test_gaps		= 0;
+	gu32_test_missing	= 0;
+	gu32_test_bad		= 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stream without and with interrupt latency
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_stream(void)
+{
+	adc_stream_stats_t stats = {0};
+
+	// No latency
+	test_adc_run( TEST_ADC_RUN_SCANS );
+
+	TEST_ASSERT( gu32_test_block_scans > 1U );
+	TEST_ASSERT_EQ( gu32_test_blocks, TEST_ADC_RUN_SCANS / gu32_test_block_scans );
+	TEST_ASSERT_EQ( gu32_test_scans, TEST_ADC_RUN_SCANS );
+	TEST_ASSERT_EQ( gu32_test_gaps, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad, 0 );
+	TEST_ASSERT_EQ( adc_get_stream_stats( &stats ), eADC_OK );
+	TEST_ASSERT_EQ( stats.blocks, gu32_test_blocks );
+	TEST_ASSERT_EQ( stats.overruns, 0 );
+
+	// Latest scan of last block
+	TEST_ASSERT_EQ( adc_get_raw( eADC_AIN_2 ), (( TEST_ADC_RUN_SCANS - 1U ) & TEST_ADC_SEQ_MASK ) + 1U );
+
+	// Latency just below one block is hidden by second block
+	test_adc_clear();
+	nrf_drv_saadc_mock_set_delay( gu32_test_block_scans - 1U );
+	test_adc_run( TEST_ADC_RUN_SCANS );
+
+	TEST_ASSERT( gu32_test_scans >= ( TEST_ADC_RUN_SCANS - gu32_test_block_scans ));
+	TEST_ASSERT_EQ( gu32_test_gaps, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad, 0 );
+	TEST_ASSERT_EQ( nrf_drv_saadc_mock_get_lost(), 0 );
+	TEST_ASSERT_EQ( adc_get_stream_stats( &stats ), eADC_OK );
+	TEST_ASSERT_EQ( stats.overruns, 0 );
+
+	// Longer latency loses scans, each gap shows up as stall
+	test_adc_clear();
+	nrf_drv_saadc_mock_set_delay( gu32_test_block_scans + 3U );
+	test_adc_run( TEST_ADC_RUN_SCANS );
+
+	TEST_ASSERT( nrf_drv_saadc_mock_get_lost() > 0U );
+	TEST_ASSERT( gu32_test_gaps > 0U );
+	TEST_ASSERT( gu32_test_missing <= nrf_drv_saadc_mock_get_lost());
+	TEST_ASSERT_EQ( gu32_test_bad, 0 );
+	TEST_ASSERT_EQ( adc_get_stream_stats( &stats ), eADC_OK );
+	TEST_ASSERT( stats.overruns >= gu32_test_gaps );
+
+	// Stream recovers, scans lost at the end of previous run are seen
+	// as gap of first block
+	gu32_test_blocks	= 0;
+	gu32_test_scans		= 0;
+	gu32_test_gaps		= 0;
+	nrf_drv_saadc_mock_set_delay( 0U );
+	test_adc_run( TEST_ADC_RUN_SCANS );
+
+	TEST_ASSERT_EQ( gu32_test_missing, nrf_drv_saadc_mock_get_lost());
+	TEST_ASSERT_EQ( gu32_test_bad, 0 );
+
+	test_adc_clear();
+	test_adc_run( TEST_ADC_RUN_SCANS );
+
+	TEST_ASSERT_EQ( gu32_test_gaps, 0 );
+	TEST_ASSERT_EQ( gu32_test_scans, TEST_ADC_RUN_SCANS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	TEST_ASSERT_EQ( adc_init(), eADC_OK );
+
+	test_stream();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include "nrf_gpio.h"
+#include "app_util_platform.h"
 
 #include "gpio.h"
 #include "pin_mapper.h"
@@ -54,6 +55,15 @@ typedef struct
  */
 static bool gb_is_init = false;
 
+/**
+ * 	GPIO port registers
+ */
+static NRF_GPIO_Type * const gp_gpio_port[ eGPIO_PORT_NUM_OF ] =
+{
+    [eGPIO_PORT_0] = NRF_P0,
+    [eGPIO_PORT_1] = NRF_P1,
+};
+
 /**
  * 	GPIO CONFIGURATION TABLE
  */
@@ -243,6 +253,105 @@ void gpio_toggle(const gpio_pins_t pin)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*	Get absolute pin number
+*
+* @note	Used for configuration of peripherals working directly with
+*		pins, e.g. GPIOTE.
+*
+* @param[in] 	pin   	- GPIO pin
+* @return	pin_num	- Pin number including port
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t gpio_get_pin_num(const gpio_pins_t pin)
+{
+    PROJECT_CONFIG_ASSERT( pin < eGPIO_NUM_OF );
+
+    return NRF_GPIO_PIN_MAP( g_gpio_cfg_table[pin].port, g_gpio_cfg_table[pin].pin );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*	Get pin pull device mode
+*
+* @note	Used for configuration of peripherals that re-configure
+*		pin, e.g. GPIOTE input, so that pull stays as in GPIO table.
+*
+* @param[in] 	pin   	- GPIO pin
+* @return	pull	- Pull device mode
+*/
+////////////////////////////////////////////////////////////////////////////////
+nrf_gpio_pin_pull_t gpio_get_pin_pull(const gpio_pins_t pin)
+{
+    PROJECT_CONFIG_ASSERT( pin < eGPIO_NUM_OF );
+
+    return g_gpio_cfg_table[pin].pull;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*	Read multiple pins of port
+*
+* @note	All pins are sampled in single IN register read.
+*
+* @param[in] 	port	- GPIO port
+* @param[in] 	mask	- Pins to read, e.g. GPIO_BTN_MASK
+* @param[out] 	p_value	- Pin states, bit per pin, masked
+* @return	status	- Status of operation, error if not initialized
+*/
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_read_mask(const gpio_port_t port, const uint32_t mask, uint32_t * const p_value)
+{
+    gpio_status_t status = eGPIO_OK;
+
+    PROJECT_CONFIG_ASSERT( port < eGPIO_PORT_NUM_OF );
+
+    if  (   ( true == gb_is_init )
+        &&  ( port < eGPIO_PORT_NUM_OF )
+        &&  ( NULL != p_value ))
+    {
+        *p_value = ( gp_gpio_port[port]->IN & mask );
+    }
+    else
+    {
+        status = eGPIO_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*	Write multiple pins of port
+*
+* @note	All pins change in single OUT write, so no intermediate state
+*		appears on outputs. Read-modify-write is done in critical
+*		region, pins outside mask written from ISR are not lost.
+*
+* @param[in] 	port	- GPIO port
+* @param[in] 	mask	- Pins to write, e.g. GPIO_TP_MASK
+* @param[in] 	value	- Pin states, bit per pin
+* @return	void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void gpio_write_mask(const gpio_port_t port, const uint32_t mask, const uint32_t value)
+{
+    PROJECT_CONFIG_ASSERT( port < eGPIO_PORT_NUM_OF );
+
+    if  (   ( true == gb_is_init )
+        &&  ( port < eGPIO_PORT_NUM_OF ))
+    {
+        NRF_GPIO_Type * const p_port = gp_gpio_port[port];
+
+        CRITICAL_REGION_ENTER();
+
+        p_port->OUT = (( p_port->OUT & ~mask ) | ( value & mask ));
+
+        CRITICAL_REGION_EXIT();
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
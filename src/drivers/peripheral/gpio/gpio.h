@@ -27,6 +27,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "nrf_gpio.h"
+
+#include "pin_mapper.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -75,6 +78,62 @@ typedef enum
     eGPIO_UKNOWN,	/**<Uknown state - during startup time */
 } gpio_state_t;
 
+/**
+ * 	GPIO ports
+ */
+typedef enum
+{
+    eGPIO_PORT_0 = 0,	/**<Port P0 */
+    eGPIO_PORT_1,	/**<Port P1 */
+
+    eGPIO_PORT_NUM_OF
+} gpio_port_t;
+
+/**
+ * 	Compile time pin port and mask
+ *
+ * @note	Takes pin name as used in "pin_mapper.h" and GPIO configuration
+ * 		table, e.g. GPIO_PIN_MASK( TP_1 ).
+ */
+#define GPIO_PIN_PORT(name)		((gpio_port_t)( name##__PORT ))
+#define GPIO_PIN_MASK(name)		( 1UL << ( name##__PIN ))
+
+/**
+ * 	Test point outputs
+ */
+#define GPIO_TP_PORT			GPIO_PIN_PORT( TP_1 )
+#define GPIO_TP_MASK			( GPIO_PIN_MASK( TP_1 ) | GPIO_PIN_MASK( TP_2 ) | GPIO_PIN_MASK( TP_3 ))
+
+/**
+ * 	User button inputs
+ */
+#define GPIO_BTN_PORT			GPIO_PIN_PORT( BTN_1 )
+#define GPIO_BTN_MASK			( GPIO_PIN_MASK( BTN_1 ) | GPIO_PIN_MASK( BTN_2 ) | GPIO_PIN_MASK( BTN_3 ) | GPIO_PIN_MASK( BTN_4 ))
+
+/**
+ * 	User LED outputs
+ */
+#define GPIO_LED_PORT			GPIO_PIN_PORT( LED_1 )
+#define GPIO_LED_MASK			( GPIO_PIN_MASK( LED_1 ) | GPIO_PIN_MASK( LED_2 ) | GPIO_PIN_MASK( LED_3 ) | GPIO_PIN_MASK( LED_4 ))
+
+/**
+ * 	Invalid configuration catcher
+ *
+ * @note	Pins of single group must share port, otherwise group can
+ * 		not be accessed in single register access.
+ */
+#if (( TP_1__PORT != TP_2__PORT ) || ( TP_1__PORT != TP_3__PORT ))
+	#error "Test points must be on same port!"
+#endif
+
+#if (( BTN_1__PORT != BTN_2__PORT ) || ( BTN_1__PORT != BTN_3__PORT ) || ( BTN_1__PORT != BTN_4__PORT ))
+	#error "Buttons must be on same port!"
+#endif
+
+#if (( LED_1__PORT != LED_2__PORT ) || ( LED_1__PORT != LED_3__PORT ) || ( LED_1__PORT != LED_4__PORT ))
+	#error "LEDs must be on same port!"
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +142,10 @@ gpio_status_t	gpio_is_init	(bool * const p_is_init);
 gpio_state_t	gpio_get	(const gpio_pins_t pin);
 void		gpio_set	(const gpio_pins_t pin, const gpio_state_t state);
 void		gpio_toggle	(const gpio_pins_t pin);
+uint32_t	gpio_get_pin_num(const gpio_pins_t pin);
+nrf_gpio_pin_pull_t gpio_get_pin_pull(const gpio_pins_t pin);
+gpio_status_t	gpio_read_mask	(const gpio_port_t port, const uint32_t mask, uint32_t * const p_value);
+void		gpio_write_mask	(const gpio_port_t port, const uint32_t mask, const uint32_t value);
 
 
 #endif // __GPIO_H
@@ -22,7 +22,10 @@
 #include <stdbool.h>
 
 #include "nrf_drv_systick.h"
+#include "nrf_drv_clock.h"
+#include "nrf_rtc.h"
 #include "systick.h"
+#include "middleware/trace/trace.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -35,34 +38,301 @@
  */
 #define SYSTICK_PERIOD_HZ               ( 1000UL )    
 
+/**
+ *    Enable/Disable RTC time base
+ *
+ * @note    Cortex SysTick is stopped while CPU sleeps, thus when
+ *          scheduler sleeps time base must come from RTC (LFCLK).
+ *
+ *          1 - RTC2 drives millisecond tick and us timestamps (30.5 us resolution)
+ *          0 - Cortex SysTick drives millisecond tick and us timestamps (1/64 us resolution)
+ */
+#define SYSTICK_RTC_EN                  ( 1 )
+
+#if ( 1 == SYSTICK_RTC_EN )
+
+    /**
+     *    RTC instance used as time base
+     */
+    #define SYSTICK_RTC                 ( NRF_RTC2 )
+    #define SYSTICK_RTC_IRQn            ( RTC2_IRQn )
+    #define SYSTICK_RTC_IRQHandler      RTC2_IRQHandler
+
+    /**
+     *    RTC counter frequency
+     *
+     *  Unit: Hz
+     */
+    #define SYSTICK_RTC_FREQ_HZ         ( 32768UL )
+
+    /**
+     *    RTC counter width
+     *
+     *  Unit: bit
+     */
+    #define SYSTICK_RTC_WIDTH           ( 24UL )
+
+    /**
+     *    RTC counter mask
+     */
+    #define SYSTICK_RTC_MASK            (( 1UL << SYSTICK_RTC_WIDTH ) - 1UL )
+
+    /**
+     *    RTC ticks per whole number of milliseconds
+     *
+     * @note    32768 Hz / 1000 Hz = 32.768 ticks, thus 4096 ticks span
+     *          exactly 125 ms. Millisecond boundaries repeat with that
+     *          period, which keeps conversion within 32-bit arithmetic.
+     */
+    #define SYSTICK_RTC_PERIOD_TICKS    ( 4096UL )
+    #define SYSTICK_RTC_PERIOD_MS       ( 125UL )
+    #define SYSTICK_RTC_PERIOD_SHIFT    ( 12UL )
+
+    /**
+     *    Minimum distance of compare value from counter
+     *
+     * @note    RTC compare event is guaranteed only when CC is set at
+     *          least two ticks ahead of COUNTER.
+     *
+     *  Unit: tick
+     */
+    #define SYSTICK_RTC_CC_MIN          ( 2UL )
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == SYSTICK_RTC_EN )
+    static systick_status_t systick_rtc_init    (void);
+    static uint64_t         systick_rtc_ticks   (void);
+    static void             systick_rtc_schedule(void);
+#else
+    static inline void      systick_tick        (void);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
-/**
- *    Systick counter
- */
-static volatile uint32_t gu32_systick_cnt = 0;
+#if ( 1 == SYSTICK_RTC_EN )
+
+    /**
+     *    RTC counter overflows
+     */
+    static volatile uint32_t gu32_systick_rtc_ovf = 0;
+
+#else
+
+    /**
+     *    Systick counter
+     */
+    static volatile uint32_t gu32_systick_cnt = 0;
+
+    /**
+     *    Systick counter upper 32 bits
+     *
+     * @note    Incremented on each gu32_systick_cnt wrap.
+     */
+    static volatile uint32_t gu32_systick_cnt_hi = 0;
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Systick ISR handler
-*
-* @return   void
-*/
-////////////////////////////////////////////////////////////////////////////////
-void SysTick_Handler(void)
-{
-    gu32_systick_cnt++;
-}
+#if ( 1 == SYSTICK_RTC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Initialize RTC time base
+    *
+    * @return   status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static systick_status_t systick_rtc_init(void)
+    {
+        systick_status_t status = eSYSTICK_OK;
+
+        // Clock driver might be initialized already by other module
+        const ret_code_t err_code = nrf_drv_clock_init();
+
+        if  (   ( NRF_SUCCESS != err_code )
+            &&  ( NRF_ERROR_MODULE_ALREADY_INITIALIZED != err_code ))
+        {
+            status = eSYSTICK_ERROR;
+        }
+        else
+        {
+            // Start LFCLK and wait for it
+            nrf_drv_clock_lfclk_request( NULL );
+
+            while ( false == nrf_drv_clock_lfclk_is_running())
+            {
+                // Wait...
+            }
+
+            nrf_rtc_task_trigger( SYSTICK_RTC, NRF_RTC_TASK_STOP );
+            nrf_rtc_task_trigger( SYSTICK_RTC, NRF_RTC_TASK_CLEAR );
+            nrf_rtc_prescaler_set( SYSTICK_RTC, 0UL );
+
+            // First millisecond
+            systick_rtc_schedule();
+
+            nrf_rtc_event_clear( SYSTICK_RTC, NRF_RTC_EVENT_COMPARE_0 );
+            nrf_rtc_event_clear( SYSTICK_RTC, NRF_RTC_EVENT_OVERFLOW );
+            nrf_rtc_int_enable( SYSTICK_RTC, ( NRF_RTC_INT_COMPARE0_MASK | NRF_RTC_INT_OVERFLOW_MASK ));
+
+            // Same priority as SysTick
+            NVIC_SetPriority( SYSTICK_RTC_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL );
+            NVIC_ClearPendingIRQ( SYSTICK_RTC_IRQn );
+            NVIC_EnableIRQ( SYSTICK_RTC_IRQn );
+
+            nrf_rtc_task_trigger( SYSTICK_RTC, NRF_RTC_TASK_START );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get 64-bit RTC tick count
+    *
+    * @note     Overflow that was not yet serviced by ISR is taken into account.
+    *
+    * @return   ticks   - RTC ticks since systick_init()
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint64_t systick_rtc_ticks(void)
+    {
+        uint32_t ovf;
+        uint32_t cnt;
+        uint32_t pend;
+
+        do
+        {
+            ovf  = gu32_systick_rtc_ovf;
+            cnt  = nrf_rtc_counter_get( SYSTICK_RTC );
+            pend = 0UL;
+
+            // Overflow happened but ISR not yet executed
+            if ( nrf_rtc_event_pending( SYSTICK_RTC, NRF_RTC_EVENT_OVERFLOW ))
+            {
+                // Re-read so that counter is surely after overflow
+                cnt  = nrf_rtc_counter_get( SYSTICK_RTC );
+                pend = 1UL;
+            }
+        }
+        while ( ovf != gu32_systick_rtc_ovf );
+
+        return ((((uint64_t)( ovf + pend )) << SYSTICK_RTC_WIDTH ) | cnt );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Schedule compare to next millisecond boundary
+    *
+    * @note     Boundary is taken from current counter value, not from previous
+    *           compare. Interrupt served late therefore does not push compare
+    *           into the past, it fires on next boundary that is still ahead.
+    *
+    * @return   void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void systick_rtc_schedule(void)
+    {
+        uint32_t cnt;
+        uint32_t cc;
+        uint32_t dist;
+
+        do
+        {
+            cnt = nrf_rtc_counter_get( SYSTICK_RTC );
+
+            // Position within 125 ms period and first tick of next millisecond
+            const uint32_t pos  = ( cnt & ( SYSTICK_RTC_PERIOD_TICKS - 1UL ));
+            const uint32_t ms   = (( pos * SYSTICK_RTC_PERIOD_MS ) >> SYSTICK_RTC_PERIOD_SHIFT );
+            uint32_t       next = (((( ms + 1UL ) << SYSTICK_RTC_PERIOD_SHIFT ) + SYSTICK_RTC_PERIOD_MS - 1UL ) / SYSTICK_RTC_PERIOD_MS );
+
+            if (( next - pos ) < SYSTICK_RTC_CC_MIN )
+            {
+                next = pos + SYSTICK_RTC_CC_MIN;
+            }
+
+            cc = (( cnt - pos + next ) & SYSTICK_RTC_MASK );
+            nrf_rtc_cc_set( SYSTICK_RTC, 0, cc );
+
+            // Counter might have moved while compare was set
+            dist = (( cc - nrf_rtc_counter_get( SYSTICK_RTC )) & SYSTICK_RTC_MASK );
+        }
+        while   (   ( dist < SYSTICK_RTC_CC_MIN )
+                ||  ( dist > ( SYSTICK_RTC_MASK >> 1 )));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       RTC ISR handler
+    *
+    * @return   void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void SYSTICK_RTC_IRQHandler(void)
+    {
+        TP_ENTER( SYSTICK_ISR );
+
+        // Counter overflow
+        if ( nrf_rtc_event_pending( SYSTICK_RTC, NRF_RTC_EVENT_OVERFLOW ))
+        {
+            nrf_rtc_event_clear( SYSTICK_RTC, NRF_RTC_EVENT_OVERFLOW );
+            gu32_systick_rtc_ovf++;
+        }
+
+        // Millisecond elapsed, counter itself is time base thus
+        // only wake-up for next one is needed
+        if ( nrf_rtc_event_pending( SYSTICK_RTC, NRF_RTC_EVENT_COMPARE_0 ))
+        {
+            nrf_rtc_event_clear( SYSTICK_RTC, NRF_RTC_EVENT_COMPARE_0 );
+            systick_rtc_schedule();
+        }
+
+        TP_EXIT( SYSTICK_ISR );
+    }
+
+#else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Advance millisecond counter
+    *
+    * @return   void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static inline void systick_tick(void)
+    {
+        gu32_systick_cnt++;
+
+        if ( 0UL == gu32_systick_cnt )
+        {
+            gu32_systick_cnt_hi++;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Systick ISR handler
+    *
+    * @return   void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void SysTick_Handler(void)
+    {
+        TP_ENTER( SYSTICK_ISR );
+        systick_tick();
+        TP_EXIT( SYSTICK_ISR );
+    }
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -75,17 +345,25 @@ systick_status_t systick_init(void)
 {
     systick_status_t status = eSYSTICK_OK;
 
-    // Set load register
-    SysTick->LOAD  = (uint32_t)(( SystemCoreClock / SYSTICK_PERIOD_HZ ) - 1UL);                      
-    
-    // Set interrupt priority
-    NVIC_SetPriority ( SysTick_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL ); 
-    
-    // Clear counter
-    SysTick->VAL = 0UL;                                            
-   
-    // Enable IRQ and start timer
-    SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk );                        
+    #if ( 1 == SYSTICK_RTC_EN )
+
+        status = systick_rtc_init();
+
+    #else
+
+        // Set load register
+        SysTick->LOAD  = (uint32_t)(( SystemCoreClock / SYSTICK_PERIOD_HZ ) - 1UL);                      
+        
+        // Set interrupt priority
+        NVIC_SetPriority ( SysTick_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL ); 
+        
+        // Clear counter
+        SysTick->VAL = 0UL;                                            
+       
+        // Enable IRQ and start timer
+        SysTick->CTRL = ( SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk );                        
+
+    #endif
 
     return status;
 }
@@ -94,12 +372,106 @@ systick_status_t systick_init(void)
 /**
 *       Get system tick counts
 *
-* @return   gu32_systick_cnt  - Miliseconds system tick counter
+* @note     With RTC time base value is derived from RTC counter, thus it
+*           matches systick_get_us64() also when tick interrupt is late.
+*
+* @return   time_ms  - Miliseconds system tick counter
 */
 ////////////////////////////////////////////////////////////////////////////////
 const uint32_t systick_get_ms(void)
 {
-    return (const uint32_t) gu32_systick_cnt;
+    #if ( 1 == SYSTICK_RTC_EN )
+        return (const uint32_t) systick_get_ms64();
+    #else
+        return (const uint32_t) gu32_systick_cnt;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get 64-bit monotonic time in microseconds
+*
+* @note     Safe to call from any context, including ISRs with priority
+*           higher than tick interrupt and with interrupts disabled. Pending
+*           tick that was not yet serviced is taken into account.
+*
+* @return   time_us  - Microseconds since systick_init()
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t systick_get_us64(void)
+{
+    #if ( 1 == SYSTICK_RTC_EN )
+
+        const uint64_t ticks = systick_rtc_ticks();
+
+        // us = ticks * 1e6 / 32768 = ticks * 15625 / 512
+        return (( ticks * 15625ULL ) >> 9 );
+
+    #else
+
+        uint32_t hi;
+        uint32_t lo;
+        uint32_t val;
+        uint32_t pend;
+
+        do
+        {
+            hi  = gu32_systick_cnt_hi;
+            lo  = gu32_systick_cnt;
+            val = SysTick->VAL;
+            pend = 0UL;
+
+            // Reload happened but ISR not yet executed
+            if ( SCB->ICSR & SCB_ICSR_PENDSTSET_Msk )
+            {
+                // Re-read so that value is surely after reload
+                val = SysTick->VAL;
+                pend = 1UL;
+            }
+        }
+        while (( hi != gu32_systick_cnt_hi ) || ( lo != gu32_systick_cnt ));
+
+        const uint64_t ms           = (((uint64_t) hi << 32 ) | lo ) + pend;
+        const uint32_t cycles_per_us = ( SysTick->LOAD + 1UL ) / 1000UL;
+        const uint32_t elapsed_us   = ( SysTick->LOAD - val ) / cycles_per_us;
+
+        return (( ms * 1000ULL ) + elapsed_us );
+
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get 64-bit millisecond tick counter
+*
+* @return   time_ms  - Milliseconds since systick_init()
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t systick_get_ms64(void)
+{
+    #if ( 1 == SYSTICK_RTC_EN )
+
+        const uint64_t ticks = systick_rtc_ticks();
+        const uint32_t pos   = (uint32_t)( ticks & ( SYSTICK_RTC_PERIOD_TICKS - 1UL ));
+
+        // ms = ticks * 1000 / 32768, split into whole 125 ms periods and remainder
+        return ((( ticks >> SYSTICK_RTC_PERIOD_SHIFT ) * SYSTICK_RTC_PERIOD_MS ) + (( pos * SYSTICK_RTC_PERIOD_MS ) >> SYSTICK_RTC_PERIOD_SHIFT ));
+
+    #else
+
+        uint32_t hi;
+        uint32_t lo;
+
+        do
+        {
+            hi = gu32_systick_cnt_hi;
+            lo = gu32_systick_cnt;
+        }
+        while ( hi != gu32_systick_cnt_hi );
+
+        return (((uint64_t) hi << 32 ) | lo );
+
+    #endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
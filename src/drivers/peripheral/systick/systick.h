@@ -41,6 +41,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 systick_status_t  systick_init    (void);
 const uint32_t    systick_get_ms  (void);
+uint64_t          systick_get_ms64(void);
+uint64_t          systick_get_us64(void);
 
 #endif // __SYSTICK_H
 
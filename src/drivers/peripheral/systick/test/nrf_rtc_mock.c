@@ -0,0 +1,219 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_rtc_mock.c
+*@brief     RTC HAL mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NRF_RTC_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Counter reads can advance time by configurable number of ticks,
+* 	which places counter increments between any two register accesses
+* 	of code under test.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "nrf_rtc_mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Register stand-in
+ */
+NRF_RTC_Type g_nrf_rtc_stub_reg = { .id = 2 };
+
+/**
+ * 	RTC state
+ */
+static bool		gb_rtc_mock_run			= false;
+static uint32_t	gu32_rtc_mock_cnt		= 0;
+static uint32_t	gu32_rtc_mock_cc		= 0;
+static bool		gb_rtc_mock_cc_armed	= false;
+static bool		gb_rtc_mock_evt_cc		= false;
+static bool		gb_rtc_mock_evt_ovf		= false;
+static uint32_t	gu32_rtc_mock_int		= 0;
+
+/**
+ * 	Ticks elapsed since clear
+ */
+static uint64_t	gu64_rtc_mock_ticks		= 0;
+
+/**
+ * 	Ticks added by each counter read
+ */
+static uint32_t	gu32_rtc_mock_read_step	= 0;
+
+/**
+ * 	Number of fired compare events
+ */
+static uint32_t	gu32_rtc_mock_compares	= 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		RTC HAL
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_rtc_task_trigger(NRF_RTC_Type * p_reg, nrf_rtc_task_t task)
+{
+	switch ( task )
+	{
+		case NRF_RTC_TASK_START:	gb_rtc_mock_run = true;		break;
+		case NRF_RTC_TASK_STOP:		gb_rtc_mock_run = false;	break;
+
+		case NRF_RTC_TASK_CLEAR:
+		default:
+			gu32_rtc_mock_cnt	= 0;
+			gu64_rtc_mock_ticks	= 0;
+			break;
+	}
+}
+
+void nrf_rtc_prescaler_set(NRF_RTC_Type * p_reg, uint32_t val)
+{
+}
+
+void nrf_rtc_cc_set(NRF_RTC_Type * p_reg, uint32_t ch, uint32_t cc_val)
+{
+	gu32_rtc_mock_cc		= ( cc_val & NRF_RTC_MOCK_MASK );
+	gb_rtc_mock_cc_armed	= ((( gu32_rtc_mock_cc - gu32_rtc_mock_cnt ) & NRF_RTC_MOCK_MASK ) >= 2UL );
+}
+
+uint32_t nrf_rtc_cc_get(NRF_RTC_Type * p_reg, uint32_t ch)
+{
+	return gu32_rtc_mock_cc;
+}
+
+uint32_t nrf_rtc_counter_get(NRF_RTC_Type * p_reg)
+{
+	const uint32_t cnt = gu32_rtc_mock_cnt;
+
+	// Time passes after read
+	for ( uint32_t i = 0; i < gu32_rtc_mock_read_step; i++ )
+	{
+		nrf_rtc_mock_tick();
+	}
+
+	return cnt;
+}
+
+bool nrf_rtc_event_pending(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
+{
+	return ( NRF_RTC_EVENT_OVERFLOW == event ) ? gb_rtc_mock_evt_ovf : gb_rtc_mock_evt_cc;
+}
+
+void nrf_rtc_event_clear(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
+{
+	if ( NRF_RTC_EVENT_OVERFLOW == event )
+	{
+		gb_rtc_mock_evt_ovf = false;
+	}
+	else
+	{
+		gb_rtc_mock_evt_cc = false;
+	}
+}
+
+void nrf_rtc_int_enable(NRF_RTC_Type * p_reg, uint32_t mask)
+{
+	gu32_rtc_mock_int |= mask;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance counter by one tick
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_rtc_mock_tick(void)
+{
+	if ( true == gb_rtc_mock_run )
+	{
+		gu32_rtc_mock_cnt = (( gu32_rtc_mock_cnt + 1UL ) & NRF_RTC_MOCK_MASK );
+		gu64_rtc_mock_ticks++;
+
+		if ( 0UL == gu32_rtc_mock_cnt )
+		{
+			gb_rtc_mock_evt_ovf = true;
+		}
+
+		if 	(	( true == gb_rtc_mock_cc_armed )
+			&&	( gu32_rtc_mock_cnt == gu32_rtc_mock_cc ))
+		{
+			gb_rtc_mock_evt_cc = true;
+			gu32_rtc_mock_compares++;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Enabled event is waiting for interrupt handler
+*
+* @return		true if interrupt is pending
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nrf_rtc_mock_irq_pending(void)
+{
+	return	(	(( true == gb_rtc_mock_evt_ovf ) && ( 0UL != ( gu32_rtc_mock_int & NRF_RTC_INT_OVERFLOW_MASK )))
+			||	(( true == gb_rtc_mock_evt_cc ) && ( 0UL != ( gu32_rtc_mock_int & NRF_RTC_INT_COMPARE0_MASK ))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set number of ticks that elapse on each counter read
+*
+* @param[in]	ticks	- Ticks per read
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_rtc_mock_set_read_step(const uint32_t ticks)
+{
+	gu32_rtc_mock_read_step = ticks;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get ticks elapsed since counter clear
+*
+* @return		number of ticks, not wrapped
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t nrf_rtc_mock_get_ticks(void)
+{
+	return gu64_rtc_mock_ticks;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of fired compare events
+*
+* @return		number of compare events
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_rtc_mock_get_compares(void)
+{
+	return gu32_rtc_mock_compares;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
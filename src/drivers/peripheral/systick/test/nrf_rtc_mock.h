@@ -0,0 +1,60 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_rtc_mock.h
+*@brief     RTC HAL mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NRF_RTC_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	RTC HAL mock
+*
+* 	Models 24-bit RTC counter with single compare channel. Tests advance
+* 	counter tick by tick and decide when pending interrupt is served.
+* 	Compare set less than two ticks ahead of counter does not fire, as
+* 	on real RTC.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_RTC_MOCK_H
+#define __NRF_RTC_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_rtc.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	RTC counter mask
+ */
+#define NRF_RTC_MOCK_MASK			( 0x00FFFFFFUL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void		nrf_rtc_mock_tick			(void);
+bool		nrf_rtc_mock_irq_pending	(void);
+void		nrf_rtc_mock_set_read_step	(const uint32_t ticks);
+uint64_t	nrf_rtc_mock_get_ticks		(void);
+uint32_t	nrf_rtc_mock_get_compares	(void);
+
+#endif // __NRF_RTC_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,8 @@
+# RTC time base on top of RTC HAL mock
+SYSTICK_DIR := $(ROOT)/src/drivers/peripheral/systick
+
+TESTS += systick
+
+systick_SRC		:= $(SYSTICK_DIR)/test/test_systick.c $(SYSTICK_DIR)/test/nrf_rtc_mock.c $(SYSTICK_DIR)/systick.c \
+				   $(ROOT)/src/middleware/trace/trace_vcd.c
+systick_CFLAGS	:= -I$(SYSTICK_DIR)/test
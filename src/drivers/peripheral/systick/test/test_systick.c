@@ -0,0 +1,301 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_systick.c
+*@brief     RTC time base host tests
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup SYSTICK_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Reference time is number of RTC ticks since init, thus expected
+* 	millisecond count is ticks * 1000 / 32768 at any moment, no matter
+* 	how late tick interrupt is served.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "test.h"
+#include "nrf_rtc_mock.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	RTC ticks per second
+ */
+#define TEST_SYSTICK_TICKS_PER_S		( 32768ULL )
+
+/**
+ * 	Max distance of compare from counter after ISR. Unit: tick
+ */
+#define TEST_SYSTICK_CC_MAX				( 34UL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Run results
+ */
+static uint32_t gu32_test_isr			= 0;
+static uint32_t gu32_test_bad_ms		= 0;
+static uint32_t gu32_test_bad_us		= 0;
+static uint32_t gu32_test_bad_cc		= 0;
+static uint64_t gu64_test_last_ms		= 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void RTC2_IRQHandler(void);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Millisecond count expected from elapsed ticks
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t test_systick_expected_ms(void)
+{
+	return (( nrf_rtc_mock_get_ticks() * 1000ULL ) / TEST_SYSTICK_TICKS_PER_S );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check time getters at current tick
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_systick_check(void)
+{
+	const uint64_t exp_before	= test_systick_expected_ms();
+	const uint64_t ms64			= systick_get_ms64();
+	const uint32_t ms			= systick_get_ms();
+	const uint64_t us64			= systick_get_us64();
+	const uint64_t exp_after	= test_systick_expected_ms();
+
+	// Counter reads might advance time, result must be within
+	if 	(	( ms64 < exp_before )
+		||	( ms64 > exp_after )
+		||	( ms64 < gu64_test_last_ms )
+		||	((uint32_t) ms64 > ms ))
+	{
+		gu32_test_bad_ms++;
+	}
+
+	if 	(	(( us64 / 1000ULL ) < ms64 )
+		||	(( us64 / 1000ULL ) > exp_after ))
+	{
+		gu32_test_bad_us++;
+	}
+
+	gu64_test_last_ms = ms64;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run RTC with given interrupt latency
+*
+* @param[in]	ticks	- Number of ticks to run
+* @param[in]	latency	- Ticks from event to ISR
+* @param[in]	check	- Check time getters on each tick
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_systick_run(const uint64_t ticks, const uint32_t latency, const bool check)
+{
+	uint32_t wait = 0;
+
+	for ( uint64_t t = 0; t < ticks; t++ )
+	{
+		nrf_rtc_mock_tick();
+
+		if ( true == nrf_rtc_mock_irq_pending())
+		{
+			if ( wait >= latency )
+			{
+				RTC2_IRQHandler();
+				gu32_test_isr++;
+				wait = 0;
+
+				// Next millisecond wake-up must be ahead and close
+				const uint32_t dist = (( nrf_rtc_cc_get( NRF_RTC2, 0 ) - nrf_rtc_counter_get( NRF_RTC2 )) & NRF_RTC_MOCK_MASK );
+
+				if ( dist > TEST_SYSTICK_CC_MAX )
+				{
+					gu32_test_bad_cc++;
+				}
+			}
+			else
+			{
+				wait++;
+			}
+		}
+
+		if ( true == check )
+		{
+			test_systick_check();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear run results
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_systick_clear(void)
+{
+	gu32_test_isr		= 0;
+	gu32_test_bad_ms	= 0;
+	gu32_test_bad_us	= 0;
+	gu32_test_bad_cc	= 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Interrupt on each millisecond boundary
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tick(void)
+{
+	const uint32_t compares = nrf_rtc_mock_get_compares();
+
+	test_systick_clear();
+	test_systick_run( 10ULL * TEST_SYSTICK_TICKS_PER_S, 0, true );
+
+	TEST_ASSERT_EQ( nrf_rtc_mock_get_compares() - compares, 10000 );
+	TEST_ASSERT_EQ( systick_get_ms(), 10000 );
+	TEST_ASSERT_EQ( systick_get_us64(), 10000000 );
+	TEST_ASSERT_EQ( gu32_test_bad_ms, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad_us, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad_cc, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Late interrupt must not lose time nor stop wake-ups
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_late(void)
+{
+	static const uint32_t latency[] = { 1, 31, 32, 33, 100, 1000, 40000 };
+
+	for ( uint32_t i = 0; i < ( sizeof( latency ) / sizeof( latency[0] )); i++ )
+	{
+		test_systick_clear();
+		test_systick_run( 2ULL * TEST_SYSTICK_TICKS_PER_S, latency[i], true );
+
+		TEST_ASSERT_EQ( gu32_test_bad_ms, 0 );
+		TEST_ASSERT_EQ( gu32_test_bad_us, 0 );
+		TEST_ASSERT_EQ( gu32_test_bad_cc, 0 );
+
+		// Wake-ups keep coming, next one at most one millisecond after served
+		TEST_ASSERT( gu32_test_isr >= (( 2UL * TEST_SYSTICK_TICKS_PER_S ) / ( latency[i] + TEST_SYSTICK_CC_MAX + 1UL )));
+	}
+
+	// Back to prompt service, tick on each boundary again
+	test_systick_run( TEST_SYSTICK_TICKS_PER_S, 0, false );
+
+	const uint32_t compares = nrf_rtc_mock_get_compares();
+
+	test_systick_run( TEST_SYSTICK_TICKS_PER_S, 0, false );
+
+	TEST_ASSERT_EQ( nrf_rtc_mock_get_compares() - compares, 1000 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Counter moves while compare is being set
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_race(void)
+{
+	for ( uint32_t step = 1; step <= 3; step++ )
+	{
+		nrf_rtc_mock_set_read_step( step );
+
+		test_systick_clear();
+		test_systick_run( TEST_SYSTICK_TICKS_PER_S, 0, true );
+
+		nrf_rtc_mock_set_read_step( 0 );
+
+		TEST_ASSERT_EQ( gu32_test_bad_ms, 0 );
+		TEST_ASSERT_EQ( gu32_test_bad_us, 0 );
+		TEST_ASSERT( gu32_test_isr > 100U );
+
+		// Wake-ups survive the race
+		const uint32_t compares = nrf_rtc_mock_get_compares();
+
+		test_systick_run( TEST_SYSTICK_TICKS_PER_S, 0, false );
+
+		TEST_ASSERT_EQ( nrf_rtc_mock_get_compares() - compares, 1000 );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		24-bit counter wrap, overflow interrupt served promptly and late
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_wrap(void)
+{
+	const uint64_t to_wrap = ( NRF_RTC_MOCK_MASK + 1ULL ) - ( nrf_rtc_mock_get_ticks() & NRF_RTC_MOCK_MASK );
+
+	// Prompt
+	test_systick_clear();
+	test_systick_run( to_wrap - 100U, 0, false );
+	test_systick_run( 200U, 0, true );
+
+	TEST_ASSERT_EQ( gu32_test_bad_ms, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad_us, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad_cc, 0 );
+	TEST_ASSERT_EQ( systick_get_ms64(), test_systick_expected_ms());
+
+	// Overflow pending while ISR is held off
+	test_systick_clear();
+	test_systick_run( NRF_RTC_MOCK_MASK + 1ULL - 300U, 0, false );
+	test_systick_run( 600U, 250U, true );
+
+	TEST_ASSERT_EQ( gu32_test_bad_ms, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad_us, 0 );
+	TEST_ASSERT_EQ( gu32_test_bad_cc, 0 );
+	TEST_ASSERT_EQ( systick_get_ms64(), test_systick_expected_ms());
+	TEST_ASSERT( nrf_rtc_mock_get_ticks() > ( 2ULL << 24 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	TEST_ASSERT_EQ( systick_init(), eSYSTICK_OK );
+	TEST_ASSERT_EQ( systick_get_ms(), 0 );
+
+	test_tick();
+	test_late();
+	test_race();
+	test_wrap();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,256 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_pwm_mock.c
+*@brief     Legacy PWM driver mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NRF_DRV_PWM_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Single PWM instance in individual load mode. Sequences are kept by
+* 	reference, so later writes to their values are seen.
+*
+* 	Playback is rendered period by period as PWM peripheral plays it:
+* 	each step for "repeats + 1" periods, last step of sequence for
+* 	additional "end_delay" periods. Simple playback plays its sequence,
+* 	complex playback first and second sequence per playback.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+
+#include "nrf_drv_pwm_mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Driver configuration and event handler
+ */
+static nrf_drv_pwm_config_t 	g_pwm_mock_cfg		= {0};
+static nrf_drv_pwm_handler_t	g_pwm_mock_handler	= NULL;
+
+/**
+ * 	Playing sequences, second one is NULL for simple playback
+ */
+static const nrf_pwm_sequence_t * gp_pwm_mock_seq[2] = { NULL, NULL };
+
+/**
+ * 	Playback count and flags
+ */
+static uint16_t	gu16_pwm_mock_count	= 0;
+static uint32_t	gu32_pwm_mock_flags	= 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+ret_code_t nrf_drv_pwm_init(nrf_drv_pwm_t const * const p_instance, nrf_drv_pwm_config_t const * p_config, nrf_drv_pwm_handler_t handler)
+{
+	g_pwm_mock_cfg 		= *p_config;
+	g_pwm_mock_handler	= handler;
+
+	return NRF_SUCCESS;
+}
+
+uint32_t nrf_drv_pwm_simple_playback(nrf_drv_pwm_t const * const p_instance, nrf_pwm_sequence_t const * p_sequence, uint16_t playback_count, uint32_t flags)
+{
+	gp_pwm_mock_seq[0]	= p_sequence;
+	gp_pwm_mock_seq[1]	= NULL;
+	gu16_pwm_mock_count	= playback_count;
+	gu32_pwm_mock_flags	= flags;
+
+	return 0;
+}
+
+uint32_t nrf_drv_pwm_complex_playback(nrf_drv_pwm_t const * const p_instance, nrf_pwm_sequence_t const * p_sequence_0, nrf_pwm_sequence_t const * p_sequence_1, uint16_t playback_count, uint32_t flags)
+{
+	gp_pwm_mock_seq[0]	= p_sequence_0;
+	gp_pwm_mock_seq[1]	= p_sequence_1;
+	gu16_pwm_mock_count	= playback_count;
+	gu32_pwm_mock_flags	= flags;
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Render single sequence
+*
+* @param[in]	p_seq	- Sequence
+* @param[in]	ch		- PWM channel
+* @param[out]	p_out	- Compare value per period
+* @param[in]	size	- Size of output
+* @param[in]	pos		- Output position
+* @return		pos		- Output position after sequence
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t nrf_drv_pwm_mock_render_seq(const nrf_pwm_sequence_t * const p_seq, const uint8_t ch, uint16_t * const p_out, const uint32_t size, uint32_t pos)
+{
+	const uint32_t steps = ( p_seq->length / NRF_PWM_CHANNEL_COUNT );
+
+	for ( uint32_t step = 0; ( step < steps ) && ( pos < size ); step++ )
+	{
+		const uint16_t	val	= p_seq->values.p_raw[( step * NRF_PWM_CHANNEL_COUNT ) + ch];
+		uint32_t		dur	= p_seq->repeats + 1UL;
+
+		if ( step == ( steps - 1UL ))
+		{
+			dur += p_seq->end_delay;
+		}
+
+		for ( uint32_t i = 0; ( i < dur ) && ( pos < size ); i++ )
+		{
+			p_out[pos++] = val;
+		}
+	}
+
+	return pos;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get driver configuration
+*
+* @return		p_cfg	- Configuration passed to init
+*/
+////////////////////////////////////////////////////////////////////////////////
+const nrf_drv_pwm_config_t * nrf_drv_pwm_mock_get_cfg(void)
+{
+	return &g_pwm_mock_cfg;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get compare value of first sequence step
+*
+* @param[in]	ch		- PWM channel
+* @return		compare	- Compare value
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t nrf_drv_pwm_mock_get_compare(const uint8_t ch)
+{
+	const uint16_t * const p_val = gp_pwm_mock_seq[0]->values.p_raw;
+
+	return p_val[ch];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Render playback of channel
+*
+* @note		Looping playback fills whole output, other stops after
+*			playback count.
+*
+* @param[in]	ch		- PWM channel
+* @param[out]	p_out	- Compare value per period
+* @param[in]	size	- Size of output
+* @return		num_of	- Number of rendered periods
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_pwm_mock_render(const uint8_t ch, uint16_t * const p_out, const uint32_t size)
+{
+	const bool	loop	= ( 0UL != ( gu32_pwm_mock_flags & NRFX_PWM_FLAG_LOOP ));
+	uint32_t	pos		= 0;
+
+	for ( uint32_t n = 0; ( pos < size ) && (( true == loop ) || ( n < gu16_pwm_mock_count )); n++ )
+	{
+		pos = nrf_drv_pwm_mock_render_seq( gp_pwm_mock_seq[0], ch, p_out, size, pos );
+
+		if ( NULL != gp_pwm_mock_seq[1] )
+		{
+			pos = nrf_drv_pwm_mock_render_seq( gp_pwm_mock_seq[1], ch, p_out, size, pos );
+		}
+	}
+
+	return pos;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		End of playback
+*
+* @note		Raises finished event unless suppressed, looping playback
+*			raises it at the end of every loop.
+*
+* @return		raised	- True if finished event is raised
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nrf_drv_pwm_mock_finish(void)
+{
+	nrf_drv_pwm_mock_loops_done();
+
+	return nrf_drv_pwm_mock_irq();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set loops done event without serving interrupt
+*
+* @note		Stands for PWM0 ISR held off by critical region.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_drv_pwm_mock_loops_done(void)
+{
+	g_stub_nrf_pwm0.EVENTS_LOOPSDONE = 1UL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Serve PWM0 interrupt
+*
+* @note		As nrfx driver, loops done event is cleared and finished
+*			event raised unless suppressed by playback flags.
+*
+* @return		raised	- True if finished event is raised
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nrf_drv_pwm_mock_irq(void)
+{
+	bool raised = false;
+
+	if ( 0UL != g_stub_nrf_pwm0.EVENTS_LOOPSDONE )
+	{
+		g_stub_nrf_pwm0.EVENTS_LOOPSDONE = 0UL;
+
+		if 	(	( 0UL == ( gu32_pwm_mock_flags & NRFX_PWM_FLAG_NO_EVT_FINISHED ))
+			&&	( NULL != g_pwm_mock_handler ))
+		{
+			raised = true;
+			g_pwm_mock_handler( NRFX_PWM_EVT_FINISHED );
+		}
+	}
+
+	return raised;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get playback flags
+*
+* @return		flags	- Flags of last playback
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_pwm_mock_get_flags(void)
+{
+	return gu32_pwm_mock_flags;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,52 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_pwm_mock.h
+*@brief     Legacy PWM driver mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NRF_DRV_PWM_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Legacy PWM driver mock
+*
+* 	Records configuration and playback of nrfx PWM driver. Compare
+* 	values are read back from playing sequence, as EasyDMA would.
+* 	Playback can be rendered per PWM period and finished on demand.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_PWM_MOCK_H
+#define __NRF_DRV_PWM_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_drv_pwm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+const nrf_drv_pwm_config_t *	nrf_drv_pwm_mock_get_cfg		(void);
+uint16_t						nrf_drv_pwm_mock_get_compare	(const uint8_t ch);
+uint32_t						nrf_drv_pwm_mock_render			(const uint8_t ch, uint16_t * const p_out, const uint32_t size);
+bool							nrf_drv_pwm_mock_finish			(void);
+void							nrf_drv_pwm_mock_loops_done		(void);
+bool							nrf_drv_pwm_mock_irq			(void);
+uint32_t						nrf_drv_pwm_mock_get_flags		(void);
+
+#endif // __NRF_DRV_PWM_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,12 @@
+# Timer PWM duty and gamma table, default and high resolution mode
+TIMER_DIR := $(ROOT)/src/drivers/peripheral/timer
+
+TESTS += timer
+
+timer_SRC	:= $(TIMER_DIR)/test/test_timer.c $(TIMER_DIR)/test/nrf_drv_pwm_mock.c $(TIMER_DIR)/timer.c
+timer_CFLAGS	:= -I$(TIMER_DIR)/test
+
+TESTS += timer_hi_res
+
+timer_hi_res_SRC	:= $(timer_SRC)
+timer_hi_res_CFLAGS	:= -I$(TIMER_DIR)/test -DTIMER_PWM0_HI_RES_EN=1
@@ -0,0 +1,223 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_timer.c
+*@brief     Timer PWM duty and gamma table host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup TIMER_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Timer runs on top of legacy PWM driver mock, compare values are read
+* 	back from playing sequence. Outputs are active low, thus LED on time
+* 	is period minus compare value.
+*
+* 	"timer_set_pwm()" must stay linear. Brightness of "timer_set_pwm_fix()"
+* 	must be monotonic over whole input range, start at 0, end at period,
+* 	be non-zero for any non-zero input and follow CIE 1931 lightness
+* 	within one count.
+*
+* 	Built for default and for high resolution mode.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <math.h>
+
+#include "test.h"
+#include "nrf_drv_pwm_mock.h"
+#include "drivers/peripheral/timer/timer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Channel under test
+ */
+#define TEST_TIMER_CH				( eTIMER_PWM0_CH2 )
+
+/**
+ * 	Timer mode, default as in "timer.c"
+ */
+#ifndef TIMER_PWM0_HI_RES_EN
+	#define TIMER_PWM0_HI_RES_EN	( 0 )
+#endif
+
+/**
+ * 	Gamma table index resolution
+ *
+ * 	Unit: bit
+ */
+#if ( 1 == TIMER_PWM0_HI_RES_EN )
+	#define TEST_TIMER_GAMMA_BITS	( 10U )
+#else
+	#define TEST_TIMER_GAMMA_BITS	( 8U )
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	PWM period. Unit: count
+ */
+static uint32_t gu32_test_period = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get LED on time of channel under test
+*
+* @return		on time - Unit: count
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_timer_on(void)
+{
+	return ( gu32_test_period - nrf_drv_pwm_mock_get_compare( TEST_TIMER_CH ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init_timer(void)
+{
+	bool is_init = false;
+
+	TEST_ASSERT_EQ( timer_set_pwm_fix( TEST_TIMER_CH, 0 ), eTIMER_ERROR );
+	TEST_ASSERT_EQ( test_assert_hits(), 1 );
+
+	TEST_ASSERT_EQ( timer_init(), eTIMER_OK );
+	TEST_ASSERT_EQ( timer_is_init( &is_init ), eTIMER_OK );
+	TEST_ASSERT( true == is_init );
+
+	gu32_test_period = nrf_drv_pwm_mock_get_cfg()->top_value;
+
+	#if ( 1 == TIMER_PWM0_HI_RES_EN )
+		TEST_ASSERT_EQ( gu32_test_period, 16000 );
+		TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_cfg()->base_clock, NRF_PWM_CLK_16MHz );
+	#else
+		TEST_ASSERT_EQ( gu32_test_period, 250 );
+		TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_cfg()->base_clock, NRF_PWM_CLK_1MHz );
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Linear duty
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_linear(void)
+{
+	for ( uint32_t i = 0; i <= 1000; i++ )
+	{
+		const float32_t duty = (float32_t) i / 1000.0f;
+
+		TEST_ASSERT_EQ( timer_set_pwm( TEST_TIMER_CH, duty ), eTIMER_OK );
+		TEST_ASSERT_EQ( nrf_drv_pwm_mock_get_compare( TEST_TIMER_CH ), (uint16_t)( gu32_test_period * ( 1.0f - duty )));
+	}
+
+	TEST_ASSERT_EQ( timer_set_pwm( TEST_TIMER_CH, 0.0f ), eTIMER_OK );
+	TEST_ASSERT_EQ( test_timer_on(), 0 );
+	TEST_ASSERT_EQ( timer_set_pwm( TEST_TIMER_CH, 0.5f ), eTIMER_OK );
+	TEST_ASSERT_EQ( test_timer_on(), gu32_test_period / 2U );
+	TEST_ASSERT_EQ( timer_set_pwm( TEST_TIMER_CH, 1.0f ), eTIMER_OK );
+	TEST_ASSERT_EQ( test_timer_on(), gu32_test_period );
+
+	TEST_ASSERT_EQ( timer_set_pwm( TEST_TIMER_CH, 1.01f ), eTIMER_ERROR );
+	TEST_ASSERT_EQ( timer_set_pwm( TEST_TIMER_CH, -0.01f ), eTIMER_ERROR );
+	TEST_ASSERT_EQ( test_timer_on(), gu32_test_period );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Perceptual brightness
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_gamma(void)
+{
+	uint32_t prev 		= 0;
+	uint32_t levels		= 1;
+	uint32_t raised		= 0;
+
+	// Endpoints
+	TEST_ASSERT_EQ( timer_set_pwm_fix( TEST_TIMER_CH, 0 ), eTIMER_OK );
+	TEST_ASSERT_EQ( test_timer_on(), 0 );
+	TEST_ASSERT_EQ( timer_set_pwm_fix( TEST_TIMER_CH, TIMER_PWM_FIX_MAX ), eTIMER_OK );
+	TEST_ASSERT_EQ( test_timer_on(), gu32_test_period );
+
+	for ( uint32_t b = 1; b <= TIMER_PWM_FIX_MAX; b++ )
+	{
+		uint32_t on = 0;
+
+		TEST_ASSERT_EQ( timer_set_pwm_fix( TEST_TIMER_CH, (uint16_t) b ), eTIMER_OK );
+		on = test_timer_on();
+
+		// Monotonic and never dark
+		TEST_ASSERT( on >= prev );
+		TEST_ASSERT( on >= 1U );
+		TEST_ASSERT( on <= gu32_test_period );
+
+		if ( on != prev )
+		{
+			levels++;
+		}
+
+		prev = on;
+	}
+
+	// Table entries against CIE 1931 lightness
+	for ( uint32_t idx = 1; idx < ( 1UL << TEST_TIMER_GAMMA_BITS ); idx++ )
+	{
+		const double	l	= 100.0 * (double) idx / (double)(( 1UL << TEST_TIMER_GAMMA_BITS ) - 1UL );
+		const double	y	= ( l <= 8.0 ) ? ( l / 903.3 ) : pow(( l + 16.0 ) / 116.0, 3.0 );
+		const double	exp	= y * (double) gu32_test_period;
+
+		TEST_ASSERT_EQ( timer_set_pwm_fix( TEST_TIMER_CH, (uint16_t)( idx << ( 16U - TEST_TIMER_GAMMA_BITS ))), eTIMER_OK );
+
+		if ( exp < 0.5 )
+		{
+			TEST_ASSERT_EQ( test_timer_on(), 1 );
+			raised++;
+		}
+		else
+		{
+			TEST_ASSERT( fabs( (double) test_timer_on() - exp ) <= 1.0 );
+		}
+	}
+
+	TEST_BENCH( "%u counts: %u distinct levels, %u lowest entries raised to 1 count",
+			(unsigned) gu32_test_period, (unsigned) levels, (unsigned) raised );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_init_timer();
+	test_linear();
+	test_gamma();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 1 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
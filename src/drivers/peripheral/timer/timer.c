@@ -25,6 +25,7 @@
 #include "timer.h"
 #include "nrf_gpio.h"
 #include "nrf_drv_pwm.h"
+#include "app_util_platform.h"
 
 #include "pin_mapper.h"
 #include "project_config.h"
@@ -34,27 +35,170 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- *  Timer PWM0 PWM output frequency
+ *  Enable/Disable PWM0 high resolution mode
  *
- *  Valid range @1MHz base freq: 500 - 5000Hz
+ *  @note   High resolution mode trades PWM frequency for bit depth. Base
+ *          clock is raised to 16 MHz and output frequency lowered to 1 kHz,
+ *          giving 16000 counts per period instead of 250.
+ */
+#ifndef TIMER_PWM0_HI_RES_EN
+    #define TIMER_PWM0_HI_RES_EN        ( 0 )
+#endif
+
+#if ( 1 == TIMER_PWM0_HI_RES_EN )
+
+    /**
+     *  Timer PWM0 PWM output frequency
+     *
+     *  Unit: Hz
+     */
+    #define TIMER_PWM0_FREQ_HZ          ( 1000 )
+
+    /**
+     *  Timer PWM0 Base frequency
+     *
+     *  Unit: Hz
+     */
+    #define TIMER_PWM0_BASE_FREQ_HZ     ( 16000000UL )
+
+    /**
+     *  Gamma table index resolution
+     *
+     *  Unit: bit
+     */
+    #define TIMER_PWM0_GAMMA_BITS       ( 10U )
+
+#else
+
+    /**
+     *  Timer PWM0 PWM output frequency
+     *
+     *  Valid range @1MHz base freq: 500 - 5000Hz
+     *
+     *  Unit: Hz
+     */
+    #define TIMER_PWM0_FREQ_HZ          ( 4000 )
+
+    /**
+     *  Timer PWM0 Base frequency
+     *
+     *  Unit: Hz
+     */
+    #define TIMER_PWM0_BASE_FREQ_HZ     ( 1000000UL )
+
+    /**
+     *  Gamma table index resolution
+     *
+     *  Unit: bit
+     */
+    #define TIMER_PWM0_GAMMA_BITS       ( 8U )
+
+#endif
+
+/**
+ *  Timer PWM0 base clock, derived from base frequency
+ */
+#if   ( 16000000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_16MHz )
+#elif ( 8000000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_8MHz )
+#elif ( 4000000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_4MHz )
+#elif ( 2000000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_2MHz )
+#elif ( 1000000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_1MHz )
+#elif ( 500000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_500kHz )
+#elif ( 250000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_250kHz )
+#elif ( 125000UL == TIMER_PWM0_BASE_FREQ_HZ )
+    #define TIMER_PWM0_BASE_CLK         ( NRF_PWM_CLK_125kHz )
+#else
+    #error "Unsupported PWM0 base frequency! Adjust <TIMER_PWM0_BASE_FREQ_HZ> macro inside timer.c file!"
+#endif
+
+/**
+ *      Calculate timer period
+ */
+#define TIMER_PWM0_PERIOD           ((uint16_t)( TIMER_PWM0_BASE_FREQ_HZ / TIMER_PWM0_FREQ_HZ ))
+
+/**
+ *  Invalid configuration catcher
  *
- *  Unit: Hz
+ *  @note   PWM COUNTERTOP is 15-bit register.
+ */
+#if (( TIMER_PWM0_BASE_FREQ_HZ / TIMER_PWM0_FREQ_HZ ) < 3 ) || (( TIMER_PWM0_BASE_FREQ_HZ / TIMER_PWM0_FREQ_HZ ) > 32767 )
+    #error "PWM0 period out of range! Adjust <TIMER_PWM0_FREQ_HZ> macro inside timer.c file!"
+#endif
+
+/**
+ *  Gamma table size and max index
  */
-#define TIMER_PWM0_FREQ_HZ          ( 4000 )
+#define TIMER_GAMMA_SIZE            ( 1UL << TIMER_PWM0_GAMMA_BITS )
+#define TIMER_GAMMA_IDX_MAX         ((uint64_t)( TIMER_GAMMA_SIZE - 1UL ))
 
 /**
- *  Timer PWM0 Base frequency
+ *  Perceptual (CIE 1931 lightness) correction of gamma table entry
  *
- * @note   Set this value based on Timer0 cfg ".base_clock"
+ *  Index "b" maps to lightness L = 100 * b / IDX_MAX, relative luminance is:
+ *      Y = L / 903.3                   for L <= 8
+ *      Y = (( L + 16 ) / 116 )^3       for L > 8
  *
- *  Unit: Hz
+ *  Both are evaluated in integer arithmetic at compile time and scaled to
+ *  PWM0 period. Cubic term is reduced by 4 (25/29 instead of 100/116) so
+ *  that it fits 64-bit for any valid period.
  */
-#define TIMER_PWM0_BASE_FREQ_HZ     ( 1000000UL )  
+#define TIMER_GAMMA_N(b)            ((uint64_t)(b) * 25ULL + 4ULL * TIMER_GAMMA_IDX_MAX )
+#define TIMER_GAMMA_D               ( 29ULL * TIMER_GAMMA_IDX_MAX )
+#define TIMER_GAMMA_D3              ( TIMER_GAMMA_D * TIMER_GAMMA_D * TIMER_GAMMA_D )
+#define TIMER_GAMMA_LIN_D           ( 9033ULL * TIMER_GAMMA_IDX_MAX )
+
+#define TIMER_GAMMA_Y(b)                                                                                            \
+    (((((uint64_t)(b) * 100ULL ) <= ( 8ULL * TIMER_GAMMA_IDX_MAX ))                                                 \
+    ? ((((uint64_t)(b) * 1000ULL * TIMER_PWM0_PERIOD ) + ( TIMER_GAMMA_LIN_D / 2ULL )) / TIMER_GAMMA_LIN_D )       \
+    : ((( TIMER_GAMMA_N(b) * TIMER_GAMMA_N(b) * TIMER_GAMMA_N(b) * TIMER_PWM0_PERIOD ) + ( TIMER_GAMMA_D3 / 2ULL )) / TIMER_GAMMA_D3 )))
 
 /**
- *      Calculate timer period
+ *  Gamma table entry
+ *
+ *  @note   With short period lowest entries round to 0 counts (first 4 at
+ *          250 counts), so any non-zero brightness gets at least 1 count
+ *          and LED does not stay dark at the bottom of a fade.
  */
-#define TIMER_PWM0_PERIOD           ((uint16_t)( TIMER_PWM0_BASE_FREQ_HZ / TIMER_PWM0_FREQ_HZ ))
+#define TIMER_GAMMA(b)              ((uint16_t)(( 0ULL == (uint64_t)(b) ) ? 0ULL : (( TIMER_GAMMA_Y(b) < 1ULL ) ? 1ULL : TIMER_GAMMA_Y(b) )))
+
+/**
+ *  Gamma table entries expansion
+ */
+#define TIMER_GAMMA_4(b)            TIMER_GAMMA(b),      TIMER_GAMMA((b)+1),   TIMER_GAMMA((b)+2),    TIMER_GAMMA((b)+3)
+#define TIMER_GAMMA_16(b)           TIMER_GAMMA_4(b),    TIMER_GAMMA_4((b)+4), TIMER_GAMMA_4((b)+8),  TIMER_GAMMA_4((b)+12)
+#define TIMER_GAMMA_64(b)           TIMER_GAMMA_16(b),   TIMER_GAMMA_16((b)+16), TIMER_GAMMA_16((b)+32), TIMER_GAMMA_16((b)+48)
+#define TIMER_GAMMA_256(b)          TIMER_GAMMA_64(b),   TIMER_GAMMA_64((b)+64), TIMER_GAMMA_64((b)+128), TIMER_GAMMA_64((b)+192)
+
+#if (( 8U != TIMER_PWM0_GAMMA_BITS ) && ( 10U != TIMER_PWM0_GAMMA_BITS ))
+    #error "Gamma table supports 8 or 10 bit index! Adjust <TIMER_PWM0_GAMMA_BITS> macro inside timer.c file!"
+#endif
+
+/**
+ *  Regular and looping sequence playback flags
+ *
+ *  @note   Looping playback must not signal finished event, otherwise
+ *          PWM0 interrupt fires at the end of every loop.
+ */
+#define TIMER_PWM0_FLAGS_LOOP       ( NRFX_PWM_FLAG_LOOP | NRFX_PWM_FLAG_NO_EVT_FINISHED )
+
+/**
+ *  Max step and end delay of sequence ramp, 24-bit REFRESH and ENDDELAY
+ *
+ *  Unit: PWM period
+ */
+#define TIMER_PWM0_SEQ_DUR_MAX      ( 0xFFFFFFUL )
+
+/**
+ *  No channel played by sequence
+ */
+#define TIMER_PWM0_SEQ_NONE         ( eTIMER_CH_NUM_OF )
 
 /**
  * 	Timer configuration table structure
@@ -83,6 +227,22 @@ static bool gb_is_init = false;
  */
 static volatile uint16_t gu16_compare_val[eTIMER_CH_NUM_OF] = {0};
 
+/**
+ *  Perceptual brightness to PWM0 compare table
+ *
+ * @note    Monotonic non-decreasing, first entry 0, last entry period.
+ */
+static const uint16_t gu16_timer_gamma[TIMER_GAMMA_SIZE] =
+{
+    TIMER_GAMMA_256( 0 ),
+
+#if ( 10U == TIMER_PWM0_GAMMA_BITS )
+    TIMER_GAMMA_256( 256 ),
+    TIMER_GAMMA_256( 512 ),
+    TIMER_GAMMA_256( 768 ),
+#endif
+};
+
 /**
  *  Timer PWM0 instance
  */
@@ -99,6 +259,29 @@ static nrf_pwm_sequence_t g_pwm0_sequence =
     .end_delay              = 0
 };
 
+/**
+ *  Sequence playback compare values, step per row
+ *
+ * @note    Must have static storage duration! Channels not played by
+ *          sequence hold their regular compare value.
+ */
+static volatile uint16_t gu16_timer_seq_val[2][TIMER_PWM_RAMP_MAX_STEPS][eTIMER_CH_NUM_OF] = {{{0}}};
+
+/**
+ *  Timer PWM0 ramp sequences
+ */
+static nrf_pwm_sequence_t g_pwm0_seq[2] =
+{
+    { .values.p_individual = (nrf_pwm_values_individual_t*) &gu16_timer_seq_val[0], .length = 0, .repeats = 0, .end_delay = 0 },
+    { .values.p_individual = (nrf_pwm_values_individual_t*) &gu16_timer_seq_val[1], .length = 0, .repeats = 0, .end_delay = 0 },
+};
+
+/**
+ *  Channel played by sequence, TIMER_PWM0_SEQ_NONE when regular
+ *  sequence is playing
+ */
+static volatile timer_ch_t g_timer_seq_ch = TIMER_PWM0_SEQ_NONE;
+
 /**
  *  Timer configuraiton table
  */
@@ -125,7 +308,13 @@ static const timer_tim_ch_t g_timer_cfg[eTIMER_CH_NUM_OF] =
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static timer_status_t timer_pwm0_init(void);
+static timer_status_t 	timer_pwm0_init			(void);
+static void 			timer_pwm0_evt_hndl		(nrfx_pwm_evt_type_t event_type);
+static void 			timer_pwm0_regular		(void);
+static void 			timer_pwm0_set_compare	(const timer_ch_t ch, const uint16_t compare);
+static uint16_t 		timer_pwm0_gamma		(const uint16_t brightness);
+static bool 			timer_pwm0_ramp_check	(const timer_pwm_ramp_t * const p_ramp);
+static uint16_t 		timer_pwm0_ramp_fill	(const uint32_t seq, const timer_ch_t ch, const timer_pwm_ramp_t * const p_ramp);
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -157,7 +346,7 @@ static timer_status_t timer_pwm0_init(void)
         },
 
         .irq_priority   = APP_IRQ_PRIORITY_LOWEST,
-        .base_clock     = NRF_PWM_CLK_1MHz,
+        .base_clock     = TIMER_PWM0_BASE_CLK,
         .count_mode     = NRF_PWM_MODE_UP,
         .top_value      = TIMER_PWM0_PERIOD,
         .load_mode      = NRF_PWM_LOAD_INDIVIDUAL,
@@ -165,17 +354,156 @@ static timer_status_t timer_pwm0_init(void)
     };
 
     // Init timer 0
-    if ( NRF_SUCCESS != nrf_drv_pwm_init( &gh_timer_pwm_0, &timer_0_cfg, NULL ))
+    if ( NRF_SUCCESS != nrf_drv_pwm_init( &gh_timer_pwm_0, &timer_0_cfg, timer_pwm0_evt_hndl ))
     {
         status = eTIMER_ERROR;
     }
 
     // Setup sequence
-    nrf_drv_pwm_simple_playback( &gh_timer_pwm_0, &g_pwm0_sequence, 1, NRFX_PWM_FLAG_LOOP );
+    nrf_drv_pwm_simple_playback( &gh_timer_pwm_0, &g_pwm0_sequence, 1, TIMER_PWM0_FLAGS_LOOP );
 
     return status;  
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		PWM0 event handler
+*
+* @note		Finished event is raised only by ramp sequence played once.
+*			Output holds last step, regular sequence continues with it.
+*
+* @param[in]	event_type	- PWM event
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void timer_pwm0_evt_hndl(nrfx_pwm_evt_type_t event_type)
+{
+    if ( NRFX_PWM_EVT_FINISHED == event_type )
+    {
+        timer_pwm0_regular();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Play regular sequence
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void timer_pwm0_regular(void)
+{
+    g_timer_seq_ch = TIMER_PWM0_SEQ_NONE;
+
+    nrf_drv_pwm_simple_playback( &gh_timer_pwm_0, &g_pwm0_sequence, 1, TIMER_PWM0_FLAGS_LOOP );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set channel compare value
+*
+* @note		Write to channel of ramp sequence takes channel back to
+*			regular sequence. Other channels are written to ramp
+*			sequence as well, EasyDMA picks them up on next step.
+*
+* @param[in] 	ch 		- Channel number
+* @param[in] 	compare	- Compare value
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void timer_pwm0_set_compare(const timer_ch_t ch, const uint16_t compare)
+{
+    gu16_compare_val[ch] = compare;
+
+    // Ramp sequence may finish in PWM0 ISR meanwhile
+    CRITICAL_REGION_ENTER();
+
+    if ( ch == g_timer_seq_ch )
+    {
+        timer_pwm0_regular();
+    }
+    else if ( TIMER_PWM0_SEQ_NONE != g_timer_seq_ch )
+    {
+        for ( uint32_t step = 0; step < TIMER_PWM_RAMP_MAX_STEPS; step++ )
+        {
+            gu16_timer_seq_val[0][step][ch] = compare;
+            gu16_timer_seq_val[1][step][ch] = compare;
+        }
+    }
+    else
+    {
+        // No action
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Brightness to compare value
+*
+* @note		Brightness is scaled to gamma table index and rounded up, so
+*			non-zero brightness never maps to first entry.
+*
+* @param[in] 	brightness 	- Brightness in range 0-TIMER_PWM_FIX_MAX
+* @return 		compare		- Compare value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t timer_pwm0_gamma(const uint16_t brightness)
+{
+    const uint32_t idx = ((( (uint32_t) brightness * (uint32_t) TIMER_GAMMA_IDX_MAX ) + ( TIMER_PWM_FIX_MAX - 1UL )) / TIMER_PWM_FIX_MAX );
+
+    return (uint16_t)( TIMER_PWM0_PERIOD - gu16_timer_gamma[idx] );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check ramp fits PWM sequence
+*
+* @param[in] 	p_ramp 	- Ramp
+* @return 		valid 	- True if ramp can be played
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool timer_pwm0_ramp_check(const timer_pwm_ramp_t * const p_ramp)
+{
+    return  (   ( NULL != p_ramp )
+            &&  ( NULL != p_ramp->p_brightness )
+            &&  ( p_ramp->num_of > 0U )
+            &&  ( p_ramp->num_of <= TIMER_PWM_RAMP_MAX_STEPS )
+            &&  ( p_ramp->step > 0UL )
+            &&  (( p_ramp->step - 1UL ) <= TIMER_PWM0_SEQ_DUR_MAX )
+            &&  ( p_ramp->end_delay <= TIMER_PWM0_SEQ_DUR_MAX ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fill ramp sequence
+*
+* @param[in] 	seq 	- Sequence number, 0 or 1
+* @param[in] 	ch 		- Channel played by ramp
+* @param[in] 	p_ramp 	- Ramp
+* @return 		last	- Compare value of last step
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t timer_pwm0_ramp_fill(const uint32_t seq, const timer_ch_t ch, const timer_pwm_ramp_t * const p_ramp)
+{
+    for ( uint32_t step = 0; step < p_ramp->num_of; step++ )
+    {
+        for ( uint32_t c = 0; c < eTIMER_CH_NUM_OF; c++ )
+        {
+            gu16_timer_seq_val[seq][step][c] = gu16_compare_val[c];
+        }
+
+        gu16_timer_seq_val[seq][step][ch] = timer_pwm0_gamma( p_ramp->p_brightness[step] );
+    }
+
+    g_pwm0_seq[seq].length      = (uint16_t)( p_ramp->num_of * eTIMER_CH_NUM_OF );
+    g_pwm0_seq[seq].repeats     = ( p_ramp->step - 1UL );
+    g_pwm0_seq[seq].end_delay   = p_ramp->end_delay;
+
+    return gu16_timer_seq_val[seq][ p_ramp->num_of - 1U ][ch];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /*!
  * @} <!-- END GROUP -->
@@ -245,6 +573,9 @@ timer_status_t timer_is_init(bool * const p_is_init)
 /**
 *		Set timer PWM duty
 *
+* @note		Duty is linear. For perceptual brightness use
+*			"timer_set_pwm_fix".
+*
 * @param[in] 	ch 		- Channel number
 * @param[in] 	duty 	- Duty cycle in range 0.0-1.0
 * @return 		status 	- Status of operation
@@ -262,7 +593,7 @@ timer_status_t timer_set_pwm(const timer_ch_t ch, const float32_t duty)
     {
         if (( duty >= 0.0f ) && ( duty <= 1.0f ))
 		{
-            gu16_compare_val[ch] = (uint16_t)( TIMER_PWM0_PERIOD * ( 1.0f - duty ));
+            timer_pwm0_set_compare( ch, (uint16_t)( TIMER_PWM0_PERIOD * ( 1.0f - duty )));
 		}
 		else
 		{
@@ -276,6 +607,187 @@ timer_status_t timer_set_pwm(const timer_ch_t ch, const float32_t duty)
 
     return status;   
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set timer PWM brightness in fixed-point
+*
+* @note		Brightness is mapped to compare value via compile-time
+*			perceptual (gamma) table, thus no float math is needed.
+*
+* @param[in] 	ch 			- Channel number
+* @param[in] 	brightness 	- Brightness in range 0-TIMER_PWM_FIX_MAX
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+timer_status_t timer_set_pwm_fix(const timer_ch_t ch, const uint16_t brightness)
+{
+    timer_status_t status = eTIMER_OK;
+
+    PROJECT_CONFIG_ASSERT( true == gb_is_init );
+    PROJECT_CONFIG_ASSERT( ch < eTIMER_CH_NUM_OF );
+
+    if  (   ( true == gb_is_init )
+        &&  ( ch < eTIMER_CH_NUM_OF ))
+    {
+        timer_pwm0_set_compare( ch, timer_pwm0_gamma( brightness ));
+    }
+    else
+    {
+        status = eTIMER_ERROR;
+    }
+
+    return status;   
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get PWM output frequency
+*
+* @return 		freq - PWM frequency, step of ramp sequence - Unit: Hz
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t timer_get_pwm_freq(void)
+{
+    return TIMER_PWM0_FREQ_HZ;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Play brightness ramps on channel by PWM sequences
+*
+* @note		Ramps are converted to compare values once and played by
+*			PWM peripheral, no CPU is needed afterwards. First ramp is
+*			followed by second one, if given. Looping playback runs until
+*			stopped, otherwise channel continues with last step.
+*
+*			Only single channel can be played at a time, other channels
+*			keep their regular compare values.
+*
+* @param[in] 	ch 			- Channel number
+* @param[in] 	p_ramp_0 	- First ramp
+* @param[in] 	p_ramp_1 	- Second ramp, can be NULL
+* @param[in] 	loop 		- Repeat ramps until stopped
+* @return 		status 		- Status of operation, error if other channel is playing
+*/
+////////////////////////////////////////////////////////////////////////////////
+timer_status_t timer_pwm_seq_start(const timer_ch_t ch, const timer_pwm_ramp_t * const p_ramp_0, const timer_pwm_ramp_t * const p_ramp_1, const bool loop)
+{
+    timer_status_t status = eTIMER_OK;
+
+    PROJECT_CONFIG_ASSERT( true == gb_is_init );
+    PROJECT_CONFIG_ASSERT( ch < eTIMER_CH_NUM_OF );
+
+    if  (   ( true == gb_is_init )
+        &&  ( ch < eTIMER_CH_NUM_OF )
+        &&  ( true == timer_pwm0_ramp_check( p_ramp_0 ))
+        &&  (( NULL == p_ramp_1 ) || ( true == timer_pwm0_ramp_check( p_ramp_1 ))))
+    {
+        // Ownership check and stop must not interleave with PWM0 ISR
+        CRITICAL_REGION_ENTER();
+
+        if ( ch == g_timer_seq_ch )
+        {
+            // Sequence buffers are about to be rewritten
+            timer_pwm0_regular();
+        }
+        else if ( TIMER_PWM0_SEQ_NONE != g_timer_seq_ch )
+        {
+            status = eTIMER_ERROR;
+        }
+        else
+        {
+            // No action
+        }
+
+        CRITICAL_REGION_EXIT();
+    }
+    else
+    {
+        status = eTIMER_ERROR;
+    }
+
+    // Only main context claims sequence, ISR can only release it
+    if ( eTIMER_OK == status )
+    {
+        const uint32_t flags = ( true == loop ) ? TIMER_PWM0_FLAGS_LOOP : 0UL;
+
+        // Channel continues with last step
+        gu16_compare_val[ch] = timer_pwm0_ramp_fill( 0, ch, p_ramp_0 );
+
+        if ( NULL != p_ramp_1 )
+        {
+            gu16_compare_val[ch] = timer_pwm0_ramp_fill( 1, ch, p_ramp_1 );
+        }
+
+        CRITICAL_REGION_ENTER();
+
+        // Loops done of stopped ramp would finish new one in ISR
+        nrf_pwm_event_clear( gh_timer_pwm_0.p_registers, NRF_PWM_EVENT_LOOPSDONE );
+
+        g_timer_seq_ch = ch;
+
+        if ( NULL != p_ramp_1 )
+        {
+            nrf_drv_pwm_complex_playback( &gh_timer_pwm_0, &g_pwm0_seq[0], &g_pwm0_seq[1], 1, flags );
+        }
+        else
+        {
+            nrf_drv_pwm_simple_playback( &gh_timer_pwm_0, &g_pwm0_seq[0], 1, flags );
+        }
+
+        CRITICAL_REGION_EXIT();
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop ramp sequence
+*
+* @note		Channel is set to last step of ramps.
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+timer_status_t timer_pwm_seq_stop(void)
+{
+    timer_status_t status = eTIMER_OK;
+
+    PROJECT_CONFIG_ASSERT( true == gb_is_init );
+
+    if ( true == gb_is_init )
+    {
+        CRITICAL_REGION_ENTER();
+
+        if ( TIMER_PWM0_SEQ_NONE != g_timer_seq_ch )
+        {
+            timer_pwm0_regular();
+        }
+
+        CRITICAL_REGION_EXIT();
+    }
+    else
+    {
+        status = eTIMER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get if channel is played by ramp sequence
+*
+* @param[in] 	ch 			- Channel number
+* @return 		is_active	- True if channel is played by ramp sequence
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool timer_pwm_seq_is_active(const timer_ch_t ch)
+{
+    return ( ch == g_timer_seq_ch );
+}
     
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -52,6 +52,30 @@ typedef enum
 	eTIMER_CH_NUM_OF,
 } timer_ch_t;
 
+/**
+ * 	Full scale of fixed-point PWM brightness
+ */
+#define TIMER_PWM_FIX_MAX       ( 0xFFFFU )
+
+/**
+ * 	Max number of steps of PWM sequence ramp
+ */
+#define TIMER_PWM_RAMP_MAX_STEPS	( 64U )
+
+/**
+ * 	PWM sequence ramp
+ *
+ * @note	Each step is played for "step" PWM periods, last step for
+ * 			additional "end_delay" PWM periods.
+ */
+typedef struct
+{
+	const uint16_t *	p_brightness;	/**<Brightness of steps, 0-TIMER_PWM_FIX_MAX */
+	uint16_t			num_of;			/**<Number of steps */
+	uint32_t			step;			/**<Step duration - Unit: PWM period */
+	uint32_t			end_delay;		/**<Extra duration of last step - Unit: PWM period */
+} timer_pwm_ramp_t;
+
 /**
  *     32-bit floating point definition
  */
@@ -63,6 +87,11 @@ typedef float float32_t;
 timer_status_t 	timer_init			(void);
 timer_status_t 	timer_is_init		(bool * const p_is_init);
 timer_status_t 	timer_set_pwm		(const timer_ch_t ch, const float32_t duty);
+timer_status_t 	timer_set_pwm_fix	(const timer_ch_t ch, const uint16_t brightness);
+uint32_t		timer_get_pwm_freq	(void);
+timer_status_t 	timer_pwm_seq_start	(const timer_ch_t ch, const timer_pwm_ramp_t * const p_ramp_0, const timer_pwm_ramp_t * const p_ramp_1, const bool loop);
+timer_status_t 	timer_pwm_seq_stop	(void);
+bool			timer_pwm_seq_is_active	(const timer_ch_t ch);
 
 #endif // __TIMER_H
 
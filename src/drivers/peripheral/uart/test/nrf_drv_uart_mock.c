@@ -0,0 +1,325 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_uart_mock.c
+*@brief     Legacy UART driver mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NRF_DRV_UART_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Reception: first "nrf_drv_uart_rx()" sets active block, second one
+* 	secondary block, third one is refused as busy. Full active block
+* 	is reported and secondary becomes active. Abort reports active
+* 	block with bytes received so far and drops both blocks.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "nrf_drv_uart_mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of captured transmission
+ *
+ * 	Unit: byte
+ */
+#define NRF_DRV_UART_MOCK_TX_SIZE			( 64UL * 1024UL )
+
+/**
+ * 	Instance state
+ */
+typedef struct
+{
+	nrf_uart_event_handler_t	handler;
+
+	uint8_t *					p_rx_active;
+	uint8_t						rx_active_len;
+	uint8_t						rx_cnt;
+	uint8_t *					p_rx_next;
+	uint8_t						rx_next_len;
+
+	const uint8_t *				p_tx;
+	uint8_t						tx_len;
+
+	uint8_t						tx_out[NRF_DRV_UART_MOCK_TX_SIZE];
+	uint32_t					tx_out_len;
+
+	uint32_t					irq;
+} nrf_drv_uart_mock_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Register blocks of instances
+ */
+NRF_UARTE_Type g_nrf_drv_uart_stub_reg[NRF_DRV_UART_STUB_NUM_OF];
+
+/**
+ * 	Instances
+ */
+static nrf_drv_uart_mock_t g_nrf_drv_uart_mock[NRF_DRV_UART_STUB_NUM_OF];
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void nrf_drv_uart_mock_event(nrf_drv_uart_mock_t * const p_m, const nrf_drv_uart_evt_type_t type, uint8_t * const p_data, const uint32_t bytes);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Raise driver event, counted as interrupt
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nrf_drv_uart_mock_event(nrf_drv_uart_mock_t * const p_m, const nrf_drv_uart_evt_type_t type, uint8_t * const p_data, const uint32_t bytes)
+{
+	nrf_drv_uart_event_t event = { .type = type };
+
+	event.data.rxtx.p_data	= p_data;
+	event.data.rxtx.bytes	= bytes;
+
+	p_m->irq++;
+	p_m->handler( &event, NULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Driver API
+*/
+////////////////////////////////////////////////////////////////////////////////
+ret_code_t nrf_drv_uart_init(const nrf_drv_uart_t * p_instance, const nrf_drv_uart_config_t * p_config, nrf_uart_event_handler_t event_handler)
+{
+	g_nrf_drv_uart_mock[p_instance->inst_idx].handler = event_handler;
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_uart_tx(const nrf_drv_uart_t * p_instance, const uint8_t * const p_data, uint8_t length)
+{
+	nrf_drv_uart_mock_t * const p_m		= &g_nrf_drv_uart_mock[p_instance->inst_idx];
+	ret_code_t					status	= NRF_SUCCESS;
+
+	if ( NULL == p_m->p_tx )
+	{
+		p_m->p_tx	= p_data;
+		p_m->tx_len	= length;
+	}
+	else
+	{
+		status = NRF_ERROR_BUSY;
+	}
+
+	return status;
+}
+
+ret_code_t nrf_drv_uart_rx(const nrf_drv_uart_t * p_instance, uint8_t * p_data, uint8_t length)
+{
+	nrf_drv_uart_mock_t * const p_m		= &g_nrf_drv_uart_mock[p_instance->inst_idx];
+	ret_code_t					status	= NRF_SUCCESS;
+
+	if ( NULL == p_m->p_rx_active )
+	{
+		p_m->p_rx_active	= p_data;
+		p_m->rx_active_len	= length;
+		p_m->rx_cnt			= 0;
+	}
+	else if ( NULL == p_m->p_rx_next )
+	{
+		p_m->p_rx_next		= p_data;
+		p_m->rx_next_len	= length;
+	}
+	else
+	{
+		status = NRF_ERROR_BUSY;
+	}
+
+	return status;
+}
+
+bool nrf_drv_uart_tx_in_progress(const nrf_drv_uart_t * p_instance)
+{
+	return ( NULL != g_nrf_drv_uart_mock[p_instance->inst_idx].p_tx );
+}
+
+void nrf_drv_uart_rx_abort(const nrf_drv_uart_t * p_instance)
+{
+	nrf_drv_uart_mock_t * const p_m		= &g_nrf_drv_uart_mock[p_instance->inst_idx];
+	uint8_t * const				p_block	= p_m->p_rx_active;
+	const uint32_t				bytes	= p_m->rx_cnt;
+
+	if ( NULL != p_block )
+	{
+		p_m->p_rx_active	= NULL;
+		p_m->p_rx_next		= NULL;
+		p_m->rx_cnt			= 0;
+
+		nrf_drv_uart_mock_event( p_m, NRF_DRV_UART_EVT_RX_DONE, p_block, bytes );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset instance, driver handler is kept
+*
+* @param[in]	inst	- Driver instance
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nrf_drv_uart_mock_reset(const uint8_t inst)
+{
+	nrf_drv_uart_mock_t * const p_m = &g_nrf_drv_uart_mock[inst];
+
+	p_m->tx_out_len	= 0;
+	p_m->irq		= 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Receive bytes from wire
+*
+* @note		Bytes arriving while no block is armed are lost, as on
+* 			target.
+*
+* @param[in]	inst	- Driver instance
+* @param[in]	p_data	- Received bytes
+* @param[in]	size	- Number of received bytes
+* @return		number of bytes stored by EasyDMA
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_uart_mock_rx_feed(const uint8_t inst, const uint8_t * const p_data, const uint32_t size)
+{
+	nrf_drv_uart_mock_t * const p_m 	= &g_nrf_drv_uart_mock[inst];
+	uint32_t					stored	= 0;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		if ( NULL != p_m->p_rx_active )
+		{
+			p_m->p_rx_active[p_m->rx_cnt++] = p_data[i];
+			g_nrf_drv_uart_stub_reg[inst].EVENTS_RXDRDY = 1UL;
+			stored++;
+
+			// Block full, switch to secondary and report
+			if ( p_m->rx_cnt >= p_m->rx_active_len )
+			{
+				uint8_t * const p_block = p_m->p_rx_active;
+				const uint32_t	bytes	= p_m->rx_cnt;
+
+				p_m->p_rx_active	= p_m->p_rx_next;
+				p_m->rx_active_len	= p_m->rx_next_len;
+				p_m->p_rx_next		= NULL;
+				p_m->rx_cnt			= 0;
+
+				nrf_drv_uart_mock_event( p_m, NRF_DRV_UART_EVT_RX_DONE, p_block, bytes );
+			}
+		}
+	}
+
+	return stored;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Finish transmission in progress
+*
+* @param[in]	inst	- Driver instance
+* @return		true if transmission was in progress
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool nrf_drv_uart_mock_tx_done(const uint8_t inst)
+{
+	nrf_drv_uart_mock_t * const p_m 	= &g_nrf_drv_uart_mock[inst];
+	const uint8_t * const		p_block	= p_m->p_tx;
+	const uint32_t				bytes	= p_m->tx_len;
+	bool						done	= false;
+
+	if ( NULL != p_block )
+	{
+		if (( p_m->tx_out_len + bytes ) <= NRF_DRV_UART_MOCK_TX_SIZE )
+		{
+			memcpy( &p_m->tx_out[p_m->tx_out_len], p_block, bytes );
+			p_m->tx_out_len += bytes;
+		}
+
+		p_m->p_tx = NULL;
+
+		nrf_drv_uart_mock_event( p_m, NRF_DRV_UART_EVT_TX_DONE, (uint8_t*) p_block, bytes );
+
+		done = true;
+	}
+
+	return done;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Finish transmissions until transmitter is idle
+*
+* @param[in]	inst	- Driver instance
+* @return		number of finished transmissions
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_uart_mock_tx_drain(const uint8_t inst)
+{
+	uint32_t num_of = 0;
+
+	while ( true == nrf_drv_uart_mock_tx_done( inst ))
+	{
+		num_of++;
+	}
+
+	return num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get bytes put on wire since reset
+*
+* @param[in]	inst	- Driver instance
+* @param[out]	pp_data	- Transmitted bytes
+* @return		number of transmitted bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_uart_mock_get_tx(const uint8_t inst, const uint8_t ** const pp_data)
+{
+	*pp_data = g_nrf_drv_uart_mock[inst].tx_out;
+
+	return g_nrf_drv_uart_mock[inst].tx_out_len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of interrupts since reset
+*
+* @param[in]	inst	- Driver instance
+* @return		number of driver events
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nrf_drv_uart_mock_get_irq(const uint8_t inst)
+{
+	return g_nrf_drv_uart_mock[inst].irq;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,52 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_uart_mock.h
+*@brief     Legacy UART driver mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NRF_DRV_UART_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Legacy UART driver mock
+*
+* 	Models EasyDMA double buffered reception and single block
+* 	transmission the way nrfx UARTE driver does. Tests play the wire:
+* 	they feed received bytes and complete transmissions, every event
+* 	passed to driver handler is counted as one interrupt.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_UART_MOCK_H
+#define __NRF_DRV_UART_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_drv_uart.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void		nrf_drv_uart_mock_reset		(const uint8_t inst);
+uint32_t	nrf_drv_uart_mock_rx_feed	(const uint8_t inst, const uint8_t * const p_data, const uint32_t size);
+bool		nrf_drv_uart_mock_tx_done	(const uint8_t inst);
+uint32_t	nrf_drv_uart_mock_tx_drain	(const uint8_t inst);
+uint32_t	nrf_drv_uart_mock_get_tx	(const uint8_t inst, const uint8_t ** const pp_data);
+uint32_t	nrf_drv_uart_mock_get_irq	(const uint8_t inst);
+
+#endif // __NRF_DRV_UART_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,14 @@
+# UART drivers on top of legacy UART driver mock
+UART_DIR := $(ROOT)/src/drivers/peripheral/uart
+
+TESTS += uart
+
+uart_SRC	:= $(UART_DIR)/test/test_uart.c $(UART_DIR)/test/nrf_drv_uart_mock.c $(UART_DIR)/uart.c \
+			   $(ROOT)/src/middleware/spsc_fifo/spsc_fifo.c $(ROOT)/src/middleware/trace/trace_vcd.c
+uart_CFLAGS	:= -I$(UART_DIR)/test
+
+TESTS += uart_dbg
+
+uart_dbg_SRC	:= $(UART_DIR)/test/test_uart_dbg.c $(UART_DIR)/test/nrf_drv_uart_mock.c $(UART_DIR)/uart_dbg.c \
+				   $(ROOT)/src/middleware/spsc_fifo/spsc_fifo.c
+uart_dbg_CFLAGS	:= -I$(UART_DIR)/test
@@ -0,0 +1,294 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_uart.c
+*@brief     UART1 block transfer host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup UART_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	UART1 driver runs on top of legacy UART driver mock. Data must pass
+* 	unchanged in both directions, writes are all or nothing and number
+* 	of interrupts per kilobyte is reported. Driver took one interrupt
+* 	per byte in each direction before block transfers.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "test.h"
+#include "nrf_drv_uart_mock.h"
+#include "app_util_platform.h"
+#include "nrf_drv_timer.h"
+#include "drivers/peripheral/uart/uart.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	UART1 driver instance
+ */
+#define TEST_UART_INST				( 1U )
+
+/**
+ * 	UART1 reception timeout timer instance
+ */
+#define TEST_UART_RX_TIMER_INST		( 2U )
+
+/**
+ * 	Test data size
+ *
+ * 	Unit: byte
+ */
+#define TEST_UART_DATA_SIZE			( 1024U )
+
+/**
+ * 	Test data blocks transferred per benchmark
+ */
+#define TEST_UART_BENCH_RUNS		( 20000U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Test data
+ */
+static uint8_t gu8_data[TEST_UART_DATA_SIZE];
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read all received bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_uart_read(uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t	num_of 	= 0;
+	char		ch		= 0;
+
+	while (( num_of < size ) && ( eUART_OK == uart_1_get( &ch )))
+	{
+		p_data[num_of++] = (uint8_t) ch;
+	}
+
+	return num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transmission in 64 byte lines
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tx(void)
+{
+	const uint8_t * p_out = NULL;
+
+	nrf_drv_uart_mock_reset( TEST_UART_INST );
+
+	for ( uint32_t i = 0; i < TEST_UART_DATA_SIZE; i += 64U )
+	{
+		TEST_ASSERT_EQ( uart_1_write_buf( &gu8_data[i], 64U ), eUART_OK );
+
+		// Line takes a while, next one is queued in the meantime
+		if ( 0U == ( i % 256U ))
+		{
+			(void) nrf_drv_uart_mock_tx_drain( TEST_UART_INST );
+		}
+	}
+
+	(void) nrf_drv_uart_mock_tx_drain( TEST_UART_INST );
+
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_get_tx( TEST_UART_INST, &p_out ), TEST_UART_DATA_SIZE );
+	TEST_ASSERT( 0 == memcmp( p_out, gu8_data, TEST_UART_DATA_SIZE ));
+	TEST_ASSERT( nrf_drv_uart_mock_get_irq( TEST_UART_INST ) <= 20U );
+
+	TEST_BENCH( "tx: %u IRQ/kB (one per byte before)", (unsigned) nrf_drv_uart_mock_get_irq( TEST_UART_INST ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Writes that do not fit are refused as whole
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tx_full(void)
+{
+	const uint8_t * p_out = NULL;
+
+	nrf_drv_uart_mock_reset( TEST_UART_INST );
+
+	// Fill Tx buffer while first block is still on the wire
+	TEST_ASSERT_EQ( uart_1_write_buf( gu8_data, 500U ), eUART_OK );
+	TEST_ASSERT_EQ( uart_1_write_buf( &gu8_data[500], 12U ), eUART_OK );
+	TEST_ASSERT_EQ( uart_1_write_buf( &gu8_data[512], 1U ), eUART_ERROR );
+	TEST_ASSERT_EQ( uart_1_write((const char*) "overflow" ), eUART_ERROR );
+
+	(void) nrf_drv_uart_mock_tx_drain( TEST_UART_INST );
+
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_get_tx( TEST_UART_INST, &p_out ), 512U );
+	TEST_ASSERT( 0 == memcmp( p_out, gu8_data, 512U ));
+
+	// Size is given, NUL byte is data
+	nrf_drv_uart_mock_reset( TEST_UART_INST );
+
+	TEST_ASSERT_EQ( uart_1_write_buf((const uint8_t*) "a\0b", 3U ), eUART_OK );
+	TEST_ASSERT_EQ( uart_1_write( "cd" ), eUART_OK );
+
+	(void) nrf_drv_uart_mock_tx_drain( TEST_UART_INST );
+
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_get_tx( TEST_UART_INST, &p_out ), 5U );
+	TEST_ASSERT( 0 == memcmp( p_out, "a\0bcd", 5U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reception in blocks and idle line flush
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_rx(void)
+{
+	static uint8_t	in[TEST_UART_DATA_SIZE];
+	uint32_t		num_of	= 0;
+	uint32_t		lost	= 0;
+
+	nrf_drv_uart_mock_reset( TEST_UART_INST );
+
+	for ( uint32_t i = 0; i < TEST_UART_DATA_SIZE; i += 256U )
+	{
+		TEST_ASSERT_EQ( nrf_drv_uart_mock_rx_feed( TEST_UART_INST, &gu8_data[i], 256U ), 256U );
+		num_of += test_uart_read( &in[num_of], TEST_UART_DATA_SIZE - num_of );
+	}
+
+	TEST_ASSERT_EQ( num_of, TEST_UART_DATA_SIZE );
+	TEST_ASSERT( 0 == memcmp( in, gu8_data, TEST_UART_DATA_SIZE ));
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_get_irq( TEST_UART_INST ), TEST_UART_DATA_SIZE / 32U );
+
+	TEST_BENCH( "rx: %u IRQ/kB (one per byte before)", (unsigned) nrf_drv_uart_mock_get_irq( TEST_UART_INST ));
+
+	// Partial block is flushed once line is idle
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_rx_feed( TEST_UART_INST, gu8_data, 5U ), 5U );
+	TEST_ASSERT_EQ( test_uart_read( in, sizeof( in )), 0U );
+
+	// Timer restarted by last byte expires, no main loop involved
+	TEST_ASSERT( NULL != g_stub_timer_hndl[TEST_UART_RX_TIMER_INST] );
+	g_stub_timer_hndl[TEST_UART_RX_TIMER_INST]( NRF_TIMER_EVENT_COMPARE0, NULL );
+	TEST_ASSERT_EQ( test_uart_read( in, sizeof( in )), 5U );
+
+	// Both blocks armed again after flush
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_rx_feed( TEST_UART_INST, gu8_data, 64U ), 64U );
+	TEST_ASSERT_EQ( test_uart_read( in, sizeof( in )), 64U );
+
+	// Full Rx buffer, rest of blocks is counted as lost
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_rx_feed( TEST_UART_INST, gu8_data, 600U ), 600U );
+	TEST_ASSERT_EQ( uart_1_get_rx_overrun( &lost ), eUART_OK );
+	TEST_ASSERT_EQ( lost, 576U - 512U );
+	TEST_ASSERT_EQ( test_uart_read( in, sizeof( in )), 512U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transmission and reception cost per byte
+*
+* @note	Includes simulated peripheral, time spent in "nrf_drv_uart" mock.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	static uint8_t	in[TEST_UART_DATA_SIZE];
+	const double	size		= (double)( TEST_UART_BENCH_RUNS * TEST_UART_DATA_SIZE );
+	uint64_t		start		= 0;
+	uint64_t		cyc_tx		= 0;
+	uint64_t		cyc_rx		= 0;
+	uint32_t		num_of		= 0;
+
+	start = test_now_cycles();
+
+	for ( uint32_t r = 0; r < TEST_UART_BENCH_RUNS; r++ )
+	{
+		nrf_drv_uart_mock_reset( TEST_UART_INST );
+
+		for ( uint32_t i = 0; i < TEST_UART_DATA_SIZE; i += 64U )
+		{
+			(void) uart_1_write_buf( &gu8_data[i], 64U );
+
+			if ( 0U == ( i % 256U ))
+			{
+				(void) nrf_drv_uart_mock_tx_drain( TEST_UART_INST );
+			}
+		}
+
+		(void) nrf_drv_uart_mock_tx_drain( TEST_UART_INST );
+	}
+
+	cyc_tx	= test_now_cycles() - start;
+	start	= test_now_cycles();
+
+	for ( uint32_t r = 0; r < TEST_UART_BENCH_RUNS; r++ )
+	{
+		nrf_drv_uart_mock_reset( TEST_UART_INST );
+
+		for ( uint32_t i = 0; i < TEST_UART_DATA_SIZE; i += 256U )
+		{
+			(void) nrf_drv_uart_mock_rx_feed( TEST_UART_INST, &gu8_data[i], 256U );
+			num_of += test_uart_read( in, TEST_UART_DATA_SIZE );
+		}
+	}
+
+	cyc_rx = test_now_cycles() - start;
+
+	TEST_ASSERT_EQ( num_of, TEST_UART_BENCH_RUNS * TEST_UART_DATA_SIZE );
+
+	TEST_BENCH( "tx: %6.2f cycles/B", (double) cyc_tx / size );
+	TEST_BENCH( "rx: %6.2f cycles/B", (double) cyc_rx / size );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	for ( uint32_t i = 0; i < TEST_UART_DATA_SIZE; i++ )
+	{
+		gu8_data[i] = (uint8_t)( i * 7U + 1U );
+	}
+
+	TEST_ASSERT_EQ( uart_1_init(), eUART_OK );
+
+	test_tx();
+	test_tx_full();
+	test_rx();
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	TEST_ASSERT_EQ( gu32_stub_critical_nest, 0 );
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
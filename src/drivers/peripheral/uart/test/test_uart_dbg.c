@@ -0,0 +1,219 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_uart_dbg.c
+*@brief     Debug UART bulk write host test and benchmark
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup UART_DBG_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Debug UART runs on top of legacy UART driver mock. Lines must reach
+* 	the wire unchanged and in order, writes are all or nothing.
+*
+* 	Benchmark reports cost per byte of writing CLI sized lines with
+* 	one call per character, as "uart_dbg_write()" did before bulk
+* 	write, and with one call per line.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "test.h"
+#include "nrf_drv_uart_mock.h"
+#include "app_util_platform.h"
+#include "app_error.h"
+#include "drivers/peripheral/uart/uart_dbg.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Debug UART driver instance
+ */
+#define TEST_UART_DBG_INST			( 0U )
+
+/**
+ * 	Length of CLI line
+ *
+ * 	Unit: byte
+ */
+#define TEST_UART_DBG_LINE_SIZE		( 48U )
+
+/**
+ * 	Lines written per benchmark
+ */
+#define TEST_UART_DBG_BENCH_LINES	( 200000U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Test data
+ */
+static uint8_t gu8_data[4096];
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Time base stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lines reach wire in order, chained in DMA blocks
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tx(void)
+{
+	const uint8_t * p_out = NULL;
+
+	nrf_drv_uart_mock_reset( TEST_UART_DBG_INST );
+
+	for ( uint32_t i = 0; i < sizeof( gu8_data ); i += 64U )
+	{
+		TEST_ASSERT_EQ( uart_dbg_write_buf( &gu8_data[i], 64U ), eUART_DBG_OK );
+
+		// Lines keep coming while previous ones are on the wire
+		if ( 960U == ( i % 1024U ))
+		{
+			(void) nrf_drv_uart_mock_tx_drain( TEST_UART_DBG_INST );
+		}
+	}
+
+	(void) nrf_drv_uart_mock_tx_drain( TEST_UART_DBG_INST );
+
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_get_tx( TEST_UART_DBG_INST, &p_out ), sizeof( gu8_data ));
+	TEST_ASSERT( 0 == memcmp( p_out, gu8_data, sizeof( gu8_data )));
+
+	// Up to 255 bytes per transfer, plus wrap arounds
+	TEST_ASSERT( nrf_drv_uart_mock_get_irq( TEST_UART_DBG_INST ) <= (( sizeof( gu8_data ) / 255U ) + 8U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lines that do not fit are refused as whole
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tx_full(void)
+{
+	const uint8_t * p_out = NULL;
+
+	nrf_drv_uart_mock_reset( TEST_UART_DBG_INST );
+
+	TEST_ASSERT_EQ( uart_dbg_write_buf( gu8_data, 2000U ), eUART_DBG_OK );
+	TEST_ASSERT_EQ( uart_dbg_write_buf( &gu8_data[2000], 49U ), eUART_DBG_ERROR );
+	TEST_ASSERT_EQ( uart_dbg_write_buf( &gu8_data[2000], 48U ), eUART_DBG_OK );
+	TEST_ASSERT_EQ( uart_dbg_write( "x" ), eUART_DBG_ERROR );
+
+	(void) nrf_drv_uart_mock_tx_drain( TEST_UART_DBG_INST );
+
+	TEST_ASSERT_EQ( nrf_drv_uart_mock_get_tx( TEST_UART_DBG_INST, &p_out ), 2048U );
+	TEST_ASSERT( 0 == memcmp( p_out, gu8_data, 2048U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cost per byte, per character versus per line writes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	const double	size		= (double)( TEST_UART_DBG_BENCH_LINES * TEST_UART_DBG_LINE_SIZE );
+	uint64_t		start		= 0;
+	uint64_t		start_cyc	= 0;
+	uint64_t		dt_char		= 0;
+	uint64_t		dt_line		= 0;
+	uint64_t		cyc_char	= 0;
+	uint64_t		cyc_line	= 0;
+
+	start 		= test_now_ns();
+	start_cyc	= test_now_cycles();
+
+	for ( uint32_t l = 0; l < TEST_UART_DBG_BENCH_LINES; l++ )
+	{
+		for ( uint32_t i = 0; i < TEST_UART_DBG_LINE_SIZE; i++ )
+		{
+			(void) uart_dbg_write_buf( &gu8_data[i], 1U );
+		}
+
+		(void) nrf_drv_uart_mock_tx_drain( TEST_UART_DBG_INST );
+		nrf_drv_uart_mock_reset( TEST_UART_DBG_INST );
+	}
+
+	cyc_char	= test_now_cycles() - start_cyc;
+	dt_char 	= test_now_ns() - start;
+	start 		= test_now_ns();
+	start_cyc	= test_now_cycles();
+
+	for ( uint32_t l = 0; l < TEST_UART_DBG_BENCH_LINES; l++ )
+	{
+		(void) uart_dbg_write_buf( gu8_data, TEST_UART_DBG_LINE_SIZE );
+
+		(void) nrf_drv_uart_mock_tx_drain( TEST_UART_DBG_INST );
+		nrf_drv_uart_mock_reset( TEST_UART_DBG_INST );
+	}
+
+	cyc_line	= test_now_cycles() - start_cyc;
+	dt_line 	= test_now_ns() - start;
+
+	TEST_BENCH( "per character (before): %6.2f ns/B, %7.2f cycles/B", (double) dt_char / size, (double) cyc_char / size );
+	TEST_BENCH( "per line (after):       %6.2f ns/B, %7.2f cycles/B", (double) dt_line / size, (double) cyc_line / size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	for ( uint32_t i = 0; i < sizeof( gu8_data ); i++ )
+	{
+		gu8_data[i] = (uint8_t)( i * 13U + 5U );
+	}
+
+	TEST_ASSERT_EQ( uart_dbg_init(), eUART_DBG_OK );
+
+	test_tx();
+	test_tx_full();
+
+	TEST_ASSERT_EQ( gu32_stub_critical_nest, 0 );
+	TEST_ASSERT_EQ( gu32_stub_app_error, 0 );
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
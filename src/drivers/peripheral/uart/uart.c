@@ -22,14 +22,20 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "uart.h"
 #include "pin_mapper.h"
 #include "project_config.h"
-#include "middleware/ring_buffer/src/ring_buffer.h"
+#include "middleware/spsc_fifo/spsc_fifo.h"
+#include "middleware/trace/trace.h"
 
 #include "nrf_gpio.h"
+#include "app_util_platform.h"
 #include "nrf_drv_uart.h"
+#include "nrf_uarte.h"
+#include "nrf_drv_timer.h"
+#include "nrf_drv_ppi.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -39,11 +45,47 @@
 /**
  *		UARTE1 buffer size
  *
+ * @note	Must be power of two!
+ *
  *	Unit: byte
  */
 #define UART_1_TX_BUF_SIZE			( 512)                         
 #define UART_1_RX_BUF_SIZE			( 512 )  
 
+/**
+ *		UARTE1 EasyDMA block sizes
+ *
+ * @note	Reception is double buffered, thus two blocks of
+ *			UART_1_RX_DMA_BUF_SIZE are reserved. Interrupt is raised
+ *			only when block is full or reception timeout expires.
+ *
+ *			Transmission sends up to UART_1_TX_DMA_BUF_SIZE bytes
+ *			directly from Tx buffer per single transfer.
+ *
+ *	Unit: byte
+ */
+#define UART_1_RX_DMA_BUF_SIZE		( 32 )
+#define UART_1_TX_DMA_BUF_SIZE		( 64 )
+
+/**
+ *		Reception timeout
+ *
+ * @note	When line is idle for that time partially filled reception
+ *			block is flushed into Rx buffer. Idle time is measured by
+ *			UART_1_RX_TIMER_INST, restarted by each received byte
+ *			over PPI, thus flush does not depend on main loop.
+ *
+ *	Unit: us
+ */
+#define UART_1_RX_TIMEOUT_US		( 1000UL )
+
+/**
+ *		Reception timeout timer instance
+ *
+ * @note	Must be enabled in sdk_config.h!
+ */
+#define UART_1_RX_TIMER_INST		( 2 )
+
 
 /**
  *		Baudrate
@@ -80,9 +122,22 @@ static bool gb_is_init = false;
  static nrf_drv_uart_t gh_uart1_handler = NRF_DRV_UART_INSTANCE( 1 );
 
  /**
-  *		Dummy reception buffers
+  *		EasyDMA reception blocks
+  *
+  * @note	Must be placed in RAM as EasyDMA has no access to flash!
   */
-  static uint8_t gu8_uart1_rx_buf = 0;
+static uint8_t gu8_uart1_rx_dma[2][UART_1_RX_DMA_BUF_SIZE] = {0};
+
+/**
+ *		Number of received bytes lost due to full Rx buffer
+ */
+static volatile uint32_t gu32_uart1_rx_overrun = 0;
+
+/**
+ *		Reception timeout timer and its PPI channel
+ */
+static const nrf_drv_timer_t	g_uart1_rx_timer		= NRF_DRV_TIMER_INSTANCE( UART_1_RX_TIMER_INST );
+static nrf_ppi_channel_t		g_uart1_rx_ppi_channel	= 0;
 
   /**
  * 	UART Rx/Tx buffer space
@@ -92,25 +147,30 @@ static uint8_t gu8_uart1_rx_buffer[UART_1_RX_BUF_SIZE] = {0};
 
 /**
  * 	UART Rx buffer
+ *
+ * @note	Producer: UART interrupt, consumer: main loop.
  */
-static p_ring_buffer_t 		g_rx_buffer1 = NULL;
-const ring_buffer_attr_t 	g_rx_buffer1_attr  = { 	.name 		= "Uart1 Rx Buf",
-													.item_size 	= 1,
-													.override 	= false,
-													.p_mem 		= &gu8_uart1_rx_buffer };
+static spsc_fifo_t g_rx_buffer1 = {0};
+
 /**
  * 	UART Tx buffer
+ *
+ * @note	Producer: "uart_1_write_buf()" inside critical region, consumer:
+ * 			transmission done interrupt. EasyDMA reads directly from it,
+ * 			thus it must be placed in RAM.
  */
-static p_ring_buffer_t 		g_tx_buffer1 = NULL;
-const ring_buffer_attr_t 	g_tx_buffer1_attr  = { 	.name 		= "Uart1 Tx Buf",
-													.item_size 	= 1,
-													.override 	= false,
-													.p_mem 		= &gu8_uart1_tx_buffer };
+static spsc_fifo_t g_tx_buffer1 = {0};
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
 static uart_status_t uart_1_init_buffers(void);
+static uart_status_t uart_1_init_rx_timeout(void);
+static void          uart_1_rx_timeout_hndl(nrf_timer_event_t event_type, void * p_context);
+static void          uart_1_rx_start    (void);
+static void          uart_1_rx_requeue  (uint8_t * const p_block);
+static void          uart_1_rx_store    (const uint8_t * const p_data, const uint32_t size);
+static void          uart_1_tx_start    (void);
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -129,51 +189,38 @@ static uart_status_t uart_1_init_buffers(void);
 ////////////////////////////////////////////////////////////////////////////////
 static void uart_1_event_hndl(nrf_drv_uart_event_t * p_event, void* p_context)
 {
-	uint8_t u8_data = 0;
+	TP_ENTER( UART_1_ISR );
 
-	// Reception buffer not empty
+	// Reception block full or flushed
     if ( p_event->type == NRF_DRV_UART_EVT_RX_DONE )
     {
-		if( p_event->data.rxtx.bytes > 0 )
-		{
-			// Get received char
-			u8_data = p_event->data.rxtx.p_data[0];
-
-			// Store rx char to buffer
-			if ( eRING_BUFFER_OK == ring_buffer_add( g_rx_buffer1, &u8_data ))
-			{
-				// No actions...
-			}
-			else
-			{
-				// TODO: handle error
-			}
-		}
+		// Store all received bytes at once
+		uart_1_rx_store( p_event->data.rxtx.p_data, p_event->data.rxtx.bytes );
 
-		// Dummy read
-		(void) nrf_drv_uart_rx( &gh_uart1_handler, &gu8_uart1_rx_buf, 1 );
+		// Hand block back to driver
+		uart_1_rx_requeue( p_event->data.rxtx.p_data );
     }
 
-	// Transmission buffer empty
+	// Transmission block sent
     else if ( p_event->type == NRF_DRV_UART_EVT_TX_DONE )
     {
-		// Send next char from tx buffer
-		if ( eRING_BUFFER_OK == ring_buffer_get( g_tx_buffer1, &u8_data ))
-		{
-			nrf_drv_uart_tx( &gh_uart1_handler, &u8_data, 1 );
-		}
+		// Release sent block and send next one
+		(void) spsc_fifo_consume( &g_tx_buffer1, p_event->data.rxtx.bytes );
+		uart_1_tx_start();
     }
 
-	// TODO: Check out what kind of error are being process here...
+	// Driver aborts reception on error, so restart it
 	else if (p_event->type == NRF_DRV_UART_EVT_ERROR)
     {
-
+		uart_1_rx_start();
     }
 
 	else
 	{
 		// No actions...
 	}
+
+	TP_EXIT( UART_1_ISR );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -188,13 +235,13 @@ static uart_status_t uart_1_init_buffers(void)
 	uart_status_t status = eUART_OK;
 
 	// Init Tx buffer
-	if ( eRING_BUFFER_OK != ring_buffer_init( &g_tx_buffer1, UART_1_TX_BUF_SIZE, &g_tx_buffer1_attr ))
+	if ( eSPSC_FIFO_OK != spsc_fifo_init( &g_tx_buffer1, gu8_uart1_tx_buffer, UART_1_TX_BUF_SIZE ))
 	{
 		status = eUART_ERROR;
 	}
 
 	// Init Rx buffer
-	if ( eRING_BUFFER_OK != ring_buffer_init( &g_rx_buffer1, UART_1_RX_BUF_SIZE, &g_rx_buffer1_attr ))
+	if ( eSPSC_FIFO_OK != spsc_fifo_init( &g_rx_buffer1, gu8_uart1_rx_buffer, UART_1_RX_BUF_SIZE ))
 	{
 		status = eUART_ERROR;
 	}
@@ -202,6 +249,162 @@ static uart_status_t uart_1_init_buffers(void)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize UART1 reception timeout
+*
+* @note		Received byte clears and starts timer over PPI. Timer stops
+*			itself at timeout and raises interrupt, that flushes partial
+*			block. STOPRX is not triggered directly over PPI, as driver
+*			must disable its ENDRX-STARTRX short before reception stops.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uart_status_t uart_1_init_rx_timeout(void)
+{
+	uart_status_t	status		= eUART_OK;
+	const uint32_t	ppi_status	= nrf_drv_ppi_init();
+
+	// PPI might already be initialized by other driver
+	if 	(	( NRF_SUCCESS != ppi_status )
+		&&	( NRF_ERROR_MODULE_ALREADY_INITIALIZED != ppi_status ))
+	{
+		status = eUART_ERROR;
+	}
+
+	// Same priority as UART, so flush does not preempt its events
+	nrf_drv_timer_config_t timer_cfg = NRF_DRV_TIMER_DEFAULT_CONFIG;
+	timer_cfg.bit_width				= NRF_TIMER_BIT_WIDTH_32;
+	timer_cfg.interrupt_priority	= 6;
+
+	if ( NRF_SUCCESS != nrf_drv_timer_init( &g_uart1_rx_timer, &timer_cfg, uart_1_rx_timeout_hndl ))
+	{
+		status = eUART_ERROR;
+	}
+	else
+	{
+		// Timer is not enabled here, first received byte starts it
+		nrf_drv_timer_extended_compare( &g_uart1_rx_timer, NRF_TIMER_CC_CHANNEL0,
+										nrf_drv_timer_us_to_ticks( &g_uart1_rx_timer, UART_1_RX_TIMEOUT_US ),
+										( NRF_TIMER_SHORT_COMPARE0_STOP_MASK | NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK ), true );
+
+		if 	(	( NRF_SUCCESS != nrf_drv_ppi_channel_alloc( &g_uart1_rx_ppi_channel ))
+			||	( NRF_SUCCESS != nrf_drv_ppi_channel_assign( 	g_uart1_rx_ppi_channel,
+																nrf_uarte_event_address_get( gh_uart1_handler.uarte.p_reg, NRF_UARTE_EVENT_RXDRDY ),
+																nrf_drv_timer_task_address_get( &g_uart1_rx_timer, NRF_TIMER_TASK_CLEAR )))
+			||	( NRF_SUCCESS != nrf_drv_ppi_channel_fork_assign( 	g_uart1_rx_ppi_channel,
+																	nrf_drv_timer_task_address_get( &g_uart1_rx_timer, NRF_TIMER_TASK_START )))
+			||	( NRF_SUCCESS != nrf_drv_ppi_channel_enable( g_uart1_rx_ppi_channel )))
+		{
+			status = eUART_ERROR;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		UART1 reception timeout handler from interrupt
+*
+* @param[in]	event_type	- Timer event
+* @param[in]	p_context	- Context of event
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_1_rx_timeout_hndl(nrf_timer_event_t event_type, void * p_context)
+{
+	// Line idle - flush partial block. Received bytes are reported
+	// via RX_DONE event, reception is restarted from there.
+	if ( NRF_TIMER_EVENT_COMPARE0 == event_type )
+	{
+		nrf_drv_uart_rx_abort( &gh_uart1_handler );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start UART1 double buffered reception
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_1_rx_start(void)
+{
+	// First call sets active block, second one secondary block
+	(void) nrf_drv_uart_rx( &gh_uart1_handler, gu8_uart1_rx_dma[0], UART_1_RX_DMA_BUF_SIZE );
+	(void) nrf_drv_uart_rx( &gh_uart1_handler, gu8_uart1_rx_dma[1], UART_1_RX_DMA_BUF_SIZE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Hand received UART1 block back to driver
+*
+* @note		Block full event leaves driver with one active block, thus
+*			returned block is taken as secondary and offer of other block
+*			is refused as busy. Timeout (abort) or error event releases
+*			both blocks, then returned block becomes active and other one
+*			secondary. Driver state alone decides, so no flag is shared
+*			with main loop.
+*
+* @param[in]	p_block	- Pointer to released reception block
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_1_rx_requeue(uint8_t * const p_block)
+{
+	uint8_t * const p_other = ( p_block == gu8_uart1_rx_dma[0] ) ? gu8_uart1_rx_dma[1] : gu8_uart1_rx_dma[0];
+
+	(void) nrf_drv_uart_rx( &gh_uart1_handler, p_block, UART_1_RX_DMA_BUF_SIZE );
+	(void) nrf_drv_uart_rx( &gh_uart1_handler, p_other, UART_1_RX_DMA_BUF_SIZE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store received UART1 block to reception buffer
+*
+* @param[in]	p_data	- Pointer to received data
+* @param[in]	size	- Number of received bytes
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_1_rx_store(const uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t added = 0;
+
+	// Rest of block is lost if buffer is full
+	(void) spsc_fifo_add_n( &g_rx_buffer1, p_data, size, &added );
+
+	gu32_uart1_rx_overrun += ( size - added );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start UART1 transmission of next block
+*
+* @note		Contiguous part of Tx buffer, up to UART_1_TX_DMA_BUF_SIZE
+*			bytes, is sent in place. It is released on transmission done.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_1_tx_start(void)
+{
+	const uint8_t * p_data 	= NULL;
+	uint32_t 		size 	= 0;
+
+	if ( eSPSC_FIFO_OK == spsc_fifo_get_span( &g_tx_buffer1, &p_data, &size ))
+	{
+		if ( size > UART_1_TX_DMA_BUF_SIZE )
+		{
+			size = UART_1_TX_DMA_BUF_SIZE;
+		}
+
+		(void) nrf_drv_uart_tx( &gh_uart1_handler, p_data, size );
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -254,8 +457,11 @@ uart_status_t uart_1_init(void)
 			status = eUART_ERROR;
 		}
 
-		// Dummy read
-		(void) nrf_drv_uart_rx( &gh_uart1_handler, &gu8_uart1_rx_buf, 1 );
+		// Flush of partially filled reception block
+		status |= uart_1_init_rx_timeout();
+
+		// Start reception
+		uart_1_rx_start();
 
 		if ( eUART_OK == status )
 		{
@@ -279,48 +485,72 @@ uart_status_t uart_1_init(void)
 uart_status_t uart_1_write(const char* str)
 {
 	uart_status_t status = eUART_OK;
-	uint8_t u8_data = 0;
 
-	UART_ASSERT( true == gb_is_init );
 	UART_ASSERT( NULL != str );
 
+	if ( NULL != str )
+	{
+		status = uart_1_write_buf((const uint8_t*) str, strlen( str ));
+	}
+	else
+	{
+		status = eUART_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		UART1 transmit buffer
+*	
+* @note This function is non-blocking. Data are copied to Tx buffer in a
+*		single pass and EasyDMA transmits them from there in place.
+*
+* @note	Data are queued all or nothing. If they do not fit into Tx
+*		buffer nothing is queued and error is returned.
+*
+* @note	Can be called from main loop and interrupts (CLI output), thus
+*		free space check, copy and transmission start are done inside
+*		critical region to keep single producer of Tx buffer.
+*
+* @param[in] 	p_data	- Pointer to data to be sended over UART
+* @param[in] 	size	- Size of data in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+uart_status_t uart_1_write_buf(const uint8_t * const p_data, const uint32_t size)
+{
+	uart_status_t status = eUART_OK;
+
+	UART_ASSERT( true == gb_is_init );
+	UART_ASSERT( NULL != p_data );
+
 	if	(	( true == gb_is_init ) 
-		&&	( NULL != str ))
+		&&	( NULL != p_data ))
 	{
-		// Get lenght of string
-		const uint32_t str_len = strlen( str );
+		CRITICAL_REGION_ENTER();
 
-		// Put all to fifo
-		for ( uint32_t ch = 0; ch < str_len; ch++ )
+		if ( size <= spsc_fifo_get_free( &g_tx_buffer1 ))
 		{
-			// Put char to tx buffer
-			if ( eRING_BUFFER_OK != ring_buffer_add( g_tx_buffer1, (const char*) str ))
+			// Copy all at once
+			(void) spsc_fifo_add_n( &g_tx_buffer1, p_data, size, NULL );
+
+			// New data has been added to Tx buffer. It will be picked up from there
+			// (in 'uart_1_event_hndl') when current block is transmitted. But if UART
+			// is not transmitting anything at the moment, we must start a new
+			// transmission here.
+			if ( false == nrf_drv_uart_tx_in_progress( &gh_uart1_handler ))
 			{
-				// TODO: handle error if not all data added
-				break;
+				uart_1_tx_start();
 			}
-
-			// Move thru string
-			str++;
+		}
+		else
+		{
+			status = eUART_ERROR;
 		}
 
-        // The new byte has been added to FIFO. It will be picked up from there
-        // (in 'uart_event_handler') when all preceding bytes are transmitted.
-        // But if UART is not transmitting anything at the moment, we must start
-        // a new transmission here.
-        if ( false == nrf_drv_uart_tx_in_progress( &gh_uart1_handler ))
-        {
-            // This operation should be almost always successful, since we've
-            // just added a byte to FIFO, but if some bigger delay occurred
-            // (some heavy interrupt handler routine has been executed) since
-            // that time, FIFO might be empty already.
-            
-			// Start trasmission by sending first char from fifo
-			if ( eRING_BUFFER_OK == ring_buffer_get( g_tx_buffer1, &u8_data ))
-			{
-				nrf_drv_uart_tx( &gh_uart1_handler, &u8_data, 1 );
-			}
-        }	
+		CRITICAL_REGION_EXIT();
 	}
 	else
 	{
@@ -351,7 +581,7 @@ uart_status_t uart_1_get(char * const p_char)
 		&&	( NULL != p_char ))
 	{
 		// Get from buffer
-		if ( eRING_BUFFER_OK != ring_buffer_get( g_rx_buffer1, p_char ))
+		if ( eSPSC_FIFO_OK != spsc_fifo_get( &g_rx_buffer1, (uint8_t*) p_char ))
 		{
 			status = eUART_ERROR;
 		}
@@ -364,6 +594,32 @@ uart_status_t uart_1_get(char * const p_char)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of UART1 received bytes lost due to full Rx buffer
+*
+* @param[out] 	p_lost	- Number of lost bytes since init
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+uart_status_t uart_1_get_rx_overrun(uint32_t * const p_lost)
+{
+	uart_status_t status = eUART_OK;
+
+	UART_ASSERT( NULL != p_lost );
+
+	if ( NULL != p_lost )
+	{
+		*p_lost = gu32_uart1_rx_overrun;
+	}
+	else
+	{
+		status = eUART_ERROR;
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
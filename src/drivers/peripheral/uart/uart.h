@@ -47,7 +47,9 @@ typedef enum
 ////////////////////////////////////////////////////////////////////////////////
 uart_status_t uart_1_init	(void);
 uart_status_t uart_1_write	(const char* pc_string);
+uart_status_t uart_1_write_buf(const uint8_t * const p_data, const uint32_t size);
 uart_status_t uart_1_get	(char * const p_char);
+uart_status_t uart_1_get_rx_overrun(uint32_t * const p_lost);
 
 
 #endif // __UART_DBG_H
@@ -22,15 +22,22 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "uart_dbg.h"
 #include "pin_mapper.h"
 #include "project_config.h"
 
-#include "app_uart.h"
+#include "nrf_gpio.h"
+#include "app_util_platform.h"
+#include "app_error.h"
+#include "nrf_drv_uart.h"
 #include "nrf_uart.h"
 #include "nrf_uarte.h"
 
+#include "middleware/spsc_fifo/spsc_fifo.h"
+#include "drivers/peripheral/systick/systick.h"
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -39,6 +46,8 @@
 /**
  *		Transmittion buffer size
  *
+ * @note	Must be power of 2!
+ *
  *	Unit: byte
  */
 #define UART_DBG_TX_BUF_SIZE		( 1024 * 2 )                         
@@ -46,10 +55,38 @@
 /**
  *		Reception buffer size
  *
+ * @note	Must be power of 2!
+ *
  *	Unit: byte
  */
 #define UART_DBG_RX_BUF_SIZE		( 512 )   
 
+/**
+ *		EasyDMA block sizes
+ *
+ * @note	Reception is double buffered, interrupt is raised only when
+ *			block is full or reception timeout expires.
+ *
+ *			Transmission sends up to UART_DBG_TX_DMA_MAX_SIZE bytes
+ *			directly from Tx buffer per single transfer. Limited by
+ *			8-bit length of legacy UART driver.
+ *
+ *	Unit: byte
+ */
+#define UART_DBG_RX_DMA_BUF_SIZE	( 16 )
+#define UART_DBG_TX_DMA_MAX_SIZE	( 255 )
+
+/**
+ *		Reception timeout
+ *
+ * @note	When line is idle for that time partially filled reception
+ *			block is flushed into Rx buffer. Resolution is given by
+ *			period of "uart_dbg_hndl()" calls.
+ *
+ *	Unit: ms
+ */
+#define UART_DBG_RX_TIMEOUT_MS		( 2UL )
+
 /**
  *		Baudrate
  *
@@ -79,27 +116,204 @@
  */
 static bool gb_is_init = false;
 
+/**
+ *	UARTE Handler
+ */	
+static nrf_drv_uart_t gh_uart_dbg_handler = NRF_DRV_UART_INSTANCE( 0 );
+
+/**
+ * 	Tx/Rx buffer space
+ *
+ * @note	EasyDMA reads directly from Tx buffer space, thus it must
+ *			be placed in RAM.
+ */
+static uint8_t gu8_uart_dbg_tx_buffer[UART_DBG_TX_BUF_SIZE] = {0};
+static uint8_t gu8_uart_dbg_rx_buffer[UART_DBG_RX_BUF_SIZE] = {0};
+
+/**
+ * 	Tx/Rx buffer
+ *
+ * @note	Tx producer: "uart_dbg_write_buf()" inside critical region,
+ *			consumer: transmission done interrupt.
+ *			Rx producer: UART interrupt, consumer: main loop.
+ */
+static spsc_fifo_t g_tx_buffer = {0};
+static spsc_fifo_t g_rx_buffer = {0};
+
+/**
+ *	EasyDMA reception blocks
+ *
+ * @note	Must be placed in RAM as EasyDMA has no access to flash!
+ */
+static uint8_t gu8_uart_dbg_rx_dma[2][UART_DBG_RX_DMA_BUF_SIZE] = {0};
+
+/**
+ *	Size of block currently being transmitted
+ */
+static volatile uint32_t gu32_uart_dbg_tx_size = 0;
+
+/**
+ *	Reception line activity
+ */
+static bool		gb_uart_dbg_rx_pending		= false;
+static uint32_t	gu32_uart_dbg_rx_last_ms	= 0;
+
+/**
+ *	Number of received bytes lost due to full Rx buffer
+ */
+static volatile uint32_t gu32_uart_dbg_rx_overrun = 0;
 
 ////////////////////////////////////////////////////////////////////////////////
-// Functions
+// Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
+static void uart_dbg_rx_start	(void);
+static void uart_dbg_rx_requeue	(uint8_t * const p_block);
+static void uart_dbg_tx_start	(void);
 
 
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
 
-// TODO: 
-void uart_error_handle(app_uart_evt_t * p_event)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Debug UART error handler
+*
+* @param[in]	err_code	- Error code
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_error_handle(const uint32_t err_code)
 {
-    if (p_event->evt_type == APP_UART_COMMUNICATION_ERROR)
+	APP_ERROR_HANDLER( err_code );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Debug UART event handler from interrupt
+*
+* @param[in]	p_event		- Event details
+* @param[in]	p_context	- Context of event
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_dbg_event_hndl(nrf_drv_uart_event_t * p_event, void* p_context)
+{
+	// Reception block full or flushed
+    if ( p_event->type == NRF_DRV_UART_EVT_RX_DONE )
     {
-        APP_ERROR_HANDLER(p_event->data.error_communication);
+		const uint32_t	size	= p_event->data.rxtx.bytes;
+		uint32_t		added	= 0;
+
+		if ( size > 0 )
+		{
+			// Rest of block is lost if buffer is full
+			(void) spsc_fifo_add_n( &g_rx_buffer, p_event->data.rxtx.p_data, size, &added );
+
+			gu32_uart_dbg_rx_overrun += ( size - added );
+
+			uart_dbg_rx_cb();
+		}
+
+		// Hand block back to driver
+		uart_dbg_rx_requeue( p_event->data.rxtx.p_data );
     }
-    else if (p_event->evt_type == APP_UART_FIFO_ERROR)
+
+	// Transmission block sent
+    else if ( p_event->type == NRF_DRV_UART_EVT_TX_DONE )
     {
-        APP_ERROR_HANDLER(p_event->data.error_code);
+		// Release sent block and chain next one
+		(void) spsc_fifo_consume( &g_tx_buffer, gu32_uart_dbg_tx_size );
+		gu32_uart_dbg_tx_size = 0;
+
+		uart_dbg_tx_start();
     }
+
+	// Communication error
+	else if ( p_event->type == NRF_DRV_UART_EVT_ERROR )
+    {
+		// Driver aborts reception on error, so restart it
+		uart_dbg_rx_start();
+
+		uart_error_handle( p_event->data.error.error_mask );
+    }
+
+	else
+	{
+		// No actions...
+	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start double buffered reception
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_dbg_rx_start(void)
+{
+	// First call sets active block, second one secondary block
+	(void) nrf_drv_uart_rx( &gh_uart_dbg_handler, gu8_uart_dbg_rx_dma[0], UART_DBG_RX_DMA_BUF_SIZE );
+	(void) nrf_drv_uart_rx( &gh_uart_dbg_handler, gu8_uart_dbg_rx_dma[1], UART_DBG_RX_DMA_BUF_SIZE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Hand received block back to driver
+*
+* @note		Same scheme as UART1: after block full event driver keeps
+*			one block and refuses second one, after timeout (abort) both
+*			blocks are armed again.
+*
+* @param[in]	p_block	- Pointer to released reception block
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_dbg_rx_requeue(uint8_t * const p_block)
+{
+	uint8_t * const p_other = ( p_block == gu8_uart_dbg_rx_dma[0] ) ? gu8_uart_dbg_rx_dma[1] : gu8_uart_dbg_rx_dma[0];
 
+	(void) nrf_drv_uart_rx( &gh_uart_dbg_handler, p_block, UART_DBG_RX_DMA_BUF_SIZE );
+	(void) nrf_drv_uart_rx( &gh_uart_dbg_handler, p_other, UART_DBG_RX_DMA_BUF_SIZE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start transmission of next block from Tx buffer
+*
+* @note		Can be called from both interrupt and main context, therefore
+*			block is taken only when transmitter is idle. Contiguous part
+*			of Tx buffer is sent in place, without copying.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void uart_dbg_tx_start(void)
+{
+	const uint8_t * p_data	= NULL;
+	uint32_t		size	= 0;
+
+	CRITICAL_REGION_ENTER();
+
+	if	(	( 0 == gu32_uart_dbg_tx_size )
+		&&	( eSPSC_FIFO_OK == spsc_fifo_get_span( &g_tx_buffer, &p_data, &size )))
+	{
+		if ( size > UART_DBG_TX_DMA_MAX_SIZE )
+		{
+			size = UART_DBG_TX_DMA_MAX_SIZE;
+		}
+
+		gu32_uart_dbg_tx_size = size;
+
+		if ( NRF_SUCCESS != nrf_drv_uart_tx( &gh_uart_dbg_handler, p_data, (uint8_t) size ))
+		{
+			gu32_uart_dbg_tx_size = 0;
+		}
+	}
+
+	CRITICAL_REGION_EXIT();
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -111,27 +325,94 @@ void uart_error_handle(app_uart_evt_t * p_event)
 uart_dbg_status_t uart_dbg_init	(void)
 {
 	uart_dbg_status_t status = eUART_DBG_OK;
-		uint32_t err_code;
 
 	if ( false == gb_is_init ) 
 	{
-		const app_uart_comm_params_t comm_params =
+		// Init buffers
+		if	(	( eSPSC_FIFO_OK != spsc_fifo_init( &g_tx_buffer, gu8_uart_dbg_tx_buffer, UART_DBG_TX_BUF_SIZE ))
+			||	( eSPSC_FIFO_OK != spsc_fifo_init( &g_rx_buffer, gu8_uart_dbg_rx_buffer, UART_DBG_RX_BUF_SIZE )))
 		{
-			DBG_UART_RX__PIN,
-			DBG_UART_TX__PIN,
-			NRF_UART_PSEL_DISCONNECTED,
-			NRF_UART_PSEL_DISCONNECTED,
-			true,
-			false,
-			UART_DBG_BAUDRATE
+			status = eUART_DBG_ERROR;
+		}
+
+		// Setup configuration
+		nrf_drv_uart_config_t config = 
+		{
+			.pseltxd			= NRF_GPIO_PIN_MAP( DBG_UART_TX__PORT, DBG_UART_TX__PIN ),          
+			.pselrxd			= NRF_GPIO_PIN_MAP( DBG_UART_RX__PORT, DBG_UART_RX__PIN ),        
+			.pselcts			= NRF_UART_PSEL_DISCONNECTED,
+			.pselrts			= NRF_UART_PSEL_DISCONNECTED,
+			.p_context			= NULL,
+			.hwfc				= NRF_UART_HWFC_DISABLED,    
+			.parity				= NRF_UART_PARITY_EXCLUDED,
+			.baudrate			= UART_DBG_BAUDRATE,
+			.interrupt_priority	= APP_IRQ_PRIORITY_LOWEST,
+			.use_easy_dma		= true,
 		};
 
-		APP_UART_FIFO_INIT( &comm_params, UART_DBG_RX_BUF_SIZE, UART_DBG_TX_BUF_SIZE, uart_error_handle, APP_IRQ_PRIORITY_LOWEST, err_code );
+		// Init
+		if ( NRF_SUCCESS != nrf_drv_uart_init( &gh_uart_dbg_handler, &config, uart_dbg_event_hndl ))
+		{
+			status = eUART_DBG_ERROR;
+		}
+
+		// Start reception
+		uart_dbg_rx_start();
+
+		if ( eUART_DBG_OK == status )
+		{
+			gb_is_init = true;
+		}
+	}
+	else
+	{
+		status = eUART_DBG_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Handle debug UART reception timeout
+*
+* @note	Partially filled reception block is flushed to Rx buffer once
+*		line is idle for UART_DBG_RX_TIMEOUT_MS.
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+uart_dbg_status_t uart_dbg_hndl(void)
+{
+	uart_dbg_status_t status = eUART_DBG_OK;
+
+	if ( true == gb_is_init )
+	{
+		const uint32_t now = systick_get_ms();
+
+		// Byte received since last check
+		if ( true == nrf_uarte_event_check( gh_uart_dbg_handler.uarte.p_reg, NRF_UARTE_EVENT_RXDRDY ))
+		{
+			nrf_uarte_event_clear( gh_uart_dbg_handler.uarte.p_reg, NRF_UARTE_EVENT_RXDRDY );
 
-		APP_ERROR_CHECK(err_code);
+			gb_uart_dbg_rx_pending		= true;
+			gu32_uart_dbg_rx_last_ms	= now;
+		}
+
+		// Line idle - flush partial block
+		else if	(	( true == gb_uart_dbg_rx_pending )
+				&&	((uint32_t)( now - gu32_uart_dbg_rx_last_ms ) >= UART_DBG_RX_TIMEOUT_MS ))
+		{
+			gb_uart_dbg_rx_pending = false;
 
-		// TODO: Check if init OK
-		gb_is_init = true;
+			// Received bytes are reported via RX_DONE event, reception
+			// is restarted from there
+			nrf_drv_uart_rx_abort( &gh_uart_dbg_handler );
+		}
+		else
+		{
+			// No actions...
+		}
 	}
 	else
 	{
@@ -155,18 +436,63 @@ uart_dbg_status_t uart_dbg_write(const char* str)
 
 	UART_DBG_ASSERT( NULL != str );
 
+	if ( NULL != str )
+	{
+		status = uart_dbg_write_buf((const uint8_t*) str, strlen( str ));
+	}
+	else
+	{
+		status = eUART_DBG_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		UART transmit buffer
+*
+* @note	This function is non-blocking. Data are copied to Tx buffer in a
+*		single pass and EasyDMA transmits them from there in place.
+*
+* @note	Data are queued all or nothing. If they do not fit into Tx
+*		buffer nothing is queued and error is returned, so line or
+*		frame is never cut in the middle.
+*
+* @note	Called from main loop and interrupts (cli_printf, deferred log,
+*		parameter streaming). Free space check and copy are done inside
+*		critical region, so Tx buffer still sees single producer.
+*
+* @param[in] 	p_data	- Pointer to data to be sended over UART
+* @param[in] 	size	- Size of data in bytes
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+uart_dbg_status_t uart_dbg_write_buf(const uint8_t * const p_data, const uint32_t size)
+{
+	uart_dbg_status_t status = eUART_DBG_OK;
+
+	UART_DBG_ASSERT( NULL != p_data );
+
 	if	(	( true == gb_is_init ) 
-		&&	( NULL != str ))
+		&&	( NULL != p_data ))
 	{
-		while( NULL != *str )
+		CRITICAL_REGION_ENTER();
+
+		if ( size <= spsc_fifo_get_free( &g_tx_buffer ))
 		{
-			// TODO: Timeout event!
-			// TODO: Check return code
-			app_uart_put( *str );
+			// Copy all at once
+			(void) spsc_fifo_add_n( &g_tx_buffer, p_data, size, NULL );
 
-			// Increment pointer
-			str++;
+			// Start transmission if idle
+			uart_dbg_tx_start();
+		}
+		else
+		{
+			status = eUART_DBG_ERROR;
 		}
+
+		CRITICAL_REGION_EXIT();
 	}
 	else
 	{
@@ -193,7 +519,7 @@ uart_dbg_status_t uart_dbg_get(char * const p_char)
 	if	(	( true == gb_is_init ) 
 		&&	( NULL != p_char ))
 	{
-		if ( NRF_SUCCESS != app_uart_get( p_char ))
+		if ( eSPSC_FIFO_OK != spsc_fifo_get( &g_rx_buffer, (uint8_t*) p_char ))
 		{
 			status = eUART_DBG_ERROR;
 		}
@@ -206,6 +532,21 @@ uart_dbg_status_t uart_dbg_get(char * const p_char)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Debug UART data received callback
+*
+* @note		Called from UART ISR context, once per received block!
+*
+* @return 	void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((weak)) void uart_dbg_rx_cb(void)
+{
+	/**
+	 * 	Leave empty for user application purposes...
+	 */
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
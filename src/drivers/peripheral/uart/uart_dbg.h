@@ -45,8 +45,11 @@ typedef enum
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 uart_dbg_status_t uart_dbg_init	(void);
+uart_dbg_status_t uart_dbg_hndl	(void);
 uart_dbg_status_t uart_dbg_write(const char* pc_string);
+uart_dbg_status_t uart_dbg_write_buf(const uint8_t * const p_data, const uint32_t size);
 uart_dbg_status_t uart_dbg_get	(char * const p_char);
+void			  uart_dbg_rx_cb(void);
 
 
 #endif // __UART_DBG_H
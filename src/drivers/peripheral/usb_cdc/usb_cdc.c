@@ -26,7 +26,7 @@
 
 #include "usb_cdc.h"
 #include "project_config.h"
-#include "middleware/ring_buffer/src/ring_buffer.h"
+#include "middleware/spsc_fifo/spsc_fifo.h"
 #include "drivers/peripheral/systick/systick.h"
 
 // Debug communication port
@@ -91,23 +91,47 @@
 /**
  *		USB CDC buffer size
  *
+ * @note	Must be power of two!
+ *
  *	Unit: byte
  */                     
 #define USB_CDC_RX_BUF_SIZE                 ( 512 )  
+#define USB_CDC_TX_BUF_SIZE                 ( 1024 )  
 
 /**
- *      USB Clock Startup Timeout time 
+ *      USB CDC reception block size
+ *
+ * @note    Equal to bulk endpoint size, so that whole USB packet
+ *          is taken at once.
+ *
+ *	Unit: byte
+ */
+#define USB_CDC_RX_BLOCK_SIZE               ( NRF_DRV_USBD_EPSIZE )
+
+/**
+ *      USB CDC reception statistics window
  *
  *  Unit: ms
  */
-#define USB_CDC_CLOCK_START_TIMOUT_MS       ( 10UL )
+#define USB_CDC_RX_STATS_PERIOD_MS          ( 1000UL )
 
 /**
- *      USB Transmission Timeout time
+ *      USB CDC transmission packet size
+ *
+ * @note    Queued writes are coalesced into packets of that size. Packet
+ *          is sent directly from Tx buffer, thus it is shorter when data
+ *          wraps around end of buffer.
+ *
+ *	Unit: byte
+ */
+#define USB_CDC_TX_PACKET_SIZE              ( NRF_DRV_USBD_EPSIZE )
+
+/**
+ *      USB Clock Startup Timeout time 
  *
  *  Unit: ms
  */
-#define USB_CDC_TX_TIMOUT_MS                ( 10UL )
+#define USB_CDC_CLOCK_START_TIMOUT_MS       ( 10UL )
 
 /**
  *      USB Event handler Timeout time
@@ -136,23 +160,34 @@
 static bool gb_is_init = false;
 
 /**
- *		Dummy reception buffers
+ *		Reception block
+ */
+static uint8_t gu8_usb_cdc_rx_buf[USB_CDC_RX_BLOCK_SIZE] = {0};
+
+/**
+ *		Size of packet being transmitted
+ *
+ * @note    Packet is released from Tx buffer only on
+ *          "APP_USBD_CDC_ACM_USER_EVT_TX_DONE", so it stays intact
+ *          during transfer.
  */
-static uint8_t gu8_usb_cdc_rx_buf = 0;
+static uint32_t gu32_usb_cdc_tx_size = 0;
 
 /**
  * 	USB CDC Tx/Rx buffer space
  */
 static uint8_t gu8_usb_cdc_rx_buffer[USB_CDC_RX_BUF_SIZE] = {0};
+static uint8_t gu8_usb_cdc_tx_buffer[USB_CDC_TX_BUF_SIZE] = {0};
 
 /**
  * 	USB CDC Rx buffer
  */
-static p_ring_buffer_t 		g_rx_buffer = NULL;
-const ring_buffer_attr_t 	g_rx_buffer_attr  = { 	.name 		= "USB CDC Rx Buf",
-													.item_size 	= 1,
-													.override 	= false,
-													.p_mem 		= &gu8_usb_cdc_rx_buffer };
+static spsc_fifo_t g_rx_buffer = {0};
+
+/**
+ * 	USB CDC Tx buffer
+ */
+static spsc_fifo_t g_tx_buffer = {0};
 
 /**
  *  Is transmission in progress flag
@@ -164,12 +199,23 @@ static volatile bool gb_tx_in_progress = false;
  */
 static volatile bool gb_is_port_open = false;
 
+/**
+ *  Reception statistics
+ */
+static usb_cdc_rx_stats_t   g_rx_stats          = {0};
+static uint32_t             gu32_rx_win_bytes   = 0;
+static uint32_t             gu32_rx_win_start   = 0;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
 static usb_cdc_status_t usb_cdc_init_buffers        (void);
+static void             usb_cdc_rx_store            (const uint8_t * const p_data, const uint32_t size);
+static void             usb_cdc_rx_stats_hndl       (void);
+static void             usb_cdc_tx_start            (void);
 static void             usb_cdc_event_cdc_hndl      (app_usbd_class_inst_t const * p_inst, app_usbd_cdc_acm_user_event_t event);
 static void             usb_cdc_event_usbd_hndl     (app_usbd_event_type_t event);
+static void             usb_cdc_event_isr_hndl      (app_usbd_internal_evt_t const * const p_event, bool queued);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -199,7 +245,13 @@ static usb_cdc_status_t usb_cdc_init_buffers(void)
 	usb_cdc_status_t status = eUSB_CDC_OK;
 
 	// Init Rx buffer
-	if ( eRING_BUFFER_OK != ring_buffer_init( &g_rx_buffer, USB_CDC_RX_BUF_SIZE, &g_rx_buffer_attr ))
+	if ( eSPSC_FIFO_OK != spsc_fifo_init( &g_rx_buffer, gu8_usb_cdc_rx_buffer, USB_CDC_RX_BUF_SIZE ))
+	{
+		status = eUSB_CDC_ERROR;
+	}
+
+	// Init Tx buffer
+	if ( eSPSC_FIFO_OK != spsc_fifo_init( &g_tx_buffer, gu8_usb_cdc_tx_buffer, USB_CDC_TX_BUF_SIZE ))
 	{
 		status = eUSB_CDC_ERROR;
 	}
@@ -207,6 +259,106 @@ static usb_cdc_status_t usb_cdc_init_buffers(void)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store received USB block to reception buffer
+*
+* @param[in]    p_data  - Pointer to received data
+* @param[in]    size    - Number of received bytes
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void usb_cdc_rx_store(const uint8_t * const p_data, const uint32_t size)
+{
+    uint32_t added = 0;
+
+    if ( eSPSC_FIFO_OK != spsc_fifo_add_n( &g_rx_buffer, p_data, size, &added ))
+    {
+        // Rest of block is lost
+        g_rx_stats.overruns++;
+
+        USB_CDC_DBG_PRINT( "USB_CDC: Error Rx buffer full! " );
+    }
+
+    g_rx_stats.bytes    += added;
+    gu32_rx_win_bytes   += added;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate reception throughput
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void usb_cdc_rx_stats_hndl(void)
+{
+    const uint32_t now = systick_get_ms();
+    const uint32_t dt  = (uint32_t)( now - gu32_rx_win_start );
+
+    if ( dt >= USB_CDC_RX_STATS_PERIOD_MS )
+    {
+        g_rx_stats.rate     = (uint32_t)(( 1000ULL * gu32_rx_win_bytes ) / dt );
+        gu32_rx_win_bytes   = 0;
+        gu32_rx_win_start   = now;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start transmission of next packet
+*
+* @note		Contiguous queued data from Tx buffer, up to single packet,
+*           is sent in place.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void usb_cdc_tx_start(void)
+{
+    const uint8_t * p_data  = NULL;
+    uint32_t        size    = 0;
+
+    if  (   ( false == gb_tx_in_progress )
+        &&  ( true == gb_is_port_open ))
+    {
+        if ( eSPSC_FIFO_OK == spsc_fifo_get_span( &g_tx_buffer, &p_data, &size ))
+        {
+            if ( size > USB_CDC_TX_PACKET_SIZE )
+            {
+                size = USB_CDC_TX_PACKET_SIZE;
+            }
+
+            if ( NRF_SUCCESS == app_usbd_cdc_acm_write( &gh_usb_cdc, p_data, size ))
+            {
+                gu32_usb_cdc_tx_size    = size;
+                gb_tx_in_progress       = true;
+            }
+            else
+            {
+                USB_CDC_DBG_PRINT( "USB_CDC: Packet transmission failed! " );
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		USB Device ISR event handler
+*
+* @param[in]    p_event - Internal event
+* @param[in]    queued  - Event was put into event queue
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void usb_cdc_event_isr_hndl(app_usbd_internal_evt_t const * const p_event, bool queued)
+{
+    if ( true == queued )
+    {
+        usb_cdc_event_isr_cb();
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		USB Device event handler
@@ -272,7 +424,13 @@ static void usb_cdc_event_usbd_hndl(app_usbd_event_type_t event)
             app_usbd_stop();
 
             // Clear port open flag
-            gb_is_port_open = false;
+            gb_is_port_open     = false;
+            gb_tx_in_progress   = false;
+
+            // Packet in transfer is lost, otherwise it would be sent
+            // again on reconnect
+            (void) spsc_fifo_consume( &g_tx_buffer, gu32_usb_cdc_tx_size );
+            gu32_usb_cdc_tx_size = 0;
 
             // Raise callback
             usb_cdc_unplugged_cb();
@@ -315,12 +473,16 @@ static void usb_cdc_event_cdc_hndl(app_usbd_class_inst_t const * p_inst, app_usb
         // User event on port open
         case APP_USBD_CDC_ACM_USER_EVT_PORT_OPEN:
         {
-			// Dummy read
-			app_usbd_cdc_acm_read( &gh_usb_cdc, &gu8_usb_cdc_rx_buf, 1 );
+			// Setup first block reception
+			app_usbd_cdc_acm_read_any( &gh_usb_cdc, gu8_usb_cdc_rx_buf, USB_CDC_RX_BLOCK_SIZE );
 
             // Raise port open flag
 			gb_is_port_open = true;
 
+            // Send rest of data queued before port was closed. Nothing
+            // is queued while port is closed.
+            usb_cdc_tx_start();
+
             // Raise callback
             usb_cdc_port_open_cb();
 
@@ -334,7 +496,12 @@ static void usb_cdc_event_cdc_hndl(app_usbd_class_inst_t const * p_inst, app_usb
         case APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE:
 
             // Clear port open flag
-			gb_is_port_open = false;
+			gb_is_port_open     = false;
+            gb_tx_in_progress   = false;
+
+            // Packet in transfer is lost
+            (void) spsc_fifo_consume( &g_tx_buffer, gu32_usb_cdc_tx_size );
+            gu32_usb_cdc_tx_size = 0;
 
             // Raise callback
             usb_cdc_port_close_cb();
@@ -347,29 +514,27 @@ static void usb_cdc_event_cdc_hndl(app_usbd_class_inst_t const * p_inst, app_usb
         // User event on transmission complete
         case APP_USBD_CDC_ACM_USER_EVT_TX_DONE:
 	
+            // Release sent packet
+            (void) spsc_fifo_consume( &g_tx_buffer, gu32_usb_cdc_tx_size );
+            gu32_usb_cdc_tx_size = 0;
+
             // Clear tx in progress flag
 			gb_tx_in_progress = false;
+
+            // Chain next packet
+            usb_cdc_tx_start();
 		
 			break;
 
         // User event on reception complete
         case APP_USBD_CDC_ACM_USER_EVT_RX_DONE:
         			
-			// Take all bytes from reception buffer
+			// Take all pending blocks
 			do
 			{
-				// Store rx char to buffer
-				if ( eRING_BUFFER_OK == ring_buffer_add( g_rx_buffer, &gu8_usb_cdc_rx_buf ))
-				{
-					// No actions...
-				}
-				else
-				{
-                    USB_CDC_DBG_PRINT( "USB_CDC: Error Rx buffer full! " );
-					USB_CDC_ASSERT( 0 );
-				}
-
-			} while ( NRF_SUCCESS == app_usbd_cdc_acm_read( &gh_usb_cdc, &gu8_usb_cdc_rx_buf, 1 ));
+				usb_cdc_rx_store( gu8_usb_cdc_rx_buf, app_usbd_cdc_acm_rx_size( &gh_usb_cdc ));
+
+			} while ( NRF_SUCCESS == app_usbd_cdc_acm_read_any( &gh_usb_cdc, gu8_usb_cdc_rx_buf, USB_CDC_RX_BLOCK_SIZE ));
 
             break;
         
@@ -405,15 +570,22 @@ static void usb_cdc_event_cdc_hndl(app_usbd_class_inst_t const * p_inst, app_usb
 usb_cdc_status_t usb_cdc_init(void)
 {
 	usb_cdc_status_t                status      = eUSB_CDC_OK;
-    static const app_usbd_config_t  usbd_config = { .ev_state_proc = usb_cdc_event_usbd_hndl };
+    static const app_usbd_config_t  usbd_config = 
+    { 
+        .ev_isr_handler = usb_cdc_event_isr_hndl,
+        .ev_state_proc  = usb_cdc_event_usbd_hndl 
+    };
 
 	if ( false == gb_is_init )
 	{
 		// Init Rx/Tx buffers
 		status |= usb_cdc_init_buffers();
 
-        // Init clock 
-        if ( NRF_SUCCESS != nrf_drv_clock_init())
+        // Init clock (might be initialized already by systick)
+        const ret_code_t clk_err = nrf_drv_clock_init();
+
+        if  (   ( NRF_SUCCESS != clk_err )
+            &&  ( NRF_ERROR_MODULE_ALREADY_INITIALIZED != clk_err ))
         {
             status = eUSB_CDC_ERROR;
         }
@@ -496,6 +668,9 @@ usb_cdc_status_t usb_cdc_hndl(void)
                 break;
             }
 		}
+
+        // Update reception statistics
+        usb_cdc_rx_stats_hndl();
 	}
     else
     {
@@ -507,9 +682,12 @@ usb_cdc_status_t usb_cdc_hndl(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Transmit over USB CDC 
+*		Transmit string over USB CDC 
 *	
-* @note This function is blocking
+* @note This function is non-blocking
+*
+* @note	Error is returned unless whole string is queued, that is also
+*		when port is closed. Part that fitted into Tx buffer is sent.
 *
 * @param[in] 	str     - String to be send
 * @return 		status	- Status of operation
@@ -517,51 +695,72 @@ usb_cdc_status_t usb_cdc_hndl(void)
 ////////////////////////////////////////////////////////////////////////////////
 usb_cdc_status_t usb_cdc_write(const char* str)
 {
-	usb_cdc_status_t status = eUSB_CDC_OK;
+	usb_cdc_status_t    status      = eUSB_CDC_OK;
+    uint32_t            accepted    = 0;
     
-	USB_CDC_ASSERT( true == gb_is_init );
 	USB_CDC_ASSERT( NULL != str );
 
+    if ( NULL != str )
+    {
+        const uint32_t len = strlen( str );
+
+        status = usb_cdc_write_buf((const uint8_t*) str, len, &accepted );
+
+        // Not all data queued
+        if ( accepted != len )
+        {
+            status = eUSB_CDC_ERROR;
+        }
+    }
+    else
+    {
+        status = eUSB_CDC_ERROR;
+    }
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transmit data over USB CDC 
+*	
+* @note This function is non-blocking. Data are queued into Tx buffer and
+*       send in packets, each next one started on previous transmission
+*       done event.
+*
+* @note	Data are queued only while port is open. With port closed
+*		nothing is queued, "p_accepted" is zero and status is OK.
+*
+* @param[in] 	p_data      - Pointer to data to be send
+* @param[in] 	size        - Size of data in bytes
+* @param[out] 	p_accepted  - Number of bytes accepted into Tx buffer
+* @return 		status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+usb_cdc_status_t usb_cdc_write_buf(const uint8_t * const p_data, const uint32_t size, uint32_t * const p_accepted)
+{
+	usb_cdc_status_t    status      = eUSB_CDC_OK;
+    uint32_t            accepted    = 0;
+    
+	USB_CDC_ASSERT( true == gb_is_init );
+	USB_CDC_ASSERT( NULL != p_data );
+	USB_CDC_ASSERT( NULL != p_accepted );
+
     if  (   ( true == gb_is_init )
-        &&  ( NULL != str ))
+        &&  ( NULL != p_data )
+        &&  ( NULL != p_accepted ))
     {
         // Is VCP open?
     	if ( true == gb_is_port_open )
     	{
-            // Raise tx in progress flag
-    		gb_tx_in_progress = true;
-
-            // Start transmission
-    		app_usbd_cdc_acm_write( &gh_usb_cdc, str, strlen(str));
-
-            // Get current time
-            const uint32_t timestamp_start = systick_get_ms();
-
-            /*
-             *  Wait until transmission is over, where "APP_USBD_CDC_ACM_USER_EVT_TX_DONE" event is
-             *  raised.
-             * 
-             *  Check also if port is still open as it might happend that during transmission USB 
-             *  cable is removed!
-             */
-    		while   (   ( true == gb_tx_in_progress )
-                    &&  ( true == gb_is_port_open ))
-    		{
-                // Check for timeout
-    	        if (((uint32_t) ( systick_get_ms() - timestamp_start )) > USB_CDC_TX_TIMOUT_MS )
-                {
-                    status = eUSB_CDC_ERROR;
-                
-                    USB_CDC_DBG_PRINT( "USB_CDC: Waiting for tx done timeouted! " );
-                    USB_CDC_ASSERT( 0 );
-
-                    break;
-                }
+            // Queue as much as fits
+            (void) spsc_fifo_add_n( &g_tx_buffer, p_data, size, &accepted );
 
-                // Handle events
-    			usb_cdc_hndl();
-    		}
+            // Start transmission if idle
+            usb_cdc_tx_start();
     	}
+
+        *p_accepted = accepted;
     }
     else
     {
@@ -571,6 +770,40 @@ usb_cdc_status_t usb_cdc_write(const char* str)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get free space of USB CDC Tx buffer
+*
+* @note	Lets caller queue frame all or nothing. All writes are done
+*		from main loop, thus free space can only grow until next
+*		"usb_cdc_write_buf()" call.
+*
+* @note	With port closed nothing can be queued and free space is zero.
+*
+* @param[out] 	p_free	- Free space in Tx buffer. Unit: byte
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+usb_cdc_status_t usb_cdc_get_tx_free(uint32_t * const p_free)
+{
+	usb_cdc_status_t status = eUSB_CDC_OK;
+
+	USB_CDC_ASSERT( true == gb_is_init );
+	USB_CDC_ASSERT( NULL != p_free );
+
+	if	(	( true == gb_is_init )
+		&&	( NULL != p_free ))
+	{
+		*p_free = ( true == gb_is_port_open ) ? spsc_fifo_get_free( &g_tx_buffer ) : 0UL;
+	}
+	else
+	{
+		status = eUSB_CDC_ERROR;
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Receive character from USB CDC
@@ -592,7 +825,7 @@ usb_cdc_status_t usb_cdc_get(char * const p_char)
 		&&	( NULL != p_char ))
 	{
 		// Get from buffer
-		if ( eRING_BUFFER_OK != ring_buffer_get( g_rx_buffer, p_char ))
+		if ( eSPSC_FIFO_OK != spsc_fifo_get( &g_rx_buffer, (uint8_t*) p_char ))
 		{
 			status = eUSB_CDC_ERROR;
 		}
@@ -605,6 +838,70 @@ usb_cdc_status_t usb_cdc_get(char * const p_char)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read block of data from USB CDC
+*
+* @note This function is non-blocking
+*
+* @param[out] 	p_buf	- Pointer to buffer for received data
+* @param[in] 	size	- Size of buffer in bytes
+* @param[out] 	p_read	- Number of bytes actually read
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+usb_cdc_status_t usb_cdc_read(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_read)
+{
+	usb_cdc_status_t    status  = eUSB_CDC_OK;
+    uint32_t            read    = 0;
+
+	USB_CDC_ASSERT( true == gb_is_init );
+	USB_CDC_ASSERT( NULL != p_buf );
+	USB_CDC_ASSERT( NULL != p_read );
+
+	if	(	( true == gb_is_init ) 
+		&&	( NULL != p_buf )
+		&&	( NULL != p_read ))
+	{
+        // Take as much as available
+		(void) spsc_fifo_get_n( &g_rx_buffer, p_buf, size, &read );
+
+        *p_read = read;
+	}
+	else
+	{
+		status = eUSB_CDC_ERROR;
+	}
+	
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get USB CDC reception statistics
+*
+* @param[out] 	p_stats	- Pointer to reception statistics
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+usb_cdc_status_t usb_cdc_get_rx_stats(usb_cdc_rx_stats_t * const p_stats)
+{
+	usb_cdc_status_t status = eUSB_CDC_OK;
+
+	USB_CDC_ASSERT( NULL != p_stats );
+
+	if ( NULL != p_stats )
+	{
+		*p_stats = g_rx_stats;
+	}
+	else
+	{
+		status = eUSB_CDC_ERROR;
+	}
+	
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		USB cable plugged event callback 
@@ -661,6 +958,23 @@ __attribute__((weak)) void usb_cdc_port_close_cb(void)
 	 */
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		USB event queued callback
+*
+* @note		Called from USBD ISR context after event is put into queue. 
+*			Event itself is processed later inside "usb_cdc_hndl()".
+*
+* @return 	void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((weak)) void usb_cdc_event_isr_cb(void)
+{
+	/**
+	 * 	Leave empty for user application purposes...
+	 */
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -15,6 +15,17 @@
 * @{ <!-- BEGIN GROUP -->
 *
 * 	Debug USB_CDC API
+*
+* 	Transmission is queued and non-blocking. Data are queued only while
+* 	host has port open:
+*
+* 		usb_cdc_write		- error unless whole string is queued,
+* 							  thus also when port is closed
+* 		usb_cdc_write_buf	- OK with number of accepted bytes, zero
+* 							  when port is closed
+*
+* 	Data left in Tx buffer when port closes are sent once it is opened
+* 	again, packet in transfer at close is dropped.
 */
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +52,16 @@ typedef enum
     eUSB_CDC_ERROR,		/**<General error code */
 } usb_cdc_status_t;
 
+/**
+ * 	USB CDC reception statistics
+ */
+typedef struct
+{
+    uint32_t    bytes;      /**<Total number of received bytes */
+    uint32_t    rate;       /**<Reception throughput. Unit: byte/s */
+    uint32_t    overruns;   /**<Number of reception buffer overruns */
+} usb_cdc_rx_stats_t;
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -48,12 +69,17 @@ typedef enum
 usb_cdc_status_t usb_cdc_init	(void);
 usb_cdc_status_t usb_cdc_hndl	(void);
 usb_cdc_status_t usb_cdc_write	(const char* str);
+usb_cdc_status_t usb_cdc_write_buf(const uint8_t * const p_data, const uint32_t size, uint32_t * const p_accepted);
+usb_cdc_status_t usb_cdc_get_tx_free(uint32_t * const p_free);
 usb_cdc_status_t usb_cdc_get	(char * const p_char);
+usb_cdc_status_t usb_cdc_read	(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_read);
+usb_cdc_status_t usb_cdc_get_rx_stats(usb_cdc_rx_stats_t * const p_stats);
 
 void usb_cdc_plugged_cb         (void);
 void usb_cdc_unplugged_cb       (void);
 void usb_cdc_port_open_cb       (void);
 void usb_cdc_port_close_cb      (void);
+void usb_cdc_event_isr_cb       (void);
 
 #endif // __USC_CDC_H
 
@@ -27,6 +27,10 @@
 
 // Middleware
 #include "middleware/watchdog/watchdog/src/wdt.h"
+#include "middleware/watchdog/wdt_sup.h"
+#include "middleware/scheduler/scheduler.h"
+#include "middleware/cli/cli_log.h"
+#include "middleware/journal/journal.h"
 
 // Application
 #include "app.h"
@@ -59,16 +63,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 int main(void)
 {
-	uint32_t cnt           = systick_get_ms();
-	uint32_t cnt_p_10ms    = cnt;
-	uint32_t cnt_p_100ms   = cnt;
-	uint32_t cnt_p_1000ms  = cnt;
-
     // Init systick
     systick_init();
 
+    // Latch reset reason and take over journal of previous run
+    (void) journal_init();
+
     // Init watchdog
-    if ( eWDT_OK != wdt_init())
+    if  (   ( eWDT_OK != wdt_init())
+        ||  ( eWDT_OK != wdt_sup_init()))
     {
         PROJECT_CONFIG_ASSERT(0);
     }
@@ -82,38 +85,20 @@ int main(void)
     // Init application
     app_init();
 
+    // Init scheduler
+    if ( eSCHED_OK != sched_init())
+    {
+        PROJECT_CONFIG_ASSERT(0);
+    }
+
     // Main loop
     while ( 1 )
     {
-        // Get current systick
-        cnt = systick_get_ms();
-
-        // 10ms loop
-        if (((uint32_t)( cnt - cnt_p_10ms )) >= 10UL )
-        {
-            cnt_p_10ms = cnt;
-
-            app_hndl_10ms();
-
-            // Kick watchdog every 10ms
-            wdt_task_report( eWDT_TASK_MAIN );
-        }
-
-        // 100ms loop
-        if (((uint32_t)( cnt - cnt_p_100ms )) >= 100UL )
-        {
-            cnt_p_100ms = cnt;
-
-            app_hndl_100ms();
-        }
-
-        // 1000ms loop
-        if (((uint32_t)( cnt - cnt_p_1000ms )) >= 1000UL )
-        {
-            cnt_p_1000ms = cnt;
+        // Run ready tasks or sleep
+        sched_hndl();
 
-            app_hndl_1000ms();
-        }
+        // Format and send deferred logs
+        cli_log_hndl();
 
         // Handle watchdog
         wdt_hndl();
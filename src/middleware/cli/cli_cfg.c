@@ -97,6 +97,10 @@ static cli_cfg_ch_data_t g_cli_ch[eCLI_CH_NUM_OF] =
 		
 		{ 	.par_num = ePAR_BTN_1,						.name="BUTTON STATE" 						},
 		{ 	.par_num = ePAR_AIN_1,						.name="ADC VALUES"	 						},
+		{ 	.par_num = ePAR_USB_RX_RATE,				.name="USB CDC"		 						},
+		{ 	.par_num = ePAR_UART1_RX_OVERRUN,			.name="UART1"		 						},
+		{ 	.par_num = ePAR_SCHED_CPU_LOAD,				.name="SCHEDULER"	 						},
+		{ 	.par_num = ePAR_RST_REASON,					.name="RESET JOURNAL"	 					},
 
 
 		// USER CODE END
@@ -0,0 +1,348 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      cli_idx.c
+*@brief     CLI command name index
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CLI_IDX
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Hash table uses FNV-1a hash with linear probing. Slot holds position
+* 	of command in entry table plus one, zero marks empty slot.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "cli_idx.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	FNV-1a constants
+ */
+#define CLI_IDX_FNV_OFFSET						( 2166136261UL )
+#define CLI_IDX_FNV_PRIME						( 16777619UL )
+
+/**
+ * 	Indexed command
+ */
+typedef struct
+{
+	const char *	p_name;		/**<Command name */
+	const void *	p_cmd;		/**<Command, owned by registered table */
+	uint32_t		hash;		/**<Hash of name */
+} cli_idx_entry_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Indexed commands in order of registration
+ */
+static cli_idx_entry_t g_cli_idx_entry[CLI_IDX_MAX_CMD] = {0};
+static uint32_t gu32_cli_idx_num_of = 0;
+
+/**
+ * 	Hash slots
+ */
+static uint16_t gu16_cli_idx_slot[CLI_IDX_HASH_SIZE] = {0};
+
+/**
+ * 	Entry positions sorted by name
+ */
+static uint16_t gu16_cli_idx_sorted[CLI_IDX_MAX_CMD] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t cli_idx_hash		(const char * const p_str, const uint32_t len);
+static uint32_t cli_idx_lower_bound	(const char * const p_str, const uint32_t len);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate FNV-1a hash
+*
+* @param[in]	p_str	- Pointer to string
+* @param[in]	len		- Length of string
+* @return		hash	- Hash value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t cli_idx_hash(const char * const p_str, const uint32_t len)
+{
+	uint32_t hash = CLI_IDX_FNV_OFFSET;
+
+	for ( uint32_t i = 0; i < len; i++ )
+	{
+		hash ^= (uint8_t) p_str[i];
+		hash *= CLI_IDX_FNV_PRIME;
+	}
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find first sorted position with name not less than given string
+*
+* @note		Only first "len" characters of names are compared, thus
+* 			returned position is first name starting with given prefix
+* 			if there is any.
+*
+* @param[in]	p_str	- Pointer to string
+* @param[in]	len		- Length of string
+* @return		pos		- Sorted position
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t cli_idx_lower_bound(const char * const p_str, const uint32_t len)
+{
+	uint32_t lo = 0;
+	uint32_t hi = gu32_cli_idx_num_of;
+
+	while ( lo < hi )
+	{
+		const uint32_t mid = ( lo + hi ) / 2U;
+
+		if ( strncmp( g_cli_idx_entry[ gu16_cli_idx_sorted[mid] ].p_name, p_str, len ) < 0 )
+		{
+			lo = mid + 1U;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CLI_IDX_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of CLI command index API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add command to index
+*
+* @note		Call for each command when its table is registered. Cost of
+* 			adding is linear due to sorted insertion, lookup afterwards
+* 			does not depend on number of commands.
+*
+* @param[in]	p_name	- Command name, must stay valid
+* @param[in]	p_cmd	- Command, returned by lookup
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_idx_add(const char * const p_name, const void * const p_cmd)
+{
+	cli_status_t 	status	= eCLI_OK;
+	const void * 	p_found	= NULL;
+
+	CLI_ASSERT( NULL != p_name );
+
+	if 	(	( NULL != p_name )
+		&&	( gu32_cli_idx_num_of < CLI_IDX_MAX_CMD )
+		&&	( eCLI_OK != cli_idx_find( p_name, strlen( p_name ), &p_found )))
+	{
+		const uint32_t 	len 	= strlen( p_name );
+		const uint32_t	hash	= cli_idx_hash( p_name, len );
+		const uint32_t	pos		= gu32_cli_idx_num_of;
+		uint32_t		slot	= hash & ( CLI_IDX_HASH_SIZE - 1U );
+
+		g_cli_idx_entry[pos].p_name = p_name;
+		g_cli_idx_entry[pos].p_cmd 	= p_cmd;
+		g_cli_idx_entry[pos].hash 	= hash;
+
+		// Hash slot, table is never full due to size check
+		while ( 0U != gu16_cli_idx_slot[slot] )
+		{
+			slot = ( slot + 1U ) & ( CLI_IDX_HASH_SIZE - 1U );
+		}
+
+		gu16_cli_idx_slot[slot] = (uint16_t)( pos + 1U );
+
+		// Sorted position
+		const uint32_t ins = cli_idx_lower_bound( p_name, len + 1U );
+
+		for ( uint32_t i = pos; i > ins; i-- )
+		{
+			gu16_cli_idx_sorted[i] = gu16_cli_idx_sorted[i-1];
+		}
+
+		gu16_cli_idx_sorted[ins] = (uint16_t) pos;
+
+		gu32_cli_idx_num_of++;
+	}
+	else
+	{
+		status = eCLI_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find command by name
+*
+* @note		String does not need to be terminated, thus command can be
+* 			looked up directly inside received line.
+*
+* @param[in]	p_str	- Pointer to command name
+* @param[in]	len		- Length of command name
+* @param[out]	pp_cmd	- Found command
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_idx_find(const char * const p_str, const uint32_t len, const void ** const pp_cmd)
+{
+	cli_status_t status = eCLI_ERROR;
+
+	if 	(	( NULL != p_str )
+		&&	( NULL != pp_cmd ))
+	{
+		const uint32_t	hash	= cli_idx_hash( p_str, len );
+		uint32_t		slot	= hash & ( CLI_IDX_HASH_SIZE - 1U );
+
+		while 	(	( eCLI_OK != status )
+				&&	( 0U != gu16_cli_idx_slot[slot] ))
+		{
+			const cli_idx_entry_t * const p_entry = &g_cli_idx_entry[ gu16_cli_idx_slot[slot] - 1U ];
+
+			if 	(	( hash == p_entry->hash )
+				&&	( 0 == strncmp( p_entry->p_name, p_str, len ))
+				&&	( '\0' == p_entry->p_name[len] ))
+			{
+				*pp_cmd = p_entry->p_cmd;
+				status 	= eCLI_OK;
+			}
+
+			slot = ( slot + 1U ) & ( CLI_IDX_HASH_SIZE - 1U );
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find commands starting with prefix
+*
+* @note		Names of matches are obtained by "cli_idx_get_name()" from
+* 			"first" to "first + num_of - 1" position.
+*
+* @param[in]	p_prefix	- Pointer to prefix
+* @param[in]	len			- Length of prefix
+* @param[out]	p_match		- Search result
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_idx_complete(const char * const p_prefix, const uint32_t len, cli_idx_match_t * const p_match)
+{
+	cli_status_t status = eCLI_OK;
+
+	if 	(	( NULL != p_prefix )
+		&&	( NULL != p_match ))
+	{
+		const uint32_t 	first 	= cli_idx_lower_bound( p_prefix, len );
+		uint32_t		last	= first;
+
+		while 	(	( last < gu32_cli_idx_num_of )
+				&&	( 0 == strncmp( cli_idx_get_name( last ), p_prefix, len )))
+		{
+			last++;
+		}
+
+		p_match->first 		= first;
+		p_match->num_of 	= last - first;
+		p_match->common_len = 0;
+
+		// Names are sorted, common prefix of first and last is common to all
+		if ( p_match->num_of > 0U )
+		{
+			const char * const p_first 	= cli_idx_get_name( first );
+			const char * const p_last 	= cli_idx_get_name( last - 1U );
+			uint32_t i = 0;
+
+			while 	(	( '\0' != p_first[i] )
+					&&	( p_first[i] == p_last[i] ))
+			{
+				i++;
+			}
+
+			p_match->common_len = i;
+		}
+	}
+	else
+	{
+		status = eCLI_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get command name by sorted position
+*
+* @param[in]	pos		- Sorted position
+* @return		p_name	- Command name, NULL if out of range
+*/
+////////////////////////////////////////////////////////////////////////////////
+const char * cli_idx_get_name(const uint32_t pos)
+{
+	const char * p_name = NULL;
+
+	if ( pos < gu32_cli_idx_num_of )
+	{
+		p_name = g_cli_idx_entry[ gu16_cli_idx_sorted[pos] ].p_name;
+	}
+
+	return p_name;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of indexed commands
+*
+* @return		num_of	- Number of commands
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t cli_idx_get_num_of(void)
+{
+	return gu32_cli_idx_num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,94 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      cli_idx.h
+*@brief     CLI command name index
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CLI_IDX
+* @{ <!-- BEGIN GROUP -->
+*
+* 	CLI command name index
+*
+* 	Index is built once, when command tables are registered. Command
+* 	lookup is hash based and costs O(length of command) regardless of
+* 	number of registered commands. Names are additionally kept sorted,
+* 	thus commands starting with given prefix form continuous range,
+* 	used for tab completion.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CLI_IDX_H
+#define __CLI_IDX_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cli_cfg.h"
+#include "cli/src/cli.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Maximum number of indexed commands
+ *
+ * @note	All user tables plus built-in table.
+ */
+#define CLI_IDX_MAX_CMD							( CLI_CFG_MAX_NUM_OF_COMMANDS * ( CLI_CFG_MAX_NUM_OF_USER_TABLES + 1 ))
+
+/**
+ * 	Number of hash slots
+ *
+ * @note	Must be power of two and at least twice CLI_IDX_MAX_CMD,
+ * 			so that probe sequences stay short.
+ */
+#define CLI_IDX_HASH_SIZE						( 256U )
+
+/**
+ * 	Prefix search result
+ */
+typedef struct
+{
+	uint32_t	first;			/**<Sorted position of first match */
+	uint32_t	num_of;			/**<Number of matching commands */
+	uint32_t	common_len;		/**<Length of prefix common to all matches */
+} cli_idx_match_t;
+
+/**
+ * 	Invalid configuration catcher
+ */
+#if ( 0 != ( CLI_IDX_HASH_SIZE & ( CLI_IDX_HASH_SIZE - 1 )))
+	#error "CLI index hash size must be power of two! Adjust <CLI_IDX_HASH_SIZE> macro inside cli_idx.h file!"
+#endif
+
+#if ( CLI_IDX_HASH_SIZE < ( 2 * CLI_IDX_MAX_CMD ))
+	#error "CLI index hash size too small for number of commands! Adjust <CLI_IDX_HASH_SIZE> macro inside cli_idx.h file!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_idx_add			(const char * const p_name, const void * const p_cmd);
+cli_status_t cli_idx_find			(const char * const p_str, const uint32_t len, const void ** const pp_cmd);
+cli_status_t cli_idx_complete		(const char * const p_prefix, const uint32_t len, cli_idx_match_t * const p_match);
+const char * cli_idx_get_name		(const uint32_t pos);
+uint32_t	 cli_idx_get_num_of		(void);
+
+#endif // __CLI_IDX_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -28,8 +28,18 @@
 
 // USER CODE BEGIN...
 
-// Communication driver
+#include <string.h>
+
+// Communication drivers
 #include "drivers/peripheral/uart/uart_dbg.h"
+#include "drivers/peripheral/uart/uart.h"
+#include "drivers/peripheral/usb_cdc/usb_cdc.h"
+
+// Binary parameter protocol on the same port
+#include "middleware/parameters/par_proto.h"
+
+// Command index for tab completion
+#include "cli_idx.h"
 
 // For reset
 #include "nrf_nvic.h"
@@ -42,6 +52,29 @@
 
 // USER CODE BEGIN..
 
+/**
+ * 	Size of transport line buffer
+ *
+ * 	Unit: byte
+ */
+#define CLI_IF_LINE_SIZE						( CLI_CFG_RX_BUF_SIZE )
+
+/**
+ * 	No transport
+ */
+#define CLI_IF_TRANSPORT_NONE					( eCLI_IF_TRANSPORT_NUM_OF )
+
+/**
+ * 	Transport
+ */
+typedef struct
+{
+	uint8_t		line[CLI_IF_LINE_SIZE];		/**<Received line */
+	uint32_t	len;						/**<Length of received line */
+	bool		ready;						/**<Line complete */
+	bool		en;							/**<Transport enabled */
+	bool		log_en;						/**<Transport receives output not related to command */
+} cli_if_transport_data_t;
 
 // USER CODE END...
 
@@ -51,6 +84,43 @@
 
 // USER CODE BEGIN...
 
+/**
+ * 	Transports
+ *
+ * @note	Debug UART is enabled at init, others once their driver
+ * 			is initialized by application.
+ */
+static cli_if_transport_data_t g_cli_if_transport[eCLI_IF_TRANSPORT_NUM_OF] =
+{
+	[eCLI_IF_TRANSPORT_UART_DBG]	= { .en = false,	.log_en = true 	},
+	[eCLI_IF_TRANSPORT_USB_CDC]		= { .en = false,	.log_en = false	},
+	[eCLI_IF_TRANSPORT_UART_1]		= { .en = false,	.log_en = false	},
+};
+
+/**
+ * 	Transport whose line is being passed to CLI
+ */
+static cli_if_transport_t g_cli_if_feed = CLI_IF_TRANSPORT_NONE;
+static uint32_t gu32_cli_if_feed_idx = 0;
+
+/**
+ * 	Transport of last line, round robin starts after it
+ */
+static cli_if_transport_t g_cli_if_last = CLI_IF_TRANSPORT_NONE;
+
+/**
+ * 	Transport receiving CLI output
+ *
+ * @note	Set when byte of its line is passed to CLI and cleared on
+ * 			next receive call, thus covers echo and whole execution of
+ * 			command dispatched on line feed.
+ */
+static cli_if_transport_t g_cli_if_resp = CLI_IF_TRANSPORT_NONE;
+
+/**
+ * 	Output is log, goes to logging transports
+ */
+static bool gb_cli_if_log = false;
 
 // USER CODE END...
 
@@ -58,11 +128,215 @@
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
 
+// USER CODE BEGIN...
+
+static bool cli_if_transport_get	(const cli_if_transport_t transport, uint8_t * const p_byte);
+static void cli_if_transport_write	(const cli_if_transport_t transport, const uint8_t * const p_data, const uint32_t size);
+static void cli_if_collect			(void);
+static void cli_if_complete			(const cli_if_transport_t transport);
+
+// USER CODE END...
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 
+// USER CODE BEGIN...
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get received byte from transport
+*
+* @note		Bytes of binary parameter protocol frames are filtered out.
+*
+* @param[in]	transport	- Transport
+* @param[out]	p_byte		- Received byte
+* @return 		true if text byte received
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool cli_if_transport_get(const cli_if_transport_t transport, uint8_t * const p_byte)
+{
+	char ch 		= 0;
+	bool is_text 	= false;
+
+	switch ( transport )
+	{
+		case eCLI_IF_TRANSPORT_UART_DBG:
+			while 	(	( false == is_text )
+					&&	( eUART_DBG_OK == uart_dbg_get( &ch )))
+			{
+				is_text = !par_proto_filter( ePAR_PROTO_CH_UART_DBG, (uint8_t) ch );
+			}
+			break;
+
+		case eCLI_IF_TRANSPORT_USB_CDC:
+			while 	(	( false == is_text )
+					&&	( eUSB_CDC_OK == usb_cdc_get( &ch )))
+			{
+				is_text = !par_proto_filter( ePAR_PROTO_CH_USB_CDC, (uint8_t) ch );
+			}
+			break;
+
+		case eCLI_IF_TRANSPORT_UART_1:
+			is_text = ( eUART_OK == uart_1_get( &ch ));
+			break;
+
+		default:
+			// No actions...
+			break;
+	}
+
+	*p_byte = (uint8_t) ch;
+
+	return is_text;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write to transport
+*
+* @note		All drivers queue data, thus slow transport does not block
+* 			others. Data not fitting into queue are dropped.
+*
+* @param[in]	transport	- Transport
+* @param[in]	p_data		- Pointer to data
+* @param[in]	size		- Size of data
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void cli_if_transport_write(const cli_if_transport_t transport, const uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t accepted = 0;
+
+	switch ( transport )
+	{
+		case eCLI_IF_TRANSPORT_UART_DBG:
+			(void) uart_dbg_write_buf( p_data, size );
+			break;
+
+		case eCLI_IF_TRANSPORT_USB_CDC:
+			(void) usb_cdc_write_buf( p_data, size, &accepted );
+			break;
+
+		case eCLI_IF_TRANSPORT_UART_1:
+			(void) uart_1_write_buf( p_data, size );
+			break;
+
+		default:
+			// No actions...
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Collect received bytes into per transport line buffers
+*
+* @note		Each transport is read until its line is complete, lines
+* 			are then passed to CLI one at a time.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void cli_if_collect(void)
+{
+	for ( uint32_t t = 0; t < eCLI_IF_TRANSPORT_NUM_OF; t++ )
+	{
+		cli_if_transport_data_t * const p_t = &g_cli_if_transport[t];
+		uint8_t byte = 0;
+
+		while 	(	( true == p_t->en )
+				&&	( false == p_t->ready )
+				&&	( true == cli_if_transport_get( t, &byte )))
+		{
+			if ( '\t' == byte )
+			{
+				cli_if_complete( t );
+			}
+			else
+			{
+				p_t->line[p_t->len++] = byte;
+
+				if 	(	( '\r' == byte )
+					||	( '\n' == byte )
+					||	( CLI_IF_LINE_SIZE <= p_t->len ))
+				{
+					p_t->ready = true;
+				}
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Complete command name in transport line
+*
+* @note		Only command name (line without space) is completed. Single
+* 			match is completed fully, multiple matches up to their common
+* 			prefix. If nothing can be added, matches are listed and line
+* 			is echoed back.
+*
+* @param[in]	transport	- Transport
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void cli_if_complete(const cli_if_transport_t transport)
+{
+	cli_if_transport_data_t * const p_t 	= &g_cli_if_transport[transport];
+	cli_idx_match_t 				match 	= {0};
+	static char						echo[CLI_IF_LINE_SIZE + 1];
+
+	if 	(	( NULL == memchr( p_t->line, ' ', p_t->len ))
+		&&	( eCLI_OK == cli_idx_complete((const char*) p_t->line, p_t->len, &match ))
+		&&	( match.num_of > 0U ))
+	{
+		const char * const 	p_name 	= cli_idx_get_name( match.first );
+		const uint32_t		start	= p_t->len;
+
+		// Keep space for line termination
+		while 	(	( p_t->len < match.common_len )
+				&&	( p_t->len < ( CLI_IF_LINE_SIZE - 2U )))
+		{
+			p_t->line[p_t->len] = (uint8_t) p_name[p_t->len];
+			p_t->len++;
+		}
+
+		if 	(	( 1U == match.num_of )
+			&&	( p_t->len == match.common_len ))
+		{
+			p_t->line[p_t->len++] = ' ';
+		}
+
+		if ( p_t->len > start )
+		{
+			memcpy( echo, &p_t->line[start], ( p_t->len - start ));
+			echo[p_t->len - start] = '\0';
+			cli_if_transport_write( transport, (const uint8_t*) echo, ( p_t->len - start ));
+		}
+		else
+		{
+			cli_if_transport_write( transport, (const uint8_t*) "\r\n", 2U );
+
+			for ( uint32_t i = 0; i < match.num_of; i++ )
+			{
+				const char * const p_match = cli_idx_get_name( match.first + i );
+
+				cli_if_transport_write( transport, (const uint8_t*) p_match, strlen( p_match ));
+				cli_if_transport_write( transport, (const uint8_t*) "  ", 2U );
+			}
+
+			cli_if_transport_write( transport, (const uint8_t*) "\r\n", 2U );
+
+			memcpy( echo, p_t->line, p_t->len );
+			echo[p_t->len] = '\0';
+			cli_if_transport_write( transport, (const uint8_t*) echo, p_t->len );
+		}
+	}
+}
+
+// USER CODE END...
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Initialize Command Line Interface communication port
@@ -80,6 +354,10 @@ cli_status_t cli_if_init(void)
 	{
 		status = eCLI_ERROR_INIT;
 	}
+	else
+	{
+		g_cli_if_transport[eCLI_IF_TRANSPORT_UART_DBG].en = true;
+	}
 
 	// USER CODE END...
 
@@ -119,7 +397,46 @@ cli_status_t cli_if_receive(uint8_t * const p_data)
 
 	// USER CODE BEGIN...
 
-	if ( eUART_DBG_OK != uart_dbg_get((char*) p_data))
+	// Handling of previous byte is over
+	g_cli_if_resp = CLI_IF_TRANSPORT_NONE;
+
+	cli_if_collect();
+
+	// Take next complete line, round robin
+	if ( CLI_IF_TRANSPORT_NONE == g_cli_if_feed )
+	{
+		for ( uint32_t i = 1; i <= eCLI_IF_TRANSPORT_NUM_OF; i++ )
+		{
+			const uint32_t t = ( g_cli_if_last + i ) % eCLI_IF_TRANSPORT_NUM_OF;
+
+			if ( true == g_cli_if_transport[t].ready )
+			{
+				g_cli_if_feed 			= t;
+				g_cli_if_last 			= t;
+				gu32_cli_if_feed_idx 	= 0;
+				break;
+			}
+		}
+	}
+
+	if ( CLI_IF_TRANSPORT_NONE != g_cli_if_feed )
+	{
+		cli_if_transport_data_t * const p_t = &g_cli_if_transport[g_cli_if_feed];
+
+		*p_data = p_t->line[gu32_cli_if_feed_idx++];
+
+		// Echo and command dispatched on line feed answer to this transport
+		g_cli_if_resp = g_cli_if_feed;
+
+		// Line passed
+		if ( gu32_cli_if_feed_idx >= p_t->len )
+		{
+			p_t->len 		= 0;
+			p_t->ready 		= false;
+			g_cli_if_feed 	= CLI_IF_TRANSPORT_NONE;
+		}
+	}
+	else
 	{
 		status = eCLI_ERROR;
 	}
@@ -143,9 +460,24 @@ cli_status_t cli_if_transmit(const uint8_t * const p_data)
 
 	// USER CODE BEGIN...
 
-	if ( eUART_DBG_OK != uart_dbg_write((const char*) p_data))
+	const uint32_t size = strlen((const char*) p_data );
+
+	// Command response to its transport only, logs and rest to logging transports
+	if 	(	( false == gb_cli_if_log )
+		&&	( CLI_IF_TRANSPORT_NONE != g_cli_if_resp ))
 	{
-		status = eCLI_ERROR;
+		cli_if_transport_write( g_cli_if_resp, p_data, size );
+	}
+	else
+	{
+		for ( uint32_t t = 0; t < eCLI_IF_TRANSPORT_NUM_OF; t++ )
+		{
+			if 	(	( true == g_cli_if_transport[t].en )
+				&&	( true == g_cli_if_transport[t].log_en ))
+			{
+				cli_if_transport_write( t, p_data, size );
+			}
+		}
 	}
 
 	// USER CODE END...
@@ -230,6 +562,120 @@ cli_status_t cli_if_device_reset(void)
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Enable/Disable CLI transport
+*
+* @note	Transport driver must be initialized before enabling it!
+*
+* @param[in]	transport	- Transport
+* @param[in]	en			- Enable flag
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_if_set_en(const cli_if_transport_t transport, const bool en)
+{
+	cli_status_t status = eCLI_OK;
+
+	if ( transport < eCLI_IF_TRANSPORT_NUM_OF )
+	{
+		g_cli_if_transport[transport].en = en;
+	}
+	else
+	{
+		status = eCLI_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Enable/Disable logging output on CLI transport
+*
+* @note	Command responses are always sent to transport command came from.
+*
+* @param[in]	transport	- Transport
+* @param[in]	en			- Enable flag
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_if_set_log_en(const cli_if_transport_t transport, const bool en)
+{
+	cli_status_t status = eCLI_OK;
+
+	if ( transport < eCLI_IF_TRANSPORT_NUM_OF )
+	{
+		g_cli_if_transport[transport].log_en = en;
+	}
+	else
+	{
+		status = eCLI_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Route CLI output to logging transports
+*
+* @note	Set around output that is log, so it is not taken for response
+* 		of command being handled.
+*
+* @param[in]	log			- Output is log
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_if_set_log_out(const bool log)
+{
+	cli_status_t status = eCLI_OK;
+
+	gb_cli_if_log = log;
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Register user command table
+*
+* @note	Use instead of "cli_register_cmd_table()", so that command names
+* 		are indexed for lookup and tab completion.
+*
+* @param[in]	p_cmd_table	- Pointer to command table
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_if_register_cmd_table(const cli_cmd_table_t * const p_cmd_table)
+{
+	cli_status_t status = eCLI_OK;
+
+	CLI_ASSERT( NULL != p_cmd_table );
+
+	if ( NULL != p_cmd_table )
+	{
+		status = cli_register_cmd_table( p_cmd_table );
+
+		if ( eCLI_OK == status )
+		{
+			for ( uint32_t cmd = 0; cmd < p_cmd_table->num_of; cmd++ )
+			{
+				if ( eCLI_OK != cli_idx_add( p_cmd_table->cmd[cmd].p_name, &p_cmd_table->cmd[cmd] ))
+				{
+					status = eCLI_ERROR;
+				}
+			}
+		}
+	}
+	else
+	{
+		status = eCLI_ERROR;
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -22,8 +22,24 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
 #include "cli/src/cli.h"
 
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	CLI transports
+ */
+typedef enum
+{
+	eCLI_IF_TRANSPORT_UART_DBG = 0,		/**<Debug UART (J-Link VCOM) */
+	eCLI_IF_TRANSPORT_USB_CDC,			/**<USB CDC */
+	eCLI_IF_TRANSPORT_UART_1,			/**<UART1 */
+
+	eCLI_IF_TRANSPORT_NUM_OF
+} cli_if_transport_t;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -35,6 +51,10 @@ cli_status_t cli_if_transmit		(const uint8_t * const p_data);
 cli_status_t cli_if_aquire_mutex	(void);
 cli_status_t cli_if_release_mutex	(void);
 cli_status_t cli_if_device_reset	(void);
+cli_status_t cli_if_set_en			(const cli_if_transport_t transport, const bool en);
+cli_status_t cli_if_set_log_en		(const cli_if_transport_t transport, const bool en);
+cli_status_t cli_if_set_log_out		(const bool log);
+cli_status_t cli_if_register_cmd_table	(const cli_cmd_table_t * const p_cmd_table);
 
 #endif // __CLI_H
 
@@ -0,0 +1,280 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      cli_log.c
+*@brief     Deferred logging to CLI channels
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CLI_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Entries are kept in "nrf_atfifo", which allows multiple producers
+* 	on different interrupt priorities without locking.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdarg.h>
+
+#include "cli_log.h"
+#include "cli_if.h"
+
+#include "nrf_atfifo.h"
+#include "nrf_atomic.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Log entry
+ */
+typedef struct
+{
+	const char *	p_fmt;						/**<Format string */
+	uint32_t		timestamp;					/**<Time of call, ms */
+	uint8_t			ch;							/**<CLI channel */
+	uint8_t			num_of;						/**<Number of arguments */
+	uintptr_t		args[CLI_LOG_MAX_ARGS];		/**<Raw arguments */
+} cli_log_entry_t;
+
+/**
+ * 	Formatting in "cli_log_hndl()" passes fixed number of arguments
+ */
+#if ( 6U != CLI_LOG_MAX_ARGS )
+	#error "Deferred logging supports exactly 6 arguments! Adjust <CLI_LOG_MAX_ARGS> macro inside cli_log.h file!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Log entry queue
+ */
+NRF_ATFIFO_DEF( g_cli_log_fifo, cli_log_entry_t, CLI_LOG_QUEUE_SIZE );
+
+/**
+ * 	Number of queued, processed and dropped entries
+ */
+static nrf_atomic_u32_t gu32_cli_log_logged 	= 0UL;
+static nrf_atomic_u32_t gu32_cli_log_processed 	= 0UL;
+static nrf_atomic_u32_t gu32_cli_log_dropped 	= 0UL;
+
+/**
+ * 	Maximum queue usage
+ */
+static volatile uint32_t gu32_cli_log_max_used = 0UL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CLI_LOG_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of deferred logging API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize deferred logging
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_log_init(void)
+{
+	cli_status_t status = eCLI_OK;
+
+	if ( NRF_SUCCESS == NRF_ATFIFO_INIT( g_cli_log_fifo ))
+	{
+		gb_is_init = true;
+	}
+	else
+	{
+		status = eCLI_ERROR_INIT;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Queue log entry
+*
+* @note		Use CLI_LOG_CH macro instead of calling this function
+* 			directly, as it checks channel enable and counts arguments.
+*
+* 			Safe to call from ISR. Arguments above CLI_LOG_MAX_ARGS
+* 			are ignored. All arguments must be passed as uintptr_t.
+*
+* @param[in]	ch			- CLI channel
+* @param[in]	num_of_args	- Number of arguments after format string
+* @param[in]	p_fmt		- Format string, must be string literal
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_log_push(const cli_ch_opt_t ch, const uint32_t num_of_args, const char * const p_fmt, ...)
+{
+	cli_status_t 			status 	= eCLI_OK;
+	nrf_atfifo_item_put_t	ctx		= {0};
+	cli_log_entry_t * 		p_entry	= NULL;
+
+	CLI_ASSERT( num_of_args <= CLI_LOG_MAX_ARGS );
+
+	if ( true == gb_is_init )
+	{
+		p_entry = nrf_atfifo_item_alloc( g_cli_log_fifo, &ctx );
+
+		if ( NULL != p_entry )
+		{
+			va_list args;
+
+			p_entry->p_fmt 		= p_fmt;
+			p_entry->timestamp	= systick_get_ms();
+			p_entry->ch			= (uint8_t) ch;
+			p_entry->num_of		= (uint8_t)(( num_of_args < CLI_LOG_MAX_ARGS ) ? num_of_args : CLI_LOG_MAX_ARGS );
+
+			va_start( args, p_fmt );
+
+			for ( uint32_t i = 0; i < p_entry->num_of; i++ )
+			{
+				p_entry->args[i] = va_arg( args, uintptr_t );
+			}
+
+			va_end( args );
+
+			(void) nrf_atfifo_item_put( g_cli_log_fifo, &ctx );
+
+			// Queue usage statistics
+			const uint32_t used = nrf_atomic_u32_add( &gu32_cli_log_logged, 1UL ) - gu32_cli_log_processed;
+
+			if ( used > gu32_cli_log_max_used )
+			{
+				gu32_cli_log_max_used = used;
+			}
+		}
+		else
+		{
+			(void) nrf_atomic_u32_add( &gu32_cli_log_dropped, 1UL );
+			status = eCLI_ERROR;
+		}
+	}
+	else
+	{
+		status = eCLI_ERROR_INIT;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Format and transmit queued log entries
+*
+* @note		Call from main loop. At most CLI_LOG_MAX_PER_HNDL entries
+* 			are processed per call, thus tasks are not delayed by
+* 			burst of logs.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void cli_log_hndl(void)
+{
+	nrf_atfifo_item_get_t		ctx 	= {0};
+	const cli_log_entry_t * 	p_entry	= NULL;
+	cli_log_entry_t				entry;
+	char 						str[CLI_LOG_STR_SIZE];
+
+	if ( true == gb_is_init )
+	{
+		for ( uint32_t i = 0; i < CLI_LOG_MAX_PER_HNDL; i++ )
+		{
+			p_entry = nrf_atfifo_item_get( g_cli_log_fifo, &ctx );
+
+			if ( NULL == p_entry )
+			{
+				break;
+			}
+
+			// Release slot before slow formatting
+			entry = *p_entry;
+			(void) nrf_atfifo_item_free( g_cli_log_fifo, &ctx );
+			(void) nrf_atomic_u32_add( &gu32_cli_log_processed, 1UL );
+
+			// Unused arguments are ignored by formatter
+			for ( uint32_t arg = entry.num_of; arg < CLI_LOG_MAX_ARGS; arg++ )
+			{
+				entry.args[arg] = 0U;
+			}
+
+			const int len = snprintf( str, sizeof( str ), "[%lu.%03lu] ", ( entry.timestamp / 1000UL ), ( entry.timestamp % 1000UL ));
+
+			(void) snprintf( &str[len], ( sizeof( str ) - len ), entry.p_fmt,
+							 entry.args[0], entry.args[1], entry.args[2],
+							 entry.args[3], entry.args[4], entry.args[5] );
+
+			// Not response of command being handled
+			(void) cli_if_set_log_out( true );
+			cli_printf_ch((cli_ch_opt_t) entry.ch, "%s", str );
+			(void) cli_if_set_log_out( false );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get deferred logging statistics
+*
+* @param[out]	p_stats	- Pointer to statistics
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_log_get_stats(cli_log_stats_t * const p_stats)
+{
+	cli_status_t status = eCLI_OK;
+
+	if ( NULL != p_stats )
+	{
+		p_stats->logged		= gu32_cli_log_logged;
+		p_stats->dropped	= gu32_cli_log_dropped;
+		p_stats->max_used	= gu32_cli_log_max_used;
+	}
+	else
+	{
+		status = eCLI_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
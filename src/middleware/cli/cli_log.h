@@ -0,0 +1,132 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      cli_log.h
+*@brief     Deferred logging to CLI channels
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CLI_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Deferred logging to CLI channels
+*
+* 	Call site stores only format string pointer, timestamp and raw
+* 	arguments into lock-free queue. Formatting and transmission is
+* 	done later from main loop by "cli_log_hndl()".
+*
+* 	Restrictions (same as for NRF_LOG deferred mode):
+*
+* 		- format string must be string literal,
+* 		- "%s" arguments must point to constant strings,
+* 		- arguments must be integers or pointers, each is cast to
+* 		  uintptr_t at call site,
+* 		  floats are logged with CLI_LOG_FLOAT_MARKER/CLI_LOG_FLOAT,
+* 		- at most CLI_LOG_MAX_ARGS arguments.
+*
+* 	Example:
+*
+* 		CLI_LOG_CH( eCLI_CH_APP, "Btn %d, level: " CLI_LOG_FLOAT_MARKER, btn, CLI_LOG_FLOAT( level ));
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CLI_LOG_H
+#define __CLI_LOG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cli_cfg.h"
+#include "cli/src/cli.h"
+#include "app_util.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of log entries in queue
+ *
+ * @note	Single entry takes ( 12 + sizeof(uintptr_t) * CLI_LOG_MAX_ARGS )
+ * 			bytes, 36 bytes on target.
+ */
+#define CLI_LOG_QUEUE_SIZE						( 32U )
+
+/**
+ * 	Maximum number of arguments per log entry
+ */
+#define CLI_LOG_MAX_ARGS						( 6U )
+
+/**
+ * 	Maximum number of entries processed per "cli_log_hndl()" call
+ */
+#define CLI_LOG_MAX_PER_HNDL					( 8U )
+
+/**
+ * 	Size of formatted message
+ *
+ * @note	Longer messages are truncated.
+ *
+ * 	Unit: byte
+ */
+#define CLI_LOG_STR_SIZE						( 128U )
+
+/**
+ * 	Float argument format marker and argument expansion
+ *
+ * @note	CLI_LOG_FLOAT expands to three arguments, resolution is 0.001.
+ */
+#define CLI_LOG_FLOAT_MARKER					"%s%lu.%03lu"
+#define CLI_LOG_FLOAT(val)						(( (val) < 0.0f ) ? "-" : "" ),															\
+												(uint32_t)((( (val) < 0.0f ) ? -(val) : (val) )),										\
+												(uint32_t)(((( (val) < 0.0f ) ? -(val) : (val) ) - (float32_t)(uint32_t)((( (val) < 0.0f ) ? -(val) : (val) ))) * 1000.0f )
+
+/**
+ * 	Log to CLI channel
+ *
+ * @note	Channel enable flag is checked before anything else, thus
+ * 			disabled channel costs only single lookup at call site.
+ *
+ * 	Safe to call from ISR.
+ */
+#define CLI_LOG_CH(ch, ...)						do																						\
+												{																						\
+													if ( true == cli_cfg_get_ch_en( ch ))												\
+													{																					\
+														(void) cli_log_push( (ch), NUM_VA_ARGS_LESS_1( __VA_ARGS__ ), __VA_ARGS__ );	\
+													}																					\
+												} while ( 0 )
+
+/**
+ * 	Deferred logging statistics
+ */
+typedef struct
+{
+	uint32_t	logged;		/**<Number of queued entries */
+	uint32_t	dropped;	/**<Number of entries lost due to full queue */
+	uint32_t	max_used;	/**<Maximum number of entries in queue */
+} cli_log_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_log_init		(void);
+cli_status_t cli_log_push		(const cli_ch_opt_t ch, const uint32_t num_of_args, const char * const p_fmt, ...);
+void		 cli_log_hndl		(void);
+cli_status_t cli_log_get_stats	(cli_log_stats_t * const p_stats);
+
+#endif // __CLI_LOG_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
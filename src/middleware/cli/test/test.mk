@@ -0,0 +1,12 @@
+# CLI command index, dispatch and deferred logging tests
+CLI_DIR := $(ROOT)/src/middleware/cli
+
+TESTS += cli_idx
+
+cli_idx_SRC		:= $(CLI_DIR)/test/test_cli_idx.c $(CLI_DIR)/cli_idx.c
+cli_idx_CFLAGS	:= -I$(ROOT)/test/stub/middleware/cli
+
+TESTS += cli_log
+
+cli_log_SRC		:= $(CLI_DIR)/test/test_cli_log.c $(CLI_DIR)/cli_log.c
+cli_log_CFLAGS	:= -I$(ROOT)/test/stub/middleware/cli
@@ -0,0 +1,297 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_cli_idx.c
+*@brief     CLI command index host test and benchmark
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup CLI_IDX_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Index is filled to its capacity from user command tables, the same
+* 	way as "cli_if_register_cmd_table()" does it, and checked for lookup
+* 	and completion.
+*
+* 	Benchmark dispatches received lines with 10, 30 and 90 registered
+* 	commands and compares index lookup with linear scan of command
+* 	tables.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "test.h"
+#include "middleware/cli/cli_idx.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of command tables, index capacity
+ */
+#define TEST_CLI_TABLES					( CLI_IDX_MAX_CMD / CLI_CFG_MAX_NUM_OF_COMMANDS )
+
+/**
+ * 	Command name size
+ */
+#define TEST_CLI_NAME_SIZE				( 16 )
+
+/**
+ * 	Lookups per benchmark point
+ */
+#define TEST_BENCH_LOOKUPS				( 5000000UL )
+
+/**
+ * 	Dispatch function
+ */
+typedef const cli_cmd_t * (*test_cli_dispatch_t)(const char * const p_line, const uint32_t num_of);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Command name parts
+ */
+static const char * const gp_test_cli_group[] = { "adc", "btn", "led", "nvm", "par", "sys", "trace", "uart", "usb" };
+static const char * const gp_test_cli_action[] = { "get", "set", "info", "en", "dis", "reset", "stat", "dump", "cfg", "test" };
+
+/**
+ * 	User command tables
+ */
+static char				gc_test_cli_name[CLI_IDX_MAX_CMD][TEST_CLI_NAME_SIZE]	= {{0}};
+static cli_cmd_table_t	g_test_cli_table[TEST_CLI_TABLES]						= {0};
+
+/**
+ * 	Received lines, command with attributes
+ */
+static char				gc_test_cli_line[CLI_IDX_MAX_CMD][TEST_CLI_NAME_SIZE + 8]	= {{0}};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Build command tables and index them
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_cli_build(void)
+{
+	for ( uint32_t t = 0; t < TEST_CLI_TABLES; t++ )
+	{
+		for ( uint32_t c = 0; c < CLI_CFG_MAX_NUM_OF_COMMANDS; c++ )
+		{
+			const uint32_t n = ( t * CLI_CFG_MAX_NUM_OF_COMMANDS ) + c;
+
+			snprintf( gc_test_cli_name[n], TEST_CLI_NAME_SIZE, "%s_%s", gp_test_cli_group[t], gp_test_cli_action[c] );
+			snprintf( gc_test_cli_line[n], sizeof( gc_test_cli_line[n] ), "%s_%s 1 2\r\n", gp_test_cli_group[t], gp_test_cli_action[c] );
+
+			g_test_cli_table[t].cmd[c].p_name = gc_test_cli_name[n];
+		}
+
+		g_test_cli_table[t].num_of = CLI_CFG_MAX_NUM_OF_COMMANDS;
+	}
+
+	// Registration, as in "cli_if_register_cmd_table()"
+	for ( uint32_t t = 0; t < TEST_CLI_TABLES; t++ )
+	{
+		for ( uint32_t c = 0; c < g_test_cli_table[t].num_of; c++ )
+		{
+			TEST_ASSERT_EQ( cli_idx_add( g_test_cli_table[t].cmd[c].p_name, &g_test_cli_table[t].cmd[c] ), eCLI_OK );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Dispatch by index
+*/
+////////////////////////////////////////////////////////////////////////////////
+static const cli_cmd_t * test_cli_dispatch_idx(const char * const p_line, const uint32_t num_of)
+{
+	const void * 	p_cmd 	= NULL;
+	const uint32_t	len		= strcspn( p_line, " \r\n" );
+
+	(void) cli_idx_find( p_line, len, &p_cmd );
+
+	return (const cli_cmd_t*) p_cmd;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Dispatch by linear scan of command tables
+*/
+////////////////////////////////////////////////////////////////////////////////
+static const cli_cmd_t * test_cli_dispatch_scan(const char * const p_line, const uint32_t num_of)
+{
+	const cli_cmd_t *	p_cmd	= NULL;
+	const uint32_t		len		= strcspn( p_line, " \r\n" );
+
+	for ( uint32_t t = 0; ( t < TEST_CLI_TABLES ) && ( NULL == p_cmd ); t++ )
+	{
+		for ( uint32_t c = 0; ( c < g_test_cli_table[t].num_of ) && (( t * CLI_CFG_MAX_NUM_OF_COMMANDS ) + c < num_of ); c++ )
+		{
+			const char * const p_name = g_test_cli_table[t].cmd[c].p_name;
+
+			if 	(	( 0 == strncmp( p_name, p_line, len ))
+				&&	( '\0' == p_name[len] ))
+			{
+				p_cmd = &g_test_cli_table[t].cmd[c];
+				break;
+			}
+		}
+	}
+
+	return p_cmd;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lookup of every command
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_find(void)
+{
+	const void * p_cmd = NULL;
+
+	TEST_ASSERT_EQ( cli_idx_get_num_of(), CLI_IDX_MAX_CMD );
+
+	for ( uint32_t n = 0; n < CLI_IDX_MAX_CMD; n++ )
+	{
+		const cli_cmd_t * const p_exp = &g_test_cli_table[ n / CLI_CFG_MAX_NUM_OF_COMMANDS ].cmd[ n % CLI_CFG_MAX_NUM_OF_COMMANDS ];
+
+		TEST_ASSERT( p_exp == test_cli_dispatch_idx( gc_test_cli_line[n], CLI_IDX_MAX_CMD ));
+		TEST_ASSERT( p_exp == test_cli_dispatch_scan( gc_test_cli_line[n], CLI_IDX_MAX_CMD ));
+	}
+
+	// Prefix, extension and unknown name
+	TEST_ASSERT_EQ( cli_idx_find( "led_se", 6, &p_cmd ), eCLI_ERROR );
+	TEST_ASSERT_EQ( cli_idx_find( "led_sets", 8, &p_cmd ), eCLI_ERROR );
+	TEST_ASSERT_EQ( cli_idx_find( "led_foo", 7, &p_cmd ), eCLI_ERROR );
+
+	// Duplicate and over capacity
+	TEST_ASSERT_EQ( cli_idx_add( "led_set", NULL ), eCLI_ERROR );
+	TEST_ASSERT_EQ( cli_idx_add( "zzz", NULL ), eCLI_ERROR );
+	TEST_ASSERT_EQ( cli_idx_get_num_of(), CLI_IDX_MAX_CMD );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sorted order and tab completion
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_complete(void)
+{
+	cli_idx_match_t match = {0};
+
+	for ( uint32_t pos = 1; pos < cli_idx_get_num_of(); pos++ )
+	{
+		TEST_ASSERT( strcmp( cli_idx_get_name( pos - 1 ), cli_idx_get_name( pos )) < 0 );
+	}
+
+	// "led_set" and "led_stat"
+	TEST_ASSERT_EQ( cli_idx_complete( "led_s", 5, &match ), eCLI_OK );
+	TEST_ASSERT_EQ( match.num_of, 2 );
+	TEST_ASSERT_EQ( match.common_len, 5 );
+	TEST_ASSERT_EQ( strcmp( cli_idx_get_name( match.first ), "led_set" ), 0 );
+
+	// Single match
+	TEST_ASSERT_EQ( cli_idx_complete( "trace_r", 7, &match ), eCLI_OK );
+	TEST_ASSERT_EQ( match.num_of, 1 );
+	TEST_ASSERT_EQ( match.common_len, strlen( "trace_reset" ));
+
+	// Whole group
+	TEST_ASSERT_EQ( cli_idx_complete( "u", 1, &match ), eCLI_OK );
+	TEST_ASSERT_EQ( match.num_of, 2 * CLI_CFG_MAX_NUM_OF_COMMANDS );
+	TEST_ASSERT_EQ( match.common_len, 1 );
+
+	// All commands and no match
+	TEST_ASSERT_EQ( cli_idx_complete( "", 0, &match ), eCLI_OK );
+	TEST_ASSERT_EQ( match.num_of, CLI_IDX_MAX_CMD );
+	TEST_ASSERT_EQ( cli_idx_complete( "x", 1, &match ), eCLI_OK );
+	TEST_ASSERT_EQ( match.num_of, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Time single dispatch method
+*
+* @return		time per dispatch - Unit: ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double test_cli_bench_one(const test_cli_dispatch_t pf_dispatch, const uint32_t num_of)
+{
+	const cli_cmd_t * volatile	p_sink	= NULL;
+	uint32_t					n		= 0;
+	const uint64_t				start	= test_now_ns();
+
+	for ( uint32_t i = 0; i < TEST_BENCH_LOOKUPS; i++ )
+	{
+		p_sink = pf_dispatch( gc_test_cli_line[n], num_of );
+
+		// Stride through commands, prime step visits all entries
+		n += 7U;
+
+		if ( n >= num_of )
+		{
+			n -= num_of;
+		}
+	}
+
+	(void) p_sink;
+
+	return ((double)( test_now_ns() - start ) / (double) TEST_BENCH_LOOKUPS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Dispatch benchmark
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	const uint32_t num_of[] = { 10, 30, CLI_IDX_MAX_CMD };
+
+	for ( uint32_t i = 0; i < ( sizeof( num_of ) / sizeof( num_of[0] )); i++ )
+	{
+		const double idx	= test_cli_bench_one( test_cli_dispatch_idx, num_of[i] );
+		const double scan	= test_cli_bench_one( test_cli_dispatch_scan, num_of[i] );
+
+		TEST_BENCH( "%3u commands: index %6.2f ns, scan %7.2f ns per dispatch", (unsigned) num_of[i], idx, scan );
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_cli_build();
+	test_find();
+	test_complete();
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,389 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_cli_log.c
+*@brief     Deferred logging host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup CLI_LOG_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Entries are pushed by CLI_LOG_CH and formatted by cli_log_hndl()
+* 	into captured channel output. Pointer arguments (sign of
+* 	CLI_LOG_FLOAT, "%s") must survive 64-bit host build.
+*
+* 	Bench compares call site cost of immediate text logging (format
+* 	and print) against deferred push.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "test.h"
+#include "middleware/cli/cli_log.h"
+#include "middleware/cli/cli_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of captured lines
+ */
+#define TEST_LOG_LINES					( 64U )
+
+/**
+ * 	Number of bench iterations
+ */
+#define TEST_BENCH_LOOPS				( 20000U )
+
+/**
+ * 	Float type as on target
+ */
+typedef float float32_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Time
+ *
+ * 	Unit: ms
+ */
+static uint32_t gu32_test_ms = 0UL;
+
+/**
+ * 	Channel enable
+ */
+static bool gb_test_ch_en[eCLI_CH_NUM_OF] = {0};
+
+/**
+ * 	Captured output
+ */
+static char			gc_test_line[TEST_LOG_LINES][CLI_LOG_STR_SIZE + 16U]	= {{0}};
+static cli_ch_opt_t	g_test_line_ch[TEST_LOG_LINES]							= {0};
+static uint32_t		gu32_test_lines											= 0;
+static bool			gb_test_line_log[TEST_LOG_LINES]						= {0};
+
+/**
+ * 	Output routed to logging transports
+ */
+static bool gb_test_log_out = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Systick stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return gu32_test_ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		CLI configuration stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+const bool cli_cfg_get_ch_en(const cli_ch_opt_t ch)
+{
+	return gb_test_ch_en[ch];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		CLI port routing stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_if_set_log_out(const bool log)
+{
+	gb_test_log_out = log;
+
+	return eCLI_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		CLI channel print stand-in, captures line
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_printf_ch(const cli_ch_opt_t ch, char * p_format, ...)
+{
+	va_list args;
+
+	va_start( args, p_format );
+
+	if ( gu32_test_lines < TEST_LOG_LINES )
+	{
+		(void) vsnprintf( gc_test_line[gu32_test_lines], sizeof( gc_test_line[0] ), p_format, args );
+		g_test_line_ch[gu32_test_lines] = ch;
+		gb_test_line_log[gu32_test_lines] = gb_test_log_out;
+	}
+
+	gu32_test_lines++;
+
+	va_end( args );
+
+	return eCLI_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Drop captured output
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_log_clear(void)
+{
+	gu32_test_lines = 0;
+	memset( gc_test_line, 0, sizeof( gc_test_line ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init_log(void)
+{
+	cli_log_stats_t stats = {0};
+
+	TEST_ASSERT_EQ( cli_log_push( eCLI_CH_APP, 0U, "early" ), eCLI_ERROR_INIT );
+
+	cli_log_hndl();
+	TEST_ASSERT_EQ( gu32_test_lines, 0U );
+
+	TEST_ASSERT_EQ( cli_log_init(), eCLI_OK );
+	TEST_ASSERT_EQ( cli_log_get_stats( NULL ), eCLI_ERROR );
+	TEST_ASSERT_EQ( cli_log_get_stats( &stats ), eCLI_OK );
+	TEST_ASSERT_EQ( stats.logged, 0U );
+	TEST_ASSERT_EQ( stats.dropped, 0U );
+
+	for ( uint32_t ch = 0; ch < eCLI_CH_NUM_OF; ch++ )
+	{
+		gb_test_ch_en[ch] = true;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Argument types and formatting
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_format(void)
+{
+	const char *	p_name	= "adc";
+	const float32_t	neg		= -1.25f;
+	const float32_t	pos		= 3.5f;
+	const int32_t	i32		= -42;
+	const uint8_t	u8		= 200U;
+
+	test_log_clear();
+	gu32_test_ms = 12345UL;
+
+	CLI_LOG_CH( eCLI_CH_APP, "no args" );
+	CLI_LOG_CH( eCLI_CH_WAR, "%d %u %s", i32, u8, p_name );
+	CLI_LOG_CH( eCLI_CH_APP, "level: " CLI_LOG_FLOAT_MARKER, CLI_LOG_FLOAT( neg ));
+	CLI_LOG_CH( eCLI_CH_APP, "%s " CLI_LOG_FLOAT_MARKER " %s", p_name, CLI_LOG_FLOAT( pos ), "V" );
+	CLI_LOG_CH( eCLI_CH_ERR, "%d%d%d%d%d%d", 1, 2, 3, 4, 5, 6 );
+	CLI_LOG_CH( eCLI_CH_APP, "%p", (void*) &gu32_test_ms );
+
+	// Nothing formatted at call site
+	TEST_ASSERT_EQ( gu32_test_lines, 0U );
+
+	cli_log_hndl();
+	TEST_ASSERT_EQ( gu32_test_lines, 6U );
+
+	// Routed as log, not as response of command being handled
+	for ( uint32_t line = 0; line < 6U; line++ )
+	{
+		TEST_ASSERT( true == gb_test_line_log[line] );
+	}
+	TEST_ASSERT( false == gb_test_log_out );
+
+	TEST_ASSERT_EQ( strcmp( gc_test_line[0], "[12.345] no args" ), 0 );
+	TEST_ASSERT_EQ( g_test_line_ch[0], eCLI_CH_APP );
+	TEST_ASSERT_EQ( strcmp( gc_test_line[1], "[12.345] -42 200 adc" ), 0 );
+	TEST_ASSERT_EQ( g_test_line_ch[1], eCLI_CH_WAR );
+	TEST_ASSERT_EQ( strcmp( gc_test_line[2], "[12.345] level: -1.250" ), 0 );
+	TEST_ASSERT_EQ( strcmp( gc_test_line[3], "[12.345] adc 3.500 V" ), 0 );
+	TEST_ASSERT_EQ( strcmp( gc_test_line[4], "[12.345] 123456" ), 0 );
+	TEST_ASSERT_EQ( g_test_line_ch[4], eCLI_CH_ERR );
+
+	{
+		char exp[64] = {0};
+
+		(void) snprintf( exp, sizeof( exp ), "[12.345] %p", (void*) &gu32_test_ms );
+		TEST_ASSERT_EQ( strcmp( gc_test_line[5], exp ), 0 );
+	}
+
+	// Long message is truncated
+	test_log_clear();
+	CLI_LOG_CH( eCLI_CH_APP, "%s%s%s", "0123456789012345678901234567890123456789012345678901234567890123",
+										"0123456789012345678901234567890123456789012345678901234567890123",
+										"0123456789" );
+	cli_log_hndl();
+	TEST_ASSERT_EQ( gu32_test_lines, 1U );
+	TEST_ASSERT_EQ( strlen( gc_test_line[0] ), CLI_LOG_STR_SIZE - 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Disabled channel, full queue and handler budget
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_queue(void)
+{
+	cli_log_stats_t before	= {0};
+	cli_log_stats_t stats	= {0};
+	uint32_t		exp		= 0;
+
+	TEST_ASSERT_EQ( cli_log_get_stats( &before ), eCLI_OK );
+	test_log_clear();
+
+	// Disabled channel is not queued
+	gb_test_ch_en[eCLI_CH_APP] = false;
+	CLI_LOG_CH( eCLI_CH_APP, "hidden %d", 1 );
+	gb_test_ch_en[eCLI_CH_APP] = true;
+
+	TEST_ASSERT_EQ( cli_log_get_stats( &stats ), eCLI_OK );
+	TEST_ASSERT_EQ( stats.logged, before.logged );
+
+	// Overflow
+	for ( uint32_t i = 0; i < ( CLI_LOG_QUEUE_SIZE + 3U ); i++ )
+	{
+		CLI_LOG_CH( eCLI_CH_APP, "%u", i );
+	}
+
+	TEST_ASSERT_EQ( cli_log_get_stats( &stats ), eCLI_OK );
+	TEST_ASSERT_EQ( stats.logged - before.logged, CLI_LOG_QUEUE_SIZE );
+	TEST_ASSERT_EQ( stats.dropped - before.dropped, 3U );
+	TEST_ASSERT_EQ( stats.max_used, CLI_LOG_QUEUE_SIZE );
+
+	// Limited number per call, in order
+	cli_log_hndl();
+	TEST_ASSERT_EQ( gu32_test_lines, CLI_LOG_MAX_PER_HNDL );
+
+	while ( gu32_test_lines < CLI_LOG_QUEUE_SIZE )
+	{
+		const uint32_t lines = gu32_test_lines;
+
+		cli_log_hndl();
+		TEST_ASSERT( gu32_test_lines > lines );
+
+		if ( gu32_test_lines == lines )
+		{
+			break;
+		}
+	}
+
+	TEST_ASSERT_EQ( gu32_test_lines, CLI_LOG_QUEUE_SIZE );
+
+	for ( uint32_t i = 0; i < CLI_LOG_QUEUE_SIZE; i++ )
+	{
+		unsigned val = 0;
+
+		TEST_ASSERT_EQ( sscanf( gc_test_line[i], "[%*u.%*u] %u", &val ), 1 );
+		TEST_ASSERT_EQ( val, exp );
+		exp++;
+	}
+
+	// Space again
+	cli_log_hndl();
+	TEST_ASSERT_EQ( gu32_test_lines, CLI_LOG_QUEUE_SIZE );
+	TEST_ASSERT_EQ( cli_log_push( eCLI_CH_APP, 0U, "again" ), eCLI_OK );
+	cli_log_hndl();
+	TEST_ASSERT_EQ( gu32_test_lines, CLI_LOG_QUEUE_SIZE + 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Call site cost: immediate text vs. deferred
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	char			str[CLI_LOG_STR_SIZE]	= {0};
+	const float32_t	level					= -12.345f;
+	uint64_t		txt_cycles				= 0;
+	uint64_t		log_cycles				= 0;
+	uint64_t		hndl_cycles				= 0;
+	uint64_t		start					= 0;
+
+	// Immediate: format and print at call site
+	for ( uint32_t loop = 0; loop < TEST_BENCH_LOOPS; loop++ )
+	{
+		test_log_clear();
+		start = test_now_cycles();
+
+		(void) snprintf( str, sizeof( str ), "[%lu.%03lu] Btn %u, level: %s%lu.%03lu",
+						 (unsigned long)( gu32_test_ms / 1000UL ), (unsigned long)( gu32_test_ms % 1000UL ),
+						 (unsigned) loop, (( level < 0.0f ) ? "-" : "" ),
+						 (unsigned long)( -level ), (unsigned long)((( -level ) - (float32_t)(uint32_t)( -level )) * 1000.0f ));
+		(void) cli_printf_ch( eCLI_CH_APP, "%s", str );
+
+		txt_cycles += ( test_now_cycles() - start );
+	}
+
+	// Deferred: push at call site, format later
+	for ( uint32_t loop = 0; loop < TEST_BENCH_LOOPS; loop++ )
+	{
+		test_log_clear();
+		start = test_now_cycles();
+
+		CLI_LOG_CH( eCLI_CH_APP, "Btn %u, level: " CLI_LOG_FLOAT_MARKER, loop, CLI_LOG_FLOAT( level ));
+
+		log_cycles += ( test_now_cycles() - start );
+		start = test_now_cycles();
+
+		cli_log_hndl();
+
+		hndl_cycles += ( test_now_cycles() - start );
+	}
+
+	TEST_ASSERT_EQ( strcmp( &gc_test_line[0][strlen( gc_test_line[0] ) - 6U], "12.345" ), 0 );
+	TEST_ASSERT( log_cycles < txt_cycles );
+
+	TEST_BENCH( "call site: text %5" PRIu64 " cycles, deferred %5" PRIu64 " cycles (handler %5" PRIu64 " cycles)",
+				txt_cycles / TEST_BENCH_LOOPS, log_cycles / TEST_BENCH_LOOPS, hndl_cycles / TEST_BENCH_LOOPS );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_init_log();
+	test_format();
+	test_queue();
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
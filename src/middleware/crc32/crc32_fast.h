@@ -0,0 +1,93 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      crc32_fast.h
+*@brief     Table driven CRC-32 with slice-by-4/8 engine
+*@author    Ziga Miklosic
+*@date      14.11.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup CRC32_FAST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Table driven CRC-32 with slice-by-4/8 engine
+*
+* 	Standard CRC-32 (reflected polynomial 0xEDB88320, init and final
+* 	XOR 0xFFFFFFFF), bit identical to SDK crc32_compute(). Variant is
+* 	selected at compile time, only tables of selected variant are
+* 	linked in.
+*
+* 	Slicing variants process 8 or 4 bytes per step on buffers of at
+* 	least CRC32_FAST_CFG_SLICE_MIN_SIZE bytes, rest goes byte-wise.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __CRC32_FAST_H
+#define __CRC32_FAST_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Implementation variants
+ */
+#define CRC32_FAST_IMPL_BITWISE				( 0 )	/**<Bit loop, no table */
+#define CRC32_FAST_IMPL_TABLE				( 1 )	/**<Byte-wise 256 entry table (1 kB) */
+#define CRC32_FAST_IMPL_SLICE_BY_4			( 2 )	/**<Four tables, 4 bytes per step (4 kB) */
+#define CRC32_FAST_IMPL_SLICE_BY_8			( 3 )	/**<Eight tables, 8 bytes per step (8 kB) */
+
+/**
+ * 	Selected implementation
+ */
+#ifndef CRC32_FAST_CFG_IMPL
+	#define CRC32_FAST_CFG_IMPL				( CRC32_FAST_IMPL_SLICE_BY_8 )
+#endif
+
+/**
+ * 	Minimum buffer size processed with slicing
+ *
+ * 	Unit: byte
+ */
+#ifndef CRC32_FAST_CFG_SLICE_MIN_SIZE
+	#define CRC32_FAST_CFG_SLICE_MIN_SIZE	( 16U )
+#endif
+
+/**
+ * 	Streaming context
+ */
+typedef struct
+{
+	uint32_t crc;	/**<Running (non-inverted) CRC register */
+} crc32_fast_ctx_t;
+
+/**
+ * 	Invalid configuration catcher
+ */
+#if (( CRC32_FAST_CFG_IMPL < CRC32_FAST_IMPL_BITWISE ) || ( CRC32_FAST_CFG_IMPL > CRC32_FAST_IMPL_SLICE_BY_8 ))
+	#error "Invalid CRC32 implementation! Adjust <CRC32_FAST_CFG_IMPL> macro inside crc32_fast.h file!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+uint32_t	crc32_fast_compute	(const uint8_t * const p_data, const uint32_t size, const uint32_t * const p_crc);
+void		crc32_fast_init		(crc32_fast_ctx_t * const p_ctx);
+void		crc32_fast_update	(crc32_fast_ctx_t * const p_ctx, const uint8_t * const p_data, const uint32_t size);
+uint32_t	crc32_fast_final	(const crc32_fast_ctx_t * const p_ctx);
+
+#endif // __CRC32_FAST_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
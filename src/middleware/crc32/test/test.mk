@@ -0,0 +1,13 @@
+# CRC32 engine, every implementation variant is built and checked
+CRC32_FAST_DIR := $(ROOT)/src/middleware/crc32
+
+TESTS += crc32_bitwise crc32_table crc32_slice4 crc32_slice8
+
+crc32_bitwise_SRC		:= $(CRC32_FAST_DIR)/test/test_crc32_fast.c $(CRC32_FAST_DIR)/crc32_fast.c
+crc32_bitwise_CFLAGS	:= -DCRC32_FAST_CFG_IMPL=0
+crc32_table_SRC			:= $(crc32_bitwise_SRC)
+crc32_table_CFLAGS		:= -DCRC32_FAST_CFG_IMPL=1
+crc32_slice4_SRC		:= $(crc32_bitwise_SRC)
+crc32_slice4_CFLAGS		:= -DCRC32_FAST_CFG_IMPL=2
+crc32_slice8_SRC		:= $(crc32_bitwise_SRC)
+crc32_slice8_CFLAGS		:= -DCRC32_FAST_CFG_IMPL=3
@@ -0,0 +1,217 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_crc32_fast.c
+*@brief     CRC32 engine host test and benchmark
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup CRC32_FAST_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Selected variant is checked against standard test vectors and
+* 	against bit loop reference on random, chained and unaligned
+* 	buffers. Benchmark reports throughput from 16 B to 64 kB.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "middleware/crc32/crc32_fast.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Largest test buffer
+ *
+ * 	Unit: byte
+ */
+#define TEST_BUF_SIZE			( 64UL * 1024UL )
+
+/**
+ * 	Bytes processed per benchmark point
+ *
+ * 	Unit: byte
+ */
+#define TEST_BENCH_BYTES		( 64UL * 1024UL * 1024UL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Test buffer, one spare byte for unaligned access
+ */
+static uint8_t gu8_buf[TEST_BUF_SIZE + 8U];
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reference CRC-32, bit by bit
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_crc32_ref(const uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t crc = 0xFFFFFFFFUL;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		crc ^= p_data[i];
+
+		for ( uint32_t j = 0; j < 8U; j++ )
+		{
+			crc = ( crc & 1U ) ? (( crc >> 1 ) ^ 0xEDB88320UL ) : ( crc >> 1 );
+		}
+	}
+
+	return ~crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Standard check values
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_vectors(void)
+{
+	static const uint8_t zeros[32] = {0};
+
+	TEST_ASSERT_EQ( crc32_fast_compute((const uint8_t*) "123456789", 9U, NULL ), 0xCBF43926UL );
+	TEST_ASSERT_EQ( crc32_fast_compute((const uint8_t*) "", 0U, NULL ), 0x00000000UL );
+	TEST_ASSERT_EQ( crc32_fast_compute((const uint8_t*) "a", 1U, NULL ), 0xE8B7BE43UL );
+	TEST_ASSERT_EQ( crc32_fast_compute((const uint8_t*) "The quick brown fox jumps over the lazy dog", 43U, NULL ), 0x414FA339UL );
+	TEST_ASSERT_EQ( crc32_fast_compute( zeros, sizeof( zeros ), NULL ), 0x190A55ADUL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Random buffers of every length up to 300 B and unaligned starts
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_against_ref(void)
+{
+	for ( uint32_t off = 0; off < 8U; off++ )
+	{
+		for ( uint32_t size = 0; size <= 300U; size++ )
+		{
+			if ( crc32_fast_compute( &gu8_buf[off], size, NULL ) != test_crc32_ref( &gu8_buf[off], size ))
+			{
+				TEST_ASSERT( !"CRC differs from reference" );
+				printf( "  offset %u, size %u\n", (unsigned) off, (unsigned) size );
+				return;
+			}
+		}
+	}
+
+	TEST_ASSERT_EQ( crc32_fast_compute( &gu8_buf[1], TEST_BUF_SIZE, NULL ), test_crc32_ref( &gu8_buf[1], TEST_BUF_SIZE ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Chained blocks and streaming context equal single pass
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_chained(void)
+{
+	const uint32_t		whole	= crc32_fast_compute( gu8_buf, TEST_BUF_SIZE, NULL );
+	uint32_t			crc		= 0;
+	uint32_t			pos		= 0;
+	uint32_t			step	= 1;
+	crc32_fast_ctx_t	ctx;
+
+	crc32_fast_init( &ctx );
+
+	while ( pos < TEST_BUF_SIZE )
+	{
+		const uint32_t size = (( pos + step ) > TEST_BUF_SIZE ) ? ( TEST_BUF_SIZE - pos ) : step;
+
+		crc = crc32_fast_compute( &gu8_buf[pos], size, ( 0U == pos ) ? NULL : &crc );
+		crc32_fast_update( &ctx, &gu8_buf[pos], size );
+
+		pos += size;
+		step = ( step * 7U + 3U ) % 257U;
+	}
+
+	TEST_ASSERT_EQ( crc, whole );
+	TEST_ASSERT_EQ( crc32_fast_final( &ctx ), whole );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Throughput from 16 B to 64 kB
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	static const char * const p_impl[] = { "bitwise", "table", "slice-by-4", "slice-by-8" };
+
+	printf( "  implementation: %s\n", p_impl[CRC32_FAST_CFG_IMPL] );
+
+	for ( uint32_t size = 16U; size <= TEST_BUF_SIZE; size *= 4U )
+	{
+		const uint32_t		loops	= TEST_BENCH_BYTES / size / (( CRC32_FAST_IMPL_BITWISE == CRC32_FAST_CFG_IMPL ) ? 16U : 1U );
+		volatile uint32_t	sink	= 0;
+		const uint64_t		start	= test_now_ns();
+
+		for ( uint32_t i = 0; i < loops; i++ )
+		{
+			sink ^= crc32_fast_compute( gu8_buf, size, NULL );
+		}
+
+		const uint64_t dt = test_now_ns() - start;
+
+		TEST_BENCH( "%6u B: %8.1f MB/s", (unsigned) size, ((double) loops * size * 1e3 ) / (double) dt );
+		(void) sink;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	srand( 1U );
+
+	for ( uint32_t i = 0; i < sizeof( gu8_buf ); i++ )
+	{
+		gu8_buf[i] = (uint8_t) rand();
+	}
+
+	test_vectors();
+	test_against_ref();
+	test_chained();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,400 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      journal.c
+*@brief     Retained RAM reset and crash journal
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup JOURNAL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Record CRC is recalculated only at boot and on fault. Events are
+* 	written without touching CRC, ring index is kept together with its
+* 	inverted copy instead.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <string.h>
+
+#include "journal.h"
+#include "middleware/crc32/crc32_fast.h"
+#include "nrf.h"
+
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Record valid marker
+ */
+#define JOURNAL_MAGIC						( 0x4A524E4CUL )	// "JRNL"
+
+/**
+ * 	Event ring index mask
+ */
+#define JOURNAL_EVT_MASK					( JOURNAL_EVT_SIZE - 1U )
+
+/**
+ * 	Event check byte seed
+ */
+#define JOURNAL_EVT_CHECK_SEED				( 0x5AU )
+
+/**
+ * 	Exception frame word positions
+ */
+#define JOURNAL_FRAME_LR					( 5U )
+#define JOURNAL_FRAME_PC					( 6U )
+#define JOURNAL_FRAME_XPSR					( 7U )
+
+/**
+ * 	Journal record
+ *
+ * @note	Guarded by CRC32, raw values only.
+ */
+typedef struct
+{
+	uint32_t	magic;			/**<Valid marker */
+	uint32_t	boot_cnt;		/**<Boot counter */
+	uint32_t	fault;			/**<Fault type */
+	uint32_t	time_ms;		/**<Time of fault */
+	uint32_t	pc;				/**<Program counter */
+	uint32_t	lr;				/**<Link register */
+	uint32_t	info;			/**<Fault info */
+	uint32_t	line;			/**<Source line */
+	uint32_t	file;			/**<Address of source file name */
+	uint32_t	cfsr;			/**<SCB CFSR */
+	uint32_t	hfsr;			/**<SCB HFSR */
+	uint32_t	mmfar;			/**<SCB MMFAR */
+	uint32_t	bfar;			/**<SCB BFAR */
+	uint32_t	crc;			/**<CRC32 of all fields above */
+} journal_rec_t;
+
+/**
+ * 	Retained journal
+ */
+typedef struct
+{
+	journal_rec_t	rec;						/**<Record */
+	uint32_t		evt_idx;					/**<Free running event write index */
+	uint32_t		evt_idx_inv;				/**<Inverted copy of event index */
+	journal_evt_t	evt[JOURNAL_EVT_SIZE];		/**<Event ring */
+} journal_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Retained journal
+ */
+static journal_t g_journal __attribute__((section( JOURNAL_NOINIT_SECTION )));
+
+/**
+ * 	Decoded journal of previous run
+ */
+static journal_info_t g_journal_last = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t	journal_calc_crc		(const journal_rec_t * const p_rec);
+static uint8_t	journal_calc_evt_check	(const journal_evt_t * const p_evt);
+static void		journal_decode			(const uint32_t resetreas);
+
+#if ( 1 == JOURNAL_HARDFAULT_EN )
+	void journal_hardfault_hndl(const uint32_t * const p_frame);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate record CRC
+*
+* @param[in]	p_rec	- Pointer to record
+* @return		crc		- CRC32 of record without CRC field
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t journal_calc_crc(const journal_rec_t * const p_rec)
+{
+	return crc32_fast_compute((const uint8_t*) p_rec, offsetof( journal_rec_t, crc ), NULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate event check byte
+*
+* @param[in]	p_evt	- Pointer to event
+* @return		check	- XOR of all event bytes and seed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t journal_calc_evt_check(const journal_evt_t * const p_evt)
+{
+	const uint32_t fold = p_evt->time_ms ^ ((uint32_t) p_evt->id << 8U ) ^ p_evt->arg;
+
+	return (uint8_t)( JOURNAL_EVT_CHECK_SEED ^ fold ^ ( fold >> 8U ) ^ ( fold >> 16U ) ^ ( fold >> 24U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Decode retained journal of previous run
+*
+* @param[in]	resetreas	- Reset reason latched at this boot
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void journal_decode(const uint32_t resetreas)
+{
+	const journal_rec_t * const p_rec = &g_journal.rec;
+
+	memset( &g_journal_last, 0, sizeof( journal_info_t ));
+
+	g_journal_last.resetreas 	= resetreas;
+	g_journal_last.boot_cnt		= 1U;
+
+	if	(	( JOURNAL_MAGIC == p_rec->magic )
+		&&	( journal_calc_crc( p_rec ) == p_rec->crc ))
+	{
+		const uint32_t flash_size = NRF_FICR->CODEPAGESIZE * NRF_FICR->CODESIZE;
+
+		g_journal_last.boot_cnt	= p_rec->boot_cnt + 1U;
+		g_journal_last.fault	= p_rec->fault;
+		g_journal_last.time_ms	= p_rec->time_ms;
+		g_journal_last.pc		= p_rec->pc;
+		g_journal_last.lr		= p_rec->lr;
+		g_journal_last.info		= p_rec->info;
+		g_journal_last.line		= p_rec->line;
+		g_journal_last.cfsr		= p_rec->cfsr;
+		g_journal_last.hfsr		= p_rec->hfsr;
+		g_journal_last.mmfar	= p_rec->mmfar;
+		g_journal_last.bfar		= p_rec->bfar;
+
+		// File name must point into flash
+		if (( 0UL != p_rec->file ) && ( p_rec->file < flash_size ))
+		{
+			g_journal_last.p_file = (const char*)(uintptr_t) p_rec->file;
+		}
+
+		// Events, oldest first, entries with bad check are dropped
+		if ( g_journal.evt_idx == ~g_journal.evt_idx_inv )
+		{
+			const uint32_t idx		= g_journal.evt_idx;
+			const uint32_t num_of	= ( idx < JOURNAL_EVT_SIZE ) ? idx : JOURNAL_EVT_SIZE;
+
+			for ( uint32_t i = 0; i < num_of; i++ )
+			{
+				const journal_evt_t * const p_evt = &g_journal.evt[(( idx - num_of ) + i ) & JOURNAL_EVT_MASK ];
+
+				if ( journal_calc_evt_check( p_evt ) == p_evt->check )
+				{
+					g_journal_last.evt[ g_journal_last.evt_num_of++ ] = *p_evt;
+				}
+			}
+		}
+	}
+}
+
+#if ( 1 == JOURNAL_HARDFAULT_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Hard fault exception handler
+	*
+	* @note		Passes stacked exception frame of faulting code to
+	* 			journal_hardfault_hndl().
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	__attribute__((naked)) void HardFault_Handler(void)
+	{
+		__asm volatile
+		(
+			"tst	lr, #4					\n"
+			"ite	eq						\n"
+			"mrseq	r0, msp					\n"
+			"mrsne	r0, psp					\n"
+			"b		journal_hardfault_hndl	\n"
+		);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Record hard fault and reset
+	*
+	* @param[in]	p_frame	- Stacked exception frame
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	void journal_hardfault_hndl(const uint32_t * const p_frame)
+	{
+		journal_fault( eJOURNAL_FAULT_HARDFAULT, p_frame[JOURNAL_FRAME_PC], p_frame[JOURNAL_FRAME_LR], NULL, 0UL, p_frame[JOURNAL_FRAME_XPSR] );
+
+		NVIC_SystemReset();
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup JOURNAL_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize journal
+*
+* @note		Decodes journal of previous run, latches and clears reset
+* 			reason and starts new record. Call as early as possible!
+*
+* @return		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+journal_status_t journal_init(void)
+{
+	journal_status_t status = eJOURNAL_OK;
+
+	// Reset reason is latched until cleared by writing ones
+	const uint32_t resetreas = NRF_POWER->RESETREAS;
+	NRF_POWER->RESETREAS = resetreas;
+
+	journal_decode( resetreas );
+
+	// New record
+	memset( &g_journal, 0, sizeof( journal_t ));
+
+	g_journal.rec.magic		= JOURNAL_MAGIC;
+	g_journal.rec.boot_cnt	= g_journal_last.boot_cnt;
+	g_journal.rec.fault		= eJOURNAL_FAULT_NONE;
+	g_journal.rec.crc		= journal_calc_crc( &g_journal.rec );
+	g_journal.evt_idx_inv	= ~g_journal.evt_idx;
+
+	gb_is_init = true;
+
+	journal_event( eJOURNAL_EVT_BOOT, 0U );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get decoded journal of previous run
+*
+* @param[out]	p_info	- Journal of previous run
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+journal_status_t journal_get_last(journal_info_t * const p_info)
+{
+	journal_status_t status = eJOURNAL_OK;
+
+	if	(	( true == gb_is_init )
+		&&	( NULL != p_info ))
+	{
+		*p_info = g_journal_last;
+	}
+	else
+	{
+		status = eJOURNAL_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add event to journal
+*
+* @note		Shall be called from single context (main loop)!
+*
+* @param[in]	id		- Event ID, eJOURNAL_EVT_USER and above for user events
+* @param[in]	arg		- Event argument
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void journal_event(const uint16_t id, const uint8_t arg)
+{
+	if ( true == gb_is_init )
+	{
+		const uint32_t idx = g_journal.evt_idx;
+		journal_evt_t * const p_evt = &g_journal.evt[ idx & JOURNAL_EVT_MASK ];
+
+		p_evt->time_ms	= systick_get_ms();
+		p_evt->id		= id;
+		p_evt->arg		= arg;
+		p_evt->check	= journal_calc_evt_check( p_evt );
+
+		g_journal.evt_idx		= idx + 1U;
+		g_journal.evt_idx_inv	= ~( idx + 1U );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Record fault
+*
+* @note		Stores raw values and fault status registers and re-seals
+* 			record. Safe to call from fault handlers.
+*
+* @param[in]	fault	- Fault type
+* @param[in]	pc		- Program counter
+* @param[in]	lr		- Link register
+* @param[in]	p_file	- Source file, NULL if not known
+* @param[in]	line	- Source line
+* @param[in]	info	- Fault specific info
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void journal_fault(const journal_fault_t fault, const uint32_t pc, const uint32_t lr, const char * const p_file, const uint32_t line, const uint32_t info)
+{
+	journal_rec_t * const p_rec = &g_journal.rec;
+
+	p_rec->magic	= JOURNAL_MAGIC;
+	p_rec->fault	= fault;
+	p_rec->time_ms	= systick_get_ms();
+	p_rec->pc		= pc;
+	p_rec->lr		= lr;
+	p_rec->info		= info;
+	p_rec->line		= line;
+	p_rec->file		= (uint32_t)(uintptr_t) p_file;
+	p_rec->cfsr		= SCB->CFSR;
+	p_rec->hfsr		= SCB->HFSR;
+	p_rec->mmfar	= SCB->MMFAR;
+	p_rec->bfar		= SCB->BFAR;
+	p_rec->crc		= journal_calc_crc( p_rec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,168 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      journal.h
+*@brief     Retained RAM reset and crash journal
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup JOURNAL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Retained RAM reset and crash journal
+*
+* 	Journal lives in no-init RAM and survives any reset except power loss.
+* 	It consists of record guarded by CRC32 (boot counter, fault details)
+* 	and ring of recent events, where each entry carries its own check
+* 	byte. Reset reason is latched from POWER peripheral at boot.
+*
+* 	All writes are O(1) and only store raw values, no formatting is
+* 	done on fault path. Record of previous run is validated and copied
+* 	out once at boot by journal_init().
+*
+* 	Journal is the only retained crash record: watchdog supervisor
+* 	reports tasks into event ring and records watchdog reset as fault.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __JOURNAL_H
+#define __JOURNAL_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of events in journal ring
+ *
+ * @note	Must be power of two! Watchdog task reports share the ring
+ * 			with other events, single entry takes 8 bytes.
+ */
+#define JOURNAL_EVT_SIZE					( 32U )
+
+/**
+ * 	Enable/Disable hard fault capture
+ *
+ * @note	When enabled, journal provides HardFault_Handler. Disabled
+ * 			automatically when not building for ARM target.
+ */
+#ifndef JOURNAL_HARDFAULT_EN
+	#if defined( __arm__ )
+		#define JOURNAL_HARDFAULT_EN			( 1 )
+	#else
+		#define JOURNAL_HARDFAULT_EN			( 0 )
+	#endif
+#endif
+
+/**
+ * 	Retained RAM section
+ *
+ * @note	Host test overrides it with section name linker provides
+ * 			start/stop symbols for.
+ */
+#ifndef JOURNAL_NOINIT_SECTION
+	#define JOURNAL_NOINIT_SECTION				".non_init"
+#endif
+
+/**
+ * 	Journal status
+ */
+typedef enum
+{
+	eJOURNAL_OK = 0,		/**<Normal operation */
+	eJOURNAL_ERROR,			/**<General error code */
+} journal_status_t;
+
+/**
+ * 	Fault types
+ */
+typedef enum
+{
+	eJOURNAL_FAULT_NONE = 0,	/**<No fault, regular reset */
+	eJOURNAL_FAULT_ASSERT,		/**<Project assertion failed */
+	eJOURNAL_FAULT_APP_ERROR,	/**<SDK application error (APP_ERROR_HANDLER) */
+	eJOURNAL_FAULT_HARDFAULT,	/**<Hard fault exception */
+	eJOURNAL_FAULT_WDT,			/**<Watchdog pre-reset interrupt, info is stalled task and time (wdt_sup.h) */
+} journal_fault_t;
+
+/**
+ * 	Events
+ */
+typedef enum
+{
+	eJOURNAL_EVT_BOOT = 0,		/**<Application started */
+	eJOURNAL_EVT_DEADLINE,		/**<Scheduler deadline miss, argument is task */
+	eJOURNAL_EVT_USB_PLUG,		/**<USB cable plugged in */
+	eJOURNAL_EVT_USB_UNPLUG,	/**<USB cable unplugged */
+	eJOURNAL_EVT_WDT_REPORT,	/**<Watchdog task report, argument is task */
+	eJOURNAL_EVT_USER,			/**<First user defined event */
+} journal_evt_id_t;
+
+/**
+ * 	Event entry
+ */
+typedef struct
+{
+	uint32_t	time_ms;		/**<Timestamp. Unit: ms */
+	uint16_t	id;				/**<Event ID */
+	uint8_t		arg;			/**<Event argument */
+	uint8_t		check;			/**<Entry check byte */
+} journal_evt_t;
+
+/**
+ * 	Decoded journal of previous run
+ *
+ * @note	File name points into flash of running firmware, thus it is
+ * 			meaningful only when firmware was not changed between runs.
+ */
+typedef struct
+{
+	uint32_t		boot_cnt;					/**<Number of boots since journal was created */
+	uint32_t		resetreas;					/**<Raw POWER RESETREAS, cause of previous run end */
+	uint32_t		fault;						/**<Fault type, see journal_fault_t */
+	uint32_t		time_ms;					/**<Time of fault. Unit: ms */
+	uint32_t		pc;							/**<Program counter at fault */
+	uint32_t		lr;							/**<Link register at fault */
+	uint32_t		info;						/**<Fault info, SDK error code */
+	uint32_t		line;						/**<Source line of fault */
+	const char *	p_file;						/**<Source file of fault */
+	uint32_t		cfsr;						/**<Configurable fault status register */
+	uint32_t		hfsr;						/**<Hard fault status register */
+	uint32_t		mmfar;						/**<Memory manage fault address */
+	uint32_t		bfar;						/**<Bus fault address */
+	uint32_t		evt_num_of;					/**<Number of valid events */
+	journal_evt_t	evt[JOURNAL_EVT_SIZE];		/**<Events, oldest first */
+} journal_info_t;
+
+/**
+ * 	Invalid configuration catcher
+ */
+#if (( 0 == JOURNAL_EVT_SIZE ) || ( 0 != ( JOURNAL_EVT_SIZE & ( JOURNAL_EVT_SIZE - 1 ))))
+	#error "Journal event ring size must be power of two! Adjust <JOURNAL_EVT_SIZE> macro inside journal.h file!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+journal_status_t	journal_init		(void);
+journal_status_t	journal_get_last	(journal_info_t * const p_info);
+void				journal_event		(const uint16_t id, const uint8_t arg);
+void				journal_fault		(const journal_fault_t fault, const uint32_t pc, const uint32_t lr, const char * const p_file, const uint32_t line, const uint32_t info);
+
+#endif // __JOURNAL_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
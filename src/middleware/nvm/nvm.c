@@ -0,0 +1,748 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm.c
+*@brief     Non-volatile memory on top of Flash Data Storage
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Each region is mirrored in RAM and stored in flash as single FDS
+* 	record. Reads and writes operate on RAM mirror only, region is
+* 	written to flash after NVM_CFG_DEBOUNCE_MS of quiet time (but at
+* 	latest after NVM_CFG_MAX_DELAY_MS) thus many small writes, e.g. one
+* 	per persistent parameter, end up in single record write.
+*
+* 	Record is replaced with "fds_record_update()" which writes new copy
+* 	before invalidating old one. Should power be lost in between, two
+* 	valid copies are found on next start-up; the newest one (highest
+* 	record ID) is used and the rest are deleted. Incomplete records are
+* 	rejected by FDS CRC check and reclaimed by garbage collection.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "nvm.h"
+
+#include "fds.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of region in words
+ */
+#define NVM_REGION_WORDS_MAX					( NVM_CFG_REGION_SIZE_MAX / 4UL )
+
+/**
+ * 	FDS record header size
+ *
+ * 	Unit: word
+ */
+#define NVM_FDS_HEADER_WORDS					( 3UL )
+
+/**
+ * 	Region runtime state
+ */
+typedef struct
+{
+	fds_record_desc_t	desc;				/**<Descriptor of stored record */
+	uint32_t			first_dirty_ms;		/**<Timestamp of first unsaved write */
+	uint32_t			last_write_ms;		/**<Timestamp of last write */
+	bool				dirty;				/**<RAM mirror differs from flash */
+	bool				busy;				/**<Record write in progress */
+	bool				has_rec;			/**<Record exists in flash */
+} nvm_region_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Pointer to configuration table
+ */
+static const nvm_cfg_t * gp_cfg_table = NULL;
+
+/**
+ * 	RAM mirror of regions
+ */
+static uint32_t gu32_nvm_mirror[eNVM_REGION_NUM_OF][NVM_REGION_WORDS_MAX] = {0};
+
+/**
+ * 	Flush buffers
+ *
+ * @note	FDS reads data from buffer after write call returns,
+ * 			thus mirror cannot be used directly as it might change.
+ */
+static uint32_t gu32_nvm_flush_buf[eNVM_REGION_NUM_OF][NVM_REGION_WORDS_MAX] = {0};
+
+/**
+ * 	Region states
+ */
+static volatile nvm_region_t g_nvm_region[eNVM_REGION_NUM_OF] = {0};
+
+/**
+ * 	FDS state
+ */
+static volatile bool gb_nvm_fds_init_done	= false;
+static volatile bool gb_nvm_fds_init_ok		= false;
+static volatile bool gb_nvm_gc_busy			= false;
+static volatile bool gb_nvm_gc_check		= false;
+
+/**
+ * 	Statistics
+ */
+static nvm_stats_t g_nvm_stats = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void			nvm_fds_evt_hndl	(fds_evt_t const * p_evt);
+static nvm_status_t nvm_fds_wait_init	(void);
+static void			nvm_region_load		(const nvm_region_name_t region);
+static void			nvm_region_flush	(const nvm_region_name_t region);
+static void			nvm_gc_start		(void);
+static void			nvm_gc_check		(void);
+static bool			nvm_is_addr_valid	(const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		FDS event handler
+*
+* @note		With NVMC backend events are raised from within FDS calls,
+* 			thus from main loop context.
+*
+* @param[in]	p_evt	- Pointer to FDS event
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_fds_evt_hndl(fds_evt_t const * p_evt)
+{
+	switch ( p_evt->id )
+	{
+		case FDS_EVT_INIT:
+			gb_nvm_fds_init_ok = ( NRF_SUCCESS == p_evt->result );
+			gb_nvm_fds_init_done = true;
+			break;
+
+		case FDS_EVT_WRITE:
+		case FDS_EVT_UPDATE:
+
+			for ( uint32_t region = 0; region < eNVM_REGION_NUM_OF; region++ )
+			{
+				if 	(	( gp_cfg_table[region].file_id == p_evt->write.file_id )
+					&&	( gp_cfg_table[region].rec_key == p_evt->write.record_key ))
+				{
+					g_nvm_region[region].busy = false;
+
+					if ( NRF_SUCCESS == p_evt->result )
+					{
+						g_nvm_region[region].has_rec = true;
+						gb_nvm_gc_check = true;
+					}
+					else
+					{
+						// Retry with next handler call
+						g_nvm_region[region].dirty = true;
+						g_nvm_stats.errors++;
+					}
+				}
+			}
+			break;
+
+		case FDS_EVT_GC:
+			gb_nvm_gc_busy = false;
+			break;
+
+		default:
+			// No actions...
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for FDS initialization
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t nvm_fds_wait_init(void)
+{
+	nvm_status_t	status 		= eNVM_OK;
+	const uint32_t	start_ms 	= systick_get_ms();
+
+	while	(	( false == gb_nvm_fds_init_done )
+			&&	(( systick_get_ms() - start_ms ) < NVM_CFG_TIMEOUT_MS ))
+	{
+		// Wait...
+	}
+
+	if ( true != gb_nvm_fds_init_ok )
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load region from flash into RAM mirror
+*
+* @note		Newest valid record wins, older copies left behind by power
+* 			loss during update are deleted.
+*
+* @param[in]	region	- Region name
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_region_load(const nvm_region_name_t region)
+{
+	fds_record_desc_t	desc		= {0};
+	fds_find_token_t	token		= {0};
+	fds_flash_record_t	flash_rec	= {0};
+	uint32_t			rec_id		= 0;
+	uint32_t			newest_id	= 0;
+	const uint16_t		file_id		= gp_cfg_table[region].file_id;
+	const uint16_t		rec_key		= gp_cfg_table[region].rec_key;
+
+	// Erased state
+	memset( &gu32_nvm_mirror[region][0], 0xFF, gp_cfg_table[region].size );
+
+	// Find newest valid copy
+	while ( NRF_SUCCESS == fds_record_find( file_id, rec_key, &desc, &token ))
+	{
+		if ( NRF_SUCCESS == fds_record_open( &desc, &flash_rec ))
+		{
+			(void) fds_record_id_from_desc( &desc, &rec_id );
+
+			if  (	( false == g_nvm_region[region].has_rec )
+				||	( rec_id > newest_id ))
+			{
+				const uint32_t size = (( flash_rec.p_header->length_words * 4UL ) < gp_cfg_table[region].size )
+									? ( flash_rec.p_header->length_words * 4UL )
+									: gp_cfg_table[region].size;
+
+				memcpy( &gu32_nvm_mirror[region][0], flash_rec.p_data, size );
+
+				newest_id = rec_id;
+				g_nvm_region[region].desc = desc;
+				g_nvm_region[region].has_rec = true;
+			}
+
+			(void) fds_record_close( &desc );
+		}
+		else
+		{
+			// Corrupted copy
+			(void) fds_record_delete( &desc );
+			NVM_DBG_PRINT( "NVM: %s corrupted record deleted", gp_cfg_table[region].p_name );
+		}
+	}
+
+	// Remove stale copies
+	if ( true == g_nvm_region[region].has_rec )
+	{
+		memset( &token, 0, sizeof( token ));
+
+		while ( NRF_SUCCESS == fds_record_find( file_id, rec_key, &desc, &token ))
+		{
+			(void) fds_record_id_from_desc( &desc, &rec_id );
+
+			if ( rec_id != newest_id )
+			{
+				(void) fds_record_delete( &desc );
+				NVM_DBG_PRINT( "NVM: %s stale record deleted", gp_cfg_table[region].p_name );
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write RAM mirror of region to flash
+*
+* @param[in]	region	- Region name
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_region_flush(const nvm_region_name_t region)
+{
+	ret_code_t 		ret = NRF_SUCCESS;
+	fds_record_t	rec = {0};
+
+	if 	(	( false == g_nvm_region[region].busy )
+		&&	( false == gb_nvm_gc_busy ))
+	{
+		memcpy( &gu32_nvm_flush_buf[region][0], &gu32_nvm_mirror[region][0], gp_cfg_table[region].size );
+
+		rec.file_id				= gp_cfg_table[region].file_id;
+		rec.key					= gp_cfg_table[region].rec_key;
+		rec.data.p_data			= &gu32_nvm_flush_buf[region][0];
+		rec.data.length_words	= ( gp_cfg_table[region].size / 4UL );
+
+		// FDS event might be raised before call returns
+		g_nvm_region[region].dirty = false;
+		g_nvm_region[region].busy = true;
+
+		if ( true == g_nvm_region[region].has_rec )
+		{
+			ret = fds_record_update((fds_record_desc_t*) &g_nvm_region[region].desc, &rec );
+		}
+		else
+		{
+			ret = fds_record_write((fds_record_desc_t*) &g_nvm_region[region].desc, &rec );
+		}
+
+		if ( NRF_SUCCESS == ret )
+		{
+			g_nvm_stats.writes++;
+		}
+		else
+		{
+			// Not queued, no event will follow
+			g_nvm_region[region].dirty = true;
+			g_nvm_region[region].busy = false;
+
+			if ( FDS_ERR_NO_SPACE_IN_FLASH == ret )
+			{
+				// Flushed after garbage collection
+				nvm_gc_start();
+			}
+			else
+			{
+				g_nvm_stats.errors++;
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start garbage collection
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_gc_start(void)
+{
+	// FDS event might be raised before call returns
+	gb_nvm_gc_busy = true;
+
+	if ( NRF_SUCCESS == fds_gc())
+	{
+		g_nvm_stats.gc++;
+	}
+	else
+	{
+		gb_nvm_gc_busy = false;
+		g_nvm_stats.errors++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Collect garbage when there is no longer room for biggest region
+*
+* @note		Done in advance so that region flush does not have to
+* 			wait for page erase.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void nvm_gc_check(void)
+{
+	fds_stat_t stat = {0};
+
+	gb_nvm_gc_check = false;
+
+	if ( NRF_SUCCESS == fds_stat( &stat ))
+	{
+		if 	(	(( stat.largest_contig < ( NVM_REGION_WORDS_MAX + NVM_FDS_HEADER_WORDS )) && ( stat.freeable_words > 0 ))
+			||	( true == stat.corruption ))
+		{
+			nvm_gc_start();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check region boundaries
+*
+* @param[in]	region	- Region name
+* @param[in]	addr	- Start address within region
+* @param[in]	size	- Size of access
+* @return		true if access is within region
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_is_addr_valid(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+{
+	bool valid = false;
+
+	if ( region < eNVM_REGION_NUM_OF )
+	{
+		if 	(	( addr < gp_cfg_table[region].size )
+			&&	( size <= ( gp_cfg_table[region].size - addr )))
+		{
+			valid = true;
+		}
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of NVM API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize NVM
+*
+* @note		Loads all regions into RAM. Must be called before
+* 			initialization of device parameters!
+*
+* @return		status	- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_init(void)
+{
+	nvm_status_t status = eNVM_OK;
+
+	gp_cfg_table = nvm_cfg_get_table();
+
+	// Check region configuration
+	for ( uint32_t region = 0; region < eNVM_REGION_NUM_OF; region++ )
+	{
+		if 	(	( gp_cfg_table[region].size > NVM_CFG_REGION_SIZE_MAX )
+			||	( 0UL != ( gp_cfg_table[region].size % 4UL ))
+			||	( 0UL == gp_cfg_table[region].size ))
+		{
+			status = eNVM_ERROR;
+		}
+	}
+
+	NVM_ASSERT( eNVM_OK == status );
+
+	if ( eNVM_OK == status )
+	{
+		if 	(	( NRF_SUCCESS != fds_register( nvm_fds_evt_hndl ))
+			||	( NRF_SUCCESS != fds_init()))
+		{
+			status = eNVM_ERROR;
+		}
+		else
+		{
+			status = nvm_fds_wait_init();
+		}
+	}
+
+	if ( eNVM_OK == status )
+	{
+		for ( uint32_t region = 0; region < eNVM_REGION_NUM_OF; region++ )
+		{
+			nvm_region_load( region );
+		}
+
+		// Reclaim space of deleted and incomplete records
+		nvm_gc_check();
+
+		gb_is_init = true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get initialization flag
+*
+* @param[out]	p_is_init	- Initialization flag
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_is_init(bool * const p_is_init)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if ( NULL != p_is_init )
+	{
+		*p_is_init = gb_is_init;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Handle NVM
+*
+* @note		Flushes dirty regions once debounce time expires. Call it
+* 			periodically from application.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_hndl(void)
+{
+	if ( true == gb_is_init )
+	{
+		const uint32_t now = systick_get_ms();
+
+		for ( uint32_t region = 0; region < eNVM_REGION_NUM_OF; region++ )
+		{
+			if ( true == g_nvm_region[region].dirty )
+			{
+				if 	(	(( now - g_nvm_region[region].last_write_ms ) >= NVM_CFG_DEBOUNCE_MS )
+					||	(( now - g_nvm_region[region].first_dirty_ms ) >= NVM_CFG_MAX_DELAY_MS ))
+				{
+					nvm_region_flush( region );
+				}
+			}
+		}
+
+		if 	(	( true == gb_nvm_gc_check )
+			&&	( false == gb_nvm_gc_busy ))
+		{
+			nvm_gc_check();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write to NVM region
+*
+* @note		Data is written to RAM mirror only and flushed to flash
+* 			later by "nvm_hndl()" or "nvm_sync()".
+*
+* @param[in]	region	- Region name
+* @param[in]	addr	- Start address within region
+* @param[in]	size	- Size of data. Unit: byte
+* @param[in]	p_data	- Pointer to data
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_write(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	nvm_status_t status = eNVM_OK;
+
+	NVM_ASSERT( true == gb_is_init );
+	NVM_ASSERT( NULL != p_data );
+
+	if 	(	( true == gb_is_init )
+		&&	( NULL != p_data )
+		&&	( true == nvm_is_addr_valid( region, addr, size )))
+	{
+		uint8_t * const p_mirror = (uint8_t*) &gu32_nvm_mirror[region][0];
+
+		if ( 0 != memcmp( &p_mirror[addr], p_data, size ))
+		{
+			const uint32_t now = systick_get_ms();
+
+			memcpy( &p_mirror[addr], p_data, size );
+
+			if ( true == g_nvm_region[region].dirty )
+			{
+				g_nvm_stats.coalesced++;
+			}
+			else
+			{
+				g_nvm_region[region].first_dirty_ms = now;
+			}
+
+			g_nvm_region[region].last_write_ms = now;
+			g_nvm_region[region].dirty = true;
+		}
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read from NVM region
+*
+* @param[in]	region	- Region name
+* @param[in]	addr	- Start address within region
+* @param[in]	size	- Size of data. Unit: byte
+* @param[out]	p_data	- Pointer to data
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_read(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	nvm_status_t status = eNVM_OK;
+
+	NVM_ASSERT( true == gb_is_init );
+	NVM_ASSERT( NULL != p_data );
+
+	if 	(	( true == gb_is_init )
+		&&	( NULL != p_data )
+		&&	( true == nvm_is_addr_valid( region, addr, size )))
+	{
+		memcpy( p_data, &((uint8_t*) &gu32_nvm_mirror[region][0] )[addr], size );
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase part of NVM region
+*
+* @param[in]	region	- Region name
+* @param[in]	addr	- Start address within region
+* @param[in]	size	- Size of data. Unit: byte
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_erase(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+{
+	nvm_status_t 	status 				= eNVM_OK;
+	uint8_t			erased[32]			= {0};
+	uint32_t		done				= 0;
+
+	memset( &erased, 0xFF, sizeof( erased ));
+
+	if ( true == nvm_is_addr_valid( region, addr, size ))
+	{
+		while (( done < size ) && ( eNVM_OK == status ))
+		{
+			const uint32_t chunk = (( size - done ) < sizeof( erased )) ? ( size - done ) : sizeof( erased );
+
+			status = nvm_write( region, addr + done, chunk, (const uint8_t*) &erased );
+			done += chunk;
+		}
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write region to flash immediately
+*
+* @note		Blocks until region is written or NVM_CFG_TIMEOUT_MS
+* 			expires. Use before reset or power down.
+*
+* @param[in]	region	- Region name
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sync(const nvm_region_name_t region)
+{
+	nvm_status_t 	status 		= eNVM_OK;
+	const uint32_t	start_ms 	= systick_get_ms();
+
+	NVM_ASSERT( true == gb_is_init );
+	NVM_ASSERT( region < eNVM_REGION_NUM_OF );
+
+	if 	(	( true == gb_is_init )
+		&&	( region < eNVM_REGION_NUM_OF ))
+	{
+		while	(	(	( true == g_nvm_region[region].dirty )
+					||	( true == g_nvm_region[region].busy )
+					||	( true == gb_nvm_gc_busy ))
+				&&	(( systick_get_ms() - start_ms ) < NVM_CFG_TIMEOUT_MS ))
+		{
+			if ( true == g_nvm_region[region].dirty )
+			{
+				nvm_region_flush( region );
+			}
+		}
+
+		if 	(	( true == g_nvm_region[region].dirty )
+			||	( true == g_nvm_region[region].busy ))
+		{
+			status = eNVM_ERROR;
+		}
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get NVM statistics
+*
+* @param[out]	p_stats	- Pointer to statistics
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_get_stats(nvm_stats_t * const p_stats)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if ( NULL != p_stats )
+	{
+		*p_stats = g_nvm_stats;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
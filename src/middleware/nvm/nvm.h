@@ -0,0 +1,74 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm.h
+*@brief     Non-volatile memory on top of Flash Data Storage
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Non-volatile memory on top of Flash Data Storage
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __NVM_H
+#define __NVM_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nvm_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	NVM status
+ */
+typedef enum
+{
+	eNVM_OK = 0,		/**<Normal operation */
+	eNVM_ERROR,			/**<General error code */
+} nvm_status_t;
+
+/**
+ * 	NVM statistics
+ */
+typedef struct
+{
+	uint32_t	writes;			/**<Number of record writes to flash */
+	uint32_t	coalesced;		/**<Number of region writes absorbed in RAM */
+	uint32_t	gc;				/**<Number of garbage collections */
+	uint32_t	errors;			/**<Number of failed flash operations */
+} nvm_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t	nvm_init		(void);
+nvm_status_t	nvm_is_init		(bool * const p_is_init);
+void			nvm_hndl		(void);
+nvm_status_t	nvm_write		(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t	nvm_read		(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+nvm_status_t	nvm_erase		(const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+nvm_status_t	nvm_sync		(const nvm_region_name_t region);
+nvm_status_t	nvm_get_stats	(nvm_stats_t * const p_stats);
+
+#endif // __NVM_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
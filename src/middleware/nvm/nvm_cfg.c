@@ -0,0 +1,72 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_cfg.c
+*@brief     Non-volatile memory configurations
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_CONFIGURATIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Put code that is platform depended inside code block start with
+* 	"USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "nvm_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *      NVM region definitions
+ *
+ * @note	FDS file ID must be in range 0x0000-0xBFFF and record key
+ * 			in range 0x0001-0xBFFF!
+ */
+static const nvm_cfg_t g_nvm_cfg_table[eNVM_REGION_NUM_OF] =
+{
+    // USER CODE BEGIN...
+
+	// -------------------------------------------------------------------------------------------------------
+	//                                  Region name                 Size [byte]     FDS file ID         FDS record key
+	// -------------------------------------------------------------------------------------------------------
+
+	[eNVM_REGION_EEPROM_RUN_PAR]    = { .p_name = "Parameters",     .size = 1024UL,     .file_id = 0x0001U,     .rec_key = 0x0001U  },
+
+	// -------------------------------------------------------------------------------------------------------
+
+    // USER CODE END...
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get NVM configuration table
+*
+* @return		pointer to configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const nvm_cfg_t * nvm_cfg_get_table(void)
+{
+    return (const nvm_cfg_t*) &g_nvm_cfg_table;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
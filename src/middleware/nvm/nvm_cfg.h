@@ -0,0 +1,162 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_cfg.h
+*@brief     Non-volatile memory configurations
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_CONFIGURATIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Put code that is platform depended inside code block start with
+* 	"USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NVM_CFG_H
+#define __NVM_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+// USER CODE BEGIN...
+
+#include "project_config.h"
+
+// Debug communication port
+#include "middleware/cli/cli/src/cli.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 		NVM region list
+ *
+ * @note	Each region is stored as single FDS record, thus its
+ * 			size is limited by FDS virtual page size.
+ */
+typedef enum
+{
+	// USER CODE BEGIN...
+
+	eNVM_REGION_EEPROM_RUN_PAR = 0,		/**<Device parameters */
+
+	// USER CODE END...
+
+	eNVM_REGION_NUM_OF
+} nvm_region_name_t;
+
+/**
+ * 		NVM region configuration
+ */
+typedef struct
+{
+	const char* p_name;		/**<Region name */
+	uint32_t	size;		/**<Size of region. Unit: byte */
+	uint16_t	file_id;	/**<FDS file ID */
+	uint16_t	rec_key;	/**<FDS record key */
+} nvm_cfg_t;
+
+// USER CODE BEGIN...
+
+/**
+ * 	Quiet time after last write before region is flushed to flash
+ *
+ * @note	Rapid successive writes are coalesced into single
+ * 			record write, thus limiting flash wear.
+ *
+ * 	Unit: ms
+ */
+#define NVM_CFG_DEBOUNCE_MS						( 2000UL )
+
+/**
+ * 	Maximum time region stays dirty in RAM
+ *
+ * @note	Prevents flush starvation when region is written
+ * 			more often than debounce time.
+ *
+ * 	Unit: ms
+ */
+#define NVM_CFG_MAX_DELAY_MS					( 30000UL )
+
+/**
+ * 	Maximum size of single region
+ *
+ * 	Unit: byte
+ */
+#define NVM_CFG_REGION_SIZE_MAX					( 1024UL )
+
+/**
+ * 	FDS initialization and sync timeout
+ *
+ * 	Unit: ms
+ */
+#define NVM_CFG_TIMEOUT_MS						( 500UL )
+
+/**
+ * 	Enable/Disable debug mode
+ *
+ * 	@note	Disable in release!
+ */
+#define NVM_CFG_DEBUG_EN						( 1 )
+
+#ifndef DEBUG
+#undef NVM_CFG_DEBUG_EN
+#define NVM_CFG_DEBUG_EN 0
+#endif
+
+/**
+ * 	Enable/Disable assertions
+ *
+ * 	@note	Disable in release!
+ */
+#define NVM_CFG_ASSERT_EN						( 1 )
+
+#ifndef DEBUG
+#undef NVM_CFG_ASSERT_EN
+#define NVM_CFG_ASSERT_EN 0
+#endif
+
+/**
+ * 	Debug communication port macros
+ */
+#if ( 1 == NVM_CFG_DEBUG_EN )
+	#define NVM_DBG_PRINT( ... )				( cli_printf( __VA_ARGS__ ))
+#else
+	#define NVM_DBG_PRINT( ... )				{ ; }
+#endif
+
+/**
+ * 	 Assertion macros
+ */
+#if ( 1 == NVM_CFG_ASSERT_EN )
+	#define NVM_ASSERT(x)						PROJECT_CONFIG_ASSERT(x)
+#else
+	#define NVM_ASSERT(x)						{ ; }
+#endif
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+const nvm_cfg_t * nvm_cfg_get_table(void);
+
+#endif // __NVM_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,945 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fds_mock.c
+*@brief     Flash data storage simulator
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup FDS_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Record is written as: key and length, record ID, data and at last
+* 	file ID with CRC, which marks record complete. Deleted record has
+* 	its key cleared to FDS_RECORD_KEY_DIRTY.
+*
+* 	Garbage collection of a page copies its valid records into swap
+* 	page, erases the page, tags swap page as data and erased page as
+* 	new swap. Initialization finishes or rolls back collection that
+* 	was interrupted by power loss.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "fds_mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Page tag
+ */
+#define FDS_MOCK_TAG_MAGIC			( 0xDEADC0DEUL )
+#define FDS_MOCK_TAG_SWAP			( 0xF11E01FFUL )
+#define FDS_MOCK_TAG_DATA			( 0xF11E01FEUL )
+#define FDS_MOCK_TAG_WORDS			( 2UL )
+
+/**
+ * 	Record header layout
+ *
+ * 	Unit: word
+ */
+#define FDS_MOCK_HDR_TL				( 0UL )
+#define FDS_MOCK_HDR_IC				( 1UL )
+#define FDS_MOCK_HDR_ID				( 2UL )
+#define FDS_MOCK_HDR_WORDS			( 3UL )
+
+/**
+ * 	Erased flash word
+ */
+#define FDS_MOCK_ERASED				( 0xFFFFFFFFUL )
+
+/**
+ * 	Page type
+ */
+typedef enum
+{
+	eFDS_MOCK_PAGE_ERASED = 0,
+	eFDS_MOCK_PAGE_DATA,
+	eFDS_MOCK_PAGE_SWAP,
+	eFDS_MOCK_PAGE_INVALID,
+} fds_mock_page_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Flash, shared with forked processes
+ */
+static uint32_t * gp_fds_mock_flash = NULL;
+
+/**
+ * 	Flash copy for restore
+ */
+static uint32_t gu32_fds_mock_save[FDS_MOCK_PAGES][FDS_MOCK_PAGE_WORDS] = {0};
+
+/**
+ * 	FDS state
+ */
+static fds_cb_t	gp_fds_mock_cb			= NULL;
+static bool		gb_fds_mock_init		= false;
+static uint32_t	gu32_fds_mock_rec_id	= 0;
+static uint16_t	gu16_fds_mock_gc_runs	= 0;
+static uint16_t	gu16_fds_mock_open		= 0;
+
+/**
+ * 	Flash operations done and operations left till power cut
+ */
+static uint32_t	gu32_fds_mock_ops		= 0;
+static uint32_t	gu32_fds_mock_cut		= 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get page
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t * fds_mock_page(const uint32_t page)
+{
+	if ( NULL == gp_fds_mock_flash )
+	{
+		gp_fds_mock_flash = mmap( NULL, sizeof( gu32_fds_mock_save ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+		memset( gp_fds_mock_flash, 0xFF, sizeof( gu32_fds_mock_save ));
+	}
+
+	return &gp_fds_mock_flash[ page * FDS_MOCK_PAGE_WORDS ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account flash operation, power is cut before it when requested
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_op(void)
+{
+	if ( gu32_fds_mock_cut > 0 )
+	{
+		gu32_fds_mock_cut--;
+
+		if ( 0 == gu32_fds_mock_cut )
+		{
+			fflush( stdout );
+			_exit( FDS_MOCK_POWER_LOSS );
+		}
+	}
+
+	gu32_fds_mock_ops++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program word, bits can only be cleared
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_program(uint32_t * const p_word, const uint32_t val)
+{
+	fds_mock_op();
+	*p_word &= val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase page
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_erase(const uint32_t page)
+{
+	fds_mock_op();
+	memset( fds_mock_page( page ), 0xFF, FDS_MOCK_PAGE_WORDS * 4UL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get page type from its tag
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fds_mock_page_t fds_mock_page_type(const uint32_t page)
+{
+	const uint32_t * const	p_page	= fds_mock_page( page );
+	fds_mock_page_t			type	= eFDS_MOCK_PAGE_INVALID;
+
+	if ( FDS_MOCK_TAG_MAGIC == p_page[0] )
+	{
+		if ( FDS_MOCK_TAG_DATA == p_page[1] )
+		{
+			type = eFDS_MOCK_PAGE_DATA;
+		}
+		else if ( FDS_MOCK_TAG_SWAP == p_page[1] )
+		{
+			type = eFDS_MOCK_PAGE_SWAP;
+		}
+	}
+	else if ( FDS_MOCK_ERASED == p_page[0] )
+	{
+		type = eFDS_MOCK_PAGE_ERASED;
+
+		for ( uint32_t w = 1; w < FDS_MOCK_PAGE_WORDS; w++ )
+		{
+			if ( FDS_MOCK_ERASED != p_page[w] )
+			{
+				type = eFDS_MOCK_PAGE_INVALID;
+			}
+		}
+	}
+
+	return type;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get record at offset in page
+*
+* @return		pointer to record header, NULL at end of written area
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t * fds_mock_rec_at(const uint32_t page, const uint32_t offset)
+{
+	uint32_t * const	p_page	= fds_mock_page( page );
+	uint32_t *			p_rec	= NULL;
+
+	if ((( offset + FDS_MOCK_HDR_WORDS ) <= FDS_MOCK_PAGE_WORDS ) && ( FDS_MOCK_ERASED != p_page[offset] ))
+	{
+		const uint32_t len = ( p_page[offset] >> 16 );
+
+		if (( offset + FDS_MOCK_HDR_WORDS + len ) <= FDS_MOCK_PAGE_WORDS )
+		{
+			p_rec = &p_page[offset];
+		}
+	}
+
+	return p_rec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get offset of next record
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fds_mock_rec_next(const uint32_t * const p_rec)
+{
+	return ( FDS_MOCK_HDR_WORDS + ( p_rec[FDS_MOCK_HDR_TL] >> 16 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Record is complete and not deleted
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fds_mock_rec_valid(const uint32_t * const p_rec)
+{
+	const fds_header_t * const p_hdr = (const fds_header_t*) p_rec;
+
+	return (( FDS_RECORD_KEY_DIRTY != p_hdr->record_key ) && ( FDS_FILE_ID_INVALID != p_hdr->file_id ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get end of written area in page
+*
+* 	Unit: word
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fds_mock_page_end(const uint32_t page)
+{
+	uint32_t	offset	= FDS_MOCK_TAG_WORDS;
+	uint32_t *	p_rec	= NULL;
+
+	while ( NULL != ( p_rec = fds_mock_rec_at( page, offset )))
+	{
+		offset += fds_mock_rec_next( p_rec );
+	}
+
+	return offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of reclaimable words in page
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fds_mock_page_freeable(const uint32_t page)
+{
+	uint32_t	offset		= FDS_MOCK_TAG_WORDS;
+	uint32_t	freeable	= 0;
+	uint32_t *	p_rec		= NULL;
+
+	while ( NULL != ( p_rec = fds_mock_rec_at( page, offset )))
+	{
+		if ( false == fds_mock_rec_valid( p_rec ))
+		{
+			freeable += fds_mock_rec_next( p_rec );
+		}
+
+		offset += fds_mock_rec_next( p_rec );
+	}
+
+	return freeable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		CRC16-CCITT of record, without CRC field
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t fds_mock_crc(const fds_header_t * const p_hdr, const uint32_t * const p_data)
+{
+	uint8_t		buf[10]	= {0};
+	uint16_t	crc		= 0xFFFFU;
+
+	memcpy( &buf[0], &p_hdr->record_key, 2 );
+	memcpy( &buf[2], &p_hdr->length_words, 2 );
+	memcpy( &buf[4], &p_hdr->file_id, 2 );
+	memcpy( &buf[6], &p_hdr->record_id, 4 );
+
+	for ( uint32_t i = 0; i < ( sizeof( buf ) + ( p_hdr->length_words * 4UL )); i++ )
+	{
+		crc = (uint8_t)( crc >> 8 ) | ( crc << 8 );
+		crc ^= ( i < sizeof( buf )) ? buf[i] : ((const uint8_t*) p_data )[ i - sizeof( buf ) ];
+		crc ^= (uint8_t)( crc & 0xFF ) >> 4;
+		crc ^= ( crc << 8 ) << 4;
+		crc ^= (( crc & 0xFF ) << 4 ) << 1;
+	}
+
+	return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find valid record by its ID
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t * fds_mock_rec_find_id(const uint32_t record_id)
+{
+	uint32_t * p_found = NULL;
+
+	for ( uint32_t page = 0; ( page < FDS_MOCK_PAGES ) && ( NULL == p_found ); page++ )
+	{
+		if ( eFDS_MOCK_PAGE_DATA == fds_mock_page_type( page ))
+		{
+			uint32_t	offset	= FDS_MOCK_TAG_WORDS;
+			uint32_t *	p_rec	= NULL;
+
+			while ( NULL != ( p_rec = fds_mock_rec_at( page, offset )))
+			{
+				if (( true == fds_mock_rec_valid( p_rec )) && ( record_id == p_rec[FDS_MOCK_HDR_ID] ))
+				{
+					p_found = p_rec;
+				}
+
+				offset += fds_mock_rec_next( p_rec );
+			}
+		}
+	}
+
+	return p_found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Raise event
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_evt(const fds_evt_t * const p_evt)
+{
+	if ( NULL != gp_fds_mock_cb )
+	{
+		gp_fds_mock_cb( p_evt );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write page tag
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_tag(const uint32_t page, const uint32_t tag)
+{
+	uint32_t * const p_page = fds_mock_page( page );
+
+	fds_mock_program( &p_page[0], FDS_MOCK_TAG_MAGIC );
+	fds_mock_program( &p_page[1], tag );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Complete or roll back interrupted garbage collection and format
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_repair(void)
+{
+	int32_t swap = -1;
+
+	for ( uint32_t page = 0; page < FDS_MOCK_PAGES; page++ )
+	{
+		if ( eFDS_MOCK_PAGE_SWAP == fds_mock_page_type( page ))
+		{
+			swap = (int32_t) page;
+		}
+	}
+
+	if (( swap >= 0 ) && ( fds_mock_page_end( swap ) > FDS_MOCK_TAG_WORDS ))
+	{
+		bool source_erased = false;
+
+		for ( uint32_t page = 0; page < FDS_MOCK_PAGES; page++ )
+		{
+			if ( eFDS_MOCK_PAGE_DATA != fds_mock_page_type( page ) && ( page != (uint32_t) swap ))
+			{
+				source_erased = true;
+			}
+		}
+
+		if ( true == source_erased )
+		{
+			// Source page erased, copy is complete
+			fds_mock_program( &fds_mock_page( swap )[1], FDS_MOCK_TAG_DATA );
+			swap = -1;
+		}
+		else
+		{
+			// Copy interrupted, source page is intact
+			fds_mock_erase( swap );
+			fds_mock_tag( swap, FDS_MOCK_TAG_SWAP );
+		}
+	}
+
+	for ( uint32_t page = 0; page < FDS_MOCK_PAGES; page++ )
+	{
+		const fds_mock_page_t type = fds_mock_page_type( page );
+
+		if (( eFDS_MOCK_PAGE_ERASED == type ) || ( eFDS_MOCK_PAGE_INVALID == type ))
+		{
+			if ( eFDS_MOCK_PAGE_INVALID == type )
+			{
+				fds_mock_erase( page );
+			}
+
+			if ( swap < 0 )
+			{
+				fds_mock_tag( page, FDS_MOCK_TAG_SWAP );
+				swap = (int32_t) page;
+			}
+			else
+			{
+				fds_mock_tag( page, FDS_MOCK_TAG_DATA );
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write record
+*
+* @return		pointer to written record, NULL if there is no space
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t * fds_mock_rec_write(fds_record_t const * p_record, const uint32_t record_id)
+{
+	const uint32_t	len		= p_record->data.length_words;
+	uint32_t *		p_rec	= NULL;
+
+	for ( uint32_t page = 0; ( page < FDS_MOCK_PAGES ) && ( NULL == p_rec ); page++ )
+	{
+		if ( eFDS_MOCK_PAGE_DATA == fds_mock_page_type( page ))
+		{
+			const uint32_t end = fds_mock_page_end( page );
+
+			if (( end + FDS_MOCK_HDR_WORDS + len ) <= FDS_MOCK_PAGE_WORDS )
+			{
+				p_rec = &fds_mock_page( page )[end];
+			}
+		}
+	}
+
+	if ( NULL != p_rec )
+	{
+		const uint32_t * const	p_data	= (const uint32_t*) p_record->data.p_data;
+		const fds_header_t		hdr		=
+		{
+			.record_key		= p_record->key,
+			.length_words	= (uint16_t) len,
+			.file_id		= p_record->file_id,
+			.record_id		= record_id,
+		};
+		const uint32_t			ic		= ((uint32_t) fds_mock_crc( &hdr, p_data ) << 16 ) | p_record->file_id;
+
+		fds_mock_program( &p_rec[FDS_MOCK_HDR_TL], ( len << 16 ) | p_record->key );
+		fds_mock_program( &p_rec[FDS_MOCK_HDR_ID], record_id );
+
+		for ( uint32_t w = 0; w < len; w++ )
+		{
+			fds_mock_program( &p_rec[ FDS_MOCK_HDR_WORDS + w ], p_data[w] );
+		}
+
+		// Marks record complete
+		fds_mock_program( &p_rec[FDS_MOCK_HDR_IC], ic );
+	}
+
+	return p_rec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Collect garbage of single page
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fds_mock_gc_page(const uint32_t page, const uint32_t swap)
+{
+	uint32_t	src		= FDS_MOCK_TAG_WORDS;
+	uint32_t	dst		= FDS_MOCK_TAG_WORDS;
+	uint32_t *	p_rec	= NULL;
+
+	while ( NULL != ( p_rec = fds_mock_rec_at( page, src )))
+	{
+		const uint32_t len = fds_mock_rec_next( p_rec );
+
+		if ( true == fds_mock_rec_valid( p_rec ))
+		{
+			for ( uint32_t w = 0; w < len; w++ )
+			{
+				fds_mock_program( &fds_mock_page( swap )[ dst + w ], p_rec[w] );
+			}
+
+			dst += len;
+		}
+
+		src += len;
+	}
+
+	fds_mock_erase( page );
+	fds_mock_program( &fds_mock_page( swap )[1], FDS_MOCK_TAG_DATA );
+	fds_mock_tag( page, FDS_MOCK_TAG_SWAP );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		FDS API
+*/
+////////////////////////////////////////////////////////////////////////////////
+ret_code_t fds_register(fds_cb_t cb)
+{
+	gp_fds_mock_cb = cb;
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t fds_init(void)
+{
+	fds_evt_t evt = { .id = FDS_EVT_INIT, .result = NRF_SUCCESS };
+
+	fds_mock_repair();
+
+	// Continue record ID sequence
+	gu32_fds_mock_rec_id = 0;
+
+	for ( uint32_t page = 0; page < FDS_MOCK_PAGES; page++ )
+	{
+		uint32_t	offset	= FDS_MOCK_TAG_WORDS;
+		uint32_t *	p_rec	= NULL;
+
+		while (( eFDS_MOCK_PAGE_DATA == fds_mock_page_type( page )) && ( NULL != ( p_rec = fds_mock_rec_at( page, offset ))))
+		{
+			if (( FDS_MOCK_ERASED != p_rec[FDS_MOCK_HDR_ID] ) && ( p_rec[FDS_MOCK_HDR_ID] > gu32_fds_mock_rec_id ))
+			{
+				gu32_fds_mock_rec_id = p_rec[FDS_MOCK_HDR_ID];
+			}
+
+			offset += fds_mock_rec_next( p_rec );
+		}
+	}
+
+	gb_fds_mock_init = true;
+	fds_mock_evt( &evt );
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t fds_record_write(fds_record_desc_t * p_desc, fds_record_t const * p_record)
+{
+	ret_code_t		ret		= NRF_SUCCESS;
+	const uint32_t	id		= gu32_fds_mock_rec_id + 1;
+	uint32_t *		p_rec	= NULL;
+
+	if ( false == gb_fds_mock_init )
+	{
+		ret = FDS_ERR_NOT_INITIALIZED;
+	}
+	else if ( NULL == ( p_rec = fds_mock_rec_write( p_record, id )))
+	{
+		ret = FDS_ERR_NO_SPACE_IN_FLASH;
+	}
+	else
+	{
+		fds_evt_t evt = { .id = FDS_EVT_WRITE, .result = NRF_SUCCESS };
+
+		gu32_fds_mock_rec_id = id;
+
+		if ( NULL != p_desc )
+		{
+			p_desc->record_id		= id;
+			p_desc->p_record		= p_rec;
+			p_desc->gc_run_count	= gu16_fds_mock_gc_runs;
+			p_desc->record_is_open	= false;
+		}
+
+		evt.write.record_id		= id;
+		evt.write.file_id		= p_record->file_id;
+		evt.write.record_key	= p_record->key;
+
+		fds_mock_evt( &evt );
+	}
+
+	return ret;
+}
+
+ret_code_t fds_record_update(fds_record_desc_t * p_desc, fds_record_t const * p_record)
+{
+	ret_code_t		ret		= NRF_SUCCESS;
+	const uint32_t	id		= gu32_fds_mock_rec_id + 1;
+	uint32_t *		p_rec	= NULL;
+
+	if ( false == gb_fds_mock_init )
+	{
+		ret = FDS_ERR_NOT_INITIALIZED;
+	}
+	else if ( NULL == ( p_rec = fds_mock_rec_write( p_record, id )))
+	{
+		ret = FDS_ERR_NO_SPACE_IN_FLASH;
+	}
+	else
+	{
+		fds_evt_t	evt		= { .id = FDS_EVT_UPDATE, .result = NRF_SUCCESS };
+		uint32_t *	p_old	= fds_mock_rec_find_id( p_desc->record_id );
+
+		gu32_fds_mock_rec_id = id;
+
+		// New copy is complete, old one is deleted
+		if ( NULL != p_old )
+		{
+			fds_mock_program( &p_old[FDS_MOCK_HDR_TL], 0xFFFF0000UL | FDS_RECORD_KEY_DIRTY );
+		}
+
+		p_desc->record_id		= id;
+		p_desc->p_record		= p_rec;
+		p_desc->gc_run_count	= gu16_fds_mock_gc_runs;
+		p_desc->record_is_open	= false;
+
+		evt.write.record_id			= id;
+		evt.write.file_id			= p_record->file_id;
+		evt.write.record_key		= p_record->key;
+		evt.write.is_record_updated	= ( NULL != p_old );
+
+		fds_mock_evt( &evt );
+	}
+
+	return ret;
+}
+
+ret_code_t fds_record_delete(fds_record_desc_t * p_desc)
+{
+	ret_code_t			ret		= NRF_SUCCESS;
+	uint32_t * const	p_rec	= fds_mock_rec_find_id( p_desc->record_id );
+
+	if ( NULL == p_rec )
+	{
+		ret = FDS_ERR_NOT_FOUND;
+	}
+	else
+	{
+		fds_evt_t evt = { .id = FDS_EVT_DEL_RECORD, .result = NRF_SUCCESS };
+
+		evt.del.record_id	= p_desc->record_id;
+		evt.del.file_id		= ((const fds_header_t*) p_rec )->file_id;
+		evt.del.record_key	= ((const fds_header_t*) p_rec )->record_key;
+
+		fds_mock_program( &p_rec[FDS_MOCK_HDR_TL], 0xFFFF0000UL | FDS_RECORD_KEY_DIRTY );
+		fds_mock_evt( &evt );
+	}
+
+	return ret;
+}
+
+ret_code_t fds_record_find(uint16_t file_id, uint16_t record_key, fds_record_desc_t * p_desc, fds_find_token_t * p_token)
+{
+	ret_code_t ret = FDS_ERR_NOT_FOUND;
+
+	for ( uint32_t page = p_token->page; ( page < FDS_MOCK_PAGES ) && ( NRF_SUCCESS != ret ); page++ )
+	{
+		uint32_t	offset	= FDS_MOCK_TAG_WORDS;
+		uint32_t *	p_rec	= NULL;
+
+		// Continue after last found record
+		if (( page == p_token->page ) && ( NULL != p_token->p_addr ))
+		{
+			offset = ( p_token->p_addr - fds_mock_page( page )) + fds_mock_rec_next( p_token->p_addr );
+		}
+
+		while 	(	( eFDS_MOCK_PAGE_DATA == fds_mock_page_type( page ))
+				&&	( NRF_SUCCESS != ret )
+				&&	( NULL != ( p_rec = fds_mock_rec_at( page, offset ))))
+		{
+			const fds_header_t * const p_hdr = (const fds_header_t*) p_rec;
+
+			if 	(	( true == fds_mock_rec_valid( p_rec ))
+				&&	( file_id == p_hdr->file_id )
+				&&	( record_key == p_hdr->record_key ))
+			{
+				p_desc->record_id		= p_hdr->record_id;
+				p_desc->p_record		= p_rec;
+				p_desc->gc_run_count	= gu16_fds_mock_gc_runs;
+				p_desc->record_is_open	= false;
+
+				p_token->page	= (uint16_t) page;
+				p_token->p_addr	= p_rec;
+
+				ret = NRF_SUCCESS;
+			}
+
+			offset += fds_mock_rec_next( p_rec );
+		}
+	}
+
+	return ret;
+}
+
+ret_code_t fds_record_open(fds_record_desc_t * p_desc, fds_flash_record_t * p_flash_record)
+{
+	ret_code_t			ret		= NRF_SUCCESS;
+	uint32_t * const	p_rec	= fds_mock_rec_find_id( p_desc->record_id );
+
+	if ( NULL == p_rec )
+	{
+		ret = FDS_ERR_NOT_FOUND;
+	}
+	else if ( fds_mock_crc((const fds_header_t*) p_rec, &p_rec[FDS_MOCK_HDR_WORDS] ) != ((const fds_header_t*) p_rec )->crc16 )
+	{
+		ret = FDS_ERR_CRC_CHECK_FAILED;
+	}
+	else
+	{
+		p_flash_record->p_header	= (const fds_header_t*) p_rec;
+		p_flash_record->p_data		= &p_rec[FDS_MOCK_HDR_WORDS];
+		p_desc->record_is_open		= true;
+		gu16_fds_mock_open++;
+	}
+
+	return ret;
+}
+
+ret_code_t fds_record_close(fds_record_desc_t * p_desc)
+{
+	ret_code_t ret = NRF_SUCCESS;
+
+	if ( true == p_desc->record_is_open )
+	{
+		p_desc->record_is_open = false;
+		gu16_fds_mock_open--;
+	}
+	else
+	{
+		ret = FDS_ERR_NO_OPEN_RECORDS;
+	}
+
+	return ret;
+}
+
+ret_code_t fds_record_id_from_desc(fds_record_desc_t const * p_desc, uint32_t * p_record_id)
+{
+	*p_record_id = p_desc->record_id;
+
+	return NRF_SUCCESS;
+}
+
+ret_code_t fds_gc(void)
+{
+	ret_code_t	ret		= NRF_SUCCESS;
+	fds_evt_t	evt		= { .id = FDS_EVT_GC, .result = NRF_SUCCESS };
+
+	if ( false == gb_fds_mock_init )
+	{
+		ret = FDS_ERR_NOT_INITIALIZED;
+	}
+	else
+	{
+		for ( uint32_t page = 0; page < FDS_MOCK_PAGES; page++ )
+		{
+			if 	(	( eFDS_MOCK_PAGE_DATA == fds_mock_page_type( page ))
+				&&	( fds_mock_page_freeable( page ) > 0 ))
+			{
+				uint32_t swap = 0;
+
+				for ( uint32_t s = 0; s < FDS_MOCK_PAGES; s++ )
+				{
+					if ( eFDS_MOCK_PAGE_SWAP == fds_mock_page_type( s ))
+					{
+						swap = s;
+					}
+				}
+
+				fds_mock_gc_page( page, swap );
+			}
+		}
+
+		gu16_fds_mock_gc_runs++;
+		fds_mock_evt( &evt );
+	}
+
+	return ret;
+}
+
+ret_code_t fds_stat(fds_stat_t * p_stat)
+{
+	memset( p_stat, 0, sizeof( fds_stat_t ));
+
+	for ( uint32_t page = 0; page < FDS_MOCK_PAGES; page++ )
+	{
+		if ( eFDS_MOCK_PAGE_DATA == fds_mock_page_type( page ))
+		{
+			uint32_t		offset	= FDS_MOCK_TAG_WORDS;
+			uint32_t *		p_rec	= NULL;
+			const uint32_t	free	= FDS_MOCK_PAGE_WORDS - fds_mock_page_end( page );
+
+			while ( NULL != ( p_rec = fds_mock_rec_at( page, offset )))
+			{
+				if ( true == fds_mock_rec_valid( p_rec ))
+				{
+					p_stat->valid_records++;
+				}
+				else
+				{
+					p_stat->dirty_records++;
+				}
+
+				offset += fds_mock_rec_next( p_rec );
+			}
+
+			p_stat->pages_available++;
+			p_stat->words_used		+= (uint16_t)( offset - FDS_MOCK_TAG_WORDS );
+			p_stat->freeable_words	+= (uint16_t) fds_mock_page_freeable( page );
+
+			if ( free > p_stat->largest_contig )
+			{
+				p_stat->largest_contig = (uint16_t) free;
+			}
+		}
+	}
+
+	p_stat->open_records = gu16_fds_mock_open;
+
+	return NRF_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase whole flash
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fds_mock_erase_all(void)
+{
+	memset( fds_mock_page( 0 ), 0xFF, sizeof( gu32_fds_mock_save ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Save flash content
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fds_mock_save(void)
+{
+	memcpy( &gu32_fds_mock_save, fds_mock_page( 0 ), sizeof( gu32_fds_mock_save ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Restore saved flash content
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fds_mock_restore(void)
+{
+	memcpy( fds_mock_page( 0 ), &gu32_fds_mock_save, sizeof( gu32_fds_mock_save ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cut power before given number of flash operations, 0 disables
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fds_mock_set_cut(const uint32_t ops)
+{
+	gu32_fds_mock_cut = ops;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of flash operations done by this process
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fds_mock_get_ops(void)
+{
+	return gu32_fds_mock_ops;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of valid records with given file ID and key
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fds_mock_count(const uint16_t file_id, const uint16_t key)
+{
+	fds_record_desc_t	desc	= {0};
+	fds_find_token_t	token	= {0};
+	uint32_t			count	= 0;
+
+	while ( NRF_SUCCESS == fds_record_find( file_id, key, &desc, &token ))
+	{
+		count++;
+	}
+
+	return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Flip data bit of first valid record with given file ID and key
+*
+* @return		true if record is found
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool fds_mock_corrupt(const uint16_t file_id, const uint16_t key)
+{
+	fds_record_desc_t	desc	= {0};
+	fds_find_token_t	token	= {0};
+	bool				found	= false;
+
+	if ( NRF_SUCCESS == fds_record_find( file_id, key, &desc, &token ))
+	{
+		((uint32_t*) desc.p_record )[FDS_MOCK_HDR_WORDS] ^= 0x1UL;
+		found = true;
+	}
+
+	return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fds_mock.h
+*@brief     Flash data storage simulator
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FDS_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Flash data storage simulator
+*
+* 	Implements FDS API on top of simulated flash pages, with record
+* 	and page layout of SDK FDS. As with NVMC backend, every operation
+* 	is executed and its event raised before the API call returns.
+*
+* 	Each word program and page erase is single flash operation. Power
+* 	can be cut before any of them, in which case process exits with
+* 	FDS_MOCK_POWER_LOSS code. Flash is kept in memory shared with
+* 	forked processes, thus test boots firmware again in new process
+* 	on flash content left behind.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __FDS_MOCK_H
+#define __FDS_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fds.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of virtual pages, last one is swap page
+ */
+#define FDS_MOCK_PAGES				( 3UL )
+
+/**
+ * 	Virtual page size
+ *
+ * 	Unit: word
+ */
+#define FDS_MOCK_PAGE_WORDS			( 1024UL )
+
+/**
+ * 	Exit code of process when power is cut
+ */
+#define FDS_MOCK_POWER_LOSS			( 99 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void		fds_mock_erase_all		(void);
+void		fds_mock_save			(void);
+void		fds_mock_restore		(void);
+void		fds_mock_set_cut		(const uint32_t ops);
+uint32_t	fds_mock_get_ops		(void);
+uint32_t	fds_mock_count			(const uint16_t file_id, const uint16_t key);
+bool		fds_mock_corrupt		(const uint16_t file_id, const uint16_t key);
+
+#endif // __FDS_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,7 @@
+# NVM on top of FDS simulator with power loss
+NVM_DIR := $(ROOT)/src/middleware/nvm
+
+TESTS += nvm
+
+nvm_SRC		:= $(NVM_DIR)/test/test_nvm.c $(NVM_DIR)/test/fds_mock.c $(NVM_DIR)/nvm.c $(NVM_DIR)/nvm_cfg.c
+nvm_CFLAGS	:= -I$(NVM_DIR)/test -I$(ROOT)/test/stub/middleware/cli
@@ -0,0 +1,488 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_nvm.c
+*@brief     NVM host tests on simulated flash
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup NVM_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Every boot of firmware runs in forked process, flash content stays
+* 	in simulator between boots. Power loss tests cut power before each
+* 	flash operation of a region flush in turn and check that next boot
+* 	finds either old or new region content, never a mix of both.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "test.h"
+#include "fds_mock.h"
+#include "middleware/nvm/nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Region under test
+ */
+#define TEST_NVM_REGION				( eNVM_REGION_EEPROM_RUN_PAR )
+
+/**
+ * 	Region content seeds
+ */
+#define TEST_NVM_SEED_ERASED		( -1 )
+#define TEST_NVM_SEED_MIXED			( -2 )
+
+/**
+ * 	Boot process exit codes
+ */
+#define TEST_NVM_EXIT_OK			( 0 )
+#define TEST_NVM_EXIT_FAIL			( 1 )
+#define TEST_NVM_EXIT_OLD			( 2 )
+#define TEST_NVM_EXIT_NEW			( 3 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Time base
+ */
+static uint32_t gu32_test_ms = 0;
+
+/**
+ * 	Region contents expected by boot process
+ */
+static int32_t gi32_test_seed_old = 0;
+static int32_t gi32_test_seed_new = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Time base stand-in, time passes with every call
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return gu32_test_ms++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Debug port stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+cli_status_t cli_printf(char * p_format, ...)
+{
+	return eCLI_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of valid region records
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_nvm_count(void)
+{
+	const nvm_cfg_t * const p_cfg = nvm_cfg_get_table();
+
+	return fds_mock_count( p_cfg[TEST_NVM_REGION].file_id, p_cfg[TEST_NVM_REGION].rec_key );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write region content made from seed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static nvm_status_t test_nvm_write(const int32_t seed)
+{
+	uint8_t data[NVM_CFG_REGION_SIZE_MAX] = {0};
+
+	for ( uint32_t i = 0; i < sizeof( data ); i++ )
+	{
+		data[i] = (uint8_t)( seed + ( i * 7UL ));
+	}
+
+	return nvm_write( TEST_NVM_REGION, 0, sizeof( data ), (const uint8_t*) &data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get seed of region content
+*
+* @return		seed, TEST_NVM_SEED_ERASED or TEST_NVM_SEED_MIXED
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t test_nvm_seed(void)
+{
+	uint8_t data[NVM_CFG_REGION_SIZE_MAX]	= {0};
+	bool	erased							= true;
+	bool	match							= true;
+
+	TEST_ASSERT_EQ( nvm_read( TEST_NVM_REGION, 0, sizeof( data ), (uint8_t*) &data ), eNVM_OK );
+
+	for ( uint32_t i = 0; i < sizeof( data ); i++ )
+	{
+		erased &= ( 0xFF == data[i] );
+		match &= ( (uint8_t)( data[0] + ( i * 7UL )) == data[i] );
+	}
+
+	return ( true == erased ) ? TEST_NVM_SEED_ERASED : (( true == match ) ? data[0] : TEST_NVM_SEED_MIXED );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot firmware in new process
+*
+* @param[in]	p_boot	- Firmware run, returns exit code
+* @param[in]	cut		- Cut power before this flash operation, 0 for none
+* @return		exit code, TEST_NVM_EXIT_FAIL if any check failed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot(int (*p_boot)(void), const uint32_t cut)
+{
+	const uint32_t	fails	= test_fail_count();
+	const uint32_t	asserts	= test_assert_hits();
+	pid_t			pid		= 0;
+	int				status	= 0;
+
+	// Buffered output is not inherited
+	fflush( stdout );
+	pid = fork();
+
+	if ( 0 == pid )
+	{
+		int code = 0;
+
+		fds_mock_set_cut( cut );
+		code = p_boot();
+
+		if 	(	( fails != test_fail_count())
+			||	( asserts != test_assert_hits()))
+		{
+			code = TEST_NVM_EXIT_FAIL;
+		}
+
+		fflush( stdout );
+		_exit( code );
+	}
+
+	(void) waitpid( pid, &status, 0 );
+
+	return ( WIFEXITED( status )) ? WEXITSTATUS( status ) : TEST_NVM_EXIT_FAIL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot: write and sync region on blank flash
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot_blank(void)
+{
+	nvm_stats_t stats = {0};
+
+	TEST_ASSERT_EQ( nvm_init(), eNVM_OK );
+	TEST_ASSERT_EQ( test_nvm_seed(), TEST_NVM_SEED_ERASED );
+
+	// FDS events are raised before write call returns
+	TEST_ASSERT_EQ( test_nvm_write( 1 ), eNVM_OK );
+	TEST_ASSERT_EQ( nvm_sync( TEST_NVM_REGION ), eNVM_OK );
+	TEST_ASSERT_EQ( nvm_sync( TEST_NVM_REGION ), eNVM_OK );
+
+	TEST_ASSERT_EQ( test_nvm_write( 2 ), eNVM_OK );
+	TEST_ASSERT_EQ( nvm_sync( TEST_NVM_REGION ), eNVM_OK );
+	TEST_ASSERT_EQ( test_nvm_count(), 1 );
+
+	TEST_ASSERT_EQ( nvm_get_stats( &stats ), eNVM_OK );
+	TEST_ASSERT_EQ( stats.writes, 2 );
+	TEST_ASSERT_EQ( stats.errors, 0 );
+
+	return TEST_NVM_EXIT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot: burst of writes is flushed once after debounce time
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot_debounce(void)
+{
+	nvm_stats_t stats = {0};
+
+	TEST_ASSERT_EQ( nvm_init(), eNVM_OK );
+	TEST_ASSERT_EQ( test_nvm_seed(), 2 );
+
+	gu32_test_ms = 1000;
+
+	for ( int32_t seed = 3; seed <= 6; seed++ )
+	{
+		TEST_ASSERT_EQ( test_nvm_write( seed ), eNVM_OK );
+		nvm_hndl();
+	}
+
+	gu32_test_ms += ( NVM_CFG_DEBOUNCE_MS / 2 );
+	nvm_hndl();
+
+	TEST_ASSERT_EQ( nvm_get_stats( &stats ), eNVM_OK );
+	TEST_ASSERT_EQ( stats.writes, 0 );
+	TEST_ASSERT_EQ( stats.coalesced, 3 );
+
+	gu32_test_ms += NVM_CFG_DEBOUNCE_MS;
+	nvm_hndl();
+	nvm_hndl();
+
+	TEST_ASSERT_EQ( nvm_get_stats( &stats ), eNVM_OK );
+	TEST_ASSERT_EQ( stats.writes, 1 );
+	TEST_ASSERT_EQ( stats.errors, 0 );
+	TEST_ASSERT_EQ( test_nvm_count(), 1 );
+
+	return TEST_NVM_EXIT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot: check region holds old or new content, stale copies
+*		are removed and region can be written again
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot_check(void)
+{
+	int		code	= TEST_NVM_EXIT_FAIL;
+	int32_t	seed	= 0;
+
+	TEST_ASSERT_EQ( nvm_init(), eNVM_OK );
+
+	seed = test_nvm_seed();
+	TEST_ASSERT(( gi32_test_seed_old == seed ) || ( gi32_test_seed_new == seed ));
+	TEST_ASSERT_EQ( test_nvm_count(), 1 );
+
+	if ( gi32_test_seed_old == seed )
+	{
+		code = TEST_NVM_EXIT_OLD;
+	}
+	else if ( gi32_test_seed_new == seed )
+	{
+		code = TEST_NVM_EXIT_NEW;
+	}
+
+	TEST_ASSERT_EQ( test_nvm_write( 100 ), eNVM_OK );
+	TEST_ASSERT_EQ( nvm_sync( TEST_NVM_REGION ), eNVM_OK );
+	TEST_ASSERT_EQ( test_nvm_count(), 1 );
+
+	return code;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot: write new content
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot_update(void)
+{
+	TEST_ASSERT_EQ( nvm_init(), eNVM_OK );
+	TEST_ASSERT_EQ( test_nvm_write( gi32_test_seed_new ), eNVM_OK );
+	TEST_ASSERT_EQ( nvm_sync( TEST_NVM_REGION ), eNVM_OK );
+
+	return TEST_NVM_EXIT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot: fill flash with deleted copies
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot_fill(void)
+{
+	nvm_stats_t stats = {0};
+
+	TEST_ASSERT_EQ( nvm_init(), eNVM_OK );
+
+	for ( int32_t seed = 10; seed <= gi32_test_seed_old; seed++ )
+	{
+		TEST_ASSERT_EQ( test_nvm_write( seed ), eNVM_OK );
+		TEST_ASSERT_EQ( nvm_sync( TEST_NVM_REGION ), eNVM_OK );
+	}
+
+	TEST_ASSERT_EQ( nvm_get_stats( &stats ), eNVM_OK );
+	TEST_ASSERT_EQ( stats.errors, 0 );
+
+	return (int) stats.gc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Boot: check corrupted record is dropped
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int test_nvm_boot_corrupted(void)
+{
+	TEST_ASSERT_EQ( nvm_init(), eNVM_OK );
+	TEST_ASSERT_EQ( test_nvm_seed(), TEST_NVM_SEED_ERASED );
+	TEST_ASSERT_EQ( test_nvm_count(), 0 );
+
+	return TEST_NVM_EXIT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cut power before every flash operation of update
+*
+* @note		Flash content at call is restored before every cut.
+*
+* @param[in]	seed_old	- Seed of stored content
+* @param[in]	seed_new	- Seed of content being written
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_nvm_power_loss(const int32_t seed_old, const int32_t seed_new)
+{
+	uint32_t	cuts	= 0;
+	uint32_t	old		= 0;
+	uint32_t	new		= 0;
+	uint32_t	bad		= 0;
+	int			code	= FDS_MOCK_POWER_LOSS;
+
+	gi32_test_seed_old = seed_old;
+	gi32_test_seed_new = seed_new;
+
+	fds_mock_save();
+
+	for ( uint32_t cut = 1; FDS_MOCK_POWER_LOSS == code; cut++ )
+	{
+		fds_mock_restore();
+		code = test_nvm_boot( test_nvm_boot_update, cut );
+
+		if ( FDS_MOCK_POWER_LOSS == code )
+		{
+			cuts++;
+
+			switch ( test_nvm_boot( test_nvm_boot_check, 0 ))
+			{
+				case TEST_NVM_EXIT_OLD:	old++;	break;
+				case TEST_NVM_EXIT_NEW:	new++;	break;
+				default:				bad++;	break;
+			}
+		}
+	}
+
+	TEST_ASSERT_EQ( code, TEST_NVM_EXIT_OK );
+	TEST_ASSERT_EQ( bad, 0 );
+	TEST_ASSERT( old > 0 );
+	TEST_ASSERT( new > 0 );
+	TEST_ASSERT_EQ( old + new, cuts );
+
+	printf( "  power cut at %u steps: %u old, %u new\n", (unsigned) cuts, (unsigned) old, (unsigned) new );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Region write, sync and debounce
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_write(void)
+{
+	fds_mock_erase_all();
+
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_blank, 0 ), TEST_NVM_EXIT_OK );
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_debounce, 0 ), TEST_NVM_EXIT_OK );
+
+	gi32_test_seed_old = 6;
+	gi32_test_seed_new = 6;
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_check, 0 ), TEST_NVM_EXIT_OLD );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Power loss during record update
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_update_power_loss(void)
+{
+	fds_mock_erase_all();
+
+	gi32_test_seed_new = 40;
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_update, 0 ), TEST_NVM_EXIT_OK );
+
+	test_nvm_power_loss( 40, 41 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Garbage collection and power loss during it
+*
+* @note		Two data pages take six records, thus flash is full after
+* 			six writes and next boot starts garbage collection.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_gc(void)
+{
+	fds_mock_erase_all();
+
+	// Flush runs out of space and collects garbage
+	gi32_test_seed_old = 29;
+	TEST_ASSERT( test_nvm_boot( test_nvm_boot_fill, 0 ) > 0 );
+
+	gi32_test_seed_new = 29;
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_check, 0 ), TEST_NVM_EXIT_OLD );
+
+	// Garbage collection at boot
+	fds_mock_erase_all();
+
+	gi32_test_seed_old = 15;
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_fill, 0 ), 0 );
+
+	test_nvm_power_loss( 15, 16 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Corrupted record
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_corrupted(void)
+{
+	const nvm_cfg_t * const p_cfg = nvm_cfg_get_table();
+
+	fds_mock_erase_all();
+
+	gi32_test_seed_new = 50;
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_update, 0 ), TEST_NVM_EXIT_OK );
+	TEST_ASSERT( fds_mock_corrupt( p_cfg[TEST_NVM_REGION].file_id, p_cfg[TEST_NVM_REGION].rec_key ));
+	TEST_ASSERT_EQ( test_nvm_boot( test_nvm_boot_corrupted, 0 ), TEST_NVM_EXIT_OK );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_write();
+	test_update_power_loss();
+	test_gc();
+	test_corrupted();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,370 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_batch.c
+*@brief     Batched device parameter access
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_BATCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Set or get several parameters under single lock. Values are written
+* 	only when they differ from current, each write is stamped with change
+* 	sequence number so that any number of consumers can poll for changes
+* 	since their last poll.
+*
+* 	Items are validated once per batch, before anything is written, and
+* 	value sizes come from table built once at init, thus per item cost
+* 	is one "par_get()" plus "par_set()" for changed values only.
+*
+* @note	Only changes made through "par_set_batch()" and "par_set_tracked()"
+* 		are tracked! Application shall not call "par_set()" directly.
+* 		Writes from parameter core itself (CLI commands, restore to
+* 		default) are not seen.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "par_batch.h"
+#include "par_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_par_batch_is_init = false;
+
+/**
+ * 	Parameter value size
+ *
+ * 	Unit: byte
+ */
+static uint8_t gu8_par_batch_size[ePAR_NUM_OF] = {0};
+
+/**
+ * 	Change sequence counter
+ *
+ * @note	Incremented on each parameter change. Zero is reserved for
+ * 			"never changed".
+ */
+static uint32_t gu32_par_seq = 0;
+
+/**
+ * 	Change sequence of last parameter change
+ */
+static uint32_t gu32_par_seq_of[ePAR_NUM_OF] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool		par_batch_check		(const par_batch_item_t * const p_items, const uint32_t num_of);
+static void		par_batch_lock		(void);
+static void		par_batch_unlock	(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check batch items
+*
+* @param[in]	p_items	- Pointer to items
+* @param[in]	num_of	- Number of items
+* @return		valid	- True if all items are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool par_batch_check(const par_batch_item_t * const p_items, const uint32_t num_of)
+{
+	bool valid = true;
+
+	for ( uint32_t i = 0; i < num_of; i++ )
+	{
+		if 	(	( p_items[i].par_num >= ePAR_NUM_OF )
+			||	( NULL == p_items[i].p_val ))
+		{
+			valid = false;
+			break;
+		}
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lock parameters for whole batch
+*
+* @note		Mutex must be recursive as "par_set()" and "par_get()" take
+* 			it again when PAR_CFG_MUTEX_EN is enabled.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_batch_lock(void)
+{
+	#if ( 1 == PAR_CFG_MUTEX_EN )
+		(void) par_if_aquire_mutex();
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Unlock parameters after batch
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_batch_unlock(void)
+{
+	#if ( 1 == PAR_CFG_MUTEX_EN )
+		(void) par_if_release_mutex();
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_BATCH_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of batched parameter access API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize batched parameter access
+*
+* @note		Resolves value size of each parameter from configuration
+* 			table, thus type dispatch is not repeated on each access.
+*
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_batch_init(void)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+
+	for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		switch ( p_table[par_num].type )
+		{
+			case ePAR_TYPE_U8:
+			case ePAR_TYPE_I8:
+				gu8_par_batch_size[par_num] = 1U;
+				break;
+
+			case ePAR_TYPE_U16:
+			case ePAR_TYPE_I16:
+				gu8_par_batch_size[par_num] = 2U;
+				break;
+
+			case ePAR_TYPE_U32:
+			case ePAR_TYPE_I32:
+			case ePAR_TYPE_F32:
+			default:
+				gu8_par_batch_size[par_num] = 4U;
+				break;
+		}
+	}
+
+	gb_par_batch_is_init = true;
+
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set multiple parameters
+*
+* @note		Batch is rejected as whole when any item is invalid, nothing
+* 			is written then.
+*
+* @note		Parameters whose value did not change are skipped, thus range
+* 			check and type dispatch of "par_set()" is paid only for changes.
+*
+* @param[in]	p_items	- Pointer to items
+* @param[in]	num_of	- Number of items
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_set_batch(const par_batch_item_t * const p_items, const uint32_t num_of)
+{
+	par_status_t status = ePAR_OK;
+
+	PAR_ASSERT( true == gb_par_batch_is_init );
+	PAR_ASSERT( NULL != p_items );
+
+	if 	(	( true == gb_par_batch_is_init )
+		&&	( NULL != p_items )
+		&&	( true == par_batch_check( p_items, num_of )))
+	{
+		par_batch_lock();
+
+		for ( uint32_t i = 0; i < num_of; i++ )
+		{
+			const par_num_t par_num = p_items[i].par_num;
+			uint32_t 		cur_val = 0;
+			uint32_t 		new_val = 0;
+
+			memcpy( &new_val, p_items[i].p_val, gu8_par_batch_size[par_num] );
+
+			if ( ePAR_OK == par_get( par_num, &cur_val ))
+			{
+				if ( cur_val != new_val )
+				{
+					status |= par_set( par_num, p_items[i].p_val );
+
+					// Stamp change
+					gu32_par_seq++;
+
+					if ( 0UL == gu32_par_seq )
+					{
+						gu32_par_seq = 1UL;
+					}
+
+					gu32_par_seq_of[par_num] = gu32_par_seq;
+				}
+			}
+			else
+			{
+				status = ePAR_ERROR;
+			}
+		}
+
+		par_batch_unlock();
+	}
+	else
+	{
+		status = ePAR_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set single parameter with change tracking
+*
+* @param[in]	par_num	- Parameter
+* @param[in]	p_val	- Pointer to value, type must match parameter type
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_set_tracked(const par_num_t par_num, const void * const p_val)
+{
+	const par_batch_item_t item = { .par_num = par_num, .p_val = (void*) p_val };
+
+	return par_set_batch( &item, 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get multiple parameters
+*
+* @note		All values are taken under single lock, thus snapshot is
+* 			consistent. Batch is rejected as whole when any item is invalid.
+*
+* @param[in]	p_items	- Pointer to items
+* @param[in]	num_of	- Number of items
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_get_batch(const par_batch_item_t * const p_items, const uint32_t num_of)
+{
+	par_status_t status = ePAR_OK;
+
+	PAR_ASSERT( NULL != p_items );
+
+	if 	(	( NULL != p_items )
+		&&	( true == par_batch_check( p_items, num_of )))
+	{
+		par_batch_lock();
+
+		for ( uint32_t i = 0; i < num_of; i++ )
+		{
+			status |= par_get( p_items[i].par_num, p_items[i].p_val );
+		}
+
+		par_batch_unlock();
+	}
+	else
+	{
+		status = ePAR_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameters changed since last poll
+*
+* @note		Each consumer keeps its own "par_batch_changes_t" object.
+* 			Initialize it to zero, first poll then reports all parameters
+* 			ever changed.
+*
+* @param[in,out]	p_changes	- Pointer to consumer change object
+* @return			status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_get_changes(par_batch_changes_t * const p_changes)
+{
+	par_status_t status = ePAR_OK;
+
+	PAR_ASSERT( NULL != p_changes );
+
+	if ( NULL != p_changes )
+	{
+		par_batch_lock();
+
+		const uint32_t last_seq = p_changes->seq;
+
+		memset( p_changes->mask, 0, sizeof( p_changes->mask ));
+
+		for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+		{
+			// Wrap safe "changed after last poll"
+			if  (   ( 0UL != gu32_par_seq_of[par_num] )
+				&&  ((int32_t)( gu32_par_seq_of[par_num] - last_seq ) > 0 ))
+			{
+				p_changes->mask[ par_num / 32UL ] |= ( 1UL << ( par_num % 32UL ));
+			}
+		}
+
+		p_changes->seq = gu32_par_seq;
+
+		par_batch_unlock();
+	}
+	else
+	{
+		status = ePAR_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
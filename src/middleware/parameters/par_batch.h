@@ -0,0 +1,80 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_batch.h
+*@brief     Batched device parameter access
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_BATCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Batched device parameter access
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _PAR_BATCH_H_
+#define _PAR_BATCH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "parameters/src/par.h"
+#include "par_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of parameter change mask
+ *
+ * 	Unit: word
+ */
+#define PAR_BATCH_MASK_SIZE					(( ePAR_NUM_OF + 31UL ) / 32UL )
+
+/**
+ * 	Batch item
+ *
+ * @note	Value type must match parameter type from configuration table!
+ */
+typedef struct
+{
+	par_num_t	par_num;	/**<Parameter */
+	void *		p_val;		/**<Pointer to value: source for set, destination for get */
+} par_batch_item_t;
+
+/**
+ * 	Parameter change mask
+ *
+ * @note	Bit ( par_num % 32 ) of word ( par_num / 32 ) is set
+ * 			when parameter changed.
+ */
+typedef struct
+{
+	uint32_t	mask[PAR_BATCH_MASK_SIZE];	/**<Changed parameters */
+	uint32_t	seq;						/**<Change sequence at time of poll */
+} par_batch_changes_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_batch_init			(void);
+par_status_t par_set_batch			(const par_batch_item_t * const p_items, const uint32_t num_of);
+par_status_t par_set_tracked		(const par_num_t par_num, const void * const p_val);
+par_status_t par_get_batch			(const par_batch_item_t * const p_items, const uint32_t num_of);
+par_status_t par_get_changes		(par_batch_changes_t * const p_changes);
+
+#endif // _PAR_BATCH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,14 @@
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * 	Configuration table entry
+ *
+ * @note	Places entry at "ePAR_<name>" and takes its ID from
+ * 			PAR_CFG_ID_LIST, thus entry can not get ID of other parameter.
+ */
+#define PAR_CFG_ENTRY( name, ... )				[ePAR_##name] = { .id = ePAR_ID_##name, __VA_ARGS__ }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
@@ -42,7 +50,7 @@
  *
  *	Each defined parameter has following properties:
  *
- *		i) 		Parameter ID: 	Unique parameter identification number. ID shall not be duplicated.
+ *		i) 		Parameter ID: 	Unique parameter identification number, taken from PAR_CFG_ID_LIST by PAR_CFG_ENTRY().
  *		ii) 	Name:			Parameter name. Max. length of 32 chars.
  *		iii)	Min:			Parameter minimum value. Min value must be less than max value.
  *		iv)		Max:			Parameter maximum value. Max value must be more than min value.
@@ -65,20 +73,45 @@ static const par_cfg_t g_par_table[ePAR_NUM_OF] =
 	// USER CODE BEGIN...
 
 	// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-	//							ID			Name						Min 				Max 					Def 					Unit				Data type				PC Access					Persistent				Description
+	//				Parameter				Name						Min 				Max 					Def 					Unit				Data type				PC Access					Persistent				Description
 	// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-	[ePAR_BTN_1]		= 	{	.id = 0, 	.name = "User button 1",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 1. 0-idle | 1-pressed"		},
-	[ePAR_BTN_2]		= 	{	.id = 1, 	.name = "User button 2",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 2. 0-idle | 1-pressed"		},
-	[ePAR_BTN_3]		= 	{	.id = 2, 	.name = "User button 3",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 3. 0-idle | 1-pressed"		},
-	[ePAR_BTN_4]		= 	{	.id = 3, 	.name = "User button 4",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 4. 0-idle | 1-pressed"		},
-
-	[ePAR_AIN_1]		= 	{	.id = 10, 	.name = "AIN1 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.03 on nRF52840 DK "	},
-	[ePAR_AIN_2]		= 	{	.id = 11, 	.name = "AIN2 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.04 on nRF52840 DK "	},
-	[ePAR_AIN_4]		= 	{	.id = 12, 	.name = "AIN4 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.28 on nRF52840 DK "	},
-	[ePAR_AIN_5]		= 	{	.id = 13, 	.name = "AIN5 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.29 on nRF52840 DK "	},
-	[ePAR_AIN_6]		= 	{	.id = 14, 	.name = "AIN6 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.30 on nRF52840 DK "	},
-	[ePAR_AIN_7]		= 	{	.id = 15, 	.name = "AIN7 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.31 on nRF52840 DK "	},
+	PAR_CFG_ENTRY( BTN_1,                 .name = "User button 1",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 1. 0-idle | 1-pressed" ),
+	PAR_CFG_ENTRY( BTN_2,                 .name = "User button 2",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 2. 0-idle | 1-pressed" ),
+	PAR_CFG_ENTRY( BTN_3,                 .name = "User button 3",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 3. 0-idle | 1-pressed" ),
+	PAR_CFG_ENTRY( BTN_4,                 .name = "User button 4",	.min.u8 = 0 ,		.max.u8 = 1,			.def.u8 = 0	,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "State of user button 4. 0-idle | 1-pressed" ),
+
+	PAR_CFG_ENTRY( AIN_1,                 .name = "AIN1 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.03 on nRF52840 DK " ),
+	PAR_CFG_ENTRY( AIN_2,                 .name = "AIN2 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.04 on nRF52840 DK " ),
+	PAR_CFG_ENTRY( AIN_4,                 .name = "AIN4 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.28 on nRF52840 DK " ),
+	PAR_CFG_ENTRY( AIN_5,                 .name = "AIN5 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.29 on nRF52840 DK " ),
+	PAR_CFG_ENTRY( AIN_6,                 .name = "AIN6 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.30 on nRF52840 DK " ),
+	PAR_CFG_ENTRY( AIN_7,                 .name = "AIN7 raw value",	.min.u16 = 0 ,		.max.u16 = UINT16_MAX,	.def.u16 = 0,			.unit = NULL,		.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw analog value from pin P0.31 on nRF52840 DK " ),
+
+	PAR_CFG_ENTRY( USB_RX_RATE,           .name = "USB Rx rate",		.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "byte/s",	.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "USB CDC reception throughput" ),
+	PAR_CFG_ENTRY( USB_RX_OVERRUN,        .name = "USB Rx overruns",	.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of USB CDC reception buffer overruns" ),
+	PAR_CFG_ENTRY( UART1_RX_OVERRUN,      .name = "UART1 Rx lost",	.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "byte",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of UART1 received bytes lost on full buffer" ),
+
+	PAR_CFG_ENTRY( SCHED_CPU_LOAD,        .name = "CPU load",         .min.u8 = 0 ,		.max.u8 = 100,	.def.u8 = 0,			.unit = "%",		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Share of time spent inside scheduler tasks" ),
+	PAR_CFG_ENTRY( SCHED_CPU_IDLE,        .name = "CPU idle",         .min.u8 = 0 ,		.max.u8 = 100,	.def.u8 = 0,			.unit = "%",		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Share of time CPU is idle" ),
+	PAR_CFG_ENTRY( SCHED_COMM_EXEC_AVG,   .name = "Comm exec avg",    .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Average execution time of communication task" ),
+	PAR_CFG_ENTRY( SCHED_COMM_EXEC_MAX,   .name = "Comm exec max",    .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Maximum execution time of communication task" ),
+	PAR_CFG_ENTRY( SCHED_COMM_MISS,       .name = "Comm deadline miss",.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of deadline misses of communication task" ),
+	PAR_CFG_ENTRY( SCHED_10MS_EXEC_AVG,   .name = "10ms exec avg",    .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Average execution time of application 10ms task" ),
+	PAR_CFG_ENTRY( SCHED_10MS_EXEC_MAX,   .name = "10ms exec max",    .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Maximum execution time of application 10ms task" ),
+	PAR_CFG_ENTRY( SCHED_10MS_MISS,       .name = "10ms deadline miss",.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of deadline misses of application 10ms task" ),
+	PAR_CFG_ENTRY( SCHED_100MS_EXEC_AVG,  .name = "100ms exec avg",   .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Average execution time of application 100ms task" ),
+	PAR_CFG_ENTRY( SCHED_100MS_EXEC_MAX,  .name = "100ms exec max",   .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Maximum execution time of application 100ms task" ),
+	PAR_CFG_ENTRY( SCHED_100MS_MISS,      .name = "100ms deadline miss",.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of deadline misses of application 100ms task" ),
+	PAR_CFG_ENTRY( SCHED_1000MS_EXEC_AVG, .name = "1000ms exec avg",  .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Average execution time of application 1000ms task" ),
+	PAR_CFG_ENTRY( SCHED_1000MS_EXEC_MAX, .name = "1000ms exec max",  .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = "us",		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Maximum execution time of application 1000ms task" ),
+	PAR_CFG_ENTRY( SCHED_1000MS_MISS,     .name = "1000ms deadline miss",.min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of deadline misses of application 1000ms task" ),
+
+	PAR_CFG_ENTRY( RST_REASON,            .name = "Reset reason",     .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Raw POWER RESETREAS latched at boot. 0-power on" ),
+	PAR_CFG_ENTRY( RST_FAULT,             .name = "Reset fault",      .min.u8 = 0 ,		.max.u8 = 3,	.def.u8 = 0,			.unit = NULL,		.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Fault of previous run. 0-none | 1-assert | 2-app error | 3-hard fault" ),
+	PAR_CFG_ENTRY( RST_PC,                .name = "Reset fault PC",   .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Program counter of fault of previous run" ),
+	PAR_CFG_ENTRY( RST_LINE,              .name = "Reset fault line", .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Source line of fault of previous run" ),
+	PAR_CFG_ENTRY( RST_BOOT_CNT,          .name = "Boot count",       .min.u32 = 0 ,		.max.u32 = UINT32_MAX,	.def.u32 = 0,			.unit = NULL,		.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RO, 	.persistant = false,	.desc = "Number of boots since last power loss" ),
 
 
 	// ---------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -92,6 +125,13 @@ static const par_cfg_t g_par_table[ePAR_NUM_OF] =
  */
 static const uint32_t gu32_par_table_size = sizeof( g_par_table );
 
+/**
+ * 	Each parameter must have exactly one ID
+ */
+#define PAR_CFG_ID_COUNT( name, id_val )		+ 1
+_Static_assert(( 0 PAR_CFG_ID_LIST( PAR_CFG_ID_COUNT )) == ePAR_NUM_OF, "Parameter ID list does not match parameter list!" );
+#undef PAR_CFG_ID_COUNT
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -120,6 +160,37 @@ uint32_t par_cfg_get_table_size(void)
 	return gu32_par_table_size;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameter number by its external ID
+*
+* @note		Switch is generated from PAR_CFG_ID_LIST thus duplicated ID
+* 			is reported by compiler as duplicate case value. Compiler
+* 			resolves sparse IDs with jump table or binary search instead
+* 			of linear scan through configuration table.
+*
+* @param[in]	id			- Parameter ID
+* @return		par_num		- Parameter number, ePAR_NUM_OF if ID is unknown
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_num_t par_cfg_get_num_by_id(const uint16_t id)
+{
+	par_num_t par_num = ePAR_NUM_OF;
+
+	switch ( id )
+	{
+		#define PAR_CFG_ID_CASE( name, id_val )		case ( id_val ): par_num = ePAR_##name; break;
+		PAR_CFG_ID_LIST( PAR_CFG_ID_CASE )
+		#undef PAR_CFG_ID_CASE
+
+		default:
+			// Unknown ID...
+			break;
+	}
+
+	return par_num;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
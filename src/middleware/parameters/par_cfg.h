@@ -33,7 +33,7 @@
 #include "middleware/cli/cli/src/cli.h"
 
 // NVM
-//#include "middleware/nvm/nvm_cfg.h"
+#include "middleware/nvm/nvm_cfg.h"
 
 // USER CODE END...
 
@@ -69,11 +69,98 @@ typedef enum
 	ePAR_AIN_6,
 	ePAR_AIN_7,
 
+	ePAR_USB_RX_RATE,
+	ePAR_USB_RX_OVERRUN,
+	ePAR_UART1_RX_OVERRUN,
+
+	ePAR_SCHED_CPU_LOAD,
+	ePAR_SCHED_CPU_IDLE,
+
+	ePAR_SCHED_COMM_EXEC_AVG,
+	ePAR_SCHED_COMM_EXEC_MAX,
+	ePAR_SCHED_COMM_MISS,
+	ePAR_SCHED_10MS_EXEC_AVG,
+	ePAR_SCHED_10MS_EXEC_MAX,
+	ePAR_SCHED_10MS_MISS,
+	ePAR_SCHED_100MS_EXEC_AVG,
+	ePAR_SCHED_100MS_EXEC_MAX,
+	ePAR_SCHED_100MS_MISS,
+	ePAR_SCHED_1000MS_EXEC_AVG,
+	ePAR_SCHED_1000MS_EXEC_MAX,
+	ePAR_SCHED_1000MS_MISS,
+
+	ePAR_RST_REASON,
+	ePAR_RST_FAULT,
+	ePAR_RST_PC,
+	ePAR_RST_LINE,
+	ePAR_RST_BOOT_CNT,
+
 	// USER CODE END...
 
 	ePAR_NUM_OF
 } par_num_t;
 
+/**
+ * 	List of device parameter IDs
+ *
+ * @note 	Parameter ID is used by external tools to address parameter.
+ * 			This list is the only place where IDs are defined, configuration
+ * 			table and ID lookup are both generated out of it.
+ *
+ * 			Format: ENTRY( parameter name without "ePAR_" prefix, ID )
+ *
+ * @note 	User shall change code only inside section of "USER_CODE_BEGIN"
+ * 			ans "USER_CODE_END".
+ */
+#define PAR_CFG_ID_LIST( ENTRY )										\
+																		\
+	/* USER CODE BEGIN... */											\
+																		\
+	ENTRY( BTN_1,                  0    )	\
+	ENTRY( BTN_2,                  1    )	\
+	ENTRY( BTN_3,                  2    )	\
+	ENTRY( BTN_4,                  3    )	\
+	ENTRY( AIN_1,                  10   )	\
+	ENTRY( AIN_2,                  11   )	\
+	ENTRY( AIN_4,                  12   )	\
+	ENTRY( AIN_5,                  13   )	\
+	ENTRY( AIN_6,                  14   )	\
+	ENTRY( AIN_7,                  15   )	\
+	ENTRY( USB_RX_RATE,            20   )	\
+	ENTRY( USB_RX_OVERRUN,         21   )	\
+	ENTRY( UART1_RX_OVERRUN,       22   )	\
+	ENTRY( SCHED_CPU_LOAD,         30   )	\
+	ENTRY( SCHED_CPU_IDLE,         31   )	\
+	ENTRY( SCHED_COMM_EXEC_AVG,    32   )	\
+	ENTRY( SCHED_COMM_EXEC_MAX,    33   )	\
+	ENTRY( SCHED_COMM_MISS,        34   )	\
+	ENTRY( SCHED_10MS_EXEC_AVG,    35   )	\
+	ENTRY( SCHED_10MS_EXEC_MAX,    36   )	\
+	ENTRY( SCHED_10MS_MISS,        37   )	\
+	ENTRY( SCHED_100MS_EXEC_AVG,   38   )	\
+	ENTRY( SCHED_100MS_EXEC_MAX,   39   )	\
+	ENTRY( SCHED_100MS_MISS,       40   )	\
+	ENTRY( SCHED_1000MS_EXEC_AVG,  41   )	\
+	ENTRY( SCHED_1000MS_EXEC_MAX,  42   )	\
+	ENTRY( SCHED_1000MS_MISS,      43   )	\
+	ENTRY( RST_REASON,             50   )	\
+	ENTRY( RST_FAULT,              51   )	\
+	ENTRY( RST_PC,                 52   )	\
+	ENTRY( RST_LINE,               53   )	\
+	ENTRY( RST_BOOT_CNT,           54   )	\
+																		\
+	/* USER CODE END... */
+
+/**
+ * 	Parameter IDs
+ */
+typedef enum
+{
+	#define PAR_CFG_ID_ENUM( name, id_val )		ePAR_ID_##name = ( id_val ),
+	PAR_CFG_ID_LIST( PAR_CFG_ID_ENUM )
+	#undef PAR_CFG_ID_ENUM
+} par_id_t;
+
 
 // USER CODE BEGIN...
 
@@ -85,7 +172,7 @@ typedef enum
 /**
  * 	Enable/Disable storing persistent parameters to NVM
  */
-#define PAR_CFG_NVM_EN							( 0 )
+#define PAR_CFG_NVM_EN							( 1 )
 
 #if ( 1 == PAR_CFG_NVM_EN )
 	/**
@@ -178,5 +265,6 @@ typedef enum
 ////////////////////////////////////////////////////////////////////////////////
 const void * 	par_cfg_get_table		(void);
 uint32_t	 	par_cfg_get_table_size	(void);
+par_num_t		par_cfg_get_num_by_id	(const uint16_t id);
 
 #endif // _PAR_CFG_H_
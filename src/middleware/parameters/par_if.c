@@ -28,6 +28,11 @@
 
 // USER INCLUDES BEGIN...
 
+#include "sha256.h"
+
+#if ( 1 == PAR_CFG_NVM_EN )
+	#include "middleware/nvm/nvm.h"
+#endif
 
 // USER INCLUDES END...
 
@@ -68,7 +73,20 @@ par_status_t par_if_init(void)
 
 	// USER CODE BEGIN...
 
+	#if ( 1 == PAR_CFG_NVM_EN )
+		bool is_nvm_init = false;
+
+		// NVM must be ready before parameters are loaded
+		(void) nvm_is_init( &is_nvm_init );
 
+		if ( false == is_nvm_init )
+		{
+			if ( eNVM_OK != nvm_init())
+			{
+				status = ePAR_ERROR;
+			}
+		}
+	#endif
 
 	// USER CODE END...
 
@@ -152,6 +170,12 @@ void par_if_calc_hash(const uint8_t * const p_data, const uint32_t size, uint8_t
 
 	// USER CODE BEGIN...
 
+	sha256_context_t ctx;
+
+	// SHA-256, hash is 32 bytes
+	(void) sha256_init( &ctx );
+	(void) sha256_update( &ctx, p_data, size );
+	(void) sha256_final( &ctx, p_hash, 0U );
 
 	// USER CODE END...
 }
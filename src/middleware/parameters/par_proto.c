@@ -0,0 +1,965 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_proto.c
+*@brief     Binary device parameter access protocol
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_PROTO
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Binary protocol coexists with text CLI on the same port. Text never
+* 	contains SLIP END character (0xC0), thus END switches channel into
+* 	frame reception and frame closing END switches it back to text.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "par_proto.h"
+#include "par_batch.h"
+
+#include "slip.h"
+#include "crc16.h"
+#include "drivers/peripheral/systick/systick.h"
+#include "drivers/peripheral/uart/uart_dbg.h"
+#include "drivers/peripheral/usb_cdc/usb_cdc.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	SLIP frame delimiter
+ */
+#define PAR_PROTO_SLIP_END					( 0xC0U )
+
+/**
+ * 	Response command flag
+ */
+#define PAR_PROTO_RSP_FLAG					( 0x80U )
+
+/**
+ * 	Frame overhead: command, sequence and CRC
+ *
+ * 	Unit: byte
+ */
+#define PAR_PROTO_OVERHEAD					( 4U )
+
+/**
+ * 	Response header size: command, sequence and status
+ *
+ * 	Unit: byte
+ */
+#define PAR_PROTO_RSP_HEAD					( 3U )
+
+/**
+ * 	Type code of unknown parameter
+ */
+#define PAR_PROTO_TYPE_UNKNOWN				( 0xFFU )
+
+/**
+ * 	Channel reception state
+ */
+typedef enum
+{
+	ePAR_PROTO_STATE_TEXT = 0,		/**<Bytes belong to text CLI */
+	ePAR_PROTO_STATE_FRAME,			/**<Receiving binary frame */
+	ePAR_PROTO_STATE_DISCARD,		/**<Skipping invalid frame until END */
+} par_proto_state_t;
+
+/**
+ * 	Channel
+ */
+typedef struct
+{
+	slip_t				slip;							/**<SLIP decoder */
+	uint8_t				rx_buf[PAR_PROTO_RX_SIZE];		/**<Decoded frame */
+	uint32_t			last_ms;						/**<Timestamp of last received byte */
+	par_proto_state_t	state;							/**<Reception state */
+} par_proto_chan_t;
+
+/**
+ * 	Stream flags
+ */
+#define PAR_PROTO_STREAM_FLAG_EN			( 0x01U )	/**<Configuration: enable */
+#define PAR_PROTO_STREAM_FLAG_KEY			( 0x01U )	/**<Stream frame: key frame */
+#define PAR_PROTO_STREAM_FLAG_DELTA			( 0x02U )	/**<Delta encoding */
+
+/**
+ * 	Stream frame header size: command, flags, sequence and timestamp
+ *
+ * 	Unit: byte
+ */
+#define PAR_PROTO_STREAM_HEAD				( 8U )
+
+/**
+ * 	Stream
+ */
+typedef struct
+{
+	par_batch_item_t	item[PAR_PROTO_STREAM_MAX];		/**<Stream list */
+	uint32_t			val[PAR_PROTO_STREAM_MAX];		/**<Current values */
+	uint32_t			last_val[PAR_PROTO_STREAM_MAX];	/**<Last sent values */
+	uint8_t				size[PAR_PROTO_STREAM_MAX];		/**<Value sizes */
+	uint32_t			num_of;							/**<Number of parameters in list */
+	uint32_t			period_ms;						/**<Streaming period */
+	uint32_t			last_ms;						/**<Timestamp of last frame */
+	uint16_t			seq;							/**<Frame sequence number */
+	uint8_t				key_cnt;						/**<Frames since key frame */
+	bool				en;								/**<Streaming enabled */
+	bool				delta;							/**<Delta encoding enabled */
+} par_proto_stream_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Channels
+ */
+static par_proto_chan_t g_par_proto_ch[ePAR_PROTO_CH_NUM_OF] = {0};
+
+/**
+ * 	Streams
+ */
+static par_proto_stream_t g_par_proto_stream[ePAR_PROTO_CH_NUM_OF] = {0};
+
+/**
+ * 	Response frame and its SLIP encoded form
+ *
+ * @note	Encoding worst case doubles size plus both END characters.
+ */
+static uint8_t gu8_par_proto_tx[PAR_PROTO_TX_SIZE] = {0};
+static uint8_t gu8_par_proto_tx_enc[( 2U * PAR_PROTO_TX_SIZE ) + 2U] = {0};
+
+/**
+ * 	Statistics
+ */
+static par_proto_stats_t g_par_proto_stats = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void				par_proto_slip_reset	(par_proto_chan_t * const p_ch);
+static bool				par_proto_get_type		(const par_num_t par_num, uint8_t * const p_code, uint32_t * const p_size);
+static void				par_proto_process		(const par_proto_ch_t ch, const uint8_t * const p_frame, const uint32_t size);
+static par_proto_rsp_t	par_proto_cmd_ping		(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size);
+static par_proto_rsp_t	par_proto_cmd_info		(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size);
+static par_proto_rsp_t	par_proto_cmd_read		(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size);
+static par_proto_rsp_t	par_proto_cmd_write		(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size);
+static par_proto_rsp_t	par_proto_cmd_stream_cfg(const par_proto_ch_t ch, const uint8_t * const p_req, const uint32_t req_size);
+static void				par_proto_stream_send	(const par_proto_ch_t ch);
+static bool				par_proto_transmit		(const par_proto_ch_t ch, const uint8_t * const p_data, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset SLIP decoder of channel
+*
+* @param[in]	p_ch	- Pointer to channel
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_proto_slip_reset(par_proto_chan_t * const p_ch)
+{
+	p_ch->slip.state			= SLIP_STATE_DECODING;
+	p_ch->slip.p_buffer			= (uint8_t*) &p_ch->rx_buf;
+	p_ch->slip.current_index	= 0;
+	p_ch->slip.buffer_len		= PAR_PROTO_RX_SIZE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameter type code and value size
+*
+* @param[in]	par_num	- Parameter number
+* @param[out]	p_code	- Type code as defined by protocol
+* @param[out]	p_size	- Size of value. Unit: byte
+* @return		true if type is supported
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool par_proto_get_type(const par_num_t par_num, uint8_t * const p_code, uint32_t * const p_size)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+	bool 					valid 	= true;
+
+	switch ( p_table[par_num].type )
+	{
+		case ePAR_TYPE_U8:	*p_code = 0U;	*p_size = 1U;	break;
+		case ePAR_TYPE_I8:	*p_code = 1U;	*p_size = 1U;	break;
+		case ePAR_TYPE_U16:	*p_code = 2U;	*p_size = 2U;	break;
+		case ePAR_TYPE_I16:	*p_code = 3U;	*p_size = 2U;	break;
+		case ePAR_TYPE_U32:	*p_code = 4U;	*p_size = 4U;	break;
+		case ePAR_TYPE_I32:	*p_code = 5U;	*p_size = 4U;	break;
+		case ePAR_TYPE_F32:	*p_code = 6U;	*p_size = 4U;	break;
+
+		default:
+			valid = false;
+			break;
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Process received frame and send response
+*
+* @param[in]	ch		- Channel frame was received on
+* @param[in]	p_frame	- Pointer to decoded frame
+* @param[in]	size	- Size of frame
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_proto_process(const par_proto_ch_t ch, const uint8_t * const p_frame, const uint32_t size)
+{
+	if ( size < PAR_PROTO_OVERHEAD )
+	{
+		g_par_proto_stats.frame_err++;
+	}
+	else
+	{
+		const uint16_t crc_rx = (uint16_t)( p_frame[size-2U] | ( p_frame[size-1U] << 8U ));
+
+		if ( crc_rx != crc16_compute( p_frame, size - 2U, NULL ))
+		{
+			g_par_proto_stats.crc_err++;
+		}
+		else
+		{
+			const uint8_t 	cmd 		= p_frame[0];
+			const uint32_t	req_size	= size - PAR_PROTO_OVERHEAD;
+			const uint32_t	rsp_max		= PAR_PROTO_TX_SIZE - PAR_PROTO_RSP_HEAD - 2U;
+			uint32_t		rsp_size	= 0;
+			par_proto_rsp_t	rsp			= ePAR_PROTO_RSP_OK;
+			uint16_t		crc			= 0;
+
+			g_par_proto_stats.frames++;
+
+			switch ( cmd )
+			{
+				case ePAR_PROTO_CMD_PING:
+					rsp = par_proto_cmd_ping( &p_frame[2], req_size, &gu8_par_proto_tx[PAR_PROTO_RSP_HEAD], rsp_max, &rsp_size );
+					break;
+
+				case ePAR_PROTO_CMD_INFO:
+					rsp = par_proto_cmd_info( &p_frame[2], req_size, &gu8_par_proto_tx[PAR_PROTO_RSP_HEAD], rsp_max, &rsp_size );
+					break;
+
+				case ePAR_PROTO_CMD_READ:
+					rsp = par_proto_cmd_read( &p_frame[2], req_size, &gu8_par_proto_tx[PAR_PROTO_RSP_HEAD], rsp_max, &rsp_size );
+					break;
+
+				case ePAR_PROTO_CMD_WRITE:
+					rsp = par_proto_cmd_write( &p_frame[2], req_size, &gu8_par_proto_tx[PAR_PROTO_RSP_HEAD], rsp_max, &rsp_size );
+					break;
+
+				case ePAR_PROTO_CMD_STREAM_CFG:
+					rsp = par_proto_cmd_stream_cfg( ch, &p_frame[2], req_size );
+					break;
+
+				default:
+					rsp = ePAR_PROTO_RSP_UNKNOWN_CMD;
+					break;
+			}
+
+			// Assemble response
+			gu8_par_proto_tx[0] = (uint8_t)( cmd | PAR_PROTO_RSP_FLAG );
+			gu8_par_proto_tx[1] = p_frame[1];
+			gu8_par_proto_tx[2] = (uint8_t) rsp;
+
+			rsp_size += PAR_PROTO_RSP_HEAD;
+			crc = crc16_compute( gu8_par_proto_tx, rsp_size, NULL );
+
+			gu8_par_proto_tx[rsp_size++] = (uint8_t)( crc & 0xFFU );
+			gu8_par_proto_tx[rsp_size++] = (uint8_t)( crc >> 8U );
+
+			(void) par_proto_transmit( ch, gu8_par_proto_tx, rsp_size );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Ping command
+*
+* @param[in]	p_req		- Pointer to request payload
+* @param[in]	req_size	- Size of request payload
+* @param[out]	p_rsp		- Pointer to response payload
+* @param[in]	rsp_max		- Maximum size of response payload
+* @param[out]	p_rsp_size	- Size of response payload
+* @return		rsp			- Response status
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_proto_rsp_t par_proto_cmd_ping(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size)
+{
+	par_proto_rsp_t rsp = ePAR_PROTO_RSP_OK;
+
+	(void) p_req;
+	(void) rsp_max;
+
+	if ( 0U == req_size )
+	{
+		p_rsp[0] = PAR_PROTO_VERSION;
+		p_rsp[1] = (uint8_t)( ePAR_NUM_OF & 0xFFU );
+		p_rsp[2] = (uint8_t)( ePAR_NUM_OF >> 8U );
+		*p_rsp_size = 3U;
+	}
+	else
+	{
+		rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+	}
+
+	return rsp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Info command
+*
+* @param[in]	p_req		- Pointer to request payload
+* @param[in]	req_size	- Size of request payload
+* @param[out]	p_rsp		- Pointer to response payload
+* @param[in]	rsp_max		- Maximum size of response payload
+* @param[out]	p_rsp_size	- Size of response payload
+* @return		rsp			- Response status
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_proto_rsp_t par_proto_cmd_info(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+	par_proto_rsp_t 		rsp 	= ePAR_PROTO_RSP_OK;
+	uint32_t				len		= 0;
+
+	if ( 3U == req_size )
+	{
+		const uint32_t start 	= (uint32_t)( p_req[0] | ( p_req[1] << 8U ));
+		const uint32_t end 		= (( start + p_req[2] ) < ePAR_NUM_OF ) ? ( start + p_req[2] ) : ePAR_NUM_OF;
+
+		for ( uint32_t par_num = start; par_num < end; par_num++ )
+		{
+			uint8_t 	code = 0;
+			uint32_t 	size = 0;
+
+			if (( len + 4U ) > rsp_max )
+			{
+				rsp = ePAR_PROTO_RSP_OVERFLOW;
+				break;
+			}
+
+			if ( false == par_proto_get_type( par_num, &code, &size ))
+			{
+				code = PAR_PROTO_TYPE_UNKNOWN;
+			}
+
+			p_rsp[len++] = (uint8_t)( p_table[par_num].id & 0xFFU );
+			p_rsp[len++] = (uint8_t)( p_table[par_num].id >> 8U );
+			p_rsp[len++] = code;
+			p_rsp[len++] = ( ePAR_ACCESS_RO == p_table[par_num].access ) ? 0U : 1U;
+		}
+	}
+	else
+	{
+		rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+	}
+
+	*p_rsp_size = len;
+
+	return rsp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read command
+*
+* @param[in]	p_req		- Pointer to request payload
+* @param[in]	req_size	- Size of request payload
+* @param[out]	p_rsp		- Pointer to response payload
+* @param[in]	rsp_max		- Maximum size of response payload
+* @param[out]	p_rsp_size	- Size of response payload
+* @return		rsp			- Response status
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_proto_rsp_t par_proto_cmd_read(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size)
+{
+	par_proto_rsp_t rsp = ePAR_PROTO_RSP_OK;
+	uint32_t		len	= 0;
+
+	if ( 0U == ( req_size % 2U ))
+	{
+		for ( uint32_t i = 0; i < req_size; i += 2U )
+		{
+			const uint16_t 	id 		= (uint16_t)( p_req[i] | ( p_req[i+1U] << 8U ));
+			const par_num_t	par_num = par_cfg_get_num_by_id( id );
+			uint8_t 		code 	= PAR_PROTO_TYPE_UNKNOWN;
+			uint32_t 		size 	= 0;
+			uint32_t		val		= 0;
+
+			if ( par_num < ePAR_NUM_OF )
+			{
+				if ( false == par_proto_get_type( par_num, &code, &size ))
+				{
+					code = PAR_PROTO_TYPE_UNKNOWN;
+					size = 0;
+				}
+			}
+
+			if (( len + 3U + size ) > rsp_max )
+			{
+				rsp = ePAR_PROTO_RSP_OVERFLOW;
+				break;
+			}
+
+			p_rsp[len++] = p_req[i];
+			p_rsp[len++] = p_req[i+1U];
+
+			if (( size > 0U ) && ( ePAR_OK == par_get( par_num, &val )))
+			{
+				p_rsp[len++] = code;
+
+				// Little endian target, lower bytes hold value
+				memcpy( &p_rsp[len], &val, size );
+				len += size;
+			}
+			else
+			{
+				p_rsp[len++] = PAR_PROTO_TYPE_UNKNOWN;
+			}
+		}
+	}
+	else
+	{
+		rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+	}
+
+	*p_rsp_size = len;
+
+	return rsp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write command
+*
+* @note		Parsing stops at unknown ID as size of its value is not known.
+*
+* @param[in]	p_req		- Pointer to request payload
+* @param[in]	req_size	- Size of request payload
+* @param[out]	p_rsp		- Pointer to response payload
+* @param[in]	rsp_max		- Maximum size of response payload
+* @param[out]	p_rsp_size	- Size of response payload
+* @return		rsp			- Response status
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_proto_rsp_t par_proto_cmd_write(const uint8_t * const p_req, const uint32_t req_size, uint8_t * const p_rsp, const uint32_t rsp_max, uint32_t * const p_rsp_size)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+	par_proto_rsp_t 		rsp 	= ePAR_PROTO_RSP_OK;
+	uint32_t				len		= 0;
+	uint32_t				i		= 0;
+
+	while (( i < req_size ) && ( ePAR_PROTO_RSP_OK == rsp ))
+	{
+		uint16_t		id		= 0;
+		par_num_t		par_num	= ePAR_NUM_OF;
+		uint8_t 		code 	= 0;
+		uint32_t 		size 	= 0;
+		par_proto_rsp_t	result	= ePAR_PROTO_RSP_OK;
+
+		if (( i + 2U ) > req_size )
+		{
+			rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+		}
+		else if (( len + 3U ) > rsp_max )
+		{
+			rsp = ePAR_PROTO_RSP_OVERFLOW;
+		}
+		else
+		{
+			id 		= (uint16_t)( p_req[i] | ( p_req[i+1U] << 8U ));
+			par_num = par_cfg_get_num_by_id( id );
+
+			if 	(	( par_num >= ePAR_NUM_OF )
+				||	( false == par_proto_get_type( par_num, &code, &size )))
+			{
+				result 	= ePAR_PROTO_RSP_UNKNOWN_ID;
+				rsp 	= ePAR_PROTO_RSP_UNKNOWN_ID;
+			}
+			else if (( i + 2U + size ) > req_size )
+			{
+				rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+			}
+			else if ( ePAR_ACCESS_RO == p_table[par_num].access )
+			{
+				result = ePAR_PROTO_RSP_READ_ONLY;
+			}
+			else
+			{
+				uint32_t 				val 	= 0;
+				const par_batch_item_t 	item 	= { .par_num = par_num, .p_val = &val };
+
+				memcpy( &val, &p_req[i+2U], size );
+
+				// Through batch layer so that consumers see the change
+				if ( ePAR_OK != par_set_batch( &item, 1U ))
+				{
+					result = ePAR_PROTO_RSP_ERROR;
+				}
+			}
+
+			if ( ePAR_PROTO_RSP_BAD_LENGTH != rsp )
+			{
+				p_rsp[len++] = (uint8_t)( id & 0xFFU );
+				p_rsp[len++] = (uint8_t)( id >> 8U );
+				p_rsp[len++] = (uint8_t) result;
+			}
+
+			i += ( 2U + size );
+		}
+	}
+
+	*p_rsp_size = len;
+
+	return rsp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stream configuration command
+*
+* @note		Stream list is replaced as a whole, invalid request leaves
+* 			current configuration intact.
+*
+* @param[in]	ch			- Channel to stream on
+* @param[in]	p_req		- Pointer to request payload
+* @param[in]	req_size	- Size of request payload
+* @return		rsp			- Response status
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_proto_rsp_t par_proto_cmd_stream_cfg(const par_proto_ch_t ch, const uint8_t * const p_req, const uint32_t req_size)
+{
+	par_proto_stream_t * const 	p_stream 	= &g_par_proto_stream[ch];
+	par_proto_rsp_t 			rsp 		= ePAR_PROTO_RSP_OK;
+
+	if 	(	( req_size < 3U )
+		||	( 0U != (( req_size - 3U ) % 2U ))
+		||	((( req_size - 3U ) / 2U ) > PAR_PROTO_STREAM_MAX ))
+	{
+		rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+	}
+	else
+	{
+		const uint32_t 	period 	= (uint32_t)( p_req[0] | ( p_req[1] << 8U ));
+		const uint8_t	flags	= p_req[2];
+		const uint32_t	num_of	= (( req_size - 3U ) / 2U );
+
+		if ( 0U == ( flags & PAR_PROTO_STREAM_FLAG_EN ))
+		{
+			p_stream->en = false;
+		}
+		else if (( 0U == num_of ) || ( period < PAR_PROTO_STREAM_MIN_PER_MS ))
+		{
+			rsp = ePAR_PROTO_RSP_BAD_LENGTH;
+		}
+		else
+		{
+			// Validate whole list first
+			for ( uint32_t i = 0; i < num_of; i++ )
+			{
+				const uint16_t 	id 		= (uint16_t)( p_req[3U+(2U*i)] | ( p_req[4U+(2U*i)] << 8U ));
+				const par_num_t	par_num = par_cfg_get_num_by_id( id );
+				uint8_t 		code 	= 0;
+				uint32_t 		size 	= 0;
+
+				if 	(	( par_num >= ePAR_NUM_OF )
+					||	( false == par_proto_get_type( par_num, &code, &size )))
+				{
+					rsp = ePAR_PROTO_RSP_UNKNOWN_ID;
+					break;
+				}
+			}
+
+			if ( ePAR_PROTO_RSP_OK == rsp )
+			{
+				p_stream->en = false;
+
+				for ( uint32_t i = 0; i < num_of; i++ )
+				{
+					const uint16_t 	id 		= (uint16_t)( p_req[3U+(2U*i)] | ( p_req[4U+(2U*i)] << 8U ));
+					uint8_t 		code 	= 0;
+					uint32_t 		size 	= 0;
+
+					p_stream->item[i].par_num 	= par_cfg_get_num_by_id( id );
+					p_stream->item[i].p_val		= &p_stream->val[i];
+					p_stream->val[i]			= 0;
+
+					(void) par_proto_get_type( p_stream->item[i].par_num, &code, &size );
+					p_stream->size[i] = (uint8_t) size;
+				}
+
+				p_stream->num_of 	= num_of;
+				p_stream->period_ms	= period;
+				p_stream->last_ms	= systick_get_ms();
+				p_stream->seq		= 0;
+				p_stream->key_cnt	= 0;
+				p_stream->delta		= ( 0U != ( flags & PAR_PROTO_STREAM_FLAG_DELTA ));
+				p_stream->en		= true;
+			}
+		}
+	}
+
+	return rsp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Build and send stream frame
+*
+* @param[in]	ch		- Channel
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_proto_stream_send(const par_proto_ch_t ch)
+{
+	par_proto_stream_t * const 	p_stream 	= &g_par_proto_stream[ch];
+	const uint32_t				now			= systick_get_ms();
+	const uint32_t				mask_size	= ( p_stream->num_of + 7U ) / 8U;
+	uint32_t					len			= PAR_PROTO_STREAM_HEAD;
+	uint8_t						flags		= 0;
+	uint16_t					crc			= 0;
+
+	// Consistent snapshot of all values
+	(void) par_get_batch( p_stream->item, p_stream->num_of );
+
+	if 	(	( false == p_stream->delta )
+		||	( 0U == p_stream->key_cnt ))
+	{
+		flags |= PAR_PROTO_STREAM_FLAG_KEY;
+	}
+
+	if ( true == p_stream->delta )
+	{
+		flags |= PAR_PROTO_STREAM_FLAG_DELTA;
+
+		// Change mask
+		memset( &gu8_par_proto_tx[len], 0, mask_size );
+		len += mask_size;
+	}
+
+	for ( uint32_t i = 0; i < p_stream->num_of; i++ )
+	{
+		if 	(	( 0U != ( flags & PAR_PROTO_STREAM_FLAG_KEY ))
+			||	( 0 != memcmp( &p_stream->val[i], &p_stream->last_val[i], p_stream->size[i] )))
+		{
+			if ( true == p_stream->delta )
+			{
+				gu8_par_proto_tx[PAR_PROTO_STREAM_HEAD + ( i / 8U )] |= (uint8_t)( 1U << ( i % 8U ));
+			}
+
+			// Little endian target, lower bytes hold value
+			memcpy( &gu8_par_proto_tx[len], &p_stream->val[i], p_stream->size[i] );
+			len += p_stream->size[i];
+
+			p_stream->last_val[i] = p_stream->val[i];
+		}
+	}
+
+	gu8_par_proto_tx[0] = ePAR_PROTO_CMD_STREAM;
+	gu8_par_proto_tx[1] = flags;
+	gu8_par_proto_tx[2] = (uint8_t)( p_stream->seq & 0xFFU );
+	gu8_par_proto_tx[3] = (uint8_t)( p_stream->seq >> 8U );
+	gu8_par_proto_tx[4] = (uint8_t)( now & 0xFFU );
+	gu8_par_proto_tx[5] = (uint8_t)(( now >> 8U ) & 0xFFU );
+	gu8_par_proto_tx[6] = (uint8_t)(( now >> 16U ) & 0xFFU );
+	gu8_par_proto_tx[7] = (uint8_t)( now >> 24U );
+
+	crc = crc16_compute( gu8_par_proto_tx, len, NULL );
+	gu8_par_proto_tx[len++] = (uint8_t)( crc & 0xFFU );
+	gu8_par_proto_tx[len++] = (uint8_t)( crc >> 8U );
+
+	if ( true == par_proto_transmit( ch, gu8_par_proto_tx, len ))
+	{
+		p_stream->key_cnt = (uint8_t)(( p_stream->key_cnt + 1U ) % PAR_PROTO_STREAM_KEY_PERIOD );
+		g_par_proto_stats.stream++;
+	}
+	else
+	{
+		// Host missed changes of dropped frame, resync by key frame
+		p_stream->key_cnt = 0U;
+	}
+
+	// Gap in sequence tells host that frame was dropped
+	p_stream->seq++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		SLIP encode and transmit response
+*
+* @note		Frame is queued all or nothing, partial frame would corrupt
+* 			the next one on host side. Frame that does not fit into Tx
+* 			buffer is dropped and counted.
+*
+* @param[in]	ch		- Channel
+* @param[in]	p_data	- Pointer to response frame
+* @param[in]	size	- Size of response frame
+* @return		true if frame was queued
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool par_proto_transmit(const par_proto_ch_t ch, const uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t	enc_size	= 0;
+	bool		sent		= false;
+
+	// Leading END flushes any line noise on host side
+	gu8_par_proto_tx_enc[0] = PAR_PROTO_SLIP_END;
+
+	if ( NRF_SUCCESS == slip_encode( &gu8_par_proto_tx_enc[1], (uint8_t*) p_data, size, &enc_size ))
+	{
+		enc_size += 1U;
+
+		switch ( ch )
+		{
+			case ePAR_PROTO_CH_UART_DBG:
+				// All or nothing by itself
+				sent = ( eUART_DBG_OK == uart_dbg_write_buf( gu8_par_proto_tx_enc, enc_size ));
+				break;
+
+			case ePAR_PROTO_CH_USB_CDC:
+			{
+				uint32_t free 		= 0;
+				uint32_t accepted 	= 0;
+
+				// Queue only if whole frame fits
+				if 	(	( eUSB_CDC_OK == usb_cdc_get_tx_free( &free ))
+					&&	( enc_size <= free ))
+				{
+					sent = 	(	( eUSB_CDC_OK == usb_cdc_write_buf( gu8_par_proto_tx_enc, enc_size, &accepted ))
+							&&	( enc_size == accepted ));
+				}
+				break;
+			}
+
+			default:
+				// No actions...
+				break;
+		}
+	}
+
+	if ( false == sent )
+	{
+		g_par_proto_stats.tx_drop++;
+	}
+
+	return sent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_PROTO_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of binary parameter protocol API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize binary parameter protocol
+*
+* @return		status	- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_proto_init(void)
+{
+	par_status_t status = ePAR_OK;
+
+	for ( uint32_t ch = 0; ch < ePAR_PROTO_CH_NUM_OF; ch++ )
+	{
+		g_par_proto_ch[ch].state = ePAR_PROTO_STATE_TEXT;
+		par_proto_slip_reset( &g_par_proto_ch[ch] );
+	}
+
+	gb_is_init = true;
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Pass received byte through binary protocol
+*
+* @note		Complete frame is processed and answered from within this
+* 			function, thus call it from communication task only.
+*
+* @param[in]	ch		- Channel byte was received on
+* @param[in]	byte	- Received byte
+* @return		true if byte belongs to binary frame, false if it is text
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool par_proto_filter(const par_proto_ch_t ch, const uint8_t byte)
+{
+	bool consumed = false;
+
+	if 	(	( true == gb_is_init )
+		&&	( ch < ePAR_PROTO_CH_NUM_OF ))
+	{
+		par_proto_chan_t * const 	p_ch 	= &g_par_proto_ch[ch];
+		const uint32_t				now		= systick_get_ms();
+
+		// Incomplete frame, back to text
+		if 	(	( ePAR_PROTO_STATE_TEXT != p_ch->state )
+			&&	(( now - p_ch->last_ms ) > PAR_PROTO_TIMEOUT_MS ))
+		{
+			p_ch->state = ePAR_PROTO_STATE_TEXT;
+			g_par_proto_stats.timeouts++;
+		}
+
+		p_ch->last_ms = now;
+
+		switch ( p_ch->state )
+		{
+			case ePAR_PROTO_STATE_TEXT:
+				if ( PAR_PROTO_SLIP_END == byte )
+				{
+					par_proto_slip_reset( p_ch );
+					p_ch->state = ePAR_PROTO_STATE_FRAME;
+					consumed = true;
+				}
+				break;
+
+			case ePAR_PROTO_STATE_FRAME:
+			{
+				const ret_code_t ret = slip_decode_add_byte( &p_ch->slip, byte );
+
+				consumed = true;
+
+				if ( NRF_SUCCESS == ret )
+				{
+					// Empty frame is just opening END of next one
+					if ( p_ch->slip.current_index > 0U )
+					{
+						par_proto_process( ch, p_ch->rx_buf, p_ch->slip.current_index );
+						p_ch->state = ePAR_PROTO_STATE_TEXT;
+					}
+				}
+				else if ( NRF_ERROR_BUSY != ret )
+				{
+					g_par_proto_stats.frame_err++;
+					p_ch->state = ePAR_PROTO_STATE_DISCARD;
+				}
+				else
+				{
+					// Frame in progress...
+				}
+				break;
+			}
+
+			case ePAR_PROTO_STATE_DISCARD:
+				consumed = true;
+
+				if ( PAR_PROTO_SLIP_END == byte )
+				{
+					p_ch->state = ePAR_PROTO_STATE_TEXT;
+				}
+				break;
+
+			default:
+				p_ch->state = ePAR_PROTO_STATE_TEXT;
+				break;
+		}
+	}
+
+	return consumed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Handle binary parameter protocol streaming
+*
+* @note		Call it from communication task, resolution of streaming
+* 			period equals to call period.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void par_proto_hndl(void)
+{
+	if ( true == gb_is_init )
+	{
+		const uint32_t now = systick_get_ms();
+
+		for ( uint32_t ch = 0; ch < ePAR_PROTO_CH_NUM_OF; ch++ )
+		{
+			par_proto_stream_t * const p_stream = &g_par_proto_stream[ch];
+
+			if 	(	( true == p_stream->en )
+				&&	(( now - p_stream->last_ms ) >= p_stream->period_ms ))
+			{
+				// Keep period, drop missed frames
+				p_stream->last_ms += p_stream->period_ms;
+
+				if (( now - p_stream->last_ms ) >= p_stream->period_ms )
+				{
+					p_stream->last_ms = now;
+				}
+
+				par_proto_stream_send( ch );
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get binary protocol statistics
+*
+* @param[out]	p_stats	- Pointer to statistics
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_proto_get_stats(par_proto_stats_t * const p_stats)
+{
+	par_status_t status = ePAR_OK;
+
+	if ( NULL != p_stats )
+	{
+		*p_stats = g_par_proto_stats;
+	}
+	else
+	{
+		status = ePAR_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_proto.h
+*@brief     Binary device parameter access protocol
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_PROTO
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Binary device parameter access protocol
+*
+* 	Frame (before SLIP encoding), multi-byte fields are little endian:
+*
+* 		| cmd (1) | seq (1) | payload (0..n) | crc16 (2) |
+*
+* 	Frame is SLIP encoded and enclosed by END (0xC0) on both sides. CRC
+* 	is CRC-16-CCITT (init 0xFFFF) over cmd, seq and payload.
+*
+* 	Response has "cmd | 0x80", request "seq" and status byte
+* 	(par_proto_rsp_t) as first payload byte.
+*
+* 	Commands:
+*
+* 		PING  (0x00)	req: -
+* 						rsp: version (1), number of parameters (2)
+*
+* 		INFO  (0x01)	req: start index (2), count (1)
+* 						rsp: N x [ id (2), type (1), access (1) ]
+*
+* 		READ  (0x02)	req: N x [ id (2) ]
+* 						rsp: N x [ id (2), type (1), value (size of type) ]
+* 						Unknown ID is returned with type 0xFF and no value.
+*
+* 		WRITE (0x03)	req: N x [ id (2), value (size of type) ]
+* 						rsp: N x [ id (2), result (1) ]
+*
+* 		STREAM_CFG (0x04)
+* 						req: period ms (2), flags (1), N x [ id (2) ]
+* 						rsp: -
+* 						Flags: bit 0 - enable, bit 1 - delta encoding.
+* 						Streaming runs on channel the request came on.
+*
+* 	Stream frame is sent by device without request (cmd 0x10) and
+* 	has no status byte:
+*
+* 		| 0x10 | flags (1) | seq (2) | timestamp ms (4) | [ mask ] | values | crc16 (2) |
+*
+* 	Flags: bit 0 - key frame, bit 1 - delta encoding. Values are packed
+* 	in native width in order of stream list. With delta encoding, mask
+* 	of ceil(N/8) bytes precedes values (bit i set - value i present)
+* 	and only changed values are sent; each PAR_PROTO_STREAM_KEY_PERIOD
+* 	frame is key frame with all values present.
+*
+* 	Frames are never sent partially. Frame that does not fit into Tx
+* 	buffer is dropped, its sequence number is skipped and next frame is
+* 	key frame.
+*
+* 	Type codes: 0-U8, 1-I8, 2-U16, 3-I16, 4-U32, 5-I32, 6-F32
+*
+* 	Frames with invalid CRC are dropped without response.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _PAR_PROTO_H_
+#define _PAR_PROTO_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "parameters/src/par.h"
+#include "par_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Protocol version
+ */
+#define PAR_PROTO_VERSION					( 1U )
+
+/**
+ * 	Maximum size of decoded request frame
+ *
+ * 	Unit: byte
+ */
+#define PAR_PROTO_RX_SIZE					( 256U )
+
+/**
+ * 	Maximum size of decoded response frame
+ *
+ * @note	Read response that does not fit is truncated and
+ * 			returned with ePAR_PROTO_RSP_OVERFLOW status.
+ *
+ * 	Unit: byte
+ */
+#define PAR_PROTO_TX_SIZE					( 256U )
+
+/**
+ * 	Frame reception timeout
+ *
+ * @note	After timeout channel returns back to text mode, thus
+ * 			stray END character cannot block command line.
+ *
+ * 	Unit: ms
+ */
+#define PAR_PROTO_TIMEOUT_MS				( 100UL )
+
+/**
+ * 	Maximum number of parameters in stream list
+ *
+ * @note	Same as CLI live watch limit.
+ */
+#define PAR_PROTO_STREAM_MAX				( 32U )
+
+/**
+ * 	Minimum streaming period
+ *
+ * @note	Streaming is handled from communication task.
+ *
+ * 	Unit: ms
+ */
+#define PAR_PROTO_STREAM_MIN_PER_MS			( 10UL )
+
+/**
+ * 	Key frame period of delta encoded stream
+ *
+ * 	Unit: frame
+ */
+#define PAR_PROTO_STREAM_KEY_PERIOD			( 10U )
+
+/**
+ * 	Protocol channels
+ */
+typedef enum
+{
+	ePAR_PROTO_CH_UART_DBG = 0,		/**<Debug UART, shared with CLI */
+	ePAR_PROTO_CH_USB_CDC,			/**<USB CDC */
+
+	ePAR_PROTO_CH_NUM_OF
+} par_proto_ch_t;
+
+/**
+ * 	Commands
+ */
+typedef enum
+{
+	ePAR_PROTO_CMD_PING 		= 0x00U,	/**<Protocol version and number of parameters */
+	ePAR_PROTO_CMD_INFO 		= 0x01U,	/**<Parameter ID, type and access by index */
+	ePAR_PROTO_CMD_READ 		= 0x02U,	/**<Read parameters by ID */
+	ePAR_PROTO_CMD_WRITE 		= 0x03U,	/**<Write parameters by ID */
+	ePAR_PROTO_CMD_STREAM_CFG 	= 0x04U,	/**<Configure streaming */
+	ePAR_PROTO_CMD_STREAM 		= 0x10U,	/**<Stream frame, device originated */
+} par_proto_cmd_t;
+
+/**
+ * 	Response status and write item result
+ */
+typedef enum
+{
+	ePAR_PROTO_RSP_OK = 0,			/**<Success */
+	ePAR_PROTO_RSP_UNKNOWN_CMD,		/**<Unknown command */
+	ePAR_PROTO_RSP_BAD_LENGTH,		/**<Payload length invalid */
+	ePAR_PROTO_RSP_OVERFLOW,		/**<Response truncated */
+	ePAR_PROTO_RSP_UNKNOWN_ID,		/**<Unknown parameter ID */
+	ePAR_PROTO_RSP_READ_ONLY,		/**<Parameter is read only */
+	ePAR_PROTO_RSP_ERROR,			/**<Parameter access failed */
+} par_proto_rsp_t;
+
+/**
+ * 	Protocol statistics
+ */
+typedef struct
+{
+	uint32_t	frames;			/**<Number of processed frames */
+	uint32_t	crc_err;		/**<Number of frames with invalid CRC */
+	uint32_t	frame_err;		/**<Number of invalid or overflowed frames */
+	uint32_t	timeouts;		/**<Number of incomplete frames */
+	uint32_t	stream;			/**<Number of sent stream frames */
+	uint32_t	tx_drop;		/**<Number of response and stream frames dropped due to full Tx buffer */
+} par_proto_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_proto_init			(void);
+bool		 par_proto_filter		(const par_proto_ch_t ch, const uint8_t byte);
+void		 par_proto_hndl			(void);
+par_status_t par_proto_get_stats	(par_proto_stats_t * const p_stats);
+
+#endif // _PAR_PROTO_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,148 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_mock.c
+*@brief     Parameter core mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup PAR_MOCK
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "par_mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Parameter values
+ */
+static uint32_t gu32_par_mock_val[ePAR_NUM_OF] = {0};
+
+/**
+ * 	Call counters
+ */
+static uint32_t gu32_par_mock_set_cnt = 0;
+static uint32_t gu32_par_mock_get_cnt = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Value size of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t par_mock_size(const par_num_t par_num)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+	uint32_t size = 4U;
+
+	if 	(	( ePAR_TYPE_U8 == p_table[par_num].type )
+		||	( ePAR_TYPE_I8 == p_table[par_num].type ))
+	{
+		size = 1U;
+	}
+	else if (	( ePAR_TYPE_U16 == p_table[par_num].type )
+			||	( ePAR_TYPE_I16 == p_table[par_num].type ))
+	{
+		size = 2U;
+	}
+	else
+	{
+		// Word sized...
+	}
+
+	return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parameter core API
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_init(void)
+{
+	memset( gu32_par_mock_val, 0, sizeof( gu32_par_mock_val ));
+	gu32_par_mock_set_cnt = 0;
+	gu32_par_mock_get_cnt = 0;
+
+	return ePAR_OK;
+}
+
+par_status_t par_set(const par_num_t par_num, const void * p_val)
+{
+	par_status_t status = ePAR_ERROR;
+
+	gu32_par_mock_set_cnt++;
+
+	if 	(	( par_num < ePAR_NUM_OF )
+		&&	( NULL != p_val ))
+	{
+		gu32_par_mock_val[par_num] = 0;
+		memcpy( &gu32_par_mock_val[par_num], p_val, par_mock_size( par_num ));
+		status = ePAR_OK;
+	}
+
+	return status;
+}
+
+par_status_t par_get(const par_num_t par_num, void * const p_val)
+{
+	par_status_t status = ePAR_ERROR;
+
+	gu32_par_mock_get_cnt++;
+
+	if 	(	( par_num < ePAR_NUM_OF )
+		&&	( NULL != p_val ))
+	{
+		memcpy( p_val, &gu32_par_mock_val[par_num], par_mock_size( par_num ));
+		status = ePAR_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of "par_set()" calls since init
+*
+* @return		number of calls
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t par_mock_get_set_cnt(void)
+{
+	return gu32_par_mock_set_cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of "par_get()" calls since init
+*
+* @return		number of calls
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t par_mock_get_get_cnt(void)
+{
+	return gu32_par_mock_get_cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,45 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_mock.h
+*@brief     Parameter core mock
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Parameter core mock
+*
+* 	Keeps parameter values in RAM, sized by configuration table type,
+* 	and counts calls so that tests can see what reached the core.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __PAR_MOCK_H
+#define __PAR_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#include "parameters/src/par.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+uint32_t	par_mock_get_set_cnt	(void);
+uint32_t	par_mock_get_get_cnt	(void);
+
+#endif // __PAR_MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,16 @@
+# Parameter configuration and batched access on top of parameter core mock
+PAR_DIR := $(ROOT)/src/middleware/parameters
+
+TESTS += par_cfg
+
+par_cfg_SRC		:= $(PAR_DIR)/test/test_par_cfg.c $(PAR_DIR)/par_cfg.c
+
+TESTS += par_batch
+
+par_batch_SRC		:= $(PAR_DIR)/test/test_par_batch.c $(PAR_DIR)/test/par_mock.c $(PAR_DIR)/par_batch.c $(PAR_DIR)/par_cfg.c
+par_batch_CFLAGS	:= -I$(PAR_DIR)/test
+
+TESTS += par_proto
+
+par_proto_SRC		:= $(PAR_DIR)/test/test_par_proto.c $(PAR_DIR)/test/par_mock.c $(PAR_DIR)/par_proto.c $(PAR_DIR)/par_batch.c $(PAR_DIR)/par_cfg.c
+par_proto_CFLAGS	:= -I$(PAR_DIR)/test
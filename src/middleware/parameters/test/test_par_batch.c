@@ -0,0 +1,212 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_par_batch.c
+*@brief     Batched parameter access host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup PAR_BATCH_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Batch layer runs on top of parameter core mock, which counts calls
+* 	that reach the core.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "test.h"
+#include "par_mock.h"
+#include "middleware/parameters/par_batch.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Number of parameters marked in change mask
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_par_changed(const par_batch_changes_t * const p_changes)
+{
+	uint32_t num_of = 0;
+
+	for ( uint32_t i = 0; i < PAR_BATCH_MASK_SIZE; i++ )
+	{
+		num_of += (uint32_t) __builtin_popcount( p_changes->mask[i] );
+	}
+
+	return num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parameter marked in change mask
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_par_is_changed(const par_batch_changes_t * const p_changes, const par_num_t par_num)
+{
+	return ( 0UL != ( p_changes->mask[ par_num / 32UL ] & ( 1UL << ( par_num % 32UL ))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Only changed values reach the core and are tracked
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set(void)
+{
+	par_batch_changes_t	cons_a	= {0};
+	par_batch_changes_t	cons_b	= {0};
+	uint16_t			ain[3]	= { 100, 200, 300 };
+	uint32_t			rate	= 5000;
+
+	const par_batch_item_t items[] =
+	{
+		{ .par_num = ePAR_AIN_1,		.p_val = &ain[0]	},
+		{ .par_num = ePAR_AIN_2,		.p_val = &ain[1]	},
+		{ .par_num = ePAR_AIN_4,		.p_val = &ain[2]	},
+		{ .par_num = ePAR_USB_RX_RATE,	.p_val = &rate		},
+	};
+
+	// All new
+	TEST_ASSERT_EQ( par_set_batch( items, 4U ), ePAR_OK );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), 4 );
+	TEST_ASSERT_EQ( par_get_changes( &cons_a ), ePAR_OK );
+	TEST_ASSERT_EQ( test_par_changed( &cons_a ), 4 );
+
+	// Same values, nothing written nor reported
+	TEST_ASSERT_EQ( par_set_batch( items, 4U ), ePAR_OK );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), 4 );
+	TEST_ASSERT_EQ( par_get_changes( &cons_a ), ePAR_OK );
+	TEST_ASSERT_EQ( test_par_changed( &cons_a ), 0 );
+
+	// Single change
+	ain[1] = 201;
+	TEST_ASSERT_EQ( par_set_batch( items, 4U ), ePAR_OK );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), 5 );
+	TEST_ASSERT_EQ( par_get_changes( &cons_a ), ePAR_OK );
+	TEST_ASSERT_EQ( test_par_changed( &cons_a ), 1 );
+	TEST_ASSERT( test_par_is_changed( &cons_a, ePAR_AIN_2 ));
+
+	// New consumer sees everything ever changed
+	TEST_ASSERT_EQ( par_get_changes( &cons_b ), ePAR_OK );
+	TEST_ASSERT_EQ( test_par_changed( &cons_b ), 4 );
+
+	// Values reached the core
+	uint16_t	ain_get[3]	= {0};
+	uint32_t	rate_get	= 0;
+
+	const par_batch_item_t get_items[] =
+	{
+		{ .par_num = ePAR_AIN_1,		.p_val = &ain_get[0]	},
+		{ .par_num = ePAR_AIN_2,		.p_val = &ain_get[1]	},
+		{ .par_num = ePAR_AIN_4,		.p_val = &ain_get[2]	},
+		{ .par_num = ePAR_USB_RX_RATE,	.p_val = &rate_get		},
+	};
+
+	TEST_ASSERT_EQ( par_get_batch( get_items, 4U ), ePAR_OK );
+	TEST_ASSERT_EQ( ain_get[0], 100 );
+	TEST_ASSERT_EQ( ain_get[1], 201 );
+	TEST_ASSERT_EQ( ain_get[2], 300 );
+	TEST_ASSERT_EQ( rate_get, 5000 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Single tracked set compares only value size
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set_tracked(void)
+{
+	par_batch_changes_t	cons = {0};
+	uint8_t				buf[4] = { 1, 0xAA, 0xBB, 0xCC };
+
+	(void) par_get_changes( &cons );
+
+	const uint32_t set_cnt = par_mock_get_set_cnt();
+
+	TEST_ASSERT_EQ( par_set_tracked( ePAR_BTN_1, &buf[0] ), ePAR_OK );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), set_cnt + 1U );
+
+	// Bytes after value do not matter
+	buf[1] = 0x55;
+	TEST_ASSERT_EQ( par_set_tracked( ePAR_BTN_1, &buf[0] ), ePAR_OK );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), set_cnt + 1U );
+
+	TEST_ASSERT_EQ( par_get_changes( &cons ), ePAR_OK );
+	TEST_ASSERT_EQ( test_par_changed( &cons ), 1 );
+	TEST_ASSERT( test_par_is_changed( &cons, ePAR_BTN_1 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Invalid item rejects whole batch
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_invalid(void)
+{
+	uint16_t val = 1234;
+
+	const par_batch_item_t bad_num[] =
+	{
+		{ .par_num = ePAR_AIN_5,		.p_val = &val	},
+		{ .par_num = ePAR_NUM_OF,		.p_val = &val	},
+	};
+
+	const par_batch_item_t bad_ptr[] =
+	{
+		{ .par_num = ePAR_AIN_5,		.p_val = &val	},
+		{ .par_num = ePAR_AIN_6,		.p_val = NULL	},
+	};
+
+	const uint32_t set_cnt = par_mock_get_set_cnt();
+	const uint32_t get_cnt = par_mock_get_get_cnt();
+
+	TEST_ASSERT_EQ( par_set_batch( bad_num, 2U ), ePAR_ERROR );
+	TEST_ASSERT_EQ( par_set_batch( bad_ptr, 2U ), ePAR_ERROR );
+	TEST_ASSERT_EQ( par_get_batch( bad_num, 2U ), ePAR_ERROR );
+	TEST_ASSERT_EQ( par_set_tracked( ePAR_NUM_OF, &val ), ePAR_ERROR );
+
+	// Nothing reached the core
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), set_cnt );
+	TEST_ASSERT_EQ( par_mock_get_get_cnt(), get_cnt );
+
+	// Empty batch is fine
+	TEST_ASSERT_EQ( par_set_batch( bad_num, 0U ), ePAR_OK );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	TEST_ASSERT_EQ( par_init(), ePAR_OK );
+	TEST_ASSERT_EQ( par_batch_init(), ePAR_OK );
+
+	test_set();
+	test_set_tracked();
+	test_invalid();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,290 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_par_cfg.c
+*@brief     Parameter ID lookup host test and benchmark
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup PAR_CFG_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Configuration table and "par_cfg_get_num_by_id()" are checked against
+* 	PAR_CFG_ID_LIST over whole ID range.
+*
+* 	Benchmark builds synthetic sparse ID lists of 10, 100 and 1000
+* 	parameters and compares switch generated the same way as in
+* 	"par_cfg_get_num_by_id()" with linear scan of ID table.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "test.h"
+#include "middleware/parameters/par_cfg.h"
+#include "parameters/src/par.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Synthetic sparse ID of n-th parameter
+ */
+#define TEST_PAR_ID(n)					((uint16_t)(( 7U * ( n )) + 3U ))
+
+/**
+ * 	Synthetic ID list generators
+ */
+#define TEST_PAR_R10(E,b)				E((b)+0) E((b)+1) E((b)+2) E((b)+3) E((b)+4) E((b)+5) E((b)+6) E((b)+7) E((b)+8) E((b)+9)
+#define TEST_PAR_R100(E,b)				TEST_PAR_R10(E,(b)+0) TEST_PAR_R10(E,(b)+10) TEST_PAR_R10(E,(b)+20) TEST_PAR_R10(E,(b)+30) TEST_PAR_R10(E,(b)+40) \
+										TEST_PAR_R10(E,(b)+50) TEST_PAR_R10(E,(b)+60) TEST_PAR_R10(E,(b)+70) TEST_PAR_R10(E,(b)+80) TEST_PAR_R10(E,(b)+90)
+#define TEST_PAR_R1000(E,b)				TEST_PAR_R100(E,(b)+0) TEST_PAR_R100(E,(b)+100) TEST_PAR_R100(E,(b)+200) TEST_PAR_R100(E,(b)+300) TEST_PAR_R100(E,(b)+400) \
+										TEST_PAR_R100(E,(b)+500) TEST_PAR_R100(E,(b)+600) TEST_PAR_R100(E,(b)+700) TEST_PAR_R100(E,(b)+800) TEST_PAR_R100(E,(b)+900)
+
+#define TEST_PAR_ID_ELEM(n)				TEST_PAR_ID(n),
+#define TEST_PAR_ID_CASE(n)				case TEST_PAR_ID(n): num = ( n ); break;
+
+/**
+ * 	Lookups per benchmark point
+ */
+#define TEST_BENCH_LOOKUPS				( 20000000UL )
+
+/**
+ * 	Lookup function
+ */
+typedef uint32_t (*test_par_lookup_t)(const uint16_t id);
+
+/**
+ * 	Synthetic configuration
+ */
+typedef struct
+{
+	const uint16_t *	p_ids;		/**<ID table in parameter order */
+	uint32_t			num_of;		/**<Number of parameters */
+	test_par_lookup_t	pf_switch;	/**<Generated switch lookup */
+} test_par_set_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Synthetic ID tables
+ */
+static const uint16_t gu16_ids_10[]		= { TEST_PAR_R10( TEST_PAR_ID_ELEM, 0 ) };
+static const uint16_t gu16_ids_100[]	= { TEST_PAR_R100( TEST_PAR_ID_ELEM, 0 ) };
+static const uint16_t gu16_ids_1000[]	= { TEST_PAR_R1000( TEST_PAR_ID_ELEM, 0 ) };
+
+/**
+ * 	Currently scanned table, keeps compiler from specializing scan
+ */
+static const uint16_t * volatile gp_scan_ids	= NULL;
+static volatile uint32_t gu32_scan_num_of		= 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Generated lookups, same pattern as "par_cfg_get_num_by_id()"
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_par_switch_10(const uint16_t id)
+{
+	uint32_t num = UINT32_MAX;
+	switch ( id ) { TEST_PAR_R10( TEST_PAR_ID_CASE, 0 ) default: break; }
+	return num;
+}
+
+static uint32_t test_par_switch_100(const uint16_t id)
+{
+	uint32_t num = UINT32_MAX;
+	switch ( id ) { TEST_PAR_R100( TEST_PAR_ID_CASE, 0 ) default: break; }
+	return num;
+}
+
+static uint32_t test_par_switch_1000(const uint16_t id)
+{
+	uint32_t num = UINT32_MAX;
+	switch ( id ) { TEST_PAR_R1000( TEST_PAR_ID_CASE, 0 ) default: break; }
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Linear scan lookup, previous implementation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_par_scan(const uint16_t id)
+{
+	const uint16_t * const	p_ids	= gp_scan_ids;
+	const uint32_t			num_of	= gu32_scan_num_of;
+	uint32_t				num		= UINT32_MAX;
+
+	for ( uint32_t i = 0; i < num_of; i++ )
+	{
+		if ( id == p_ids[i] )
+		{
+			num = i;
+			break;
+		}
+	}
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Configuration table against ID list
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_table(void)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+	uint32_t known = 0;
+
+	TEST_ASSERT_EQ( par_cfg_get_table_size(), ePAR_NUM_OF * sizeof( par_cfg_t ));
+
+	// Each entry carries ID of its list entry and lookup resolves it back
+	#define TEST_PAR_CFG_CHECK( name, id_val )							\
+		TEST_ASSERT_EQ( p_table[ePAR_##name].id, ( id_val ));			\
+		TEST_ASSERT_EQ( par_cfg_get_num_by_id( id_val ), ePAR_##name );
+	PAR_CFG_ID_LIST( TEST_PAR_CFG_CHECK )
+	#undef TEST_PAR_CFG_CHECK
+
+	// Every table entry is filled
+	for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		TEST_ASSERT( NULL != p_table[par_num].name );
+	}
+
+	// Whole ID range, only listed IDs resolve
+	for ( uint32_t id = 0; id <= UINT16_MAX; id++ )
+	{
+		if ( ePAR_NUM_OF != par_cfg_get_num_by_id((uint16_t) id ))
+		{
+			known++;
+		}
+	}
+
+	TEST_ASSERT_EQ( known, ePAR_NUM_OF );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Synthetic lookups agree with scan
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_lookup(const test_par_set_t * const p_set)
+{
+	uint32_t bad = 0;
+
+	gp_scan_ids			= p_set->p_ids;
+	gu32_scan_num_of	= p_set->num_of;
+
+	for ( uint32_t id = 0; id <= TEST_PAR_ID( p_set->num_of ); id++ )
+	{
+		if ( p_set->pf_switch((uint16_t) id ) != test_par_scan((uint16_t) id ))
+		{
+			bad++;
+		}
+	}
+
+	TEST_ASSERT_EQ( bad, 0 );
+	TEST_ASSERT_EQ( p_set->pf_switch( TEST_PAR_ID( p_set->num_of - 1U )), p_set->num_of - 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lookup cost of existing IDs, uniformly over table
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double test_par_bench_one(const test_par_set_t * const p_set, const test_par_lookup_t pf_lookup)
+{
+	volatile uint32_t	sink	= 0;
+	uint32_t			n		= 0;
+	const uint64_t		start	= test_now_ns();
+
+	gp_scan_ids			= p_set->p_ids;
+	gu32_scan_num_of	= p_set->num_of;
+
+	for ( uint32_t i = 0; i < TEST_BENCH_LOOKUPS; i++ )
+	{
+		sink += pf_lookup( p_set->p_ids[n] );
+
+		// Stride through table, prime step visits all entries
+		n += 7U;
+
+		if ( n >= p_set->num_of )
+		{
+			n -= p_set->num_of;
+		}
+	}
+
+	(void) sink;
+
+	return ((double)( test_now_ns() - start ) / (double) TEST_BENCH_LOOKUPS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Benchmark switch against linear scan
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(const test_par_set_t * const p_set)
+{
+	const double sw		= test_par_bench_one( p_set, p_set->pf_switch );
+	const double scan	= test_par_bench_one( p_set, test_par_scan );
+
+	TEST_BENCH( "%4u params: switch %6.2f ns, scan %7.2f ns per lookup", (unsigned) p_set->num_of, sw, scan );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Test entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	static const test_par_set_t sets[] =
+	{
+		{ .p_ids = gu16_ids_10,		.num_of = 10U,		.pf_switch = test_par_switch_10		},
+		{ .p_ids = gu16_ids_100,	.num_of = 100U,		.pf_switch = test_par_switch_100	},
+		{ .p_ids = gu16_ids_1000,	.num_of = 1000U,	.pf_switch = test_par_switch_1000	},
+	};
+
+	test_init( argc, argv );
+
+	test_table();
+
+	for ( uint32_t i = 0; i < ( sizeof( sets ) / sizeof( sets[0] )); i++ )
+	{
+		test_lookup( &sets[i] );
+	}
+
+	if ( true == test_bench_en())
+	{
+		for ( uint32_t i = 0; i < ( sizeof( sets ) / sizeof( sets[0] )); i++ )
+		{
+			test_bench( &sets[i] );
+		}
+	}
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1192 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_par_proto.c
+*@brief     Binary parameter protocol host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup PAR_PROTO_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host side builds SLIP + CRC16 frames on its own, feeds them byte by
+* 	byte through par_proto_filter() and decodes responses captured from
+* 	debug UART and USB CDC stand-ins. Tx buffer free space of both ports
+* 	is controlled by test, so that dropped frames can be checked.
+*
+* 	Stream frames are decoded into host mirror of streamed values: 8 byte
+* 	header, change mask of delta encoding and key frames each
+* 	PAR_PROTO_STREAM_KEY_PERIOD frame.
+*
+* 	Bench compares bytes on the wire and cycles of full parameter table
+* 	read by single READ frame against per parameter "par_get" text
+* 	command answered by printf and parsed by scanf. Stream bandwidth of
+* 	text, binary and delta frames is compared against 115200 baud.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "test.h"
+#include "par_mock.h"
+#include "crc16.h"
+#include "middleware/parameters/par_proto.h"
+#include "middleware/parameters/par_batch.h"
+#include "drivers/peripheral/uart/uart_dbg.h"
+#include "drivers/peripheral/usb_cdc/usb_cdc.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	SLIP special characters
+ */
+#define TEST_SLIP_END					( 0xC0U )
+#define TEST_SLIP_ESC					( 0xDBU )
+#define TEST_SLIP_ESC_END				( 0xDCU )
+#define TEST_SLIP_ESC_ESC				( 0xDDU )
+
+/**
+ * 	Size of captured port output
+ *
+ * 	Unit: byte
+ */
+#define TEST_PORT_SIZE					( 4096U )
+
+/**
+ * 	Maximum size of frame
+ *
+ * 	Unit: byte
+ */
+#define TEST_FRAME_SIZE					( 600U )
+
+/**
+ * 	Type code of unknown parameter
+ */
+#define TEST_TYPE_UNKNOWN				( 0xFFU )
+
+/**
+ * 	Unused parameter ID
+ */
+#define TEST_ID_UNKNOWN					( 0x7FFFU )
+
+/**
+ * 	Number of bench iterations
+ */
+#define TEST_BENCH_LOOPS				( 2000U )
+
+/**
+ * 	Stream frame layout
+ */
+#define TEST_STREAM_HEAD				( 8U )
+#define TEST_STREAM_FLAG_EN				( 0x01U )
+#define TEST_STREAM_FLAG_KEY			( 0x01U )
+#define TEST_STREAM_FLAG_DELTA			( 0x02U )
+
+/**
+ * 	Stream period
+ *
+ * 	Unit: ms
+ */
+#define TEST_STREAM_PER_MS				( 10UL )
+
+/**
+ * 	Number of stream frames in test and bench
+ */
+#define TEST_STREAM_FRAMES				( 1000U )
+
+/**
+ * 	Number of values changed between bench stream frames
+ */
+#define TEST_STREAM_CHANGES				( 8U )
+
+/**
+ * 	Debug UART budget, 10 bits per byte at 115200 baud
+ *
+ * 	Unit: byte/s
+ */
+#define TEST_UART_BYTES_PER_S			( 115200UL / 10UL )
+
+/**
+ * 	Captured port output
+ */
+typedef struct
+{
+	uint8_t		buf[TEST_PORT_SIZE];	/**<Written bytes */
+	uint32_t	len;					/**<Number of written bytes */
+	uint32_t	rd;						/**<Host read index */
+	uint32_t	free;					/**<Tx buffer free space. Unit: byte */
+} test_port_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Time
+ *
+ * 	Unit: ms
+ */
+static uint32_t gu32_test_ms = 1000UL;
+
+/**
+ * 	Port outputs
+ */
+static test_port_t g_test_port[ePAR_PROTO_CH_NUM_OF] = {0};
+
+/**
+ * 	Decoded response
+ */
+static uint8_t	gu8_test_rsp[TEST_FRAME_SIZE]	= {0};
+static uint32_t	gu32_test_rsp_size				= 0;
+
+/**
+ * 	Host mirror of streamed values
+ */
+static uint32_t	gu32_test_mirror[PAR_PROTO_STREAM_MAX]	= {0};
+static uint16_t	gu16_test_seq							= 0;
+static bool		gb_test_mirror_valid					= false;
+
+/**
+ * 	Random generator state
+ */
+static uint32_t gu32_test_rand = 12345UL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Systick stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return gu32_test_ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Debug UART stand-in, all or nothing as driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+uart_dbg_status_t uart_dbg_write_buf(const uint8_t * const p_data, const uint32_t size)
+{
+	test_port_t * const	p_port	= &g_test_port[ePAR_PROTO_CH_UART_DBG];
+	uart_dbg_status_t	status	= eUART_DBG_ERROR;
+
+	if 	(	( size <= p_port->free )
+		&&	(( p_port->len + size ) <= TEST_PORT_SIZE ))
+	{
+		memcpy( &p_port->buf[p_port->len], p_data, size );
+		p_port->len 	+= size;
+		p_port->free	-= size;
+		status = eUART_DBG_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		USB CDC stand-in, queues as much as fits as driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+usb_cdc_status_t usb_cdc_write_buf(const uint8_t * const p_data, const uint32_t size, uint32_t * const p_accepted)
+{
+	test_port_t * const	p_port		= &g_test_port[ePAR_PROTO_CH_USB_CDC];
+	uint32_t			accepted	= ( size < p_port->free ) ? size : p_port->free;
+
+	if (( p_port->len + accepted ) > TEST_PORT_SIZE )
+	{
+		accepted = TEST_PORT_SIZE - p_port->len;
+	}
+
+	memcpy( &p_port->buf[p_port->len], p_data, accepted );
+	p_port->len 	+= accepted;
+	p_port->free	-= accepted;
+	*p_accepted		= accepted;
+
+	return eUSB_CDC_OK;
+}
+
+usb_cdc_status_t usb_cdc_get_tx_free(uint32_t * const p_free)
+{
+	*p_free = g_test_port[ePAR_PROTO_CH_USB_CDC].free;
+
+	return eUSB_CDC_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear port output and set its free space
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_port_reset(const par_proto_ch_t ch, const uint32_t free)
+{
+	g_test_port[ch].len		= 0;
+	g_test_port[ch].rd		= 0;
+	g_test_port[ch].free	= free;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Put byte SLIP escaped
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_slip_put(uint8_t * const p_out, uint32_t len, const uint8_t byte)
+{
+	if ( TEST_SLIP_END == byte )
+	{
+		p_out[len++] = TEST_SLIP_ESC;
+		p_out[len++] = TEST_SLIP_ESC_END;
+	}
+	else if ( TEST_SLIP_ESC == byte )
+	{
+		p_out[len++] = TEST_SLIP_ESC;
+		p_out[len++] = TEST_SLIP_ESC_ESC;
+	}
+	else
+	{
+		p_out[len++] = byte;
+	}
+
+	return len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Build SLIP encoded request frame
+*
+* @return		size of encoded frame
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_frame_build(uint8_t * const p_out, const uint8_t cmd, const uint8_t seq, const uint8_t * const p_payload, const uint32_t size)
+{
+	uint8_t		raw[TEST_FRAME_SIZE]	= {0};
+	uint32_t	len						= 0;
+	uint16_t	crc						= 0;
+
+	raw[0] = cmd;
+	raw[1] = seq;
+
+	if ( size > 0U )
+	{
+		memcpy( &raw[2], p_payload, size );
+	}
+
+	crc = crc16_compute( raw, size + 2U, NULL );
+	raw[size + 2U] = (uint8_t)( crc & 0xFFU );
+	raw[size + 3U] = (uint8_t)( crc >> 8U );
+
+	p_out[len++] = TEST_SLIP_END;
+
+	for ( uint32_t i = 0; i < ( size + 4U ); i++ )
+	{
+		len = test_slip_put( p_out, len, raw[i] );
+	}
+
+	p_out[len++] = TEST_SLIP_END;
+
+	return len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Feed bytes through protocol filter
+*
+* @return		number of bytes consumed by protocol
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_feed(const par_proto_ch_t ch, const uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t consumed = 0;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		if ( true == par_proto_filter( ch, p_data[i] ))
+		{
+			consumed++;
+		}
+	}
+
+	return consumed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Send request, all bytes must be taken by protocol
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_request(const par_proto_ch_t ch, const uint8_t cmd, const uint8_t seq, const uint8_t * const p_payload, const uint32_t size)
+{
+	uint8_t			frame[TEST_FRAME_SIZE]	= {0};
+	const uint32_t	len						= test_frame_build( frame, cmd, seq, p_payload, size );
+
+	TEST_ASSERT_EQ( test_feed( ch, frame, len ), len );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Decode next frame of port output
+*
+* @note		Decoded frame is in "gu8_test_rsp", CRC is checked and
+* 			removed.
+*
+* @return		true if valid frame was found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_response(const par_proto_ch_t ch)
+{
+	test_port_t * const p_port	= &g_test_port[ch];
+	bool				valid	= false;
+	bool				esc		= false;
+
+	gu32_test_rsp_size = 0;
+
+	// Skip leading ENDs
+	while (( p_port->rd < p_port->len ) && ( TEST_SLIP_END == p_port->buf[p_port->rd] ))
+	{
+		p_port->rd++;
+	}
+
+	while (( p_port->rd < p_port->len ) && ( false == valid ))
+	{
+		const uint8_t byte = p_port->buf[p_port->rd++];
+
+		if ( true == esc )
+		{
+			TEST_ASSERT(( TEST_SLIP_ESC_END == byte ) || ( TEST_SLIP_ESC_ESC == byte ));
+			gu8_test_rsp[gu32_test_rsp_size++] = ( TEST_SLIP_ESC_END == byte ) ? TEST_SLIP_END : TEST_SLIP_ESC;
+			esc = false;
+		}
+		else if ( TEST_SLIP_ESC == byte )
+		{
+			esc = true;
+		}
+		else if ( TEST_SLIP_END == byte )
+		{
+			valid = true;
+		}
+		else
+		{
+			gu8_test_rsp[gu32_test_rsp_size++] = byte;
+		}
+
+		TEST_ASSERT( gu32_test_rsp_size < TEST_FRAME_SIZE );
+	}
+
+	if ( true == valid )
+	{
+		TEST_ASSERT( gu32_test_rsp_size >= 4U );
+
+		if ( gu32_test_rsp_size >= 4U )
+		{
+			const uint16_t crc = (uint16_t)( gu8_test_rsp[gu32_test_rsp_size-2U] | ( gu8_test_rsp[gu32_test_rsp_size-1U] << 8U ));
+
+			TEST_ASSERT_EQ( crc, crc16_compute( gu8_test_rsp, gu32_test_rsp_size - 2U, NULL ));
+			gu32_test_rsp_size -= 2U;
+		}
+		else
+		{
+			valid = false;
+		}
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check response header
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_response_head(const uint8_t cmd, const uint8_t seq, const par_proto_rsp_t rsp)
+{
+	TEST_ASSERT( gu32_test_rsp_size >= 3U );
+	TEST_ASSERT_EQ( gu8_test_rsp[0], cmd | 0x80U );
+	TEST_ASSERT_EQ( gu8_test_rsp[1], seq );
+	TEST_ASSERT_EQ( gu8_test_rsp[2], rsp );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Value size of type code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_type_size(const uint8_t code)
+{
+	const uint8_t size[] = { 1U, 1U, 2U, 2U, 4U, 4U, 4U };
+
+	return ( code < sizeof( size )) ? size[code] : 0U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Build READ request of whole table
+*
+* @return		size of payload
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_read_all_req(uint8_t * const p_payload)
+{
+	const par_cfg_t * const p_table = (const par_cfg_t*) par_cfg_get_table();
+
+	for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		p_payload[2U * par_num]			= (uint8_t)( p_table[par_num].id & 0xFFU );
+		p_payload[( 2U * par_num ) + 1U] = (uint8_t)( p_table[par_num].id >> 8U );
+	}
+
+	return 2U * ePAR_NUM_OF;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Decode READ response of whole table
+*
+* @return		number of decoded values
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_read_all_rsp(uint32_t * const p_val)
+{
+	uint32_t i		= 3U;
+	uint32_t num_of	= 0;
+
+	while ((( i + 3U ) <= gu32_test_rsp_size ) && ( num_of < ePAR_NUM_OF ))
+	{
+		const uint32_t size = test_type_size( gu8_test_rsp[i + 2U] );
+
+		p_val[num_of] = 0;
+		memcpy( &p_val[num_of], &gu8_test_rsp[i + 3U], size );
+
+		i += ( 3U + size );
+		num_of++;
+	}
+
+	return num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set distinct value of every parameter, including bytes that must
+*		be escaped
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_par_fill(const uint32_t seed)
+{
+	for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		const uint32_t val = ( 0xDBC0C0DBUL ^ ( seed * 0x9E3779B9UL )) + par_num;
+
+		TEST_ASSERT_EQ( par_set( par_num, &val ), ePAR_OK );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization and CRC check vector
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init_proto(void)
+{
+	const uint8_t check[] = "123456789";
+
+	// CRC-16-CCITT (init 0xFFFF)
+	TEST_ASSERT_EQ( crc16_compute( check, 9U, NULL ), 0x29B1 );
+
+	// Not initialized, everything is text
+	TEST_ASSERT( false == par_proto_filter( ePAR_PROTO_CH_UART_DBG, TEST_SLIP_END ));
+
+	TEST_ASSERT_EQ( par_init(), ePAR_OK );
+	TEST_ASSERT_EQ( par_batch_init(), ePAR_OK );
+	TEST_ASSERT_EQ( par_proto_init(), ePAR_OK );
+
+	for ( uint32_t ch = 0; ch < ePAR_PROTO_CH_NUM_OF; ch++ )
+	{
+		test_port_reset( ch, TEST_PORT_SIZE );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Ping on both channels
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_ping(void)
+{
+	for ( uint32_t ch = 0; ch < ePAR_PROTO_CH_NUM_OF; ch++ )
+	{
+		test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+		test_port_reset( ePAR_PROTO_CH_USB_CDC, TEST_PORT_SIZE );
+		test_request( ch, ePAR_PROTO_CMD_PING, (uint8_t)( 0x10U + ch ), NULL, 0U );
+
+		TEST_ASSERT( true == test_response( ch ));
+		test_response_head( ePAR_PROTO_CMD_PING, (uint8_t)( 0x10U + ch ), ePAR_PROTO_RSP_OK );
+		TEST_ASSERT_EQ( gu32_test_rsp_size, 6U );
+		TEST_ASSERT_EQ( gu8_test_rsp[3], PAR_PROTO_VERSION );
+		TEST_ASSERT_EQ( gu8_test_rsp[4] | ( gu8_test_rsp[5] << 8U ), ePAR_NUM_OF );
+
+		// Answered on its own channel only
+		TEST_ASSERT( false == test_response( ch ));
+		TEST_ASSERT_EQ( g_test_port[( ch + 1U ) % ePAR_PROTO_CH_NUM_OF].len, 0U );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read whole table and unknown ID
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_read(void)
+{
+	const par_cfg_t * const	p_table					= (const par_cfg_t*) par_cfg_get_table();
+	uint8_t					req[TEST_FRAME_SIZE]	= {0};
+	uint32_t				val[ePAR_NUM_OF]		= {0};
+	uint32_t				size					= test_read_all_req( req );
+
+	test_par_fill( 1UL );
+
+	// Escaped sequence number is echoed
+	test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+	test_request( ePAR_PROTO_CH_UART_DBG, ePAR_PROTO_CMD_READ, TEST_SLIP_END, req, size );
+
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+	test_response_head( ePAR_PROTO_CMD_READ, TEST_SLIP_END, ePAR_PROTO_RSP_OK );
+	TEST_ASSERT_EQ( test_read_all_rsp( val ), ePAR_NUM_OF );
+
+	for ( uint32_t par_num = 0, i = 3U; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		uint32_t exp = 0;
+
+		TEST_ASSERT_EQ( par_get( par_num, &exp ), ePAR_OK );
+		TEST_ASSERT_EQ( gu8_test_rsp[i] | ( gu8_test_rsp[i + 1U] << 8U ), p_table[par_num].id );
+		TEST_ASSERT_EQ( gu8_test_rsp[i + 2U], p_table[par_num].type );
+		TEST_ASSERT_EQ( val[par_num], exp );
+
+		i += ( 3U + test_type_size( gu8_test_rsp[i + 2U] ));
+	}
+
+	// Unknown ID between known ones
+	req[0] = (uint8_t)( TEST_ID_UNKNOWN & 0xFFU );
+	req[1] = (uint8_t)( TEST_ID_UNKNOWN >> 8U );
+	size = 4U;
+
+	test_request( ePAR_PROTO_CH_UART_DBG, ePAR_PROTO_CMD_READ, 2U, req, size );
+
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+	test_response_head( ePAR_PROTO_CMD_READ, 2U, ePAR_PROTO_RSP_OK );
+	TEST_ASSERT_EQ( gu32_test_rsp_size, 3U + 3U + 3U + test_type_size( p_table[1].type ));
+	TEST_ASSERT_EQ( gu8_test_rsp[3] | ( gu8_test_rsp[4] << 8U ), TEST_ID_UNKNOWN );
+	TEST_ASSERT_EQ( gu8_test_rsp[5], TEST_TYPE_UNKNOWN );
+	TEST_ASSERT_EQ( gu8_test_rsp[6] | ( gu8_test_rsp[7] << 8U ), p_table[1].id );
+
+	// Odd length
+	test_request( ePAR_PROTO_CH_UART_DBG, ePAR_PROTO_CMD_READ, 3U, req, 3U );
+
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+	test_response_head( ePAR_PROTO_CMD_READ, 3U, ePAR_PROTO_RSP_BAD_LENGTH );
+	TEST_ASSERT_EQ( gu32_test_rsp_size, 3U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write read-only, unknown and truncated items
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_write(void)
+{
+	const par_cfg_t * const	p_table	= (const par_cfg_t*) par_cfg_get_table();
+	const uint32_t			set_cnt	= par_mock_get_set_cnt();
+	uint32_t				before	= 0;
+	uint32_t				after	= 0;
+	uint8_t					req[16]	= {0};
+	uint32_t				size	= 0;
+
+	TEST_ASSERT_EQ( par_get( ePAR_AIN_1, &before ), ePAR_OK );
+
+	// Read-only item, then unknown ID stops parsing
+	req[size++] = (uint8_t)( p_table[ePAR_AIN_1].id & 0xFFU );
+	req[size++] = (uint8_t)( p_table[ePAR_AIN_1].id >> 8U );
+	req[size++] = 0x34U;
+	req[size++] = 0x12U;
+	req[size++] = (uint8_t)( TEST_ID_UNKNOWN & 0xFFU );
+	req[size++] = (uint8_t)( TEST_ID_UNKNOWN >> 8U );
+	req[size++] = 0x01U;
+
+	test_port_reset( ePAR_PROTO_CH_USB_CDC, TEST_PORT_SIZE );
+	test_request( ePAR_PROTO_CH_USB_CDC, ePAR_PROTO_CMD_WRITE, TEST_SLIP_ESC, req, size );
+
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_USB_CDC ));
+	test_response_head( ePAR_PROTO_CMD_WRITE, TEST_SLIP_ESC, ePAR_PROTO_RSP_UNKNOWN_ID );
+	TEST_ASSERT_EQ( gu32_test_rsp_size, 3U + 3U + 3U );
+	TEST_ASSERT_EQ( gu8_test_rsp[3] | ( gu8_test_rsp[4] << 8U ), p_table[ePAR_AIN_1].id );
+	TEST_ASSERT_EQ( gu8_test_rsp[5], ePAR_PROTO_RSP_READ_ONLY );
+	TEST_ASSERT_EQ( gu8_test_rsp[6] | ( gu8_test_rsp[7] << 8U ), TEST_ID_UNKNOWN );
+	TEST_ASSERT_EQ( gu8_test_rsp[8], ePAR_PROTO_RSP_UNKNOWN_ID );
+
+	TEST_ASSERT_EQ( par_get( ePAR_AIN_1, &after ), ePAR_OK );
+	TEST_ASSERT_EQ( after, before );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), set_cnt );
+
+	// Value shorter than type
+	test_request( ePAR_PROTO_CH_USB_CDC, ePAR_PROTO_CMD_WRITE, 5U, req, 3U );
+
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_USB_CDC ));
+	test_response_head( ePAR_PROTO_CMD_WRITE, 5U, ePAR_PROTO_RSP_BAD_LENGTH );
+	TEST_ASSERT_EQ( gu32_test_rsp_size, 3U );
+	TEST_ASSERT_EQ( par_mock_get_set_cnt(), set_cnt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Invalid frames and coexistence with text
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_errors(void)
+{
+	const char			text[]					= "status\r\n";
+	uint8_t				frame[TEST_FRAME_SIZE]	= {0};
+	uint32_t			len						= 0;
+	par_proto_stats_t	before					= {0};
+	par_proto_stats_t	stats					= {0};
+
+	TEST_ASSERT_EQ( par_proto_get_stats( &before ), ePAR_OK );
+	test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+
+	// Text passes through
+	TEST_ASSERT_EQ( test_feed( ePAR_PROTO_CH_UART_DBG, (const uint8_t*) text, strlen( text )), 0U );
+
+	// Corrupted CRC, no response
+	len = test_frame_build( frame, ePAR_PROTO_CMD_PING, 7U, NULL, 0U );
+	frame[len - 2U] ^= 0x01U;
+	TEST_ASSERT_EQ( test_feed( ePAR_PROTO_CH_UART_DBG, frame, len ), len );
+
+	// Unknown command
+	test_request( ePAR_PROTO_CH_UART_DBG, 0x7EU, 8U, NULL, 0U );
+
+	// Incomplete frame, timeout returns channel to text
+	len = test_frame_build( frame, ePAR_PROTO_CMD_PING, 9U, NULL, 0U );
+	TEST_ASSERT_EQ( test_feed( ePAR_PROTO_CH_UART_DBG, frame, 3U ), 3U );
+	gu32_test_ms += ( PAR_PROTO_TIMEOUT_MS + 1UL );
+	TEST_ASSERT_EQ( test_feed( ePAR_PROTO_CH_UART_DBG, (const uint8_t*) text, strlen( text )), 0U );
+
+	// Invalid escape, frame discarded until END
+	frame[0] = TEST_SLIP_END;
+	frame[1] = TEST_SLIP_ESC;
+	frame[2] = 0x00U;
+	frame[3] = 0x55U;
+	frame[4] = TEST_SLIP_END;
+	TEST_ASSERT_EQ( test_feed( ePAR_PROTO_CH_UART_DBG, frame, 5U ), 5U );
+	TEST_ASSERT_EQ( test_feed( ePAR_PROTO_CH_UART_DBG, (const uint8_t*) text, strlen( text )), 0U );
+
+	// Only unknown command is answered
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+	test_response_head( 0x7EU, 8U, ePAR_PROTO_RSP_UNKNOWN_CMD );
+	TEST_ASSERT( false == test_response( ePAR_PROTO_CH_UART_DBG ));
+
+	TEST_ASSERT_EQ( par_proto_get_stats( &stats ), ePAR_OK );
+	TEST_ASSERT_EQ( stats.frames - before.frames, 1U );
+	TEST_ASSERT_EQ( stats.crc_err - before.crc_err, 1U );
+	TEST_ASSERT_EQ( stats.timeouts - before.timeouts, 1U );
+	TEST_ASSERT_EQ( stats.frame_err - before.frame_err, 1U );
+	TEST_ASSERT_EQ( stats.tx_drop - before.tx_drop, 0U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Frames that do not fit Tx buffer are dropped whole
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tx_drop(void)
+{
+	const par_cfg_t * const	p_table					= (const par_cfg_t*) par_cfg_get_table();
+	uint8_t					req[TEST_FRAME_SIZE]	= {0};
+	const uint32_t			size					= test_read_all_req( req );
+	par_proto_stats_t		before					= {0};
+	par_proto_stats_t		stats					= {0};
+	uint16_t				seq						= 0;
+
+	TEST_ASSERT_EQ( par_proto_get_stats( &before ), ePAR_OK );
+
+	// Response is larger than free space on both channels
+	for ( uint32_t ch = 0; ch < ePAR_PROTO_CH_NUM_OF; ch++ )
+	{
+		test_port_reset( ch, 64U );
+		test_request( ch, ePAR_PROTO_CMD_READ, 1U, req, size );
+
+		TEST_ASSERT_EQ( g_test_port[ch].len, 0U );
+		TEST_ASSERT_EQ( g_test_port[ch].free, 64U );
+
+		// Small one still fits
+		test_request( ch, ePAR_PROTO_CMD_PING, 2U, NULL, 0U );
+		TEST_ASSERT( true == test_response( ch ));
+		test_response_head( ePAR_PROTO_CMD_PING, 2U, ePAR_PROTO_RSP_OK );
+	}
+
+	TEST_ASSERT_EQ( par_proto_get_stats( &stats ), ePAR_OK );
+	TEST_ASSERT_EQ( stats.tx_drop - before.tx_drop, ePAR_PROTO_CH_NUM_OF );
+	TEST_ASSERT_EQ( stats.frames - before.frames, 2U * ePAR_PROTO_CH_NUM_OF );
+
+	// Delta stream on USB, dropped frame is followed by key frame
+	req[0] = 10U;
+	req[1] = 0U;
+	req[2] = 0x03U;
+	req[3] = (uint8_t)( p_table[ePAR_AIN_1].id & 0xFFU );
+	req[4] = (uint8_t)( p_table[ePAR_AIN_1].id >> 8U );
+
+	test_port_reset( ePAR_PROTO_CH_USB_CDC, TEST_PORT_SIZE );
+	test_request( ePAR_PROTO_CH_USB_CDC, ePAR_PROTO_CMD_STREAM_CFG, 3U, req, 5U );
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_USB_CDC ));
+	test_response_head( ePAR_PROTO_CMD_STREAM_CFG, 3U, ePAR_PROTO_RSP_OK );
+
+	// Key frame, then delta
+	for ( uint32_t i = 0; i < 2U; i++ )
+	{
+		gu32_test_ms += 10UL;
+		par_proto_hndl();
+
+		TEST_ASSERT( true == test_response( ePAR_PROTO_CH_USB_CDC ));
+		TEST_ASSERT_EQ( gu8_test_rsp[0], ePAR_PROTO_CMD_STREAM );
+		TEST_ASSERT_EQ( gu8_test_rsp[1], ( 0U == i ) ? 0x03U : 0x02U );
+		seq = (uint16_t)( gu8_test_rsp[2] | ( gu8_test_rsp[3] << 8U ));
+		TEST_ASSERT_EQ( seq, i );
+	}
+
+	// Port closed
+	test_port_reset( ePAR_PROTO_CH_USB_CDC, 0U );
+	gu32_test_ms += 10UL;
+	par_proto_hndl();
+	TEST_ASSERT_EQ( g_test_port[ePAR_PROTO_CH_USB_CDC].len, 0U );
+
+	// Reopened, key frame with skipped sequence number
+	test_port_reset( ePAR_PROTO_CH_USB_CDC, TEST_PORT_SIZE );
+	gu32_test_ms += 10UL;
+	par_proto_hndl();
+
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_USB_CDC ));
+	TEST_ASSERT_EQ( gu8_test_rsp[1], 0x03U );
+	TEST_ASSERT_EQ( gu8_test_rsp[2] | ( gu8_test_rsp[3] << 8U ), seq + 2U );
+
+	TEST_ASSERT_EQ( par_proto_get_stats( &stats ), ePAR_OK );
+	TEST_ASSERT_EQ( stats.tx_drop - before.tx_drop, ePAR_PROTO_CH_NUM_OF + 1U );
+	TEST_ASSERT_EQ( stats.stream - before.stream, 3U );
+
+	// Stop streaming
+	req[2] = 0x00U;
+	test_request( ePAR_PROTO_CH_USB_CDC, ePAR_PROTO_CMD_STREAM_CFG, 4U, req, 3U );
+	TEST_ASSERT( true == test_response( ePAR_PROTO_CH_USB_CDC ));
+	test_response_head( ePAR_PROTO_CMD_STREAM_CFG, 4U, ePAR_PROTO_RSP_OK );
+
+	gu32_test_ms += 100UL;
+	par_proto_hndl();
+	TEST_ASSERT( false == test_response( ePAR_PROTO_CH_USB_CDC ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Linear congruential generator
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_rand(void)
+{
+	gu32_test_rand = ( gu32_test_rand * 1664525UL ) + 1013904223UL;
+
+	return ( gu32_test_rand >> 8U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Configure stream of whole table
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_stream_cfg(const par_proto_ch_t ch, const uint8_t flags)
+{
+	uint8_t req[TEST_FRAME_SIZE] = {0};
+
+	req[0] = (uint8_t)( TEST_STREAM_PER_MS & 0xFFU );
+	req[1] = (uint8_t)( TEST_STREAM_PER_MS >> 8U );
+	req[2] = flags;
+
+	test_port_reset( ch, TEST_PORT_SIZE );
+	test_request( ch, ePAR_PROTO_CMD_STREAM_CFG, 0x20U, req, 3U + test_read_all_req( &req[3] ));
+
+	TEST_ASSERT( true == test_response( ch ));
+	test_response_head( ePAR_PROTO_CMD_STREAM_CFG, 0x20U, ePAR_PROTO_RSP_OK );
+
+	gu16_test_seq			= 0;
+	gb_test_mirror_valid	= false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Decode stream frame into host mirror
+*
+* @return		flags of decoded frame
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t test_stream_decode(const bool delta)
+{
+	const par_cfg_t * const	p_table		= (const par_cfg_t*) par_cfg_get_table();
+	const uint32_t			mask_size	= ( ePAR_NUM_OF + 7U ) / 8U;
+	uint32_t				i			= TEST_STREAM_HEAD;
+	uint8_t					flags		= 0;
+
+	TEST_ASSERT( gu32_test_rsp_size >= TEST_STREAM_HEAD );
+	TEST_ASSERT_EQ( gu8_test_rsp[0], ePAR_PROTO_CMD_STREAM );
+
+	flags = gu8_test_rsp[1];
+	TEST_ASSERT_EQ(( 0U != ( flags & TEST_STREAM_FLAG_DELTA )), delta );
+
+	TEST_ASSERT_EQ( gu8_test_rsp[2] | ( gu8_test_rsp[3] << 8U ), gu16_test_seq );
+	gu16_test_seq++;
+
+	TEST_ASSERT_EQ((uint32_t)( gu8_test_rsp[4] | ( gu8_test_rsp[5] << 8U ) | ( gu8_test_rsp[6] << 16U ) | ((uint32_t) gu8_test_rsp[7] << 24U )), gu32_test_ms );
+
+	// Delta frame applies to state of previous frames
+	if ( 0U != ( flags & TEST_STREAM_FLAG_KEY ))
+	{
+		gb_test_mirror_valid = true;
+	}
+
+	TEST_ASSERT( true == gb_test_mirror_valid );
+
+	if ( true == delta )
+	{
+		i += mask_size;
+	}
+
+	for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		const bool present = ( false == delta )
+						  || ( 0U != ( gu8_test_rsp[TEST_STREAM_HEAD + ( par_num / 8U )] & ( 1U << ( par_num % 8U ))));
+
+		if ( true == present )
+		{
+			const uint32_t size = test_type_size( p_table[par_num].type );
+
+			gu32_test_mirror[par_num] = 0;
+			memcpy( &gu32_test_mirror[par_num], &gu8_test_rsp[i], size );
+			i += size;
+		}
+		else
+		{
+			// Key frame carries everything
+			TEST_ASSERT_EQ( flags & TEST_STREAM_FLAG_KEY, 0U );
+		}
+	}
+
+	TEST_ASSERT_EQ( i, gu32_test_rsp_size );
+
+	return flags;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Change random parameters
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_stream_change(const uint32_t changes)
+{
+	for ( uint32_t n = 0; n < changes; n++ )
+	{
+		const par_num_t	par_num = (par_num_t)( test_rand() % ePAR_NUM_OF );
+		const uint32_t	val		= test_rand();
+
+		(void) par_set( par_num, &val );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stream frame decoding, plain and delta
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_stream(void)
+{
+	const uint32_t mask_size = ( ePAR_NUM_OF + 7U ) / 8U;
+
+	TEST_ASSERT( ePAR_NUM_OF <= PAR_PROTO_STREAM_MAX );
+
+	for ( uint32_t mode = 0; mode < 2U; mode++ )
+	{
+		const bool	delta	= ( 1U == mode );
+		uint32_t	keys	= 0;
+
+		test_stream_cfg( ePAR_PROTO_CH_UART_DBG, TEST_STREAM_FLAG_EN | ( delta ? TEST_STREAM_FLAG_DELTA : 0U ));
+
+		// Not due yet
+		par_proto_hndl();
+		TEST_ASSERT( false == test_response( ePAR_PROTO_CH_UART_DBG ));
+
+		for ( uint32_t frame = 0; frame < TEST_STREAM_FRAMES; frame++ )
+		{
+			uint8_t flags = 0;
+
+			// Some frames carry no change at all
+			test_stream_change( test_rand() % 4U );
+
+			test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+			gu32_test_ms += TEST_STREAM_PER_MS;
+			par_proto_hndl();
+
+			TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+			flags = test_stream_decode( delta );
+
+			// Key frames only at key period
+			if ( true == delta )
+			{
+				TEST_ASSERT_EQ(( 0U != ( flags & TEST_STREAM_FLAG_KEY )), ( 0U == ( frame % PAR_PROTO_STREAM_KEY_PERIOD )));
+			}
+			else
+			{
+				TEST_ASSERT_EQ( flags & TEST_STREAM_FLAG_KEY, TEST_STREAM_FLAG_KEY );
+			}
+
+			if ( 0U != ( flags & TEST_STREAM_FLAG_KEY ))
+			{
+				keys++;
+			}
+
+			// Mirror follows device
+			for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+			{
+				uint32_t val = 0;
+
+				(void) par_get( par_num, &val );
+				TEST_ASSERT_EQ( gu32_test_mirror[par_num], val );
+			}
+
+			TEST_ASSERT( false == test_response( ePAR_PROTO_CH_UART_DBG ));
+		}
+
+		TEST_ASSERT_EQ( keys, ( true == delta ) ? ( TEST_STREAM_FRAMES / PAR_PROTO_STREAM_KEY_PERIOD ) : TEST_STREAM_FRAMES );
+
+		// No change, delta frame is header and empty mask
+		if ( true == delta )
+		{
+			while ( 0U == ( gu16_test_seq % PAR_PROTO_STREAM_KEY_PERIOD ))
+			{
+				test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+				gu32_test_ms += TEST_STREAM_PER_MS;
+				par_proto_hndl();
+				TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+				(void) test_stream_decode( delta );
+			}
+
+			test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+			gu32_test_ms += TEST_STREAM_PER_MS;
+			par_proto_hndl();
+
+			TEST_ASSERT( true == test_response( ePAR_PROTO_CH_UART_DBG ));
+			(void) test_stream_decode( delta );
+			TEST_ASSERT_EQ( gu32_test_rsp_size, TEST_STREAM_HEAD + mask_size );
+		}
+	}
+
+	// Stop streaming
+	test_stream_cfg( ePAR_PROTO_CH_UART_DBG, 0U );
+	gu32_test_ms += TEST_STREAM_PER_MS;
+	par_proto_hndl();
+	TEST_ASSERT( false == test_response( ePAR_PROTO_CH_UART_DBG ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Full table read: binary frame vs. text commands
+*
+* @note		Text path is what command line offers: "par_get <id>" per
+* 			parameter, answered by printf and parsed by scanf on host.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	const par_cfg_t * const	p_table					= (const par_cfg_t*) par_cfg_get_table();
+	uint8_t					payload[TEST_FRAME_SIZE]= {0};
+	uint8_t					frame[TEST_FRAME_SIZE]	= {0};
+	char					line[64]				= {0};
+	char					rsp[64]					= {0};
+	uint32_t				val[ePAR_NUM_OF]		= {0};
+	uint32_t				bin_bytes				= 0;
+	uint32_t				txt_bytes				= 0;
+	uint64_t				bin_cycles				= 0;
+	uint64_t				txt_cycles				= 0;
+	uint64_t				start					= 0;
+	uint32_t				errors					= 0;
+
+	test_par_fill( 2UL );
+
+	// Binary
+	start = test_now_cycles();
+
+	for ( uint32_t loop = 0; loop < TEST_BENCH_LOOPS; loop++ )
+	{
+		const uint32_t size	= test_read_all_req( payload );
+		const uint32_t len	= test_frame_build( frame, ePAR_PROTO_CMD_READ, (uint8_t) loop, payload, size );
+
+		test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+		(void) test_feed( ePAR_PROTO_CH_UART_DBG, frame, len );
+
+		if  (   ( false == test_response( ePAR_PROTO_CH_UART_DBG ))
+			||	( ePAR_NUM_OF != test_read_all_rsp( val )))
+		{
+			errors++;
+		}
+
+		bin_bytes = len + g_test_port[ePAR_PROTO_CH_UART_DBG].len;
+	}
+
+	bin_cycles = ( test_now_cycles() - start ) / TEST_BENCH_LOOPS;
+
+	// Text
+	start = test_now_cycles();
+
+	for ( uint32_t loop = 0; loop < TEST_BENCH_LOOPS; loop++ )
+	{
+		txt_bytes = 0;
+
+		for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+		{
+			unsigned	id		= 0;
+			unsigned	rsp_id	= 0;
+			uint32_t	value	= 0;
+			int			len		= 0;
+
+			// Host request
+			len = snprintf( line, sizeof( line ), "par_get %u\r\n", (unsigned) p_table[par_num].id );
+			txt_bytes += (uint32_t) len;
+
+			// Device
+			if ( 1 == sscanf( line, "par_get %u", &id ))
+			{
+				const par_num_t num = par_cfg_get_num_by_id((uint16_t) id );
+
+				(void) par_get( num, &value );
+				len = snprintf( rsp, sizeof( rsp ), "%u = %" PRIu32 "\r\n", id, value );
+				txt_bytes += (uint32_t) len;
+			}
+
+			// Host response
+			if  (   ( 2 != sscanf( rsp, "%u = %" SCNu32, &rsp_id, &val[par_num] ))
+				||	( rsp_id != p_table[par_num].id ))
+			{
+				errors++;
+			}
+		}
+	}
+
+	txt_cycles = ( test_now_cycles() - start ) / TEST_BENCH_LOOPS;
+
+	TEST_ASSERT_EQ( errors, 0U );
+	TEST_ASSERT( bin_bytes < txt_bytes );
+
+	TEST_BENCH( "%u params: binary %4u bytes %7" PRIu64 " cycles, text %4u bytes %7" PRIu64 " cycles per full table read",
+				(unsigned) ePAR_NUM_OF, (unsigned) bin_bytes, bin_cycles, (unsigned) txt_bytes, txt_cycles );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stream bandwidth: text vs. binary vs. delta
+*
+* @note		Text stream is one CSV line of timestamp and all values per
+* 			period, as printed by command line.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench_stream(void)
+{
+	char		line[512]	= {0};
+	uint64_t	bytes[3]	= {0};
+	const char*	name[3]		= { "text", "binary", "delta" };
+
+	for ( uint32_t mode = 0; mode < 3U; mode++ )
+	{
+		gu32_test_rand = 12345UL;
+
+		if ( mode > 0U )
+		{
+			test_stream_cfg( ePAR_PROTO_CH_UART_DBG, TEST_STREAM_FLAG_EN | (( 2U == mode ) ? TEST_STREAM_FLAG_DELTA : 0U ));
+		}
+
+		for ( uint32_t frame = 0; frame < TEST_STREAM_FRAMES; frame++ )
+		{
+			test_stream_change( TEST_STREAM_CHANGES );
+			gu32_test_ms += TEST_STREAM_PER_MS;
+
+			if ( 0U == mode )
+			{
+				int len = snprintf( line, sizeof( line ), "%" PRIu32, gu32_test_ms );
+
+				for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+				{
+					uint32_t val = 0;
+
+					(void) par_get( par_num, &val );
+					len += snprintf( &line[len], sizeof( line ) - (size_t) len, ";%" PRIu32, val );
+				}
+
+				len += snprintf( &line[len], sizeof( line ) - (size_t) len, "\r\n" );
+				bytes[mode] += (uint64_t) len;
+			}
+			else
+			{
+				test_port_reset( ePAR_PROTO_CH_UART_DBG, TEST_PORT_SIZE );
+				par_proto_hndl();
+				bytes[mode] += g_test_port[ePAR_PROTO_CH_UART_DBG].len;
+			}
+		}
+
+		// Bytes per second
+		bytes[mode] = ( bytes[mode] * 1000ULL ) / ( TEST_STREAM_FRAMES * TEST_STREAM_PER_MS );
+
+		TEST_BENCH( "stream %u params every %u ms, %u changed: %-6s %6" PRIu64 " bytes/s, %3" PRIu64 " %% of 115200 baud",
+					(unsigned) ePAR_NUM_OF, (unsigned) TEST_STREAM_PER_MS, (unsigned) TEST_STREAM_CHANGES, name[mode],
+					bytes[mode], (uint64_t)(( bytes[mode] * 100ULL ) / TEST_UART_BYTES_PER_S ));
+	}
+
+	test_stream_cfg( ePAR_PROTO_CH_UART_DBG, 0U );
+
+	TEST_ASSERT( bytes[2] < bytes[1] );
+	TEST_ASSERT( bytes[1] < bytes[0] );
+	TEST_ASSERT( bytes[2] < TEST_UART_BYTES_PER_S );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_init_proto();
+	test_ping();
+	test_read();
+	test_write();
+	test_errors();
+	test_tx_drop();
+	test_stream();
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+		test_bench_stream();
+	}
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
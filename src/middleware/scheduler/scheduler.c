@@ -0,0 +1,549 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      scheduler.c
+*@brief     Cooperative run-to-completion scheduler
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup SCHEDULER
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Tasks are released either periodically or by event posted from ISR
+* 	(sched_post). Ready tasks are executed in order of configuration
+* 	table and each of them runs to completion. When no task is ready CPU
+* 	is put to sleep until next interrupt.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "scheduler.h"
+#include "nrf_atomic.h"
+#include "nrf.h"
+
+#include "middleware/watchdog/wdt_sup.h"
+#include "middleware/journal/journal.h"
+#include "drivers/peripheral/systick/systick.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Compile time checks
+ */
+#if ( eSCHED_TASK_NUM_OF > 32 )
+	#error "Scheduler supports up to 32 tasks!"
+#endif
+
+#if ( 1 == SCHED_CFG_PROFILE_EN )
+
+	/**
+	 * 	Cycles per microsecond
+	 */
+	#define SCHED_CYCLES_PER_US					( SCHED_CFG_CYCLE_FREQ_HZ / 1000000UL )
+
+	/**
+	 * 	Task execution time in cycles
+	 */
+	typedef struct
+	{
+		uint64_t	sum;		/**<Sum of all execution times */
+		uint32_t	min;		/**<Minimum execution time */
+		uint32_t	max;		/**<Maximum execution time */
+	} sched_cycles_t;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *      Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ *      Pointer to configuration table
+ */
+static const sched_cfg_t * gp_cfg_table = NULL;
+
+/**
+ *      Pending events mask
+ *
+ * @note    Bit n set means task n was posted. Written from ISR!
+ */
+static nrf_atomic_u32_t gu32_sched_pending = 0;
+
+/**
+ *      Time of first post of pending event
+ *
+ *  Unit: ms
+ */
+static volatile uint32_t gu32_sched_post_ms[eSCHED_TASK_NUM_OF] = {0};
+
+/**
+ *      Next periodic release time
+ *
+ *  Unit: ms
+ */
+static uint32_t gu32_sched_next_ms[eSCHED_TASK_NUM_OF] = {0};
+
+/**
+ *      Task statistics
+ */
+static sched_stats_t g_sched_stats[eSCHED_TASK_NUM_OF] = {0};
+
+#if ( 1 == SCHED_CFG_PROFILE_EN )
+
+	/**
+	 *      Task execution cycles
+	 */
+	static sched_cycles_t g_sched_cycles[eSCHED_TASK_NUM_OF] = {0};
+
+	/**
+	 *      Busy cycles inside current load window
+	 */
+	static uint32_t gu32_sched_busy_cycles = 0;
+
+	/**
+	 *      Start of current load window
+	 *
+	 *  Unit: ms
+	 */
+	static uint32_t gu32_sched_window_ms = 0;
+
+	/**
+	 *      CPU load of last complete window
+	 *
+	 *  Unit: %
+	 */
+	static float32_t gf32_sched_load = 0.0f;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void sched_run_task  (const sched_task_t task, const uint32_t release_ms, const bool is_event);
+static void sched_sleep     (void);
+
+#if ( 1 == SCHED_CFG_PROFILE_EN )
+	static void sched_profile	(const sched_task_t task, const uint32_t cycles);
+	static void sched_load_hndl	(void);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute task and update its statistics
+*
+* @param[in]	task		- Scheduler task
+* @param[in]	release_ms	- Time of task release
+* @param[in]	is_event	- Task was triggered by posted event
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void sched_run_task(const sched_task_t task, const uint32_t release_ms, const bool is_event)
+{
+	const sched_cfg_t * const p_cfg = &gp_cfg_table[task];
+	sched_stats_t * const p_stats = &g_sched_stats[task];
+
+	const uint32_t start_ms = systick_get_ms();
+
+	#if ( 1 == SCHED_CFG_PROFILE_EN )
+		const uint32_t start_cycles = SCHED_CFG_CYCLE_GET();
+	#endif
+
+	// Run to completion
+	p_cfg->pf_task();
+
+	#if ( 1 == SCHED_CFG_PROFILE_EN )
+		sched_profile( task, (uint32_t)( SCHED_CFG_CYCLE_GET() - start_cycles ));
+	#endif
+
+	const uint32_t end_ms 		= systick_get_ms();
+	const uint32_t latency_ms 	= (uint32_t)( start_ms - release_ms );
+
+	p_stats->runs++;
+
+	if ( true == is_event )
+	{
+		p_stats->events++;
+	}
+
+	if ( latency_ms > p_stats->max_latency_ms )
+	{
+		p_stats->max_latency_ms = latency_ms;
+	}
+
+	if ((uint32_t)( end_ms - release_ms ) > p_cfg->deadline_ms )
+	{
+		p_stats->deadline_miss++;
+		journal_event( eJOURNAL_EVT_DEADLINE, (uint8_t) task );
+	}
+
+	// Task is alive
+	if ( SCHED_CFG_WDT_NONE != p_cfg->wdt_task )
+	{
+		(void) wdt_sup_report( p_cfg->wdt_task );
+	}
+}
+
+#if ( 1 == SCHED_CFG_PROFILE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Accumulate task execution time
+	*
+	* @param[in]	task	- Scheduler task
+	* @param[in]	cycles	- Execution time in cycles
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void sched_profile(const sched_task_t task, const uint32_t cycles)
+	{
+		sched_cycles_t * const p_cycles = &g_sched_cycles[task];
+
+		// First run
+		if ( 0UL == g_sched_stats[task].runs )
+		{
+			p_cycles->min = cycles;
+		}
+
+		p_cycles->sum += cycles;
+
+		if ( cycles < p_cycles->min )
+		{
+			p_cycles->min = cycles;
+		}
+
+		if ( cycles > p_cycles->max )
+		{
+			p_cycles->max = cycles;
+		}
+
+		gu32_sched_busy_cycles += cycles;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Evaluate CPU load at the end of load window
+	*
+	* @note		Load is share of time spent inside tasks. Everything else
+	* 			(sleep, scheduler, watchdog handling) counts as idle.
+	*
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void sched_load_hndl(void)
+	{
+		const uint32_t now_ms 		= systick_get_ms();
+		const uint32_t window_ms 	= (uint32_t)( now_ms - gu32_sched_window_ms );
+
+		if ( window_ms >= SCHED_CFG_LOAD_WINDOW_MS )
+		{
+			const float32_t window_cycles = (float32_t) window_ms * (float32_t)( SCHED_CFG_CYCLE_FREQ_HZ / 1000UL );
+
+			gf32_sched_load = ( 100.0f * (float32_t) gu32_sched_busy_cycles ) / window_cycles;
+
+			gu32_sched_busy_cycles 	= 0UL;
+			gu32_sched_window_ms 	= now_ms;
+		}
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Put CPU to sleep until next event
+*
+* @note		WFE-SEV-WFE sequence clears event register, thus if interrupt
+* 			(or sched_post) happened after ready check, first WFE does not
+* 			sleep and no wake-up is lost.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void sched_sleep(void)
+{
+	#if ( 1 == SCHED_CFG_SLEEP_EN )
+		__WFE();
+		__SEV();
+		__WFE();
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup SCHEDULER_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of scheduler API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization of scheduler
+*
+* @note		Systick must be initialized before!
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+sched_status_t sched_init(void)
+{
+	sched_status_t status = eSCHED_OK;
+
+	if ( false == gb_is_init )
+	{
+		gp_cfg_table = sched_cfg_get_table();
+
+		if ( NULL != gp_cfg_table )
+		{
+			const uint32_t now_ms = systick_get_ms();
+
+			for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+			{
+				SCHED_ASSERT( NULL != gp_cfg_table[task].pf_task );
+
+				gu32_sched_next_ms[task] = now_ms + gp_cfg_table[task].period_ms;
+			}
+
+			#if ( 1 == SCHED_CFG_PROFILE_EN )
+				SCHED_CFG_CYCLE_INIT();
+				gu32_sched_window_ms = now_ms;
+			#endif
+
+			gb_is_init = true;
+		}
+		else
+		{
+			status = eSCHED_ERROR;
+		}
+	}
+	else
+	{
+		status = eSCHED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Scheduler handler
+*
+* @note		Shall be called from main loop. Runs all ready tasks once and
+* 			sleeps if none of them was ready.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void sched_hndl(void)
+{
+	bool is_any_run = false;
+
+	SCHED_ASSERT( true == gb_is_init );
+
+	if ( true == gb_is_init )
+	{
+		// Take all pending events
+		const uint32_t pending = nrf_atomic_u32_fetch_store( &gu32_sched_pending, 0UL );
+
+		for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+		{
+			const uint32_t	now_ms 		= systick_get_ms();
+			const uint32_t	period_ms 	= gp_cfg_table[task].period_ms;
+			const bool		is_event 	= ( 0UL != ( pending & ( 1UL << task )));
+			bool			is_due		= false;
+			uint32_t		release_ms	= now_ms;
+
+			// Periodic release
+			if  (   ( period_ms > 0UL )
+				&&  ((int32_t)( now_ms - gu32_sched_next_ms[task] ) >= 0 ))
+			{
+				is_due 		= true;
+				release_ms 	= gu32_sched_next_ms[task];
+
+				gu32_sched_next_ms[task] += period_ms;
+
+				// Overloaded - skip missed releases instead of bursting
+				if ((int32_t)( now_ms - gu32_sched_next_ms[task] ) >= 0 )
+				{
+					gu32_sched_next_ms[task] = now_ms + period_ms;
+				}
+			}
+			else if ( true == is_event )
+			{
+				release_ms = gu32_sched_post_ms[task];
+			}
+			else
+			{
+				// Not ready...
+			}
+
+			if  (   ( true == is_due )
+				||  ( true == is_event ))
+			{
+				sched_run_task( task, release_ms, is_event );
+				is_any_run = true;
+			}
+		}
+
+		#if ( 1 == SCHED_CFG_PROFILE_EN )
+			sched_load_hndl();
+		#endif
+
+		// Nothing to do - sleep until next interrupt
+		if ( false == is_any_run )
+		{
+			sched_sleep();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Post event to task
+*
+* @note		Safe to call from ISR. Task is executed once from next
+* 			scheduler pass regardless of how many times it was posted.
+*
+* @param[in]	task	- Scheduler task
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+sched_status_t sched_post(const sched_task_t task)
+{
+	sched_status_t status = eSCHED_OK;
+
+	SCHED_ASSERT( task < eSCHED_TASK_NUM_OF );
+
+	if ( task < eSCHED_TASK_NUM_OF )
+	{
+		const uint32_t now_ms = systick_get_ms();
+
+		// Timestamp only first post, used for latency measurement
+		if ( 0UL == ( nrf_atomic_u32_fetch_or( &gu32_sched_pending, ( 1UL << task )) & ( 1UL << task )))
+		{
+			gu32_sched_post_ms[task] = now_ms;
+		}
+
+		// Wake up from sleep
+		__SEV();
+	}
+	else
+	{
+		status = eSCHED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get task statistics
+*
+* @param[in]	task	- Scheduler task
+* @param[out]	p_stats	- Pointer to statistics
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+sched_status_t sched_get_stats(const sched_task_t task, sched_stats_t * const p_stats)
+{
+	sched_status_t status = eSCHED_OK;
+
+	SCHED_ASSERT( true == gb_is_init );
+	SCHED_ASSERT( task < eSCHED_TASK_NUM_OF );
+	SCHED_ASSERT( NULL != p_stats );
+
+	if  (   ( true == gb_is_init )
+		&&  ( task < eSCHED_TASK_NUM_OF )
+		&&  ( NULL != p_stats ))
+	{
+		*p_stats = g_sched_stats[task];
+
+		#if ( 1 == SCHED_CFG_PROFILE_EN )
+			const sched_cycles_t * const p_cycles = &g_sched_cycles[task];
+
+			p_stats->exec_min_us = p_cycles->min / SCHED_CYCLES_PER_US;
+			p_stats->exec_max_us = p_cycles->max / SCHED_CYCLES_PER_US;
+
+			if ( p_stats->runs > 0UL )
+			{
+				p_stats->exec_avg_us = (uint32_t)(( p_cycles->sum / p_stats->runs ) / SCHED_CYCLES_PER_US );
+			}
+		#endif
+	}
+	else
+	{
+		status = eSCHED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get CPU load
+*
+* @note		Evaluated over last SCHED_CFG_LOAD_WINDOW_MS window. Idle
+* 			fraction is 100 % - load.
+*
+* @param[out]	p_load	- Pointer to CPU load. Unit: %
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+sched_status_t sched_get_load(float32_t * const p_load)
+{
+	sched_status_t status = eSCHED_OK;
+
+	SCHED_ASSERT( true == gb_is_init );
+	SCHED_ASSERT( NULL != p_load );
+
+	if  (   ( true == gb_is_init )
+		&&  ( NULL != p_load ))
+	{
+		#if ( 1 == SCHED_CFG_PROFILE_EN )
+			*p_load = gf32_sched_load;
+		#else
+			*p_load = 0.0f;
+			status = eSCHED_ERROR;
+		#endif
+	}
+	else
+	{
+		status = eSCHED_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
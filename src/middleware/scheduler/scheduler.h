@@ -0,0 +1,74 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      scheduler.h
+*@brief     Cooperative run-to-completion scheduler
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup SCHEDULER
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Cooperative run-to-completion scheduler
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "scheduler_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Scheduler status
+ */
+typedef enum
+{
+	eSCHED_OK = 0,		/**<Normal operation */
+	eSCHED_ERROR,		/**<General error code */
+} sched_status_t;
+
+/**
+ * 	Scheduler task statistics
+ */
+typedef struct
+{
+	uint32_t	runs;				/**<Number of task executions */
+	uint32_t	events;				/**<Number of executions triggered by posted event */
+	uint32_t	deadline_miss;		/**<Number of executions finished after deadline */
+	uint32_t	max_latency_ms;		/**<Maximum delay from release to start (jitter). Unit: ms */
+	uint32_t	exec_min_us;		/**<Minimum execution time. Unit: us */
+	uint32_t	exec_avg_us;		/**<Average execution time. Unit: us */
+	uint32_t	exec_max_us;		/**<Maximum execution time. Unit: us */
+} sched_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+sched_status_t	sched_init		(void);
+void			sched_hndl		(void);
+sched_status_t	sched_post		(const sched_task_t task);
+sched_status_t	sched_get_stats	(const sched_task_t task, sched_stats_t * const p_stats);
+sched_status_t	sched_get_load	(float32_t * const p_load);
+
+#endif // __SCHEDULER_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
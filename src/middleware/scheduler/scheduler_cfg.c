@@ -0,0 +1,78 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      scheduler_cfg.c
+*@brief     Scheduler configurations
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup SCHEDULER_CONFIGURATIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Put code that is platform depended inside code block start with
+* 	"USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "scheduler_cfg.h"
+
+// USER CODE BEGIN...
+
+#include "application/app.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *      Scheduler task definitions
+ */
+static const sched_cfg_t g_sched_cfg_table[eSCHED_TASK_NUM_OF] =
+{
+    // USER CODE BEGIN...
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------
+	//                          Task function                   Task name                   Period [ms]             Deadline [ms]       Watchdog task
+	// ------------------------------------------------------------------------------------------------------------------------------------------
+
+	[eSCHED_TASK_COMM]      = { .pf_task = app_hndl_comm,       .p_name = "Communication",  .period_ms = 10UL,      .deadline_ms = 5UL,     .wdt_task = eWDT_TASK_COMM     },
+	[eSCHED_TASK_10MS]      = { .pf_task = app_hndl_10ms,       .p_name = "App 10ms",       .period_ms = 10UL,      .deadline_ms = 10UL,    .wdt_task = eWDT_TASK_MAIN     },
+	[eSCHED_TASK_100MS]     = { .pf_task = app_hndl_100ms,      .p_name = "App 100ms",      .period_ms = 100UL,     .deadline_ms = 50UL,    .wdt_task = eWDT_TASK_100MS    },
+	[eSCHED_TASK_1000MS]    = { .pf_task = app_hndl_1000ms,     .p_name = "App 1000ms",     .period_ms = 1000UL,    .deadline_ms = 100UL,   .wdt_task = eWDT_TASK_1000MS   },
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------
+
+    // USER CODE END...
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get scheduler configuration table
+*
+* @return		pointer to configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const sched_cfg_t * sched_cfg_get_table(void)
+{
+    return (const sched_cfg_t*) &g_sched_cfg_table;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,161 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      scheduler_cfg.h
+*@brief     Scheduler configurations
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup SCHEDULER_CONFIGURATIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Put code that is platform depended inside code block start with
+* 	"USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __SCHEDULER_CFG_H
+#define __SCHEDULER_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+// USER CODE BEGIN...
+
+#include "project_config.h"
+#include "nrf.h"
+
+// Watchdog tasks
+#include "middleware/watchdog/wdt_cfg.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 		Scheduler task list
+ *
+ * @note	Sequence of tasks dictates priority, first task has highest
+ * 			priority! Maximum number of tasks is 32.
+ */
+typedef enum
+{
+	// USER CODE BEGIN...
+
+	eSCHED_TASK_COMM = 0,		/**<Communication (CLI, USB CDC, UART) */
+	eSCHED_TASK_10MS,			/**<Application 10ms task */
+	eSCHED_TASK_100MS,			/**<Application 100ms task */
+	eSCHED_TASK_1000MS,			/**<Application 1000ms task */
+
+	// USER CODE END...
+
+	eSCHED_TASK_NUM_OF
+} sched_task_t;
+
+/**
+ * 		Scheduler task configuration
+ */
+typedef struct
+{
+	void 		(*pf_task)(void);	/**<Task function */
+	const char* p_name;				/**<Task name */
+	uint32_t	period_ms;			/**<Release period, 0 for event only task. Unit: ms */
+	uint32_t	deadline_ms;		/**<Deadline relative to release. Unit: ms */
+	wdt_task_t	wdt_task;			/**<Watchdog task reported on each run, SCHED_CFG_WDT_NONE to skip */
+} sched_cfg_t;
+
+/**
+ * 	No watchdog task
+ */
+#define SCHED_CFG_WDT_NONE						( eWDT_TASK_NUM_OF )
+
+/**
+ * 	Enable/Disable sleep (WFE) when no task is ready
+ *
+ * @note	Systick interrupt wakes up CPU each 1 ms at latest.
+ */
+#define SCHED_CFG_SLEEP_EN						( 1 )
+
+/**
+ * 	Enable/Disable task execution profiling
+ */
+#define SCHED_CFG_PROFILE_EN					( 1 )
+
+#if ( 1 == SCHED_CFG_PROFILE_EN )
+
+	// USER CODE BEGIN...
+
+	/**
+	 * 	Cycle counter frequency
+	 *
+	 * 	Unit: Hz
+	 */
+	#define SCHED_CFG_CYCLE_FREQ_HZ				( 64000000UL )
+
+	/**
+	 * 	Cycle counter access
+	 *
+	 * @note	On target DWT cycle counter is used. Host builds are
+	 * 			selected automatically and use mock clock provided by
+	 * 			sched_cfg_cycle_get().
+	 */
+	#if defined( __arm__ )
+		#define SCHED_CFG_CYCLE_INIT()			{ CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+												  DWT->CYCCNT = 0UL; \
+												  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; }
+		#define SCHED_CFG_CYCLE_GET()			( DWT->CYCCNT )
+	#else
+		#define SCHED_CFG_CYCLE_INIT()			{ ; }
+		#define SCHED_CFG_CYCLE_GET()			( sched_cfg_cycle_get())
+	#endif
+
+	// USER CODE END...
+
+	/**
+	 * 	CPU load evaluation window
+	 *
+	 * 	Unit: ms
+	 */
+	#define SCHED_CFG_LOAD_WINDOW_MS			( 1000UL )
+
+#endif
+
+/**
+ * 	Enable/Disable assertions
+ */
+#define SCHED_CFG_ASSERT_EN						( 1 )
+
+/**
+ * 	 Assertion macros
+ */
+#if ( 1 == SCHED_CFG_ASSERT_EN )
+	#define SCHED_ASSERT(x)						PROJECT_CONFIG_ASSERT(x)
+#else
+	#define SCHED_ASSERT(x)						{ ; }
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+const sched_cfg_t * sched_cfg_get_table(void);
+
+#if (( 1 == SCHED_CFG_PROFILE_EN ) && !defined( __arm__ ))
+	uint32_t sched_cfg_cycle_get(void);
+#endif
+
+#endif // __SCHEDULER_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,6 @@
+# Scheduler on simulated CPU, systick and UART ISR posting events
+SCHED_DIR := $(ROOT)/src/middleware/scheduler
+
+TESTS += scheduler
+
+scheduler_SRC	:= $(SCHED_DIR)/test/test_scheduler.c $(SCHED_DIR)/scheduler.c $(SCHED_DIR)/scheduler_cfg.c
@@ -0,0 +1,816 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_scheduler.c
+*@brief     Cooperative scheduler host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup SCHEDULER_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Scheduler runs with real configuration table on simulated CPU. Time
+* 	is counted in CPU cycles and systick is derived from it, tasks
+* 	consume configured execution time, WFE sleeps until next systick
+* 	or UART ISR and ISR posts communication events at pseudo-random
+* 	times.
+*
+* 	Task start times are taken by test itself and compared with
+* 	scheduler statistics: latency, jitter, event and deadline miss
+* 	counts. Execution times and sleep time are compared with profiling
+* 	done on fake cycle counter, which wraps during test.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <math.h>
+
+#include "test.h"
+#include "nrf.h"
+#include "middleware/scheduler/scheduler.h"
+#include "middleware/watchdog/wdt_sup.h"
+#include "middleware/journal/journal.h"
+#include "application/app.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated CPU cycles per ms and us
+ */
+#define TEST_SCHED_CYCLES_MS			((uint64_t)( SCHED_CFG_CYCLE_FREQ_HZ / 1000UL ))
+#define TEST_SCHED_CYCLES_US			((uint64_t)( SCHED_CFG_CYCLE_FREQ_HZ / 1000000UL ))
+
+/**
+ * 	UART ISR post interval range
+ *
+ * 	Unit: us
+ */
+#define TEST_SCHED_ISR_MIN_US			( 200UL )
+#define TEST_SCHED_ISR_MAX_US			( 4000UL )
+
+/**
+ * 	Simulated start time
+ *
+ * @note	On systick boundary, 32-bit cycle counter wraps about
+ * 			1.5 s after start.
+ *
+ * 	Unit: cycle
+ */
+#define TEST_SCHED_START				(((( 1ULL << 32 ) / TEST_SCHED_CYCLES_MS ) - 1500ULL ) * TEST_SCHED_CYCLES_MS )
+
+/**
+ * 	Overloaded 100 ms task execution time
+ *
+ * @note	Above its 50 ms deadline and over several 10 ms periods.
+ *
+ * 	Unit: us
+ */
+#define TEST_SCHED_LONG_US				( 60000UL )
+
+/**
+ * 	Task record taken by test
+ */
+typedef struct
+{
+	uint32_t	runs;			/**<Number of executions */
+	uint32_t	lat_min_us;		/**<Min start offset from period grid. Unit: us */
+	uint32_t	lat_max_us;		/**<Max start offset from period grid. Unit: us */
+	uint64_t	last_start;		/**<Start of last execution. Unit: cycle */
+	uint64_t	min_interval;	/**<Min interval between starts. Unit: cycle */
+} test_sched_rec_t;
+
+/**
+ * 	Task execution times consumed by test
+ */
+typedef struct
+{
+	uint64_t	sum_us;			/**<Sum of execution times. Unit: us */
+	uint32_t	min_us;			/**<Min execution time. Unit: us */
+	uint32_t	max_us;			/**<Max execution time. Unit: us */
+	uint32_t	runs;			/**<Number of executions */
+} test_sched_exec_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated time
+ *
+ * 	Unit: cycle
+ */
+static uint64_t gu64_test_now = TEST_SCHED_START;
+
+/**
+ * 	Time of scheduler init, start of period grid
+ *
+ * 	Unit: cycle
+ */
+static uint64_t gu64_test_t0 = 0;
+
+/**
+ * 	Event register
+ */
+static bool gb_test_event = false;
+
+/**
+ * 	Time spent in WFE sleep
+ *
+ * 	Unit: cycle
+ */
+static uint64_t gu64_test_sleep = 0;
+
+/**
+ * 	Task execution time
+ *
+ * 	Unit: us
+ */
+static uint32_t gu32_test_exec_us[eSCHED_TASK_NUM_OF] =
+{
+	[eSCHED_TASK_COMM]		= 100UL,
+	[eSCHED_TASK_10MS]		= 300UL,
+	[eSCHED_TASK_100MS]		= 1000UL,
+	[eSCHED_TASK_1000MS]	= 2000UL,
+};
+
+/**
+ * 	Execution time variation of 10 ms task, alternating +/-
+ *
+ * 	Unit: us
+ */
+static uint32_t gu32_test_exec_var_us = 0;
+
+/**
+ * 	Next 100 ms task run is overloaded
+ */
+static bool gb_test_long = false;
+
+/**
+ * 	End of overloaded run
+ *
+ * 	Unit: cycle
+ */
+static uint64_t gu64_test_long_end = 0;
+
+/**
+ * 	Task records
+ */
+static test_sched_rec_t g_test_rec[eSCHED_TASK_NUM_OF] = {0};
+
+/**
+ * 	Execution times since init
+ */
+static test_sched_exec_t g_test_exec[eSCHED_TASK_NUM_OF] = {0};
+
+/**
+ * 	UART ISR simulation
+ */
+static bool		gb_test_isr_en		= false;
+static uint64_t	gu64_test_isr_next	= 0;
+static uint32_t	gu32_test_rng		= 0x12345678UL;
+static uint32_t	gu32_test_posts		= 0;
+
+/**
+ * 	Event latency, from first post to start of communication task
+ */
+static bool		gb_test_posted		= false;
+static uint64_t	gu64_test_post_time	= 0;
+static uint32_t	gu32_test_evt_runs	= 0;
+static uint32_t	gu32_test_evt_min_us = UINT32_MAX;
+static uint32_t	gu32_test_evt_max_us = 0;
+
+/**
+ * 	Watchdog reports and journal deadline events
+ */
+static uint32_t gu32_test_wdt_report[eWDT_TASK_NUM_OF]		= {0};
+static uint32_t gu32_test_deadline_evt[eSCHED_TASK_NUM_OF]	= {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Systick stand-in, derived from simulated time
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return (uint32_t)( gu64_test_now / TEST_SCHED_CYCLES_MS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cycle counter stand-in, 32-bit as DWT
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t sched_cfg_cycle_get(void)
+{
+	return (uint32_t) gu64_test_now;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Watchdog supervisor stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+wdt_status_t wdt_sup_report(const wdt_task_t task)
+{
+	TEST_ASSERT( task < eWDT_TASK_NUM_OF );
+
+	if ( task < eWDT_TASK_NUM_OF )
+	{
+		gu32_test_wdt_report[task]++;
+	}
+
+	return eWDT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Journal stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+void journal_event(const uint16_t id, const uint8_t arg)
+{
+	TEST_ASSERT_EQ( id, eJOURNAL_EVT_DEADLINE );
+	TEST_ASSERT( arg < eSCHED_TASK_NUM_OF );
+
+	if ( arg < eSCHED_TASK_NUM_OF )
+	{
+		gu32_test_deadline_evt[arg]++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Schedule next UART ISR
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_isr_next(void)
+{
+	gu32_test_rng = ( gu32_test_rng * 1664525UL ) + 1013904223UL;
+
+	gu64_test_isr_next += ( TEST_SCHED_ISR_MIN_US + (( gu32_test_rng >> 8 ) % ( TEST_SCHED_ISR_MAX_US - TEST_SCHED_ISR_MIN_US ))) * TEST_SCHED_CYCLES_US;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		UART ISR, posts communication event
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_isr(void)
+{
+	if ( false == gb_test_posted )
+	{
+		gb_test_posted		= true;
+		gu64_test_post_time	= gu64_test_now;
+	}
+
+	gu32_test_posts++;
+	TEST_ASSERT_EQ( sched_post( eSCHED_TASK_COMM ), eSCHED_OK );
+
+	test_sched_isr_next();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance simulated time, serving ISRs on the way
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_advance(const uint64_t cycles)
+{
+	const uint64_t end = gu64_test_now + cycles;
+
+	while (( true == gb_test_isr_en ) && ( gu64_test_isr_next <= end ))
+	{
+		gu64_test_now = gu64_test_isr_next;
+		test_sched_isr();
+	}
+
+	gu64_test_now = end;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for event
+*
+* @note		Returns at once if event register is set, otherwise sleeps
+* 			until next systick or UART ISR.
+*/
+////////////////////////////////////////////////////////////////////////////////
+void __WFE(void)
+{
+	if ( true == gb_test_event )
+	{
+		gb_test_event = false;
+	}
+	else
+	{
+		const uint64_t start	= gu64_test_now;
+		const uint64_t tick		= (( gu64_test_now / TEST_SCHED_CYCLES_MS ) + 1ULL ) * TEST_SCHED_CYCLES_MS;
+
+		if (( true == gb_test_isr_en ) && ( gu64_test_isr_next < tick ))
+		{
+			gu64_test_now = gu64_test_isr_next;
+			test_sched_isr();
+		}
+		else
+		{
+			gu64_test_now = tick;
+		}
+
+		gu64_test_sleep += ( gu64_test_now - start );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Send event
+*/
+////////////////////////////////////////////////////////////////////////////////
+void __SEV(void)
+{
+	gb_test_event = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Simulated task body
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_task(const sched_task_t task)
+{
+	test_sched_rec_t * const	p_rec		= &g_test_rec[task];
+	test_sched_exec_t * const	p_exec		= &g_test_exec[task];
+	const uint64_t				period		= sched_cfg_get_table()[task].period_ms * TEST_SCHED_CYCLES_MS;
+	const uint32_t				lat_us		= (uint32_t)((( gu64_test_now - gu64_test_t0 ) % period ) / TEST_SCHED_CYCLES_US );
+	uint32_t					exec_us		= gu32_test_exec_us[task];
+
+	if ( p_rec->runs > 0UL )
+	{
+		const uint64_t interval = gu64_test_now - p_rec->last_start;
+
+		if ( interval < p_rec->min_interval )
+		{
+			p_rec->min_interval = interval;
+		}
+	}
+
+	if ( lat_us < p_rec->lat_min_us )
+	{
+		p_rec->lat_min_us = lat_us;
+	}
+
+	if ( lat_us > p_rec->lat_max_us )
+	{
+		p_rec->lat_max_us = lat_us;
+	}
+
+	p_rec->last_start = gu64_test_now;
+	p_rec->runs++;
+
+	// Posted event is consumed by this run
+	if (( eSCHED_TASK_COMM == task ) && ( true == gb_test_posted ))
+	{
+		const uint32_t evt_us = (uint32_t)(( gu64_test_now - gu64_test_post_time ) / TEST_SCHED_CYCLES_US );
+
+		gb_test_posted = false;
+		gu32_test_evt_runs++;
+
+		if ( evt_us < gu32_test_evt_min_us )
+		{
+			gu32_test_evt_min_us = evt_us;
+		}
+
+		if ( evt_us > gu32_test_evt_max_us )
+		{
+			gu32_test_evt_max_us = evt_us;
+		}
+	}
+
+	if (( eSCHED_TASK_100MS == task ) && ( true == gb_test_long ))
+	{
+		gb_test_long	= false;
+		exec_us			= TEST_SCHED_LONG_US;
+	}
+
+	if ( eSCHED_TASK_10MS == task )
+	{
+		exec_us = ( 0UL == ( p_rec->runs & 1UL )) ? ( exec_us - gu32_test_exec_var_us ) : ( exec_us + gu32_test_exec_var_us );
+	}
+
+	p_exec->sum_us += exec_us;
+	p_exec->min_us = (( 0UL == p_exec->runs ) || ( exec_us < p_exec->min_us )) ? exec_us : p_exec->min_us;
+	p_exec->max_us = ( exec_us > p_exec->max_us ) ? exec_us : p_exec->max_us;
+	p_exec->runs++;
+
+	test_sched_advance((uint64_t) exec_us * TEST_SCHED_CYCLES_US );
+
+	if ( TEST_SCHED_LONG_US == exec_us )
+	{
+		gu64_test_long_end = gu64_test_now;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Application task stand-ins used by configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+void app_hndl_comm(void)	{ test_sched_task( eSCHED_TASK_COMM ); }
+void app_hndl_10ms(void)	{ test_sched_task( eSCHED_TASK_10MS ); }
+void app_hndl_100ms(void)	{ test_sched_task( eSCHED_TASK_100MS ); }
+void app_hndl_1000ms(void)	{ test_sched_task( eSCHED_TASK_1000MS ); }
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear task records
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_rec_clear(void)
+{
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		g_test_rec[task].runs			= 0;
+		g_test_rec[task].lat_min_us		= UINT32_MAX;
+		g_test_rec[task].lat_max_us		= 0;
+		g_test_rec[task].min_interval	= UINT64_MAX;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Main loop for given time
+*
+* @note		Ends few ms after ms boundary so that releases at that
+* 			boundary are completed.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_run(const uint32_t ms)
+{
+	const uint64_t end = gu64_test_t0 + ((((( gu64_test_now - gu64_test_t0 ) / TEST_SCHED_CYCLES_MS ) + ms ) + 5ULL ) * TEST_SCHED_CYCLES_MS );
+
+	while ( gu64_test_now < end )
+	{
+		sched_hndl();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get scheduler statistics of all tasks
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_stats(sched_stats_t * const p_stats)
+{
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		TEST_ASSERT_EQ( sched_get_stats( task, &p_stats[task] ), eSCHED_OK );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Report per task latency and jitter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sched_bench(const char * const p_phase, const sched_stats_t * const p_stats)
+{
+	if ( true == test_bench_en())
+	{
+		for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+		{
+			TEST_BENCH( "%-6s %-14s runs %5u  latency max %3u ms  jitter %5u us  deadline miss %u",
+						p_phase, sched_cfg_get_table()[task].p_name, (unsigned) g_test_rec[task].runs,
+						(unsigned) p_stats[task].max_latency_ms,
+						(unsigned)(( g_test_rec[task].runs > 0UL ) ? ( g_test_rec[task].lat_max_us - g_test_rec[task].lat_min_us ) : 0UL ),
+						(unsigned) p_stats[task].deadline_miss );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init_sched(void)
+{
+	sched_stats_t	stats	= {0};
+	float32_t		load	= -1.0f;
+
+	gu64_test_t0 = gu64_test_now;
+
+	TEST_ASSERT_EQ( sched_init(), eSCHED_OK );
+	TEST_ASSERT_EQ( sched_init(), eSCHED_ERROR );
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		TEST_ASSERT_EQ( sched_get_stats( task, &stats ), eSCHED_OK );
+		TEST_ASSERT_EQ( stats.runs, 0 );
+		TEST_ASSERT_EQ( stats.exec_min_us, 0 );
+		TEST_ASSERT_EQ( stats.exec_avg_us, 0 );
+		TEST_ASSERT_EQ( stats.exec_max_us, 0 );
+	}
+
+	// No complete load window yet
+	TEST_ASSERT_EQ( sched_get_load( &load ), eSCHED_OK );
+	TEST_ASSERT( 0.0f == load );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Periodic releases only
+*
+* @note		Releases are on systick boundary and tasks in same pass run
+* 			by priority, thus start of task is delayed by exact sum of
+* 			higher priority execution times, every period.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_periodic(void)
+{
+	sched_stats_t	stats[eSCHED_TASK_NUM_OF]	= {0};
+	uint32_t		before_us					= 0;
+
+	test_sched_rec_clear();
+	test_sched_run( 2000UL );
+	test_sched_stats( stats );
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		const sched_cfg_t * const p_cfg = &sched_cfg_get_table()[task];
+
+		TEST_ASSERT_EQ( stats[task].runs, 2000UL / p_cfg->period_ms );
+		TEST_ASSERT_EQ( g_test_rec[task].runs, stats[task].runs );
+		TEST_ASSERT_EQ( stats[task].events, 0 );
+		TEST_ASSERT_EQ( stats[task].deadline_miss, 0 );
+
+		// Latency and jitter
+		TEST_ASSERT_EQ( g_test_rec[task].lat_min_us, before_us );
+		TEST_ASSERT_EQ( g_test_rec[task].lat_max_us, before_us );
+		TEST_ASSERT_EQ( stats[task].max_latency_ms, before_us / 1000UL );
+		TEST_ASSERT_EQ( g_test_rec[task].min_interval, p_cfg->period_ms * TEST_SCHED_CYCLES_MS );
+
+		before_us += gu32_test_exec_us[task];
+	}
+
+	test_sched_bench( "period", stats );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Events posted from ISR
+*
+* @note		Each run of communication task consumes all posts before its
+* 			start. Sleeping CPU is woken up at once, otherwise event waits
+* 			at most one scheduler pass.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_events(void)
+{
+	sched_stats_t	before[eSCHED_TASK_NUM_OF]	= {0};
+	sched_stats_t	stats[eSCHED_TASK_NUM_OF]	= {0};
+	uint32_t		pass_us						= 0;
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		pass_us += gu32_test_exec_us[task];
+	}
+
+	test_sched_stats( before );
+	test_sched_rec_clear();
+
+	gb_test_isr_en		= true;
+	gu64_test_isr_next	= gu64_test_now;
+	test_sched_isr_next();
+
+	test_sched_run( 3000UL );
+
+	gb_test_isr_en = false;
+	test_sched_stats( stats );
+
+	// Events
+	TEST_ASSERT( gu32_test_evt_runs > 500UL );
+	TEST_ASSERT( gu32_test_posts >= gu32_test_evt_runs );
+	TEST_ASSERT( gu32_test_posts <= ( gu32_test_evt_runs + (uint32_t) gb_test_posted + 20UL ));
+	TEST_ASSERT_EQ( stats[eSCHED_TASK_COMM].events - before[eSCHED_TASK_COMM].events, gu32_test_evt_runs );
+	TEST_ASSERT( g_test_rec[eSCHED_TASK_COMM].runs > ( 3000UL / sched_cfg_get_table()[eSCHED_TASK_COMM].period_ms ));
+
+	// Event latency
+	TEST_ASSERT_EQ( gu32_test_evt_min_us, 0 );
+	TEST_ASSERT( gu32_test_evt_max_us < pass_us );
+	TEST_ASSERT( stats[eSCHED_TASK_COMM].max_latency_ms <= (( gu32_test_evt_max_us + 999UL ) / 1000UL ));
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		const sched_cfg_t * const p_cfg = &sched_cfg_get_table()[task];
+
+		TEST_ASSERT_EQ( stats[task].deadline_miss, 0 );
+
+		if ( eSCHED_TASK_COMM != task )
+		{
+			// Periodic releases are not disturbed, only delayed
+			TEST_ASSERT_EQ( stats[task].events, 0 );
+			TEST_ASSERT_EQ( stats[task].runs - before[task].runs, 3000UL / p_cfg->period_ms );
+			TEST_ASSERT(( g_test_rec[task].lat_max_us - g_test_rec[task].lat_min_us ) < pass_us );
+			TEST_ASSERT( stats[task].max_latency_ms <= ( pass_us / 1000UL ) + 1UL );
+		}
+	}
+
+	if ( true == test_bench_en())
+	{
+		TEST_BENCH( "event  posts %u  runs %u  latency min %u us  max %u us",
+					(unsigned) gu32_test_posts, (unsigned) gu32_test_evt_runs,
+					(unsigned) gu32_test_evt_min_us, (unsigned) gu32_test_evt_max_us );
+	}
+
+	test_sched_bench( "event", stats );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Overloaded task
+*
+* @note		Single 100 ms task run longer than its deadline blocks higher
+* 			priority tasks for several periods. Each blocked task misses
+* 			deadline once and its missed releases are skipped, not
+* 			executed in a burst.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_deadline(void)
+{
+	sched_stats_t	before[eSCHED_TASK_NUM_OF]	= {0};
+	sched_stats_t	stats[eSCHED_TASK_NUM_OF]	= {0};
+	const uint32_t	exp[eSCHED_TASK_NUM_OF]		=
+	{
+		[eSCHED_TASK_COMM]		= 1UL,
+		[eSCHED_TASK_10MS]		= 1UL,
+		[eSCHED_TASK_100MS]		= 1UL,
+		[eSCHED_TASK_1000MS]	= 0UL,
+	};
+
+	test_sched_stats( before );
+	test_sched_rec_clear();
+
+	gb_test_long = true;
+	test_sched_run( 300UL );
+
+	test_sched_stats( stats );
+
+	TEST_ASSERT( false == gb_test_long );
+	TEST_ASSERT( gu64_test_long_end > 0ULL );
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		TEST_ASSERT_EQ( stats[task].deadline_miss - before[task].deadline_miss, exp[task] );
+		TEST_ASSERT_EQ( gu32_test_deadline_evt[task], stats[task].deadline_miss );
+	}
+
+	// Blocked for whole overloaded run
+	TEST_ASSERT( stats[eSCHED_TASK_10MS].max_latency_ms >= (( TEST_SCHED_LONG_US / 1000UL ) - 10UL ));
+	TEST_ASSERT( stats[eSCHED_TASK_COMM].max_latency_ms >= (( TEST_SCHED_LONG_US / 1000UL ) - 10UL ));
+
+	// No burst after overload
+	TEST_ASSERT( g_test_rec[eSCHED_TASK_COMM].min_interval >= ( 9ULL * TEST_SCHED_CYCLES_MS ));
+	TEST_ASSERT( g_test_rec[eSCHED_TASK_10MS].min_interval >= ( 9ULL * TEST_SCHED_CYCLES_MS ));
+	TEST_ASSERT( g_test_rec[eSCHED_TASK_10MS].runs < ( 300UL / 10UL ));
+
+	test_sched_bench( "ovrld", stats );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execution time profiling and CPU load
+*
+* @note		Load is share of task execution time inside window, all the
+* 			rest is spent in WFE on simulated CPU. Thus load and measured
+* 			idle fraction must add up to 100 %.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_profile(void)
+{
+	const uint32_t	exec_us[eSCHED_TASK_NUM_OF] =
+	{
+		[eSCHED_TASK_COMM]		= 1000UL,
+		[eSCHED_TASK_10MS]		= 2000UL,
+		[eSCHED_TASK_100MS]		= 1000UL,
+		[eSCHED_TASK_1000MS]	= 2000UL,
+	};
+	sched_stats_t	stats[eSCHED_TASK_NUM_OF]	= {0};
+	float32_t		load						= 0.0f;
+	float32_t		exp_load					= 0.0f;
+	uint64_t		sleep						= 0;
+	uint64_t		start						= 0;
+	float32_t		idle						= 0.0f;
+
+	// Higher load, 10 ms task varies around its average
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		gu32_test_exec_us[task] = exec_us[task];
+		exp_load += ( 100.0f * (float32_t) exec_us[task] ) / ( 1000.0f * (float32_t) sched_cfg_get_table()[task].period_ms );
+	}
+
+	gu32_test_exec_var_us = 500UL;
+
+	// Settle one window, measure idle over last one
+	test_sched_run( SCHED_CFG_LOAD_WINDOW_MS );
+
+	sleep = gu64_test_sleep;
+	start = gu64_test_now;
+
+	test_sched_run( SCHED_CFG_LOAD_WINDOW_MS );
+
+	idle = ( 100.0f * (float32_t)( gu64_test_sleep - sleep )) / (float32_t)( gu64_test_now - start );
+
+	TEST_ASSERT_EQ( sched_get_load( &load ), eSCHED_OK );
+	TEST_ASSERT( fabsf( load - exp_load ) < 0.3f );
+	TEST_ASSERT( fabsf(( 100.0f - load ) - idle ) < 0.3f );
+
+	// Min/avg/max over whole test, 32-bit counter has wrapped
+	TEST_ASSERT( gu64_test_now > ( 1ULL << 32 ));
+	test_sched_stats( stats );
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		const test_sched_exec_t * const p_exec = &g_test_exec[task];
+
+		TEST_ASSERT_EQ( p_exec->runs, stats[task].runs );
+		TEST_ASSERT_EQ( stats[task].exec_min_us, p_exec->min_us );
+		TEST_ASSERT_EQ( stats[task].exec_max_us, p_exec->max_us );
+		TEST_ASSERT_EQ( stats[task].exec_avg_us, p_exec->sum_us / p_exec->runs );
+	}
+
+	TEST_ASSERT_EQ( stats[eSCHED_TASK_10MS].exec_min_us, 300UL );
+	TEST_ASSERT_EQ( stats[eSCHED_TASK_10MS].exec_max_us, 2500UL );
+	TEST_ASSERT_EQ( stats[eSCHED_TASK_100MS].exec_max_us, TEST_SCHED_LONG_US );
+
+	if ( true == test_bench_en())
+	{
+		for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+		{
+			TEST_BENCH( "prof   %-14s exec min %5u us  avg %5u us  max %5u us",
+						sched_cfg_get_table()[task].p_name, (unsigned) stats[task].exec_min_us,
+						(unsigned) stats[task].exec_avg_us, (unsigned) stats[task].exec_max_us );
+		}
+
+		TEST_BENCH( "prof   load %.2f %% (expected %.2f %%), idle %.2f %%", load, exp_load, idle );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Every run reports its watchdog task
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_wdt(void)
+{
+	sched_stats_t	stats[eSCHED_TASK_NUM_OF]	= {0};
+	uint32_t		exp[eWDT_TASK_NUM_OF]		= {0};
+
+	test_sched_stats( stats );
+
+	for ( uint32_t task = 0; task < eSCHED_TASK_NUM_OF; task++ )
+	{
+		const wdt_task_t wdt_task = sched_cfg_get_table()[task].wdt_task;
+
+		if ( SCHED_CFG_WDT_NONE != wdt_task )
+		{
+			exp[wdt_task] += stats[task].runs;
+		}
+	}
+
+	TEST_ASSERT_EQ( memcmp( exp, gu32_test_wdt_report, sizeof( exp )), 0 );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_init_sched();
+	test_periodic();
+	test_events();
+	test_deadline();
+	test_profile();
+	test_wdt();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,411 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      spsc_fifo.c
+*@brief     Lock-free single producer single consumer byte FIFO
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup SPSC_FIFO
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Own index is read plainly, index of other side is read with acquire
+* 	and own index is published with release ordering. On Cortex-M4 this
+* 	results in plain load/store plus DMB, data copy is always done
+* 	before index update becomes visible.
+*
+* 	Apart from init, functions do not check arguments as they are meant
+* 	for interrupt paths. FIFO must be initialized before use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <string.h>
+
+#include "spsc_fifo.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Index access of other side
+ */
+#define SPSC_FIFO_LOAD(idx)					( __atomic_load_n( &(idx), __ATOMIC_ACQUIRE ))
+
+/**
+ * 	Publish own index
+ */
+#define SPSC_FIFO_STORE(idx,val)			( __atomic_store_n( &(idx), (val), __ATOMIC_RELEASE ))
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t spsc_fifo_min(const uint32_t a, const uint32_t b);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get smaller of two values
+*
+* @param[in]	a	- First value
+* @param[in]	b	- Second value
+* @return		smaller value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t spsc_fifo_min(const uint32_t a, const uint32_t b)
+{
+	return (( a < b ) ? a : b );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup SPSC_FIFO_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of SPSC FIFO API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize FIFO
+*
+* @note		Must be called before producer or consumer starts.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[in]	p_buf	- FIFO memory
+* @param[in]	size	- Size of FIFO memory, power of two
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_init(spsc_fifo_t * const p_fifo, uint8_t * const p_buf, const uint32_t size)
+{
+	spsc_fifo_status_t status = eSPSC_FIFO_OK;
+
+	if 	(	( NULL != p_fifo )
+		&&	( NULL != p_buf )
+		&&	( size > 0UL )
+		&&	( 0UL == ( size & ( size - 1UL ))))
+	{
+		p_fifo->p_buf 	= p_buf;
+		p_fifo->mask 	= size - 1UL;
+		p_fifo->head	= 0UL;
+		p_fifo->tail	= 0UL;
+	}
+	else
+	{
+		status = eSPSC_FIFO_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add single byte to FIFO
+*
+* @note		Producer side.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[in]	data	- Byte to add
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_add(spsc_fifo_t * const p_fifo, const uint8_t data)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		head	= p_fifo->head;
+
+	if (( head - SPSC_FIFO_LOAD( p_fifo->tail )) <= p_fifo->mask )
+	{
+		p_fifo->p_buf[ head & p_fifo->mask ] = data;
+		SPSC_FIFO_STORE( p_fifo->head, head + 1UL );
+	}
+	else
+	{
+		status = eSPSC_FIFO_FULL;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add block of bytes to FIFO
+*
+* @note		Producer side. As much as fits is added.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data
+* @param[out]	p_added	- Number of added bytes, can be NULL
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_add_n(spsc_fifo_t * const p_fifo, const uint8_t * const p_data, const uint32_t size, uint32_t * const p_added)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		head	= p_fifo->head;
+	const uint32_t		free	= ( p_fifo->mask + 1UL ) - ( head - SPSC_FIFO_LOAD( p_fifo->tail ));
+	const uint32_t		num_of	= spsc_fifo_min( size, free );
+	const uint32_t		idx		= head & p_fifo->mask;
+	const uint32_t		first	= spsc_fifo_min( num_of, ( p_fifo->mask + 1UL ) - idx );
+
+	// Copy with wrap around
+	memcpy( &p_fifo->p_buf[idx], p_data, first );
+	memcpy( p_fifo->p_buf, &p_data[first], ( num_of - first ));
+
+	SPSC_FIFO_STORE( p_fifo->head, head + num_of );
+
+	if ( num_of < size )
+	{
+		status = eSPSC_FIFO_FULL;
+	}
+
+	if ( NULL != p_added )
+	{
+		*p_added = num_of;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get single byte from FIFO
+*
+* @note		Consumer side.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[out]	p_data	- Pointer to byte
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_get(spsc_fifo_t * const p_fifo, uint8_t * const p_data)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		tail	= p_fifo->tail;
+
+	if ( SPSC_FIFO_LOAD( p_fifo->head ) != tail )
+	{
+		*p_data = p_fifo->p_buf[ tail & p_fifo->mask ];
+		SPSC_FIFO_STORE( p_fifo->tail, tail + 1UL );
+	}
+	else
+	{
+		status = eSPSC_FIFO_EMPTY;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get block of bytes from FIFO
+*
+* @note		Consumer side. As much as available is taken.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[out]	p_data	- Pointer to destination
+* @param[in]	size	- Size of destination
+* @param[out]	p_read	- Number of taken bytes, can be NULL
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_get_n(spsc_fifo_t * const p_fifo, uint8_t * const p_data, const uint32_t size, uint32_t * const p_read)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		tail	= p_fifo->tail;
+	const uint32_t		used	= SPSC_FIFO_LOAD( p_fifo->head ) - tail;
+	const uint32_t		num_of	= spsc_fifo_min( size, used );
+	const uint32_t		idx		= tail & p_fifo->mask;
+	const uint32_t		first	= spsc_fifo_min( num_of, ( p_fifo->mask + 1UL ) - idx );
+
+	// Copy with wrap around
+	memcpy( p_data, &p_fifo->p_buf[idx], first );
+	memcpy( &p_data[first], p_fifo->p_buf, ( num_of - first ));
+
+	SPSC_FIFO_STORE( p_fifo->tail, tail + num_of );
+
+	if ( num_of < size )
+	{
+		status = eSPSC_FIFO_EMPTY;
+	}
+
+	if ( NULL != p_read )
+	{
+		*p_read = num_of;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get contiguous span of data without taking it
+*
+* @note		Consumer side. Span ends at the end of FIFO memory even if
+* 			more data wrapped around, release it with "spsc_fifo_consume()".
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[out]	pp_data	- Start of span
+* @param[out]	p_size	- Size of span, zero if FIFO is empty
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_get_span(spsc_fifo_t * const p_fifo, const uint8_t ** const pp_data, uint32_t * const p_size)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		tail	= p_fifo->tail;
+	const uint32_t		used	= SPSC_FIFO_LOAD( p_fifo->head ) - tail;
+	const uint32_t		idx		= tail & p_fifo->mask;
+
+	*pp_data 	= &p_fifo->p_buf[idx];
+	*p_size		= spsc_fifo_min( used, ( p_fifo->mask + 1UL ) - idx );
+
+	if ( 0UL == *p_size )
+	{
+		status = eSPSC_FIFO_EMPTY;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release data obtained by "spsc_fifo_get_span()"
+*
+* @note		Consumer side.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[in]	size	- Number of bytes to release
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_consume(spsc_fifo_t * const p_fifo, const uint32_t size)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		tail	= p_fifo->tail;
+
+	if ( size <= ( SPSC_FIFO_LOAD( p_fifo->head ) - tail ))
+	{
+		SPSC_FIFO_STORE( p_fifo->tail, tail + size );
+	}
+	else
+	{
+		status = eSPSC_FIFO_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get contiguous span of free space
+*
+* @note		Producer side. Data written into span are added with
+* 			"spsc_fifo_commit()".
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[out]	pp_data	- Start of span
+* @param[out]	p_size	- Size of span, zero if FIFO is full
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_put_span(spsc_fifo_t * const p_fifo, uint8_t ** const pp_data, uint32_t * const p_size)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		head	= p_fifo->head;
+	const uint32_t		free	= ( p_fifo->mask + 1UL ) - ( head - SPSC_FIFO_LOAD( p_fifo->tail ));
+	const uint32_t		idx		= head & p_fifo->mask;
+
+	*pp_data 	= &p_fifo->p_buf[idx];
+	*p_size		= spsc_fifo_min( free, ( p_fifo->mask + 1UL ) - idx );
+
+	if ( 0UL == *p_size )
+	{
+		status = eSPSC_FIFO_FULL;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add data written into span obtained by "spsc_fifo_put_span()"
+*
+* @note		Producer side.
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @param[in]	size	- Number of written bytes
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t spsc_fifo_commit(spsc_fifo_t * const p_fifo, const uint32_t size)
+{
+	spsc_fifo_status_t 	status 	= eSPSC_FIFO_OK;
+	const uint32_t		head	= p_fifo->head;
+
+	if ( size <= ( p_fifo->mask + 1UL - ( head - SPSC_FIFO_LOAD( p_fifo->tail ))))
+	{
+		SPSC_FIFO_STORE( p_fifo->head, head + size );
+	}
+	else
+	{
+		status = eSPSC_FIFO_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of bytes in FIFO
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @return		used	- Number of bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t spsc_fifo_get_used(const spsc_fifo_t * const p_fifo)
+{
+	const uint32_t tail = SPSC_FIFO_LOAD( p_fifo->tail );
+
+	return ( SPSC_FIFO_LOAD( p_fifo->head ) - tail );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of free bytes in FIFO
+*
+* @param[in]	p_fifo	- Pointer to FIFO
+* @return		free	- Number of free bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t spsc_fifo_get_free(const spsc_fifo_t * const p_fifo)
+{
+	return (( p_fifo->mask + 1UL ) - spsc_fifo_get_used( p_fifo ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
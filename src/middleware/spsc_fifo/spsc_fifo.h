@@ -0,0 +1,93 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      spsc_fifo.h
+*@brief     Lock-free single producer single consumer byte FIFO
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup SPSC_FIFO
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Lock-free single producer single consumer byte FIFO
+*
+* 	Intended for ISR <-> main loop paths. Producer only writes head and
+* 	consumer only writes tail, thus no critical section is needed as
+* 	long as each side stays in single context.
+*
+* 	Producer side:	spsc_fifo_add, spsc_fifo_add_n, spsc_fifo_put_span,
+* 					spsc_fifo_commit, spsc_fifo_get_free
+*
+* 	Consumer side:	spsc_fifo_get, spsc_fifo_get_n, spsc_fifo_get_span,
+* 					spsc_fifo_consume, spsc_fifo_get_used
+*
+* 	Span functions give direct access to contiguous part of FIFO memory,
+* 	so that EasyDMA can read from or write into FIFO without copying.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPSC_FIFO_H
+#define __SPSC_FIFO_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	SPSC FIFO status
+ */
+typedef enum
+{
+	eSPSC_FIFO_OK 		= 0x00,		/**<Normal operation */
+	eSPSC_FIFO_ERROR	= 0x01,		/**<General error code */
+	eSPSC_FIFO_FULL		= 0x02,		/**<Not all data fit into FIFO */
+	eSPSC_FIFO_EMPTY	= 0x04,		/**<Not enough data in FIFO */
+} spsc_fifo_status_t;
+
+/**
+ * 	SPSC FIFO
+ *
+ * @note	Indices are free running, their difference is number of
+ * 			used bytes. Size must be power of two.
+ */
+typedef struct
+{
+	uint8_t *			p_buf;		/**<FIFO memory */
+	uint32_t			mask;		/**<Size - 1 */
+	volatile uint32_t	head;		/**<Write index, owned by producer */
+	volatile uint32_t	tail;		/**<Read index, owned by consumer */
+} spsc_fifo_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+spsc_fifo_status_t	spsc_fifo_init		(spsc_fifo_t * const p_fifo, uint8_t * const p_buf, const uint32_t size);
+spsc_fifo_status_t	spsc_fifo_add		(spsc_fifo_t * const p_fifo, const uint8_t data);
+spsc_fifo_status_t	spsc_fifo_add_n		(spsc_fifo_t * const p_fifo, const uint8_t * const p_data, const uint32_t size, uint32_t * const p_added);
+spsc_fifo_status_t	spsc_fifo_get		(spsc_fifo_t * const p_fifo, uint8_t * const p_data);
+spsc_fifo_status_t	spsc_fifo_get_n		(spsc_fifo_t * const p_fifo, uint8_t * const p_data, const uint32_t size, uint32_t * const p_read);
+spsc_fifo_status_t	spsc_fifo_get_span	(spsc_fifo_t * const p_fifo, const uint8_t ** const pp_data, uint32_t * const p_size);
+spsc_fifo_status_t	spsc_fifo_consume	(spsc_fifo_t * const p_fifo, const uint32_t size);
+spsc_fifo_status_t	spsc_fifo_put_span	(spsc_fifo_t * const p_fifo, uint8_t ** const pp_data, uint32_t * const p_size);
+spsc_fifo_status_t	spsc_fifo_commit	(spsc_fifo_t * const p_fifo, const uint32_t size);
+uint32_t			spsc_fifo_get_used	(const spsc_fifo_t * const p_fifo);
+uint32_t			spsc_fifo_get_free	(const spsc_fifo_t * const p_fifo);
+
+#endif // __SPSC_FIFO_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,6 @@
+# SPSC FIFO, single thread and producer/consumer threads
+SPSC_FIFO_DIR := $(ROOT)/src/middleware/spsc_fifo
+
+TESTS += spsc_fifo
+
+spsc_fifo_SRC	:= $(SPSC_FIFO_DIR)/test/test_spsc_fifo.c $(SPSC_FIFO_DIR)/spsc_fifo.c
@@ -0,0 +1,456 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_spsc_fifo.c
+*@brief     SPSC FIFO host tests
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup SPSC_FIFO_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Single threaded tests cover wrap around of memory and of free
+* 	running indices for byte, bulk and span access.
+*
+* 	Two thread test runs producer and consumer concurrently on small
+* 	FIFO, with indices starting just before overflow. Producer sends
+* 	byte sequence mixing all producer calls, consumer checks sequence
+* 	mixing all consumer calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "test.h"
+#include "middleware/spsc_fifo/spsc_fifo.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	FIFO size
+ */
+#define TEST_FIFO_SIZE					( 64UL )
+
+/**
+ * 	Index start, just before overflow
+ */
+#define TEST_FIFO_IDX_START				( 0xFFFFFF00UL )
+
+/**
+ * 	Bytes sent by two thread test
+ */
+#define TEST_FIFO_THREAD_BYTES			( 4000000UL )
+
+/**
+ * 	Bytes sent by benchmark
+ */
+#define TEST_FIFO_BENCH_BYTES			( 20000000UL )
+
+/**
+ * 	Producer and consumer access
+ */
+typedef enum
+{
+	eTEST_FIFO_MIX = 0,		/**<All calls mixed */
+	eTEST_FIFO_BYTE,		/**<Single byte calls */
+	eTEST_FIFO_BULK,		/**<Block copy calls */
+	eTEST_FIFO_SPAN,		/**<Span calls */
+} test_fifo_access_t;
+
+/**
+ * 	Two thread run
+ */
+typedef struct
+{
+	spsc_fifo_t			fifo;		/**<FIFO under test */
+	uint32_t			bytes;		/**<Bytes to transfer */
+	test_fifo_access_t	access;		/**<Access method */
+	uint32_t			received;	/**<Bytes received by consumer */
+	uint32_t			bad;		/**<Bytes out of sequence */
+} test_fifo_run_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	FIFO memory
+ */
+static uint8_t gu8_test_fifo_buf[TEST_FIFO_SIZE] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Init FIFO with indices at given start
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fifo_init(spsc_fifo_t * const p_fifo, const uint32_t start)
+{
+	TEST_ASSERT_EQ( spsc_fifo_init( p_fifo, gu8_test_fifo_buf, TEST_FIFO_SIZE ), eSPSC_FIFO_OK );
+
+	p_fifo->head = start;
+	p_fifo->tail = start;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Byte access and index overflow
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_byte(void)
+{
+	spsc_fifo_t fifo	= {0};
+	uint8_t		byte	= 0;
+	uint32_t	bad		= 0;
+
+	TEST_ASSERT_EQ( spsc_fifo_init( &fifo, gu8_test_fifo_buf, 48 ), eSPSC_FIFO_ERROR );
+	TEST_ASSERT_EQ( spsc_fifo_init( &fifo, gu8_test_fifo_buf, 0 ), eSPSC_FIFO_ERROR );
+	TEST_ASSERT_EQ( spsc_fifo_init( NULL, gu8_test_fifo_buf, TEST_FIFO_SIZE ), eSPSC_FIFO_ERROR );
+
+	test_fifo_init( &fifo, TEST_FIFO_IDX_START );
+
+	// Cross index overflow several times with full FIFO
+	for ( uint32_t round = 0; round < 16; round++ )
+	{
+		for ( uint32_t i = 0; i < TEST_FIFO_SIZE; i++ )
+		{
+			bad += ( eSPSC_FIFO_OK != spsc_fifo_add( &fifo, (uint8_t)( round + i )));
+		}
+
+		TEST_ASSERT_EQ( spsc_fifo_add( &fifo, 0 ), eSPSC_FIFO_FULL );
+		TEST_ASSERT_EQ( spsc_fifo_get_used( &fifo ), TEST_FIFO_SIZE );
+		TEST_ASSERT_EQ( spsc_fifo_get_free( &fifo ), 0 );
+
+		for ( uint32_t i = 0; i < TEST_FIFO_SIZE; i++ )
+		{
+			bad += ( eSPSC_FIFO_OK != spsc_fifo_get( &fifo, &byte ));
+			bad += ((uint8_t)( round + i ) != byte );
+		}
+
+		TEST_ASSERT_EQ( spsc_fifo_get( &fifo, &byte ), eSPSC_FIFO_EMPTY );
+		TEST_ASSERT_EQ( spsc_fifo_get_used( &fifo ), 0 );
+	}
+
+	TEST_ASSERT_EQ( bad, 0 );
+	TEST_ASSERT( fifo.head < TEST_FIFO_IDX_START );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Bulk access across end of memory
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bulk(void)
+{
+	spsc_fifo_t fifo				= {0};
+	uint8_t		in[TEST_FIFO_SIZE]	= {0};
+	uint8_t		out[TEST_FIFO_SIZE]	= {0};
+	uint32_t	num_of				= 0;
+
+	for ( uint32_t i = 0; i < TEST_FIFO_SIZE; i++ )
+	{
+		in[i] = (uint8_t)( 0xA0 + i );
+	}
+
+	// Start 10 bytes before end of memory
+	test_fifo_init( &fifo, TEST_FIFO_IDX_START - 10 );
+
+	TEST_ASSERT_EQ( spsc_fifo_add_n( &fifo, in, 40, &num_of ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( num_of, 40 );
+
+	// Only what fits is added
+	TEST_ASSERT_EQ( spsc_fifo_add_n( &fifo, &in[40], 24 + 8, &num_of ), eSPSC_FIFO_FULL );
+	TEST_ASSERT_EQ( num_of, 24 );
+	TEST_ASSERT_EQ( spsc_fifo_add_n( &fifo, in, 1, NULL ), eSPSC_FIFO_FULL );
+
+	TEST_ASSERT_EQ( spsc_fifo_get_n( &fifo, out, 30, &num_of ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( num_of, 30 );
+
+	// Only what is available is taken
+	TEST_ASSERT_EQ( spsc_fifo_get_n( &fifo, &out[30], TEST_FIFO_SIZE, &num_of ), eSPSC_FIFO_EMPTY );
+	TEST_ASSERT_EQ( num_of, 34 );
+	TEST_ASSERT_EQ( memcmp( in, out, TEST_FIFO_SIZE ), 0 );
+
+	TEST_ASSERT_EQ( spsc_fifo_get_n( &fifo, out, 1, NULL ), eSPSC_FIFO_EMPTY );
+	TEST_ASSERT_EQ( spsc_fifo_add_n( &fifo, in, 0, &num_of ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( num_of, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Span access across end of memory
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_span(void)
+{
+	spsc_fifo_t 	fifo	= {0};
+	uint8_t *		p_put	= NULL;
+	const uint8_t *	p_get	= NULL;
+	uint32_t		size	= 0;
+
+	test_fifo_init( &fifo, TEST_FIFO_IDX_START - 10 );
+
+	// Empty FIFO, free span ends at end of memory
+	TEST_ASSERT_EQ( spsc_fifo_get_span( &fifo, &p_get, &size ), eSPSC_FIFO_EMPTY );
+	TEST_ASSERT_EQ( size, 0 );
+	TEST_ASSERT_EQ( spsc_fifo_put_span( &fifo, &p_put, &size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( size, 10 );
+	TEST_ASSERT( &gu8_test_fifo_buf[ TEST_FIFO_SIZE - 10 ] == p_put );
+
+	memset( p_put, 0x11, size );
+	TEST_ASSERT_EQ( spsc_fifo_commit( &fifo, size ), eSPSC_FIFO_OK );
+
+	// Next span starts at beginning of memory
+	TEST_ASSERT_EQ( spsc_fifo_put_span( &fifo, &p_put, &size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( size, TEST_FIFO_SIZE - 10 );
+	TEST_ASSERT( &gu8_test_fifo_buf[0] == p_put );
+
+	memset( p_put, 0x22, size );
+	TEST_ASSERT_EQ( spsc_fifo_commit( &fifo, size + 1 ), eSPSC_FIFO_ERROR );
+	TEST_ASSERT_EQ( spsc_fifo_commit( &fifo, size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( spsc_fifo_put_span( &fifo, &p_put, &size ), eSPSC_FIFO_FULL );
+	TEST_ASSERT_EQ( size, 0 );
+
+	// Data span stops at end of memory, even though more data wrapped
+	TEST_ASSERT_EQ( spsc_fifo_get_span( &fifo, &p_get, &size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( size, 10 );
+	TEST_ASSERT_EQ( p_get[0], 0x11 );
+	TEST_ASSERT_EQ( p_get[9], 0x11 );
+
+	// Partial release
+	TEST_ASSERT_EQ( spsc_fifo_consume( &fifo, 4 ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( spsc_fifo_get_span( &fifo, &p_get, &size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( size, 6 );
+	TEST_ASSERT_EQ( spsc_fifo_consume( &fifo, size ), eSPSC_FIFO_OK );
+
+	TEST_ASSERT_EQ( spsc_fifo_get_span( &fifo, &p_get, &size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( size, TEST_FIFO_SIZE - 10 );
+	TEST_ASSERT( &gu8_test_fifo_buf[0] == p_get );
+	TEST_ASSERT_EQ( p_get[0], 0x22 );
+	TEST_ASSERT_EQ( spsc_fifo_consume( &fifo, size + 1 ), eSPSC_FIFO_ERROR );
+	TEST_ASSERT_EQ( spsc_fifo_consume( &fifo, size ), eSPSC_FIFO_OK );
+	TEST_ASSERT_EQ( spsc_fifo_get_used( &fifo ), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Producer thread
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * test_fifo_producer(void * p_arg)
+{
+	test_fifo_run_t * const p_run	= (test_fifo_run_t*) p_arg;
+	uint8_t					blk[23]	= {0};
+	uint32_t				sent	= 0;
+	uint32_t				step	= 0;
+
+	while ( sent < p_run->bytes )
+	{
+		const test_fifo_access_t	access	= ( eTEST_FIFO_MIX == p_run->access ) ? (test_fifo_access_t)(( step++ % 3 ) + 1 ) : p_run->access;
+		uint32_t					num_of	= 0;
+
+		switch ( access )
+		{
+			case eTEST_FIFO_BYTE:
+				if ( eSPSC_FIFO_OK == spsc_fifo_add( &p_run->fifo, (uint8_t) sent ))
+				{
+					num_of = 1;
+				}
+				break;
+
+			case eTEST_FIFO_BULK:
+				for ( uint32_t i = 0; i < sizeof( blk ); i++ )
+				{
+					blk[i] = (uint8_t)( sent + i );
+				}
+
+				(void) spsc_fifo_add_n( &p_run->fifo, blk, (( p_run->bytes - sent ) < sizeof( blk )) ? ( p_run->bytes - sent ) : sizeof( blk ), &num_of );
+				break;
+
+			case eTEST_FIFO_SPAN:
+			default:
+			{
+				uint8_t * p_span = NULL;
+
+				(void) spsc_fifo_put_span( &p_run->fifo, &p_span, &num_of );
+
+				num_of = (( p_run->bytes - sent ) < num_of ) ? ( p_run->bytes - sent ) : num_of;
+
+				for ( uint32_t i = 0; i < num_of; i++ )
+				{
+					p_span[i] = (uint8_t)( sent + i );
+				}
+
+				(void) spsc_fifo_commit( &p_run->fifo, num_of );
+			}
+				break;
+		}
+
+		// Let consumer run when FIFO is full, also on single core host
+		if ( 0 == num_of )
+		{
+			(void) sched_yield();
+		}
+
+		sent += num_of;
+	}
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Consumer thread
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * test_fifo_consumer(void * p_arg)
+{
+	test_fifo_run_t * const p_run	= (test_fifo_run_t*) p_arg;
+	uint8_t					blk[17]	= {0};
+	uint32_t				step	= 0;
+
+	while ( p_run->received < p_run->bytes )
+	{
+		const test_fifo_access_t	access	= ( eTEST_FIFO_MIX == p_run->access ) ? (test_fifo_access_t)(( step++ % 3 ) + 1 ) : p_run->access;
+		const uint8_t *				p_data	= blk;
+		uint32_t					num_of	= 0;
+
+		switch ( access )
+		{
+			case eTEST_FIFO_BYTE:
+				if ( eSPSC_FIFO_OK == spsc_fifo_get( &p_run->fifo, &blk[0] ))
+				{
+					num_of = 1;
+				}
+				break;
+
+			case eTEST_FIFO_BULK:
+				(void) spsc_fifo_get_n( &p_run->fifo, blk, sizeof( blk ), &num_of );
+				break;
+
+			case eTEST_FIFO_SPAN:
+			default:
+				(void) spsc_fifo_get_span( &p_run->fifo, &p_data, &num_of );
+				break;
+		}
+
+		for ( uint32_t i = 0; i < num_of; i++ )
+		{
+			p_run->bad += ( p_data[i] != (uint8_t)( p_run->received + i ));
+		}
+
+		if ( eTEST_FIFO_SPAN == access )
+		{
+			(void) spsc_fifo_consume( &p_run->fifo, num_of );
+		}
+
+		if ( 0 == num_of )
+		{
+			(void) sched_yield();
+		}
+
+		p_run->received += num_of;
+	}
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run producer and consumer concurrently
+*
+* @return		run time - Unit: ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t test_fifo_threads(test_fifo_run_t * const p_run, const uint32_t start)
+{
+	pthread_t		prod	= {0};
+	pthread_t		cons	= {0};
+	const uint64_t	t0		= test_now_ns();
+
+	test_fifo_init( &p_run->fifo, start );
+
+	TEST_ASSERT_EQ( pthread_create( &cons, NULL, test_fifo_consumer, p_run ), 0 );
+	TEST_ASSERT_EQ( pthread_create( &prod, NULL, test_fifo_producer, p_run ), 0 );
+	TEST_ASSERT_EQ( pthread_join( prod, NULL ), 0 );
+	TEST_ASSERT_EQ( pthread_join( cons, NULL ), 0 );
+
+	return ( test_now_ns() - t0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Two thread transfer
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_threads(void)
+{
+	test_fifo_run_t run = { .bytes = TEST_FIFO_THREAD_BYTES, .access = eTEST_FIFO_MIX };
+
+	(void) test_fifo_threads( &run, TEST_FIFO_IDX_START );
+
+	TEST_ASSERT_EQ( run.received, TEST_FIFO_THREAD_BYTES );
+	TEST_ASSERT_EQ( run.bad, 0 );
+	TEST_ASSERT_EQ( spsc_fifo_get_used( &run.fifo ), 0 );
+	TEST_ASSERT( run.fifo.head < TEST_FIFO_IDX_START );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Two thread throughput per access method
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bench(void)
+{
+	const test_fifo_access_t	access[]	= { eTEST_FIFO_BYTE, eTEST_FIFO_BULK, eTEST_FIFO_SPAN };
+	const char * const			p_name[]	= { "byte", "bulk", "span" };
+
+	for ( uint32_t i = 0; i < ( sizeof( access ) / sizeof( access[0] )); i++ )
+	{
+		test_fifo_run_t run = { .bytes = TEST_FIFO_BENCH_BYTES, .access = access[i] };
+		const uint64_t	ns	= test_fifo_threads( &run, 0 );
+
+		TEST_ASSERT_EQ( run.bad, 0 );
+		TEST_BENCH( "%s: %7.2f MB/s, %5.2f ns/byte", p_name[i], ( TEST_FIFO_BENCH_BYTES * 1e3 ) / (double) ns, (double) ns / TEST_FIFO_BENCH_BYTES );
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_byte();
+	test_bulk();
+	test_span();
+	test_threads();
+
+	if ( true == test_bench_en())
+	{
+		test_bench();
+	}
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
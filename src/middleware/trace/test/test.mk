@@ -0,0 +1,6 @@
+# Test point trace driven by TP_ENTER/TP_EXIT, VCD output parsed back
+TRACE_DIR := $(ROOT)/src/middleware/trace
+
+TESTS += trace
+
+trace_SRC	:= $(TRACE_DIR)/test/test_trace.c $(TRACE_DIR)/trace_vcd.c
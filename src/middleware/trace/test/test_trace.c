@@ -0,0 +1,334 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_trace.c
+*@brief     Test point trace VCD host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup TRACE_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	TP_ENTER/TP_EXIT are driven on host build and resulting VCD file is
+* 	parsed back. Header must declare wire per test point, all starting
+* 	low. Edges must follow calls, repeated levels and unmapped events
+* 	must not be dumped and timestamps must increase.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "middleware/trace/trace.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Max number of dumped edges
+ */
+#define TEST_TRACE_EDGES				( 32U )
+
+/**
+ * 	Min duration of traced pulse
+ *
+ * 	Unit: ns
+ */
+#define TEST_TRACE_PULSE_NS				( 20000ULL )
+
+/**
+ * 	Dumped edge
+ */
+typedef struct
+{
+	uint64_t	time;	/**<Timestamp - Unit: ns */
+	char		id;		/**<Wire identifier */
+	char		level;	/**<New level, '0' or '1' */
+} test_trace_edge_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	VCD file path
+ */
+static char gc_test_path[] = "/tmp/test_trace_XXXXXX";
+
+/**
+ * 	VCD file content
+ */
+static char gc_test_vcd[8192] = {0};
+
+/**
+ * 	Parsed edges
+ */
+static test_trace_edge_t	g_test_edge[TEST_TRACE_EDGES]	= {0};
+static uint32_t				gu32_test_edges					= 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get wire identifier of test point
+*/
+////////////////////////////////////////////////////////////////////////////////
+static char test_trace_id(const uint32_t mask)
+{
+	return (char)( '!' + __builtin_ctz( mask ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Busy wait
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_trace_wait(const uint64_t ns)
+{
+	const uint64_t start = test_now_ns();
+
+	while (( test_now_ns() - start ) < ns )
+	{
+		// Wait
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read VCD file
+*
+* @return		size - Size of file
+*/
+////////////////////////////////////////////////////////////////////////////////
+static size_t test_trace_read(void)
+{
+	FILE *	p_file	= fopen( gc_test_path, "r" );
+	size_t	size	= 0;
+
+	TEST_ASSERT( NULL != p_file );
+
+	if ( NULL != p_file )
+	{
+		size = fread( gc_test_vcd, 1, sizeof( gc_test_vcd ) - 1U, p_file );
+		(void) fclose( p_file );
+	}
+
+	gc_test_vcd[size] = '\0';
+
+	return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parse edges after header
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_trace_parse(void)
+{
+	const char *	p_line	= strstr( gc_test_vcd, "$dumpvars\n" );
+	uint64_t		time	= 0;
+	bool			has_ts	= false;
+
+	gu32_test_edges = 0;
+
+	TEST_ASSERT( NULL != p_line );
+
+	if ( NULL != p_line )
+	{
+		// Skip initial values
+		p_line = strstr( p_line, "$end\n" );
+	}
+
+	while (( NULL != p_line ) && ( '\0' != *p_line ))
+	{
+		p_line = strchr( p_line, '\n' );
+
+		if (( NULL == p_line ) || ( '\0' == p_line[1] ))
+		{
+			break;
+		}
+
+		p_line++;
+
+		if ( '#' == p_line[0] )
+		{
+			const uint64_t ts = strtoull( &p_line[1], NULL, 10 );
+
+			// Strictly increasing, never repeated
+			TEST_ASSERT(( false == has_ts ) || ( ts > time ));
+			time	= ts;
+			has_ts	= true;
+		}
+		else
+		{
+			TEST_ASSERT( true == has_ts );
+			TEST_ASSERT(( '0' == p_line[0] ) || ( '1' == p_line[0] ));
+			TEST_ASSERT( gu32_test_edges < TEST_TRACE_EDGES );
+
+			if ( gu32_test_edges < TEST_TRACE_EDGES )
+			{
+				g_test_edge[gu32_test_edges].time	= time;
+				g_test_edge[gu32_test_edges].level	= p_line[0];
+				g_test_edge[gu32_test_edges].id		= p_line[1];
+				gu32_test_edges++;
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Open and close
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_open(void)
+{
+	const int fd = mkstemp( gc_test_path );
+
+	TEST_ASSERT( fd >= 0 );
+	(void) close( fd );
+
+	TEST_ASSERT_EQ( trace_vcd_open( NULL ), eTRACE_VCD_ERROR );
+	TEST_ASSERT_EQ( trace_vcd_open( "/nonexistent/dir/trace.vcd" ), eTRACE_VCD_ERROR );
+
+	TEST_ASSERT_EQ( trace_vcd_open( gc_test_path ), eTRACE_VCD_OK );
+	TEST_ASSERT_EQ( trace_vcd_open( gc_test_path ), eTRACE_VCD_ERROR );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Drive test points and check dump
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_dump(void)
+{
+	char			line[64]	= {0};
+	uint32_t		wires		= 0;
+	const char		adc			= test_trace_id( TRACE_CFG_ADC_ISR );
+	const char		uart		= test_trace_id( TRACE_CFG_UART_1_ISR );
+	const char		systick		= test_trace_id( TRACE_CFG_SYSTICK_ISR );
+	const test_trace_edge_t exp[] =
+	{
+		{ .id = adc, 		.level = '1' },
+		{ .id = uart,		.level = '1' },
+		{ .id = uart,		.level = '0' },
+		{ .id = adc,		.level = '0' },
+		{ .id = systick,	.level = '1' },
+		{ .id = systick,	.level = '0' },
+	};
+
+	TP_ENTER( ADC_ISR );
+	TP_ENTER( ADC_ISR );
+	TP_ENTER( UART_1_ISR );
+	test_trace_wait( TEST_TRACE_PULSE_NS );
+	TP_EXIT( UART_1_ISR );
+	TP_EXIT( ADC_ISR );
+
+	// Unmapped event
+	TP_ENTER( APP_COMM );
+	TP_EXIT( APP_COMM );
+
+	TP_ENTER( SYSTICK_ISR );
+	TP_EXIT( SYSTICK_ISR );
+	TP_EXIT( SYSTICK_ISR );
+
+	TEST_ASSERT_EQ( trace_vcd_close(), eTRACE_VCD_OK );
+	TEST_ASSERT( test_trace_read() > 0U );
+
+	// Header
+	TEST_ASSERT( NULL != strstr( gc_test_vcd, "$timescale 1ns $end\n" ));
+	TEST_ASSERT( NULL != strstr( gc_test_vcd, "$enddefinitions $end\n" ));
+
+	for ( uint32_t pin = 0; pin < 32U; pin++ )
+	{
+		if ( GPIO_TP_MASK & ( 1UL << pin ))
+		{
+			(void) snprintf( line, sizeof( line ), "$var wire 1 %c tp_p%u_%02u $end\n", test_trace_id( 1UL << pin ), (unsigned) GPIO_TP_PORT, (unsigned) pin );
+			TEST_ASSERT( NULL != strstr( gc_test_vcd, line ));
+
+			(void) snprintf( line, sizeof( line ), "\n0%c\n", test_trace_id( 1UL << pin ));
+			TEST_ASSERT( NULL != strstr( gc_test_vcd, line ));
+
+			wires++;
+		}
+	}
+
+	TEST_ASSERT_EQ( wires, __builtin_popcount( GPIO_TP_MASK ));
+
+	// Edges
+	test_trace_parse();
+	TEST_ASSERT_EQ( gu32_test_edges, sizeof( exp ) / sizeof( exp[0] ));
+
+	for ( uint32_t i = 0; ( i < gu32_test_edges ) && ( i < ( sizeof( exp ) / sizeof( exp[0] ))); i++ )
+	{
+		TEST_ASSERT_EQ( g_test_edge[i].id, exp[i].id );
+		TEST_ASSERT_EQ( g_test_edge[i].level, exp[i].level );
+	}
+
+	// Pulse width
+	if ( gu32_test_edges >= 3U )
+	{
+		TEST_ASSERT(( g_test_edge[2].time - g_test_edge[1].time ) >= TEST_TRACE_PULSE_NS );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Writes after close
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_closed(void)
+{
+	const size_t size = test_trace_read();
+
+	TP_ENTER( ADC_ISR );
+	TP_EXIT( ADC_ISR );
+
+	TEST_ASSERT_EQ( test_trace_read(), size );
+	TEST_ASSERT_EQ( trace_vcd_close(), eTRACE_VCD_OK );
+
+	// Reopen starts low
+	TEST_ASSERT_EQ( trace_vcd_open( gc_test_path ), eTRACE_VCD_OK );
+	TP_ENTER( ADC_ISR );
+	TEST_ASSERT_EQ( trace_vcd_close(), eTRACE_VCD_OK );
+
+	(void) test_trace_read();
+	test_trace_parse();
+	TEST_ASSERT_EQ( gu32_test_edges, 1 );
+	TEST_ASSERT_EQ( g_test_edge[0].level, '1' );
+
+	(void) unlink( gc_test_path );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_open();
+	test_dump();
+	test_closed();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 0 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
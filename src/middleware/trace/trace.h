@@ -0,0 +1,88 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      trace.h
+*@brief     Test point trace for timing of hot paths
+*@author    Ziga Miklosic
+*@date      12.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TRACE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Test point trace for timing of hot paths
+*
+* 	TP_ENTER/TP_EXIT drive test point high/low with single OUTSET/OUTCLR
+* 	register write, so they can be placed inside ISRs with negligible
+* 	overhead. Event to test point map is resolved at compile time, see
+* 	trace_cfg.h. Unmapped events compile to nothing.
+*
+* 	On host build same macros record edges into VCD file instead, see
+* 	trace_vcd.h.
+*
+* 	Usage:
+*
+* 		TP_ENTER( ADC_ISR );
+* 		...
+* 		TP_EXIT( ADC_ISR );
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __TRACE_H
+#define __TRACE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "trace_cfg.h"
+
+#if ( 1 == TRACE_CFG_EN )
+	#if ( 1 == TRACE_CFG_HOST_EN )
+		#include "trace_vcd.h"
+	#else
+		#include "nrf.h"
+	#endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == TRACE_CFG_EN )
+
+	#if ( 1 == TRACE_CFG_HOST_EN )
+
+		#define TP_ENTER(id)		do { if ( 0UL != TRACE_CFG_##id ) { trace_vcd_write( TRACE_CFG_##id, true ); }} while(0)
+		#define TP_EXIT(id)			do { if ( 0UL != TRACE_CFG_##id ) { trace_vcd_write( TRACE_CFG_##id, false ); }} while(0)
+
+	#else
+
+		/**
+		 * 	Test point port registers
+		 */
+		#if ( 1 == TP_1__PORT )
+			#define TRACE_PORT		( NRF_P1 )
+		#else
+			#define TRACE_PORT		( NRF_P0 )
+		#endif
+
+		#define TP_ENTER(id)		do { if ( 0UL != TRACE_CFG_##id ) { TRACE_PORT->OUTSET = TRACE_CFG_##id; }} while(0)
+		#define TP_EXIT(id)			do { if ( 0UL != TRACE_CFG_##id ) { TRACE_PORT->OUTCLR = TRACE_CFG_##id; }} while(0)
+
+	#endif
+
+#else
+	#define TP_ENTER(id)			do { ; } while(0)
+	#define TP_EXIT(id)				do { ; } while(0)
+#endif
+
+#endif // __TRACE_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
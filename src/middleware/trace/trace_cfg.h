@@ -0,0 +1,97 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      trace_cfg.h
+*@brief     Test point trace configurations
+*@author    Ziga Miklosic
+*@date      12.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TRACE_CONFIGURATIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Put code that is platform depended inside code block start with
+* 	"USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __TRACE_CFG_H
+#define __TRACE_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+// USER CODE BEGIN...
+
+#include "drivers/peripheral/gpio/gpio.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Enable/Disable tracing
+ *
+ * @note	When disabled all TP_ENTER/TP_EXIT calls compile to nothing.
+ */
+#define TRACE_CFG_EN							( 1 )
+
+/**
+ * 	Enable/Disable host (VCD file) tracing
+ *
+ * @note	Selected automatically when not building for ARM target.
+ */
+#ifndef TRACE_CFG_HOST_EN
+	#if defined( __arm__ )
+		#define TRACE_CFG_HOST_EN				( 0 )
+	#else
+		#define TRACE_CFG_HOST_EN				( 1 )
+	#endif
+#endif
+
+/**
+ * 	Trace event to test point map
+ *
+ * @note	Each event is mapped to pin mask of test point it drives,
+ * 			use ( 0UL ) to disable event. Several events may share
+ * 			same test point, but they shall not nest then.
+ *
+ * 			Only test points TP_1..TP_3 are allowed!
+ */
+
+// USER CODE BEGIN...
+
+#define TRACE_CFG_UART_1_ISR					( GPIO_PIN_MASK( TP_1 ))
+#define TRACE_CFG_ADC_ISR						( GPIO_PIN_MASK( TP_2 ))
+#define TRACE_CFG_SYSTICK_ISR					( GPIO_PIN_MASK( TP_3 ))
+#define TRACE_CFG_APP_COMM						( 0UL )
+#define TRACE_CFG_APP_10MS						( 0UL )
+#define TRACE_CFG_APP_100MS						( 0UL )
+#define TRACE_CFG_APP_1000MS					( 0UL )
+
+// USER CODE END...
+
+/**
+ * 	Invalid configuration catcher
+ */
+#define TRACE_CFG_ALL_MASK						( TRACE_CFG_UART_1_ISR | TRACE_CFG_ADC_ISR | TRACE_CFG_SYSTICK_ISR \
+												| TRACE_CFG_APP_COMM | TRACE_CFG_APP_10MS | TRACE_CFG_APP_100MS | TRACE_CFG_APP_1000MS )
+
+#if ( 0 != ( TRACE_CFG_ALL_MASK & ~GPIO_TP_MASK ))
+	#error "Trace event mapped to pin that is not test point! Adjust event map inside trace_cfg.h file!"
+#endif
+
+#endif // __TRACE_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,251 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      trace_vcd.c
+*@brief     Host VCD writer for test point trace
+*@author    Ziga Miklosic
+*@date      12.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup TRACE_VCD
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Wires are declared once at open for every test point pin. Edges are
+* 	written only when level actually changes, so repeated TP_ENTER on
+* 	already high test point does not bloat the dump.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "trace_cfg.h"
+
+#if ( 1 == TRACE_CFG_HOST_EN )
+
+#include <stdio.h>
+#include <time.h>
+
+#include "trace_vcd.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	First VCD identifier character
+ */
+#define TRACE_VCD_ID_BASE				( '!' )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Output file
+ */
+static FILE * gp_trace_vcd_file = NULL;
+
+/**
+ * 	Start time. Unit: ns
+ */
+static uint64_t gu64_trace_vcd_start = 0;
+
+/**
+ * 	Time of last written timestamp. Unit: ns
+ */
+static uint64_t gu64_trace_vcd_last = UINT64_MAX;
+
+/**
+ * 	Current test point levels (pin mask)
+ */
+static uint32_t gu32_trace_vcd_level = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t trace_vcd_now_ns(void);
+static void 	trace_vcd_header(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get monotonic host time
+*
+* @return 		time - Host time. Unit: ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t trace_vcd_now_ns(void)
+{
+	struct timespec ts;
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (( (uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write VCD header
+*
+* @note	All test points start low.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void trace_vcd_header(void)
+{
+	(void) fprintf( gp_trace_vcd_file, "$timescale 1ns $end\n$scope module trace $end\n" );
+
+	// Declare wire per test point pin
+	for ( uint32_t pin = 0; pin < 32U; pin++ )
+	{
+		if ( GPIO_TP_MASK & ( 1UL << pin ))
+		{
+			(void) fprintf( gp_trace_vcd_file, "$var wire 1 %c tp_p%u_%02u $end\n", (char)( TRACE_VCD_ID_BASE + pin ), (unsigned) GPIO_TP_PORT, (unsigned) pin );
+		}
+	}
+
+	(void) fprintf( gp_trace_vcd_file, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n" );
+
+	for ( uint32_t pin = 0; pin < 32U; pin++ )
+	{
+		if ( GPIO_TP_MASK & ( 1UL << pin ))
+		{
+			(void) fprintf( gp_trace_vcd_file, "0%c\n", (char)( TRACE_VCD_ID_BASE + pin ));
+		}
+	}
+
+	(void) fprintf( gp_trace_vcd_file, "$end\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TRACE_VCD_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of trace VCD API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Open VCD file and write header
+*
+* @note	All test points start low. Fails if already opened.
+*
+* @param[in]	p_path	- Path to VCD file
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+trace_vcd_status_t trace_vcd_open(const char * const p_path)
+{
+	trace_vcd_status_t status = eTRACE_VCD_OK;
+
+	if (( NULL != p_path ) && ( NULL == gp_trace_vcd_file ))
+	{
+		gp_trace_vcd_file = fopen( p_path, "w" );
+
+		if ( NULL != gp_trace_vcd_file )
+		{
+			trace_vcd_header();
+
+			gu64_trace_vcd_start	= trace_vcd_now_ns();
+			gu64_trace_vcd_last		= 0;
+			gu32_trace_vcd_level	= 0;
+		}
+		else
+		{
+			status = eTRACE_VCD_ERROR;
+		}
+	}
+	else
+	{
+		status = eTRACE_VCD_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Record test point level change
+*
+* @note	Silently ignored if VCD file is not opened.
+*
+* @param[in]	mask	- Test point pin mask
+* @param[in]	level	- New level of test points
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void trace_vcd_write(const uint32_t mask, const bool level)
+{
+	const uint32_t	new_level	= ( level ? ( gu32_trace_vcd_level | mask ) : ( gu32_trace_vcd_level & ~mask ));
+	const uint32_t	change		= (( new_level ^ gu32_trace_vcd_level ) & GPIO_TP_MASK );
+
+	if (( NULL != gp_trace_vcd_file ) && ( 0UL != change ))
+	{
+		const uint64_t now = ( trace_vcd_now_ns() - gu64_trace_vcd_start );
+
+		if ( now != gu64_trace_vcd_last )
+		{
+			(void) fprintf( gp_trace_vcd_file, "#%llu\n", (unsigned long long) now );
+			gu64_trace_vcd_last = now;
+		}
+
+		for ( uint32_t pin = 0; pin < 32U; pin++ )
+		{
+			if ( change & ( 1UL << pin ))
+			{
+				(void) fprintf( gp_trace_vcd_file, "%c%c\n", ( level ? '1' : '0' ), (char)( TRACE_VCD_ID_BASE + pin ));
+			}
+		}
+
+		gu32_trace_vcd_level = new_level;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Close VCD file
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+trace_vcd_status_t trace_vcd_close(void)
+{
+	trace_vcd_status_t status = eTRACE_VCD_OK;
+
+	if ( NULL != gp_trace_vcd_file )
+	{
+		if ( 0 != fclose( gp_trace_vcd_file ))
+		{
+			status = eTRACE_VCD_ERROR;
+		}
+
+		gp_trace_vcd_file = NULL;
+	}
+
+	return status;
+}
+
+#endif // ( 1 == TRACE_CFG_HOST_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
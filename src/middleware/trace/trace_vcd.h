@@ -0,0 +1,61 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      trace_vcd.h
+*@brief     Host VCD writer for test point trace
+*@author    Ziga Miklosic
+*@date      12.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TRACE_VCD
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host VCD writer for test point trace
+*
+* 	Records test point edges with monotonic host timestamps into Value
+* 	Change Dump file, which can be opened in GTKWave or PulseView. Each
+* 	test point is dumped as separate wire.
+*
+* @note	Host builds only!
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __TRACE_VCD_H
+#define __TRACE_VCD_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Trace VCD status
+ */
+typedef enum
+{
+	eTRACE_VCD_OK = 0,		/**<Normal operation */
+	eTRACE_VCD_ERROR,		/**<General error code */
+} trace_vcd_status_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+trace_vcd_status_t	trace_vcd_open	(const char * const p_path);
+void				trace_vcd_write	(const uint32_t mask, const bool level);
+trace_vcd_status_t	trace_vcd_close	(void);
+
+#endif // __TRACE_VCD_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
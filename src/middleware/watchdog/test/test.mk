@@ -0,0 +1,7 @@
+# Watchdog supervisor and journal on simulated clock
+WDT_DIR := $(ROOT)/src/middleware/watchdog
+
+TESTS += wdt_sup
+
+wdt_sup_SRC		:= $(WDT_DIR)/test/test_wdt_sup.c $(WDT_DIR)/wdt_sup.c $(WDT_DIR)/wdt_cfg.c $(ROOT)/src/middleware/journal/journal.c $(ROOT)/src/middleware/crc32/crc32_fast.c
+wdt_sup_CFLAGS	:= -DJOURNAL_NOINIT_SECTION=\"journal_noinit\"
@@ -0,0 +1,487 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test_wdt_sup.c
+*@brief     Watchdog supervisor host test
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup WDT_SUP_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Supervisor and journal run on simulated WDT clock. Reboot is
+* 	simulated by calling journal_init() and wdt_sup_init() again, as
+* 	retained journal RAM keeps its content within test process.
+*
+* 	Journal is placed into "journal_noinit" section, thus test can
+* 	corrupt retained RAM through linker provided section symbols.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "test.h"
+#include "nrf.h"
+#include "middleware/watchdog/wdt_sup.h"
+#include "middleware/watchdog/wdt_if.h"
+#include "middleware/journal/journal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated reset reasons, POWER RESETREAS
+ */
+#define TEST_RESETREAS_DOG				( 0x02UL )
+#define TEST_RESETREAS_SREQ				( 0x04UL )
+
+/**
+ * 	Number of random report intervals
+ */
+#define TEST_HIST_REPORTS				( 10000U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Simulated clock
+ *
+ * 	Unit: ms
+ */
+static uint32_t gu32_test_ms = 0UL;
+
+/**
+ * 	Reports passed to watchdog core
+ */
+static uint32_t gu32_test_report_cnt[eWDT_TASK_NUM_OF] = {0};
+
+/**
+ * 	Retained journal RAM, provided by linker
+ */
+extern uint8_t __start_journal_noinit[];
+extern uint8_t __stop_journal_noinit[];
+
+/**
+ * 	Random generator state
+ */
+static uint32_t gu32_test_rand = 1UL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clock stand-ins
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint32_t systick_get_ms(void)
+{
+	return gu32_test_ms;
+}
+
+uint32_t wdt_if_get_systick(void)
+{
+	return gu32_test_ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Watchdog core stand-in
+*/
+////////////////////////////////////////////////////////////////////////////////
+wdt_status_t wdt_task_report(const wdt_task_t task)
+{
+	gu32_test_report_cnt[task]++;
+
+	return eWDT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Linear congruential generator
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_rand(void)
+{
+	gu32_test_rand = ( gu32_test_rand * 1664525UL ) + 1013904223UL;
+
+	return ( gu32_test_rand >> 8U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Simulated reset
+*
+* @return		journal of previous run
+*/
+////////////////////////////////////////////////////////////////////////////////
+static journal_info_t test_reboot(const uint32_t resetreas)
+{
+	journal_info_t info = {0};
+
+	NRF_POWER->RESETREAS = resetreas;
+
+	TEST_ASSERT_EQ( journal_init(), eJOURNAL_OK );
+	TEST_ASSERT_EQ( wdt_sup_init(), eWDT_OK );
+	TEST_ASSERT_EQ( journal_get_last( &info ), eJOURNAL_OK );
+	TEST_ASSERT_EQ( info.resetreas, resetreas );
+
+	return info;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Report all enabled tasks except one
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_report_all(const wdt_task_t skip)
+{
+	const wdt_cfg_t * const p_cfg = (const wdt_cfg_t*) wdt_cfg_get_table();
+
+	for ( uint32_t task = 0; task < eWDT_TASK_NUM_OF; task++ )
+	{
+		if (( task != skip ) && ( true == p_cfg[task].enable ))
+		{
+			TEST_ASSERT_EQ( wdt_sup_report( task ), eWDT_OK );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cold boot
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_cold(void)
+{
+	journal_info_t info = {0};
+
+	// Power-on, retained RAM holds garbage
+	memset( __start_journal_noinit, 0xA5, (size_t)( __stop_journal_noinit - __start_journal_noinit ));
+
+	gu32_test_ms = 5UL;
+	info = test_reboot( 0UL );
+
+	TEST_ASSERT_EQ( info.boot_cnt, 1U );
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_NONE );
+	TEST_ASSERT_EQ( info.evt_num_of, 0U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Report interval histogram
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_hist(void)
+{
+	const wdt_cfg_t * const	p_cfg		= (const wdt_cfg_t*) wdt_cfg_get_table();
+	const uint32_t			timeout		= p_cfg[eWDT_TASK_MAIN].timeout;
+	const uint32_t			edge_to		= p_cfg[eWDT_TASK_1000MS].timeout;
+	const uint32_t			width		= edge_to / WDT_CFG_SUP_HIST_BINS;
+	uint32_t				exp[WDT_CFG_SUP_HIST_BINS] = {0};
+	uint32_t				exp_max		= 0;
+	wdt_sup_stats_t			stats		= {0};
+	uint32_t				reports		= gu32_test_report_cnt[eWDT_TASK_MAIN];
+	uint32_t				last_ms		= gu32_test_ms;
+	const uint32_t			interval[]	=
+	{
+		0U, width - 1U, width, ( 3U * width ) + 1U, edge_to - 1U, edge_to, 3U * edge_to,
+	};
+	const uint32_t			bin[]		=
+	{
+		0U, 0U, 1U, 3U, WDT_CFG_SUP_HIST_BINS - 1U, WDT_CFG_SUP_HIST_BINS - 1U, WDT_CFG_SUP_HIST_BINS - 1U,
+	};
+
+	// Bin edges, exact in ms for slowest task
+	TEST_ASSERT_EQ( edge_to % WDT_CFG_SUP_HIST_BINS, 0U );
+
+	for ( uint32_t i = 0; i < ( sizeof( interval ) / sizeof( interval[0] )); i++ )
+	{
+		gu32_test_ms += interval[i];
+		TEST_ASSERT_EQ( wdt_sup_report( eWDT_TASK_1000MS ), eWDT_OK );
+
+		exp[bin[i]]++;
+		exp_max = ( interval[i] > exp_max ) ? interval[i] : exp_max;
+	}
+
+	TEST_ASSERT_EQ( wdt_sup_get_stats( eWDT_TASK_1000MS, &stats ), eWDT_OK );
+
+	for ( uint32_t i = 0; i < WDT_CFG_SUP_HIST_BINS; i++ )
+	{
+		TEST_ASSERT_EQ( stats.hist[i], exp[i] );
+	}
+
+	TEST_ASSERT_EQ( stats.max_ms, exp_max );
+
+	// Random intervals around timeout, bin is floor( interval * bins / timeout )
+	memset( exp, 0, sizeof( exp ));
+	exp_max = 0;
+
+	TEST_ASSERT_EQ( wdt_sup_get_stats( eWDT_TASK_MAIN, &stats ), eWDT_OK );
+	TEST_ASSERT_EQ( stats.max_ms, 0U );
+
+	for ( uint32_t i = 0; i < TEST_HIST_REPORTS; i++ )
+	{
+		uint32_t ms = test_rand() % (( timeout * 5U ) / 4U );
+
+		// First interval since init also covers edge reports above
+		gu32_test_ms 	+= ms;
+		ms				= gu32_test_ms - last_ms;
+		last_ms			= gu32_test_ms;
+
+		TEST_ASSERT_EQ( wdt_sup_report( eWDT_TASK_MAIN ), eWDT_OK );
+
+		exp[( ms < timeout ) ? (( ms * WDT_CFG_SUP_HIST_BINS ) / timeout ) : ( WDT_CFG_SUP_HIST_BINS - 1U )]++;
+		exp_max = ( ms > exp_max ) ? ms : exp_max;
+	}
+
+	TEST_ASSERT_EQ( wdt_sup_get_stats( eWDT_TASK_MAIN, &stats ), eWDT_OK );
+
+	for ( uint32_t i = 0; i < WDT_CFG_SUP_HIST_BINS; i++ )
+	{
+		TEST_ASSERT_EQ( stats.hist[i], exp[i] );
+	}
+
+	TEST_ASSERT_EQ( stats.max_ms, exp_max );
+
+	// Every report reaches watchdog core
+	reports = gu32_test_report_cnt[eWDT_TASK_MAIN] - reports;
+	TEST_ASSERT_EQ( reports, TEST_HIST_REPORTS );
+
+	// Other tasks untouched
+	TEST_ASSERT_EQ( wdt_sup_get_stats( eWDT_TASK_COMM, &stats ), eWDT_OK );
+	TEST_ASSERT_EQ( stats.max_ms, 0U );
+
+	// Invalid arguments
+	TEST_ASSERT_EQ( wdt_sup_get_stats( eWDT_TASK_MAIN, NULL ), eWDT_ERROR );
+	TEST_ASSERT_EQ( test_assert_hits(), 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Event ring wraparound across regular reset
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_ring(void)
+{
+	const uint32_t	reports		= ( 2U * JOURNAL_EVT_SIZE ) + 5U;
+	journal_info_t	info		= {0};
+	uint32_t		boot_cnt	= 0;
+
+	info		= test_reboot( TEST_RESETREAS_SREQ );
+	boot_cnt	= info.boot_cnt;
+
+	for ( uint32_t i = 0; i < reports; i++ )
+	{
+		gu32_test_ms += 7UL;
+		TEST_ASSERT_EQ( wdt_sup_report((wdt_task_t)( i % eWDT_TASK_NUM_OF )), eWDT_OK );
+	}
+
+	info = test_reboot( TEST_RESETREAS_SREQ );
+
+	TEST_ASSERT_EQ( info.boot_cnt, boot_cnt + 1U );
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_NONE );
+
+	// Boot event and oldest reports are overwritten, oldest first
+	TEST_ASSERT_EQ( info.evt_num_of, JOURNAL_EVT_SIZE );
+
+	for ( uint32_t i = 0; i < info.evt_num_of; i++ )
+	{
+		const uint32_t report = ( reports - JOURNAL_EVT_SIZE ) + i;
+
+		TEST_ASSERT_EQ( info.evt[i].id, eJOURNAL_EVT_WDT_REPORT );
+		TEST_ASSERT_EQ( info.evt[i].arg, report % eWDT_TASK_NUM_OF );
+		TEST_ASSERT_EQ( info.evt[i].time_ms, gu32_test_ms - ( 7UL * ( reports - 1U - report )));
+	}
+
+	// Less than ring size, boot event first
+	gu32_test_ms += 1UL;
+	TEST_ASSERT_EQ( wdt_sup_report( eWDT_TASK_COMM ), eWDT_OK );
+
+	info = test_reboot( TEST_RESETREAS_SREQ );
+
+	TEST_ASSERT_EQ( info.evt_num_of, 2U );
+	TEST_ASSERT_EQ( info.evt[0].id, eJOURNAL_EVT_BOOT );
+	TEST_ASSERT_EQ( info.evt[1].id, eJOURNAL_EVT_WDT_REPORT );
+	TEST_ASSERT_EQ( info.evt[1].arg, eWDT_TASK_COMM );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Pre-reset capture, reboot and decode
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_crash(void)
+{
+	const wdt_cfg_t * const	p_cfg		= (const wdt_cfg_t*) wdt_cfg_get_table();
+	journal_info_t			info		= {0};
+	uint32_t				boot_cnt	= 0;
+	uint32_t				stall_start	= 0;
+	uint32_t				crash_ms	= 0;
+
+	info		= test_reboot( TEST_RESETREAS_SREQ );
+	boot_cnt	= info.boot_cnt;
+
+	// Communication stalls, others keep reporting
+	stall_start = gu32_test_ms;
+
+	while (( gu32_test_ms - stall_start ) < ( p_cfg[eWDT_TASK_COMM].timeout + 150UL ))
+	{
+		gu32_test_ms += 10UL;
+		test_report_all( eWDT_TASK_COMM );
+	}
+
+	crash_ms = gu32_test_ms;
+	wdt_sup_pre_reset( 0x00012345UL, 0x00023457UL );
+
+	// Reset by watchdog
+	gu32_test_ms = 3UL;
+	info = test_reboot( TEST_RESETREAS_DOG );
+
+	TEST_ASSERT_EQ( info.boot_cnt, boot_cnt + 1U );
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_WDT );
+	TEST_ASSERT_EQ( info.time_ms, crash_ms );
+	TEST_ASSERT_EQ( info.pc, 0x00012345UL );
+	TEST_ASSERT_EQ( info.lr, 0x00023457UL );
+	TEST_ASSERT_EQ( WDT_SUP_INFO_TASK( info.info ), eWDT_TASK_COMM );
+	TEST_ASSERT_EQ( WDT_SUP_INFO_STALLED_MS( info.info ), crash_ms - stall_start );
+	TEST_ASSERT( NULL == info.p_file );
+
+	// Last events are reports of live tasks before reset
+	TEST_ASSERT_EQ( info.evt_num_of, JOURNAL_EVT_SIZE );
+	TEST_ASSERT_EQ( info.evt[JOURNAL_EVT_SIZE - 1U].id, eJOURNAL_EVT_WDT_REPORT );
+	TEST_ASSERT_EQ( info.evt[JOURNAL_EVT_SIZE - 1U].time_ms, crash_ms );
+
+	for ( uint32_t i = 0; i < info.evt_num_of; i++ )
+	{
+		TEST_ASSERT( eWDT_TASK_COMM != info.evt[i].arg );
+	}
+
+	// Most overdue wins, not longest elapsed: 1000 ms task is 300 ms
+	// overdue after 3300 ms, main loop 500 ms overdue after 600 ms
+	gu32_test_ms += 2700UL;
+	test_report_all( eWDT_TASK_1000MS );
+	gu32_test_ms += 600UL;
+	wdt_sup_pre_reset( 0UL, 0UL );
+
+	info = test_reboot( TEST_RESETREAS_DOG );
+
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_WDT );
+	TEST_ASSERT_EQ( WDT_SUP_INFO_TASK( info.info ), eWDT_TASK_MAIN );
+	TEST_ASSERT_EQ( WDT_SUP_INFO_STALLED_MS( info.info ), 600U );
+
+	// No task overdue
+	gu32_test_ms += 10UL;
+	wdt_sup_pre_reset( 0UL, 0UL );
+
+	info = test_reboot( TEST_RESETREAS_DOG );
+
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_WDT );
+	TEST_ASSERT_EQ( WDT_SUP_INFO_TASK( info.info ), eWDT_TASK_NUM_OF );
+	TEST_ASSERT_EQ( WDT_SUP_INFO_STALLED_MS( info.info ), 0U );
+
+	// Stall time saturates
+	gu32_test_ms += 0x7FFFFFFFUL;
+	wdt_sup_pre_reset( 0UL, 0UL );
+
+	info = test_reboot( TEST_RESETREAS_DOG );
+
+	TEST_ASSERT_EQ( WDT_SUP_INFO_STALLED_MS( info.info ), 0x00FFFFFFUL );
+
+	// Reported only once
+	info = test_reboot( TEST_RESETREAS_SREQ );
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_NONE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Corrupted retained RAM is rejected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_corrupt(void)
+{
+	const size_t	size	= (size_t)( __stop_journal_noinit - __start_journal_noinit );
+	journal_info_t	info	= {0};
+	journal_info_t	ref		= {0};
+
+	TEST_ASSERT( size >= ( JOURNAL_EVT_SIZE * sizeof( journal_evt_t )));
+	TEST_ASSERT(( 1U + ( 3U * eWDT_TASK_NUM_OF )) < JOURNAL_EVT_SIZE );
+
+	// Reference without corruption
+	info = test_reboot( TEST_RESETREAS_SREQ );
+
+	for ( uint32_t i = 0; i < 3U; i++ )
+	{
+		gu32_test_ms += 10UL;
+		test_report_all( eWDT_TASK_NUM_OF );
+	}
+
+	gu32_test_ms += 10UL;
+	wdt_sup_pre_reset( 0x1000UL, 0x2000UL );
+
+	// Single event with bad check byte is dropped, record stays valid.
+	// Event ring is at the end of retained journal.
+	__start_journal_noinit[ size - (( JOURNAL_EVT_SIZE - 5U ) * sizeof( journal_evt_t )) ] ^= 0x01U;
+
+	ref = test_reboot( TEST_RESETREAS_DOG );
+
+	TEST_ASSERT_EQ( ref.fault, eJOURNAL_FAULT_WDT );
+	TEST_ASSERT_EQ( ref.boot_cnt, info.boot_cnt + 1U );
+	TEST_ASSERT_EQ( ref.evt_num_of, 3U * eWDT_TASK_NUM_OF );
+
+	// Same capture, record bit flip
+	gu32_test_ms += 10UL;
+	wdt_sup_pre_reset( 0x1000UL, 0x2000UL );
+
+	__start_journal_noinit[4U * 4U] ^= 0x80U;
+
+	info = test_reboot( TEST_RESETREAS_DOG );
+
+	// Treated as cold boot
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_NONE );
+	TEST_ASSERT_EQ( info.boot_cnt, 1U );
+	TEST_ASSERT_EQ( info.pc, 0U );
+	TEST_ASSERT_EQ( info.evt_num_of, 0U );
+
+	// Journal works again after rejection
+	gu32_test_ms += 10UL;
+	wdt_sup_pre_reset( 0x1000UL, 0x2000UL );
+
+	info = test_reboot( TEST_RESETREAS_DOG );
+
+	TEST_ASSERT_EQ( info.fault, eJOURNAL_FAULT_WDT );
+	TEST_ASSERT_EQ( info.boot_cnt, 2U );
+	TEST_ASSERT_EQ( info.pc, 0x1000UL );
+}
+
+int main(int argc, char ** argv)
+{
+	test_init( argc, argv );
+
+	test_cold();
+	test_hist();
+	test_ring();
+	test_crash();
+	test_corrupt();
+
+	TEST_ASSERT_EQ( test_assert_hits(), 1 );
+
+	return test_result();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -41,7 +41,10 @@ static const wdt_cfg_t g_wdt_cfg_table[eWDT_TASK_NUM_OF] =
 	//                      Task name               Report timeout [ms]	    Enable flag 	
 	// ----------------------------------------------------------------------------------------
 
-	[eWDT_TASK_MAIN] = { .p_name = "Main loop",      .timeout=100UL,         .enable=true   },
+	[eWDT_TASK_MAIN]    = { .p_name = "Main loop",      .timeout=100UL,         .enable=true   },
+	[eWDT_TASK_COMM]    = { .p_name = "Communication",  .timeout=100UL,         .enable=true   },
+	[eWDT_TASK_100MS]   = { .p_name = "App 100ms",      .timeout=500UL,         .enable=true   },
+	[eWDT_TASK_1000MS]  = { .p_name = "App 1000ms",     .timeout=3000UL,        .enable=true   },
 
 	// ----------------------------------------------------------------------------------------
 
@@ -50,6 +50,9 @@ typedef enum
 	// USER CODE START...
 
 	eWDT_TASK_MAIN = 0,
+	eWDT_TASK_COMM,
+	eWDT_TASK_100MS,
+	eWDT_TASK_1000MS,
 
 	// USER CODE END...
 
@@ -126,6 +129,14 @@ typedef enum
  */
 #define WDT_CFG_STATS_EN						( 1 )
 
+/**
+ * 	Number of report interval histogram bins
+ *
+ * @note	Bins split task timeout evenly, last bin also counts
+ * 			intervals beyond timeout.
+ */
+#define WDT_CFG_SUP_HIST_BINS					( 8U )
+
 /**
  * 	Platform weak definition
  */
@@ -34,6 +34,10 @@
 
 // WDT periphery
 #include "nrf_drv_wdt.h"
+#include "nrf.h"
+
+// Task supervisor
+#include "wdt_sup.h"
 
 // USER INCLUDE END...
 
@@ -43,6 +47,26 @@
 
 // USER DEFINITIONS BEGIN...
 
+/**
+ *  Number of stack words searched for exception frame
+ */
+#define WDT_IF_FRAME_SEARCH_DEPTH       ( 32U )
+
+/**
+ *  Exception return (EXC_RETURN) pattern and process stack flag
+ */
+#define WDT_IF_EXC_RETURN_MASK          ( 0xFFFFFFE3UL )
+#define WDT_IF_EXC_RETURN_VAL           ( 0xFFFFFFE1UL )
+#define WDT_IF_EXC_RETURN_PSP           ( 0x00000004UL )
+
+/**
+ *  Exception frame word positions and xPSR thumb bit
+ */
+#define WDT_IF_FRAME_LR                 ( 5U )
+#define WDT_IF_FRAME_PC                 ( 6U )
+#define WDT_IF_FRAME_XPSR               ( 7U )
+#define WDT_IF_XPSR_THUMB               ( 0x01000000UL )
+
 // USER DEFINITIONS END...
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +85,7 @@ static nrf_drv_wdt_channel_id g_wdt_ch_id = 0;
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
+static const uint32_t * wdt_if_get_exc_frame(void);
 
 /**
  * @brief WDT events handler.
@@ -68,6 +93,49 @@ static nrf_drv_wdt_channel_id g_wdt_ch_id = 0;
 void wdt_event_handler(void)
 {
     //NOTE: The max amount of time we can spend in WDT interrupt is two cycles of 32768[Hz] clock - after that, reset occurs
+    const uint32_t * p_frame = wdt_if_get_exc_frame();
+
+    if ( NULL != p_frame )
+    {
+        wdt_sup_pre_reset( p_frame[WDT_IF_FRAME_PC], p_frame[WDT_IF_FRAME_LR] );
+    }
+    else
+    {
+        wdt_sup_pre_reset( 0UL, 0UL );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find exception frame of interrupted code
+*
+* @note     WDT IRQ handler pushes EXC_RETURN (LR) on entry, hardware
+*           stacked frame lies right above it. Frame is accepted only
+*           if stacked xPSR has thumb bit set.
+*
+* @return		p_frame - Pointer to exception frame, NULL if not found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static const uint32_t * wdt_if_get_exc_frame(void)
+{
+    const uint32_t * p_sp       = (const uint32_t*) __get_MSP();
+    const uint32_t * p_frame    = NULL;
+
+    for ( uint32_t i = 0; i < WDT_IF_FRAME_SEARCH_DEPTH; i++ )
+    {
+        if ( WDT_IF_EXC_RETURN_VAL == ( p_sp[i] & WDT_IF_EXC_RETURN_MASK ))
+        {
+            const uint32_t * p_cand = ( p_sp[i] & WDT_IF_EXC_RETURN_PSP ) ? (const uint32_t*) __get_PSP() : &p_sp[i+1];
+
+            if ( p_cand[WDT_IF_FRAME_XPSR] & WDT_IF_XPSR_THUMB )
+            {
+                p_frame = p_cand;
+                break;
+            }
+        }
+    }
+
+    return p_frame;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -234,25 +302,6 @@ wdt_status_t wdt_if_release_mutex(void)
     return status;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Watchdog pre-reset ISR 
-*
-* @note     User shall provide definition of that function based 
-*           on used platform!
-*
-*           Also put here /ref wdt_pre_reset_isr_callback if needed!
-*
-*
-* @code     // Example code: TODO:
-*
-* @endcode
-*
-* @return		void
-*/
-////////////////////////////////////////////////////////////////////////////////
-// TODO: ...
-
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
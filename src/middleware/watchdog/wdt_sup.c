@@ -0,0 +1,259 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      wdt_sup.c
+*@brief     Watchdog task supervisor
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup WDT_SUP
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Pre-reset capture runs inside WDT interrupt, which has only two
+* 	32.768 kHz cycles before reset. Therefore it only finds stalled task
+* 	and seals journal record, which is validated and decoded at next
+* 	boot by journal.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+
+#include "wdt_sup.h"
+#include "wdt_if.h"
+
+#include "middleware/journal/journal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Maximum stall time in journal fault info
+ *
+ * 	Unit: ms
+ */
+#define WDT_SUP_INFO_STALLED_MAX		( 0x00FFFFFFUL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization guard
+ */
+static bool gb_is_init = false;
+
+/**
+ * 	Pointer to watchdog configuration table
+ */
+static const wdt_cfg_t * gp_wdt_sup_cfg = NULL;
+
+/**
+ * 	Last report time per task
+ *
+ *  Unit: ms
+ */
+static volatile uint32_t gu32_wdt_sup_last_ms[eWDT_TASK_NUM_OF] = {0};
+
+/**
+ * 	Report statistics per task
+ */
+static wdt_sup_stats_t g_wdt_sup_stats[eWDT_TASK_NUM_OF] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup WDT_SUP_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize watchdog supervisor
+*
+* @note		Call after journal_init() and before watchdog is started!
+*
+* @return		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+wdt_status_t wdt_sup_init(void)
+{
+	wdt_status_t status = eWDT_OK;
+
+	gp_wdt_sup_cfg = (const wdt_cfg_t*) wdt_cfg_get_table();
+
+	if ( NULL != gp_wdt_sup_cfg )
+	{
+		const uint32_t now_ms = wdt_if_get_systick();
+
+		for ( uint32_t task = 0; task < eWDT_TASK_NUM_OF; task++ )
+		{
+			gu32_wdt_sup_last_ms[task] = now_ms;
+		}
+
+		gb_is_init = true;
+	}
+	else
+	{
+		status = eWDT_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Report task is alive
+*
+* @note		Replaces direct call of wdt_task_report().
+*
+* @param[in]	task	- Watchdog task
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+wdt_status_t wdt_sup_report(const wdt_task_t task)
+{
+	wdt_status_t status = eWDT_OK;
+
+	WDT_ASSERT( true == gb_is_init );
+	WDT_ASSERT( task < eWDT_TASK_NUM_OF );
+
+	if	(	( true == gb_is_init )
+		&&	( task < eWDT_TASK_NUM_OF ))
+	{
+		const uint32_t now_ms		= wdt_if_get_systick();
+		const uint32_t interval_ms	= (uint32_t)( now_ms - gu32_wdt_sup_last_ms[task] );
+		const uint32_t timeout_ms	= gp_wdt_sup_cfg[task].timeout;
+		wdt_sup_stats_t * const p_stats = &g_wdt_sup_stats[task];
+
+		gu32_wdt_sup_last_ms[task] = now_ms;
+
+		// Bin width is timeout/WDT_CFG_SUP_HIST_BINS, last bin is open ended
+		uint32_t bin = WDT_CFG_SUP_HIST_BINS - 1U;
+
+		if ( interval_ms < timeout_ms )
+		{
+			bin = (uint32_t)(((uint64_t) interval_ms * WDT_CFG_SUP_HIST_BINS ) / timeout_ms );
+		}
+
+		p_stats->hist[bin]++;
+
+		if ( interval_ms > p_stats->max_ms )
+		{
+			p_stats->max_ms = interval_ms;
+		}
+
+		journal_event( eJOURNAL_EVT_WDT_REPORT, (uint8_t) task );
+
+		status = wdt_task_report( task );
+	}
+	else
+	{
+		status = eWDT_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get task report statistics
+*
+* @param[in]	task	- Watchdog task
+* @param[out]	p_stats	- Report statistics
+* @return		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+wdt_status_t wdt_sup_get_stats(const wdt_task_t task, wdt_sup_stats_t * const p_stats)
+{
+	wdt_status_t status = eWDT_OK;
+
+	WDT_ASSERT( true == gb_is_init );
+	WDT_ASSERT( task < eWDT_TASK_NUM_OF );
+	WDT_ASSERT( NULL != p_stats );
+
+	if	(	( true == gb_is_init )
+		&&	( task < eWDT_TASK_NUM_OF )
+		&&	( NULL != p_stats ))
+	{
+		*p_stats = g_wdt_sup_stats[task];
+	}
+	else
+	{
+		status = eWDT_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Record watchdog reset into journal
+*
+* @note		Called from watchdog pre-reset interrupt!
+*
+* @param[in]	pc	- Interrupted program counter
+* @param[in]	lr	- Interrupted link register
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void wdt_sup_pre_reset(const uint32_t pc, const uint32_t lr)
+{
+	const uint32_t	now_ms		= wdt_if_get_systick();
+	uint32_t		task_stall	= eWDT_TASK_NUM_OF;
+	uint32_t		stalled_ms	= 0;
+	int32_t			overdue_max	= 0;
+
+	// Task most overdue
+	if ( true == gb_is_init )
+	{
+		for ( uint32_t task = 0; task < eWDT_TASK_NUM_OF; task++ )
+		{
+			if ( true == gp_wdt_sup_cfg[task].enable )
+			{
+				const uint32_t elapsed_ms 	= (uint32_t)( now_ms - gu32_wdt_sup_last_ms[task] );
+				const int32_t overdue 		= (int32_t)( elapsed_ms - gp_wdt_sup_cfg[task].timeout );
+
+				if ( overdue > overdue_max )
+				{
+					overdue_max = overdue;
+					task_stall	= task;
+					stalled_ms	= elapsed_ms;
+				}
+			}
+		}
+	}
+
+	if ( stalled_ms > WDT_SUP_INFO_STALLED_MAX )
+	{
+		stalled_ms = WDT_SUP_INFO_STALLED_MAX;
+	}
+
+	journal_fault( eJOURNAL_FAULT_WDT, pc, lr, NULL, 0UL, (( stalled_ms << 8U ) | ( task_stall & 0xFFUL )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,87 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      wdt_sup.h
+*@brief     Watchdog task supervisor
+*@author    Ziga Miklosic
+*@date      05.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup WDT_SUP
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Watchdog task supervisor
+*
+* 	Sits in front of watchdog task reporting. Each report updates
+* 	histogram of report intervals (in fractions of task timeout) and
+* 	worst-case interval, and is added to journal event ring.
+*
+* 	On watchdog pre-reset interrupt stalled task and interrupted PC/LR
+* 	are recorded into journal as eJOURNAL_FAULT_WDT. Record is decoded
+* 	at next boot by journal_init() together with last events, use
+* 	WDT_SUP_INFO_TASK/WDT_SUP_INFO_STALLED_MS to decode fault info.
+*
+* 	Time base is wdt_if_get_systick(), thus supervisor can be driven by
+* 	simulated clock.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __WDT_SUP_H
+#define __WDT_SUP_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "wdt_cfg.h"
+#include "watchdog/src/wdt.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Task report statistics
+ */
+typedef struct
+{
+	uint32_t	hist[WDT_CFG_SUP_HIST_BINS];	/**<Report interval histogram, bin width timeout/WDT_CFG_SUP_HIST_BINS */
+	uint32_t	max_ms;							/**<Worst-case report interval. Unit: ms */
+} wdt_sup_stats_t;
+
+/**
+ * 	Journal fault info of watchdog reset
+ *
+ * 	Bits 0..7 hold stalled task (eWDT_TASK_NUM_OF if none overdue),
+ * 	bits 8..31 time since its last report in ms, saturated.
+ */
+#define WDT_SUP_INFO_TASK(info)					((uint32_t)(info) & 0xFFUL )
+#define WDT_SUP_INFO_STALLED_MS(info)			((uint32_t)(info) >> 8U )
+
+/**
+ * 	Invalid configuration catcher
+ */
+#if (( WDT_CFG_SUP_HIST_BINS < 1 ) || ( WDT_CFG_SUP_HIST_BINS > 32 ))
+	#error "Invalid number of histogram bins! Adjust <WDT_CFG_SUP_HIST_BINS> macro inside wdt_cfg.h file!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+wdt_status_t	wdt_sup_init		(void);
+wdt_status_t	wdt_sup_report		(const wdt_task_t task);
+wdt_status_t	wdt_sup_get_stats	(const wdt_task_t task, wdt_sup_stats_t * const p_stats);
+void			wdt_sup_pre_reset	(const uint32_t pc, const uint32_t lr);
+
+#endif // __WDT_SUP_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -18,25 +18,33 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include "project_config.h"
 #include "nrf_delay.h"
+#include "app_error.h"
 #include "gpio.h"
 
+#include "middleware/journal/journal.h"
+
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
 
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void project_config_panic(void);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*	Project level assert handler
+*	Panic mode, blink all LEDs forever
 *
 * @return   void
 */
 ////////////////////////////////////////////////////////////////////////////////
-void project_config_assert_fail(void)
+static void project_config_panic(void)
 {
     gpio_init();
 
@@ -57,6 +65,61 @@ void project_config_assert_fail(void)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*	Project level assert handler
+*
+* @param[in]    p_file  - Source file of failed assertion
+* @param[in]    line    - Source line of failed assertion
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void project_config_assert_fail(const char * const p_file, const uint32_t line)
+{
+    journal_fault( eJOURNAL_FAULT_ASSERT, (uint32_t) __builtin_return_address(0), 0UL, p_file, line, 0UL );
+
+    project_config_panic();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*	SDK application error handler
+*
+* @note     Overrides weak definition from "app_error_weak.c". Called by
+*           APP_ERROR_HANDLER and APP_ERROR_CHECK.
+*
+* @param[in]    id      - Fault identifier
+* @param[in]    pc      - Program counter of fault
+* @param[in]    info    - Fault specific info
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info)
+{
+    __disable_irq();
+
+    if ( NRF_FAULT_ID_SDK_ERROR == id )
+    {
+        const error_info_t * p_info = (const error_info_t*) info;
+        journal_fault( eJOURNAL_FAULT_APP_ERROR, pc, 0UL, (const char*) p_info->p_file_name, p_info->line_num, p_info->err_code );
+    }
+    else if ( NRF_FAULT_ID_SDK_ASSERT == id )
+    {
+        const assert_info_t * p_info = (const assert_info_t*) info;
+        journal_fault( eJOURNAL_FAULT_APP_ERROR, pc, 0UL, (const char*) p_info->p_file_name, p_info->line_num, id );
+    }
+    else
+    {
+        journal_fault( eJOURNAL_FAULT_APP_ERROR, pc, 0UL, NULL, 0UL, id );
+    }
+
+#if ( 1 == PROJECT_CONFIG_DEBUG_EN )
+    project_config_panic();
+#else
+    NVIC_SystemReset();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -21,6 +21,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,8 +63,8 @@ typedef float float32_t;
  * 	Project assertion
  */
 #if ( PROJECT_CONFIG_DEBUG_EN )
-    void project_config_assert_fail(void);
-    #define PROJECT_CONFIG_ASSERT(x)			if( !( x )) { project_config_assert_fail(); }
+    void project_config_assert_fail(const char * const p_file, const uint32_t line);
+    #define PROJECT_CONFIG_ASSERT(x)			if( !( x )) { project_config_assert_fail( __FILE__, __LINE__ ); }
 #else
     #define PROJECT_CONFIG_ASSERT(x)			{ ; }
 #endif
@@ -0,0 +1,39 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      app_error.h
+*@brief     Error handler stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __APP_ERROR_STUB_H
+#define __APP_ERROR_STUB_H
+
+#include "sdk_errors.h"
+
+/**
+ * 	Number of APP_ERROR_HANDLER calls
+ */
+extern volatile uint32_t gu32_stub_app_error;
+
+#define APP_ERROR_HANDLER(err)			{ (void)( err ); gu32_stub_app_error++; }
+#define APP_ERROR_CHECK(err)			{ if ( NRF_SUCCESS != ( err )) { gu32_stub_app_error++; }}
+
+#endif // __APP_ERROR_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
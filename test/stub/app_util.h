@@ -0,0 +1,39 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      app_util.h
+*@brief     Utilities stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __APP_UTIL_STUB_H
+#define __APP_UTIL_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CONCAT_2(p1, p2)				CONCAT_2_(p1, p2)
+#define CONCAT_2_(p1, p2)				p1##p2
+
+#define NUM_VA_ARGS_LESS_1_IMPL(_ignored, _0, _1, _2, _3, _4, _5, _6, _7, _8, _9, N, ...)	N
+#define NUM_VA_ARGS_LESS_1(...)			NUM_VA_ARGS_LESS_1_IMPL(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, ~)
+
+#endif // __APP_UTIL_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
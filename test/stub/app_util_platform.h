@@ -0,0 +1,51 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      app_util_platform.h
+*@brief     Platform utilities stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __APP_UTIL_PLATFORM_STUB_H
+#define __APP_UTIL_PLATFORM_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sdk_errors.h"
+
+/**
+ * 	Critical region
+ *
+ * @note	Tests call ISR stand-ins from the same thread, so region only
+ * 			counts nesting. Tests may check it is balanced.
+ */
+extern volatile uint32_t gu32_stub_critical_nest;
+
+#define CRITICAL_REGION_ENTER()			{ gu32_stub_critical_nest++;
+#define CRITICAL_REGION_EXIT()			gu32_stub_critical_nest--; }
+
+#define APP_IRQ_PRIORITY_HIGHEST		( 2 )
+#define APP_IRQ_PRIORITY_HIGH			( 2 )
+#define APP_IRQ_PRIORITY_MID			( 4 )
+#define APP_IRQ_PRIORITY_LOW			( 6 )
+#define APP_IRQ_PRIORITY_LOWEST			( 7 )
+
+#endif // __APP_UTIL_PLATFORM_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,56 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      button.h
+*@brief     Button core stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for button submodule header, only types used by
+* 	button configuration and debouncer.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_STUB_H
+#define __BUTTON_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drivers/hmi/button/button_cfg.h"
+#include "drivers/peripheral/gpio/gpio.h"
+
+typedef enum
+{
+	eBUTTON_OK		= 0x00,
+	eBUTTON_ERROR	= 0x01,
+} button_status_t;
+
+typedef enum
+{
+	eBUTTON_POL_ACTIVE_HIGH = 0,
+	eBUTTON_POL_ACTIVE_LOW,
+} button_polarity_t;
+
+typedef struct
+{
+	gpio_pins_t			gpio_pin;
+	button_polarity_t	polarity;
+	float				lpf_fc;
+	bool				lpf_en;
+} button_cfg_t;
+
+#endif // __BUTTON_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,49 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      crc16.h
+*@brief     CRC-16-CCITT stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK library, same algorithm as SDK (CCITT, init
+* 	0xFFFF when "p_crc" is NULL).
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __CRC16_STUB_H
+#define __CRC16_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+static inline uint16_t crc16_compute(uint8_t const * p_data, uint32_t size, uint16_t const * p_crc)
+{
+	uint16_t crc = ( NULL == p_crc ) ? 0xFFFFU : *p_crc;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		crc  = (uint16_t)((uint8_t)( crc >> 8 ) | ( crc << 8 ));
+		crc ^= p_data[i];
+		crc ^= (uint8_t)( crc & 0xFFU ) >> 4;
+		crc ^= (uint16_t)(( crc << 8 ) << 4 );
+		crc ^= (uint16_t)((( crc & 0xFFU ) << 4 ) << 1 );
+	}
+
+	return crc;
+}
+
+#endif // __CRC16_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      led.h
+*@brief     LED core stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for LED submodule header, only types and functions
+* 	used by LED configuration and sequence engine. Functions are
+* 	implemented by test.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __LED_STUB_H
+#define __LED_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drivers/hmi/led/led_cfg.h"
+
+typedef enum
+{
+	eLED_OK		= 0x00,
+	eLED_ERROR	= 0x01,
+} led_status_t;
+
+typedef enum
+{
+	eLED_OFF = 0,
+	eLED_ON,
+} led_state_t;
+
+typedef enum
+{
+	eLED_BLINK_CONTINUOUS = 0,
+	eLED_BLINK_1X,
+	eLED_BLINK_2X,
+	eLED_BLINK_3X,
+	eLED_BLINK_4X,
+	eLED_BLINK_5X,
+	eLED_BLINK_6X,
+	eLED_BLINK_7X,
+	eLED_BLINK_8X,
+	eLED_BLINK_9X,
+	eLED_BLINK_10X,
+} led_blink_t;
+
+typedef enum
+{
+	eLED_POL_ACTIVE_HIGH = 0,
+	eLED_POL_ACTIVE_LOW,
+} led_polarity_t;
+
+typedef enum
+{
+	eLED_DRV_GPIO = 0,
+	eLED_DRV_TIMER_PWM,
+} led_drv_type_t;
+
+typedef struct
+{
+	float32_t	fade_in_time;
+	float32_t	fade_out_time;
+	float32_t	max_duty;
+} led_fade_cfg_t;
+
+typedef struct
+{
+	led_drv_type_t	drv_type;
+	union
+	{
+		timer_ch_t	tim_ch;
+		uint32_t	gpio_pin;
+	} drv_ch;
+	led_state_t		initial_state;
+	led_polarity_t	polarity;
+} led_cfg_t;
+
+led_status_t led_set			(const led_num_t num, const led_state_t state);
+led_status_t led_set_smooth		(const led_num_t num, const led_state_t state);
+led_status_t led_blink_smooth	(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+led_status_t led_set_fade_cfg	(const led_num_t num, const led_fade_cfg_t * const p_fade_cfg);
+
+#endif // __LED_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,59 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      cli.h
+*@brief     CLI library stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for CLI submodule header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __CLI_STUB_H
+#define __CLI_STUB_H
+
+#include <stdint.h>
+
+#include "middleware/cli/cli_cfg.h"
+
+typedef enum
+{
+	eCLI_OK				= 0x00,
+	eCLI_ERROR			= 0x01,
+	eCLI_ERROR_INIT		= 0x02,
+} cli_status_t;
+
+typedef void (*pf_cli_cmd)(const uint8_t * p_attr);
+
+typedef struct
+{
+	const char *	p_name;
+	pf_cli_cmd		p_func;
+	const char *	p_help;
+} cli_cmd_t;
+
+typedef struct
+{
+	cli_cmd_t	cmd[CLI_CFG_MAX_NUM_OF_COMMANDS];
+	uint32_t	num_of;
+} cli_cmd_table_t;
+
+cli_status_t cli_printf				(char * p_format, ...);
+cli_status_t cli_printf_ch			(const cli_ch_opt_t ch, char * p_format, ...);
+cli_status_t cli_register_cmd_table	(const cli_cmd_table_t * const p_cmd_table);
+
+#endif // __CLI_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
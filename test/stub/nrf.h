@@ -0,0 +1,77 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf.h
+*@brief     Device header stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_STUB_H
+#define __NRF_STUB_H
+
+#include <stdint.h>
+
+#define __NVIC_PRIO_BITS				( 3UL )
+
+typedef enum
+{
+	SysTick_IRQn	= -1,
+	RTC2_IRQn		= 36,
+} IRQn_Type;
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)	{ }
+static inline void NVIC_ClearPendingIRQ(IRQn_Type irq)					{ }
+static inline void NVIC_EnableIRQ(IRQn_Type irq)						{ }
+
+// Event register, weak no-op in stub.c, tests simulating sleep override them
+void __WFE(void);
+void __SEV(void);
+
+/**
+ * 	Peripheral registers, plain memory defined in stub.c
+ */
+typedef struct
+{
+	volatile uint32_t	RESETREAS;
+} NRF_POWER_Type;
+
+typedef struct
+{
+	volatile uint32_t	CODEPAGESIZE;
+	volatile uint32_t	CODESIZE;
+} NRF_FICR_Type;
+
+typedef struct
+{
+	volatile uint32_t	CFSR;
+	volatile uint32_t	HFSR;
+	volatile uint32_t	MMFAR;
+	volatile uint32_t	BFAR;
+} SCB_Type;
+
+extern NRF_POWER_Type	g_stub_nrf_power;
+extern NRF_FICR_Type	g_stub_nrf_ficr;
+extern SCB_Type			g_stub_scb;
+
+#define NRF_POWER						( &g_stub_nrf_power )
+#define NRF_FICR						( &g_stub_nrf_ficr )
+#define SCB								( &g_stub_scb )
+
+#endif // __NRF_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
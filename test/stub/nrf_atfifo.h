@@ -0,0 +1,113 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_atfifo.h
+*@brief     Atomic FIFO stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+* 	Tests push and pop from the same thread, thus plain ring buffer
+* 	of "item_cnt" items is enough.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_ATFIFO_STUB_H
+#define __NRF_ATFIFO_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sdk_errors.h"
+
+typedef struct
+{
+	uint8_t *	p_buf;
+	uint32_t	item_size;
+	uint32_t	item_cnt;
+	uint32_t	head;
+	uint32_t	tail;
+} nrf_atfifo_t;
+
+typedef struct
+{
+	uint32_t	idx;
+} nrf_atfifo_item_put_t;
+
+typedef struct
+{
+	uint32_t	idx;
+} nrf_atfifo_item_get_t;
+
+#define NRF_ATFIFO_DEF(fifo_id, storage_type, count)																\
+	static storage_type		fifo_id##_data[(count)];																\
+	static nrf_atfifo_t		fifo_id##_inst = { (uint8_t*) fifo_id##_data, sizeof( storage_type ), (count), 0, 0 };	\
+	static nrf_atfifo_t * const fifo_id = &fifo_id##_inst
+
+#define NRF_ATFIFO_INIT(fifo_id)	nrf_atfifo_init( fifo_id )
+
+static inline ret_code_t nrf_atfifo_init(nrf_atfifo_t * const p_fifo)
+{
+	p_fifo->head = 0;
+	p_fifo->tail = 0;
+
+	return NRF_SUCCESS;
+}
+
+static inline void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+{
+	void * p_item = NULL;
+
+	if (( p_fifo->tail - p_fifo->head ) < p_fifo->item_cnt )
+	{
+		p_context->idx	= p_fifo->tail % p_fifo->item_cnt;
+		p_item			= &p_fifo->p_buf[p_context->idx * p_fifo->item_size];
+	}
+
+	return p_item;
+}
+
+static inline bool nrf_atfifo_item_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+{
+	(void) p_context;
+	p_fifo->tail++;
+
+	return true;
+}
+
+static inline void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+{
+	void * p_item = NULL;
+
+	if ( p_fifo->tail != p_fifo->head )
+	{
+		p_context->idx	= p_fifo->head % p_fifo->item_cnt;
+		p_item			= &p_fifo->p_buf[p_context->idx * p_fifo->item_size];
+	}
+
+	return p_item;
+}
+
+static inline bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+{
+	(void) p_context;
+	p_fifo->head++;
+
+	return true;
+}
+
+#endif // __NRF_ATFIFO_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
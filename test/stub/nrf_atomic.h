@@ -0,0 +1,59 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_atomic.h
+*@brief     Atomic operations stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_ATOMIC_STUB_H
+#define __NRF_ATOMIC_STUB_H
+
+#include <stdint.h>
+
+typedef volatile uint32_t nrf_atomic_flag_t;
+typedef volatile uint32_t nrf_atomic_u32_t;
+
+static inline uint32_t nrf_atomic_flag_set(nrf_atomic_flag_t * p_data)
+{
+	return __atomic_exchange_n( p_data, 1UL, __ATOMIC_SEQ_CST );
+}
+
+static inline uint32_t nrf_atomic_flag_clear_fetch(nrf_atomic_flag_t * p_data)
+{
+	return __atomic_exchange_n( p_data, 0UL, __ATOMIC_SEQ_CST );
+}
+
+static inline uint32_t nrf_atomic_u32_fetch_store(nrf_atomic_u32_t * p_data, uint32_t value)
+{
+	return __atomic_exchange_n( p_data, value, __ATOMIC_SEQ_CST );
+}
+
+static inline uint32_t nrf_atomic_u32_add(nrf_atomic_u32_t * p_data, uint32_t value)
+{
+	return __atomic_add_fetch( p_data, value, __ATOMIC_SEQ_CST );
+}
+
+static inline uint32_t nrf_atomic_u32_fetch_or(nrf_atomic_u32_t * p_data, uint32_t value)
+{
+	return __atomic_fetch_or( p_data, value, __ATOMIC_SEQ_CST );
+}
+
+#endif // __NRF_ATOMIC_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,50 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_clock.h
+*@brief     Legacy clock driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_CLOCK_STUB_H
+#define __NRF_DRV_CLOCK_STUB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sdk_errors.h"
+
+typedef struct nrf_drv_clock_handler_item_s nrf_drv_clock_handler_item_t;
+
+static inline ret_code_t nrf_drv_clock_init(void)
+{
+	return NRF_SUCCESS;
+}
+
+static inline void nrf_drv_clock_lfclk_request(nrf_drv_clock_handler_item_t * p_handler_item)
+{
+}
+
+static inline bool nrf_drv_clock_lfclk_is_running(void)
+{
+	return true;
+}
+
+#endif // __NRF_DRV_CLOCK_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_gpiote.h
+*@brief     Legacy GPIOTE driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+* 	Functions are provided by test, which records configuration and
+* 	raises pin events.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_GPIOTE_STUB_H
+#define __NRF_DRV_GPIOTE_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_gpio.h"
+#include "sdk_errors.h"
+
+typedef uint32_t nrf_drv_gpiote_pin_t;
+
+typedef enum
+{
+	NRF_GPIOTE_POLARITY_LOTOHI	= 1,
+	NRF_GPIOTE_POLARITY_HITOLO	= 2,
+	NRF_GPIOTE_POLARITY_TOGGLE	= 3,
+} nrf_gpiote_polarity_t;
+
+typedef struct
+{
+	nrf_gpiote_polarity_t	sense;
+	nrf_gpio_pin_pull_t		pull;
+	bool					is_watcher;
+	bool					hi_accuracy;
+	bool					skip_gpio_setup;
+} nrf_drv_gpiote_in_config_t;
+
+typedef void (*nrf_drv_gpiote_evt_handler_t)(nrf_drv_gpiote_pin_t pin, nrf_gpiote_polarity_t action);
+
+#define GPIOTE_CONFIG_IN_SENSE_TOGGLE(hi_accu)	\
+{												\
+	.sense 			= NRF_GPIOTE_POLARITY_TOGGLE,	\
+	.pull 			= NRF_GPIO_PIN_NOPULL,			\
+	.is_watcher 	= false,						\
+	.hi_accuracy 	= hi_accu,						\
+	.skip_gpio_setup= false,						\
+}
+
+bool		nrf_drv_gpiote_is_init			(void);
+ret_code_t	nrf_drv_gpiote_init				(void);
+ret_code_t	nrf_drv_gpiote_in_init			(nrf_drv_gpiote_pin_t pin, nrf_drv_gpiote_in_config_t const * p_config, nrf_drv_gpiote_evt_handler_t evt_handler);
+void		nrf_drv_gpiote_in_event_enable	(nrf_drv_gpiote_pin_t pin, bool int_enable);
+
+#endif // __NRF_DRV_GPIOTE_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
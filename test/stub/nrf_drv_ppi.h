@@ -0,0 +1,61 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_ppi.h
+*@brief     Legacy PPI driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_PPI_STUB_H
+#define __NRF_DRV_PPI_STUB_H
+
+#include <stdint.h>
+
+#include "sdk_errors.h"
+
+typedef uint8_t nrf_ppi_channel_t;
+
+static inline ret_code_t nrf_drv_ppi_init(void)
+{
+	return NRF_SUCCESS;
+}
+
+static inline ret_code_t nrf_drv_ppi_channel_alloc(nrf_ppi_channel_t * p_channel)
+{
+	*p_channel = 0;
+	return NRF_SUCCESS;
+}
+
+static inline ret_code_t nrf_drv_ppi_channel_assign(nrf_ppi_channel_t channel, uint32_t eep, uint32_t tep)
+{
+	return NRF_SUCCESS;
+}
+
+static inline ret_code_t nrf_drv_ppi_channel_fork_assign(nrf_ppi_channel_t channel, uint32_t fork_tep)
+{
+	return NRF_SUCCESS;
+}
+
+static inline ret_code_t nrf_drv_ppi_channel_enable(nrf_ppi_channel_t channel)
+{
+	return NRF_SUCCESS;
+}
+
+#endif // __NRF_DRV_PPI_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_pwm.h
+*@brief     Legacy PWM driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_PWM_STUB_H
+#define __NRF_DRV_PWM_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sdk_errors.h"
+#include "app_util_platform.h"
+
+#define NRF_PWM_CHANNEL_COUNT			( 4 )
+#define NRF_DRV_PWM_PIN_NOT_USED		( 0xFF )
+
+#define NRFX_PWM_FLAG_STOP				( 0x01UL )
+#define NRFX_PWM_FLAG_LOOP				( 0x02UL )
+#define NRFX_PWM_FLAG_NO_EVT_FINISHED	( 0x10UL )
+
+/**
+ * 	Peripheral registers, plain memory defined in stub.c
+ */
+typedef struct
+{
+	volatile uint32_t	EVENTS_LOOPSDONE;
+} NRF_PWM_Type;
+
+typedef enum
+{
+	NRF_PWM_EVENT_LOOPSDONE = 0,
+} nrf_pwm_event_t;
+
+extern NRF_PWM_Type g_stub_nrf_pwm0;
+
+static inline void nrf_pwm_event_clear(NRF_PWM_Type * p_reg, nrf_pwm_event_t event)	{ p_reg->EVENTS_LOOPSDONE = 0UL; }
+
+typedef struct
+{
+	NRF_PWM_Type *	p_registers;
+	uint8_t			drv_inst_idx;
+} nrf_drv_pwm_t;
+
+#define NRF_DRV_PWM_INSTANCE(id)		{ .p_registers = &g_stub_nrf_pwm0, .drv_inst_idx = ( id ) }
+
+typedef enum
+{
+	NRF_PWM_CLK_16MHz = 0,
+	NRF_PWM_CLK_8MHz,
+	NRF_PWM_CLK_4MHz,
+	NRF_PWM_CLK_2MHz,
+	NRF_PWM_CLK_1MHz,
+	NRF_PWM_CLK_500kHz,
+	NRF_PWM_CLK_250kHz,
+	NRF_PWM_CLK_125kHz,
+} nrf_pwm_clk_t;
+
+typedef enum
+{
+	NRF_PWM_MODE_UP = 0,
+	NRF_PWM_MODE_UP_AND_DOWN,
+} nrf_pwm_mode_t;
+
+typedef enum
+{
+	NRF_PWM_LOAD_COMMON = 0,
+	NRF_PWM_LOAD_GROUPED,
+	NRF_PWM_LOAD_INDIVIDUAL,
+	NRF_PWM_LOAD_WAVE_FORM,
+} nrf_pwm_dec_load_t;
+
+typedef enum
+{
+	NRF_PWM_STEP_AUTO = 0,
+	NRF_PWM_STEP_TRIGGERED,
+} nrf_pwm_dec_step_t;
+
+typedef struct
+{
+	uint16_t channel_0;
+	uint16_t channel_1;
+	uint16_t channel_2;
+	uint16_t channel_3;
+} nrf_pwm_values_individual_t;
+
+typedef union
+{
+	uint16_t const *					p_raw;
+	nrf_pwm_values_individual_t const *	p_individual;
+} nrf_pwm_values_t;
+
+typedef struct
+{
+	nrf_pwm_values_t	values;
+	uint16_t			length;
+	uint32_t			repeats;
+	uint32_t			end_delay;
+} nrf_pwm_sequence_t;
+
+typedef struct
+{
+	uint8_t				output_pins[NRF_PWM_CHANNEL_COUNT];
+	uint8_t				irq_priority;
+	nrf_pwm_clk_t		base_clock;
+	nrf_pwm_mode_t		count_mode;
+	uint16_t			top_value;
+	nrf_pwm_dec_load_t	load_mode;
+	nrf_pwm_dec_step_t	step_mode;
+} nrf_drv_pwm_config_t;
+
+typedef enum
+{
+	NRFX_PWM_EVT_FINISHED = 0,
+	NRFX_PWM_EVT_END_SEQ0,
+	NRFX_PWM_EVT_END_SEQ1,
+	NRFX_PWM_EVT_STOPPED,
+} nrfx_pwm_evt_type_t;
+
+typedef void (*nrf_drv_pwm_handler_t)(nrfx_pwm_evt_type_t event_type);
+
+ret_code_t	nrf_drv_pwm_init			(nrf_drv_pwm_t const * const p_instance, nrf_drv_pwm_config_t const * p_config, nrf_drv_pwm_handler_t handler);
+uint32_t	nrf_drv_pwm_simple_playback	(nrf_drv_pwm_t const * const p_instance, nrf_pwm_sequence_t const * p_sequence, uint16_t playback_count, uint32_t flags);
+uint32_t	nrf_drv_pwm_complex_playback(nrf_drv_pwm_t const * const p_instance, nrf_pwm_sequence_t const * p_sequence_0, nrf_pwm_sequence_t const * p_sequence_1, uint16_t playback_count, uint32_t flags);
+
+#endif // __NRF_DRV_PWM_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,159 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_saadc.h
+*@brief     Legacy SAADC driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_SAADC_STUB_H
+#define __NRF_DRV_SAADC_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sdk_errors.h"
+
+typedef enum
+{
+	NRF_SAADC_RESOLUTION_8BIT = 0,
+	NRF_SAADC_RESOLUTION_10BIT,
+	NRF_SAADC_RESOLUTION_12BIT,
+	NRF_SAADC_RESOLUTION_14BIT,
+} nrf_saadc_resolution_t;
+
+typedef enum
+{
+	NRF_SAADC_OVERSAMPLE_DISABLED = 0,
+} nrf_saadc_oversample_t;
+
+typedef enum
+{
+	NRF_SAADC_INPUT_DISABLED = 0,
+	NRF_SAADC_INPUT_AIN0,
+	NRF_SAADC_INPUT_AIN1,
+	NRF_SAADC_INPUT_AIN2,
+	NRF_SAADC_INPUT_AIN3,
+	NRF_SAADC_INPUT_AIN4,
+	NRF_SAADC_INPUT_AIN5,
+	NRF_SAADC_INPUT_AIN6,
+	NRF_SAADC_INPUT_AIN7,
+	NRF_SAADC_INPUT_VDD,
+} nrf_saadc_input_t;
+
+typedef enum
+{
+	NRF_SAADC_RESISTOR_DISABLED = 0,
+	NRF_SAADC_RESISTOR_PULLDOWN,
+	NRF_SAADC_RESISTOR_PULLUP,
+	NRF_SAADC_RESISTOR_VDD1_2,
+} nrf_saadc_resistor_t;
+
+typedef enum
+{
+	NRF_SAADC_GAIN1_6 = 0,
+	NRF_SAADC_GAIN1_5,
+	NRF_SAADC_GAIN1_4,
+	NRF_SAADC_GAIN1_3,
+	NRF_SAADC_GAIN1_2,
+	NRF_SAADC_GAIN1,
+	NRF_SAADC_GAIN2,
+	NRF_SAADC_GAIN4,
+} nrf_saadc_gain_t;
+
+typedef enum
+{
+	NRF_SAADC_REFERENCE_INTERNAL = 0,
+	NRF_SAADC_REFERENCE_VDD4,
+} nrf_saadc_reference_t;
+
+typedef enum
+{
+	NRF_SAADC_ACQTIME_3US = 0,
+	NRF_SAADC_ACQTIME_5US,
+	NRF_SAADC_ACQTIME_10US,
+	NRF_SAADC_ACQTIME_15US,
+	NRF_SAADC_ACQTIME_20US,
+	NRF_SAADC_ACQTIME_40US,
+} nrf_saadc_acqtime_t;
+
+typedef enum
+{
+	NRF_SAADC_MODE_SINGLE_ENDED = 0,
+	NRF_SAADC_MODE_DIFFERENTIAL,
+} nrf_saadc_mode_t;
+
+typedef enum
+{
+	NRF_SAADC_BURST_DISABLED = 0,
+	NRF_SAADC_BURST_ENABLED,
+} nrf_saadc_burst_t;
+
+typedef struct
+{
+	nrf_saadc_resistor_t	resistor_p;
+	nrf_saadc_resistor_t	resistor_n;
+	nrf_saadc_gain_t		gain;
+	nrf_saadc_reference_t	reference;
+	nrf_saadc_acqtime_t		acq_time;
+	nrf_saadc_mode_t		mode;
+	nrf_saadc_burst_t		burst;
+	nrf_saadc_input_t		pin_p;
+	nrf_saadc_input_t		pin_n;
+} nrf_saadc_channel_config_t;
+
+typedef struct
+{
+	nrf_saadc_resolution_t	resolution;
+	nrf_saadc_oversample_t	oversample;
+	uint8_t					interrupt_priority;
+	bool					low_power_mode;
+} nrf_drv_saadc_config_t;
+
+typedef enum
+{
+	NRF_DRV_SAADC_EVT_DONE = 0,
+	NRFX_SAADC_EVT_LIMIT,
+	NRFX_SAADC_EVT_CALIBRATEDONE,
+} nrf_drv_saadc_evt_type_t;
+
+typedef struct
+{
+	nrf_drv_saadc_evt_type_t type;
+	union
+	{
+		struct
+		{
+			int16_t *	p_buffer;
+			uint16_t	size;
+		} done;
+	} data;
+} nrf_drv_saadc_evt_t;
+
+typedef void (*nrf_drv_saadc_event_handler_t)(nrf_drv_saadc_evt_t const * p_event);
+
+ret_code_t	nrf_drv_saadc_init				(const nrf_drv_saadc_config_t * p_config, nrf_drv_saadc_event_handler_t event_handler);
+ret_code_t	nrf_drv_saadc_channel_init		(uint8_t channel, const nrf_saadc_channel_config_t * const p_config);
+ret_code_t	nrf_drv_saadc_calibrate_offset	(void);
+ret_code_t	nrf_drv_saadc_buffer_convert	(int16_t * buffer, uint16_t size);
+uint32_t	nrf_drv_saadc_sample_task_get	(void);
+bool		nrf_drv_saadc_is_busy			(void);
+
+#endif // __NRF_DRV_SAADC_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
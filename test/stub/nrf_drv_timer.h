@@ -0,0 +1,117 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_timer.h
+*@brief     Legacy timer driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_TIMER_STUB_H
+#define __NRF_DRV_TIMER_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sdk_errors.h"
+
+typedef struct
+{
+	uint8_t instance_id;
+} nrf_drv_timer_t;
+
+#define NRF_DRV_TIMER_INSTANCE(id)			{ .instance_id = ( id ) }
+
+typedef enum
+{
+	NRF_TIMER_BIT_WIDTH_16 = 0,
+	NRF_TIMER_BIT_WIDTH_32 = 3,
+} nrf_timer_bit_width_t;
+
+typedef enum
+{
+	NRF_TIMER_CC_CHANNEL0 = 0,
+} nrf_timer_cc_channel_t;
+
+typedef enum
+{
+	NRF_TIMER_EVENT_COMPARE0 = 0,
+} nrf_timer_event_t;
+
+typedef enum
+{
+	NRF_TIMER_TASK_START = 0,
+	NRF_TIMER_TASK_CLEAR,
+} nrf_timer_task_t;
+
+#define NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK	( 1UL )
+#define NRF_TIMER_SHORT_COMPARE0_STOP_MASK	( 0x100UL )
+
+typedef struct
+{
+	uint32_t				frequency;
+	uint32_t				mode;
+	nrf_timer_bit_width_t	bit_width;
+	uint8_t					interrupt_priority;
+	void *					p_context;
+} nrf_drv_timer_config_t;
+
+#define NRF_DRV_TIMER_DEFAULT_CONFIG		{ .frequency = 0, .mode = 0, .bit_width = NRF_TIMER_BIT_WIDTH_16, .interrupt_priority = 7, .p_context = NULL }
+
+typedef void (*nrfx_timer_event_handler_t)(nrf_timer_event_t event_type, void * p_context);
+
+/**
+ * 	Event handler per instance, defined in stub.c. Tests raise timer
+ * 	events by calling it.
+ */
+#define NRF_DRV_TIMER_STUB_NUM_OF			( 5 )
+
+extern nrfx_timer_event_handler_t g_stub_timer_hndl[NRF_DRV_TIMER_STUB_NUM_OF];
+
+static inline ret_code_t nrf_drv_timer_init(const nrf_drv_timer_t * p_instance, const nrf_drv_timer_config_t * p_config, nrfx_timer_event_handler_t handler)
+{
+	g_stub_timer_hndl[p_instance->instance_id] = handler;
+
+	return NRF_SUCCESS;
+}
+
+static inline uint32_t nrf_drv_timer_us_to_ticks(const nrf_drv_timer_t * p_instance, uint32_t time_us)
+{
+	return ( time_us * 16UL );
+}
+
+static inline void nrf_drv_timer_extended_compare(const nrf_drv_timer_t * p_instance, nrf_timer_cc_channel_t cc_channel, uint32_t cc_value, uint32_t timer_short_mask, bool enable_int)
+{
+}
+
+static inline void nrf_drv_timer_enable(const nrf_drv_timer_t * p_instance)
+{
+}
+
+static inline uint32_t nrf_drv_timer_compare_event_address_get(const nrf_drv_timer_t * p_instance, nrf_timer_cc_channel_t channel)
+{
+	return 0UL;
+}
+
+static inline uint32_t nrf_drv_timer_task_address_get(const nrf_drv_timer_t * p_instance, nrf_timer_task_t timer_task)
+{
+	return 0UL;
+}
+
+#endif // __NRF_DRV_TIMER_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,108 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_drv_uart.h
+*@brief     Legacy UART driver stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_DRV_UART_STUB_H
+#define __NRF_DRV_UART_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sdk_errors.h"
+#include "nrf_uart.h"
+#include "nrf_uarte.h"
+
+/**
+ * 	Number of driver instances
+ */
+#define NRF_DRV_UART_STUB_NUM_OF		( 2 )
+
+/**
+ * 	Register blocks of instances
+ */
+extern NRF_UARTE_Type g_nrf_drv_uart_stub_reg[NRF_DRV_UART_STUB_NUM_OF];
+
+typedef struct
+{
+	struct
+	{
+		NRF_UARTE_Type * p_reg;
+	} uarte;
+	uint8_t inst_idx;
+} nrf_drv_uart_t;
+
+#define NRF_DRV_UART_INSTANCE(id)		{ .uarte = { .p_reg = &g_nrf_drv_uart_stub_reg[id] }, .inst_idx = ( id ) }
+
+typedef enum
+{
+	NRF_DRV_UART_EVT_TX_DONE,
+	NRF_DRV_UART_EVT_RX_DONE,
+	NRF_DRV_UART_EVT_ERROR,
+} nrf_drv_uart_evt_type_t;
+
+typedef struct
+{
+	uint8_t *	p_data;
+	uint32_t	bytes;
+} nrf_drv_uart_xfer_evt_t;
+
+typedef struct
+{
+	nrf_drv_uart_xfer_evt_t	rxtx;
+	uint32_t				error_mask;
+} nrf_drv_uart_error_evt_t;
+
+typedef struct
+{
+	nrf_drv_uart_evt_type_t type;
+	union
+	{
+		nrf_drv_uart_xfer_evt_t		rxtx;
+		nrf_drv_uart_error_evt_t	error;
+	} data;
+} nrf_drv_uart_event_t;
+
+typedef void (*nrf_uart_event_handler_t)(nrf_drv_uart_event_t * p_event, void * p_context);
+
+typedef struct
+{
+	uint32_t			pseltxd;
+	uint32_t			pselrxd;
+	uint32_t			pselcts;
+	uint32_t			pselrts;
+	void *				p_context;
+	nrf_uart_hwfc_t		hwfc;
+	nrf_uart_parity_t	parity;
+	uint32_t			baudrate;
+	uint8_t				interrupt_priority;
+	bool				use_easy_dma;
+} nrf_drv_uart_config_t;
+
+ret_code_t	nrf_drv_uart_init			(const nrf_drv_uart_t * p_instance, const nrf_drv_uart_config_t * p_config, nrf_uart_event_handler_t event_handler);
+ret_code_t	nrf_drv_uart_tx				(const nrf_drv_uart_t * p_instance, const uint8_t * const p_data, uint8_t length);
+ret_code_t	nrf_drv_uart_rx				(const nrf_drv_uart_t * p_instance, uint8_t * p_data, uint8_t length);
+bool		nrf_drv_uart_tx_in_progress	(const nrf_drv_uart_t * p_instance);
+void		nrf_drv_uart_rx_abort		(const nrf_drv_uart_t * p_instance);
+
+#endif // __NRF_DRV_UART_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
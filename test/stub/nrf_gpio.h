@@ -0,0 +1,40 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_gpio.h
+*@brief     GPIO HAL stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_GPIO_STUB_H
+#define __NRF_GPIO_STUB_H
+
+#include <stdint.h>
+
+#define NRF_GPIO_PIN_MAP(port,pin)		((( port ) << 5 ) | (( pin ) & 0x1F ))
+
+typedef enum
+{
+	NRF_GPIO_PIN_NOPULL		= 0,
+	NRF_GPIO_PIN_PULLDOWN	= 1,
+	NRF_GPIO_PIN_PULLUP		= 3,
+} nrf_gpio_pin_pull_t;
+
+#endif // __NRF_GPIO_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
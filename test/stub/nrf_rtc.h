@@ -0,0 +1,71 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_rtc.h
+*@brief     RTC HAL stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_RTC_STUB_H
+#define __NRF_RTC_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf.h"
+
+/**
+ * 	RTC registers are modelled by mock linked with the test
+ */
+typedef struct
+{
+	uint32_t id;
+} NRF_RTC_Type;
+
+extern NRF_RTC_Type g_nrf_rtc_stub_reg;
+
+#define NRF_RTC2						( &g_nrf_rtc_stub_reg )
+
+typedef enum
+{
+	NRF_RTC_TASK_START = 0,
+	NRF_RTC_TASK_STOP,
+	NRF_RTC_TASK_CLEAR,
+} nrf_rtc_task_t;
+
+typedef enum
+{
+	NRF_RTC_EVENT_COMPARE_0 = 0,
+	NRF_RTC_EVENT_OVERFLOW,
+} nrf_rtc_event_t;
+
+#define NRF_RTC_INT_COMPARE0_MASK		( 1UL << 16 )
+#define NRF_RTC_INT_OVERFLOW_MASK		( 1UL << 1 )
+
+void		nrf_rtc_task_trigger	(NRF_RTC_Type * p_reg, nrf_rtc_task_t task);
+void		nrf_rtc_prescaler_set	(NRF_RTC_Type * p_reg, uint32_t val);
+void		nrf_rtc_cc_set			(NRF_RTC_Type * p_reg, uint32_t ch, uint32_t cc_val);
+uint32_t	nrf_rtc_cc_get			(NRF_RTC_Type * p_reg, uint32_t ch);
+uint32_t	nrf_rtc_counter_get		(NRF_RTC_Type * p_reg);
+bool		nrf_rtc_event_pending	(NRF_RTC_Type * p_reg, nrf_rtc_event_t event);
+void		nrf_rtc_event_clear		(NRF_RTC_Type * p_reg, nrf_rtc_event_t event);
+void		nrf_rtc_int_enable		(NRF_RTC_Type * p_reg, uint32_t mask);
+
+#endif // __NRF_RTC_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,43 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_uart.h
+*@brief     UART HAL stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_UART_STUB_H
+#define __NRF_UART_STUB_H
+
+#define NRF_UART_PSEL_DISCONNECTED		( 0xFFFFFFFFUL )
+
+typedef enum
+{
+	NRF_UART_HWFC_DISABLED = 0,
+	NRF_UART_HWFC_ENABLED,
+} nrf_uart_hwfc_t;
+
+typedef enum
+{
+	NRF_UART_PARITY_EXCLUDED = 0,
+	NRF_UART_PARITY_INCLUDED,
+} nrf_uart_parity_t;
+
+#endif // __NRF_UART_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
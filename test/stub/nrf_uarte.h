@@ -0,0 +1,69 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nrf_uarte.h
+*@brief     UARTE HAL stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __NRF_UARTE_STUB_H
+#define __NRF_UARTE_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * 	UARTE registers, only events used by drivers
+ */
+typedef struct
+{
+	volatile uint32_t EVENTS_RXDRDY;
+} NRF_UARTE_Type;
+
+typedef enum
+{
+	NRF_UARTE_EVENT_RXDRDY = 0,
+} nrf_uarte_event_t;
+
+typedef enum
+{
+	NRF_UARTE_BAUDRATE_115200	= 0x01D60000UL,
+	NRF_UARTE_BAUDRATE_1000000	= 0x10000000UL,
+} nrf_uarte_baudrate_t;
+
+static inline bool nrf_uarte_event_check(NRF_UARTE_Type * p_reg, nrf_uarte_event_t event)
+{
+	(void) event;
+	return ( 0UL != p_reg->EVENTS_RXDRDY );
+}
+
+static inline uint32_t nrf_uarte_event_address_get(NRF_UARTE_Type * p_reg, nrf_uarte_event_t event)
+{
+	(void) event;
+	return (uint32_t)(uintptr_t) &p_reg->EVENTS_RXDRDY;
+}
+
+static inline void nrf_uarte_event_clear(NRF_UARTE_Type * p_reg, nrf_uarte_event_t event)
+{
+	(void) event;
+	p_reg->EVENTS_RXDRDY = 0UL;
+}
+
+#endif // __NRF_UARTE_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
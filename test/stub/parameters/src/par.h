@@ -0,0 +1,96 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par.h
+*@brief     Parameters library stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for parameters submodule header, only what firmware
+* 	modules use. Parameter core is provided by mock of the test.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __PAR_STUB_H
+#define __PAR_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "project_config.h"
+#include "middleware/parameters/par_cfg.h"
+
+typedef enum
+{
+	ePAR_OK				= 0x00,
+	ePAR_ERROR			= 0x01,
+	ePAR_ERROR_INIT		= 0x02,
+	ePAR_ERROR_NVM		= 0x04,
+	ePAR_ERROR_CRC		= 0x08,
+	ePAR_ERROR_TYPE		= 0x10,
+	ePAR_ERROR_MUTEX	= 0x20,
+	ePAR_ERROR_VALUE	= 0x40,
+} par_status_t;
+
+typedef enum
+{
+	ePAR_TYPE_U8 = 0,
+	ePAR_TYPE_I8,
+	ePAR_TYPE_U16,
+	ePAR_TYPE_I16,
+	ePAR_TYPE_U32,
+	ePAR_TYPE_I32,
+	ePAR_TYPE_F32,
+
+	ePAR_TYPE_NUM_OF
+} par_type_list_t;
+
+typedef union
+{
+	uint8_t		u8;
+	int8_t		i8;
+	uint16_t	u16;
+	int16_t		i16;
+	uint32_t	u32;
+	int32_t		i32;
+	float32_t	f32;
+} par_type_t;
+
+typedef enum
+{
+	ePAR_ACCESS_RO = 0,
+	ePAR_ACCESS_RW,
+} par_io_acess_t;
+
+typedef struct
+{
+	const char *		name;
+	par_type_t			min;
+	par_type_t			max;
+	par_type_t			def;
+	const char *		unit;
+	const char *		desc;
+	uint16_t			id;
+	par_type_list_t		type;
+	par_io_acess_t		access;
+	bool				persistant;
+} par_cfg_t;
+
+par_status_t par_init	(void);
+par_status_t par_set	(const par_num_t par_num, const void * p_val);
+par_status_t par_get	(const par_num_t par_num, void * const p_val);
+
+#endif // __PAR_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,44 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      sdk_errors.h
+*@brief     SDK error codes stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK header, only what firmware modules use.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __SDK_ERRORS_STUB_H
+#define __SDK_ERRORS_STUB_H
+
+#include <stdint.h>
+
+typedef uint32_t ret_code_t;
+
+#define NRF_SUCCESS						( 0UL )
+#define NRF_ERROR_INTERNAL				( 3UL )
+#define NRF_ERROR_NO_MEM				( 4UL )
+#define NRF_ERROR_NOT_FOUND				( 5UL )
+#define NRF_ERROR_INVALID_STATE			( 8UL )
+#define NRF_ERROR_INVALID_LENGTH		( 9UL )
+#define NRF_ERROR_INVALID_DATA			( 11UL )
+#define NRF_ERROR_NULL					( 14UL )
+#define NRF_ERROR_BUSY					( 17UL )
+#define NRF_ERROR_MODULE_ALREADY_INITIALIZED	( 0x8005UL )
+
+#endif // __SDK_ERRORS_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
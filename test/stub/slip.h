@@ -0,0 +1,146 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      slip.h
+*@brief     SLIP encoder and decoder stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for SDK library, same behaviour as SDK: encoder appends
+* 	closing END only, decoder returns NRF_ERROR_BUSY until END.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __SLIP_STUB_H
+#define __SLIP_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "sdk_errors.h"
+
+#define SLIP_BYTE_END				( 0xC0U )
+#define SLIP_BYTE_ESC				( 0xDBU )
+#define SLIP_BYTE_ESC_END			( 0xDCU )
+#define SLIP_BYTE_ESC_ESC			( 0xDDU )
+
+typedef enum
+{
+	SLIP_STATE_DECODING,
+	SLIP_STATE_ESC_RECEIVED,
+	SLIP_STATE_CLEARING_INVALID_PACKET,
+} slip_read_state_t;
+
+typedef struct
+{
+	slip_read_state_t	state;
+	uint8_t *			p_buffer;
+	uint32_t			current_index;
+	uint32_t			buffer_len;
+} slip_t;
+
+static inline ret_code_t slip_encode(uint8_t * p_output, uint8_t * p_input, uint32_t input_length, uint32_t * p_output_buffer_length)
+{
+	ret_code_t ret = NRF_ERROR_NULL;
+
+	if (( NULL != p_output ) && ( NULL != p_input ) && ( NULL != p_output_buffer_length ))
+	{
+		uint32_t len = 0;
+
+		for ( uint32_t i = 0; i < input_length; i++ )
+		{
+			if ( SLIP_BYTE_END == p_input[i] )
+			{
+				p_output[len++] = SLIP_BYTE_ESC;
+				p_output[len++] = SLIP_BYTE_ESC_END;
+			}
+			else if ( SLIP_BYTE_ESC == p_input[i] )
+			{
+				p_output[len++] = SLIP_BYTE_ESC;
+				p_output[len++] = SLIP_BYTE_ESC_ESC;
+			}
+			else
+			{
+				p_output[len++] = p_input[i];
+			}
+		}
+
+		p_output[len++] = SLIP_BYTE_END;
+		*p_output_buffer_length = len;
+		ret = NRF_SUCCESS;
+	}
+
+	return ret;
+}
+
+static inline ret_code_t slip_decode_add_byte(slip_t * p_slip, uint8_t c)
+{
+	ret_code_t ret = NRF_ERROR_BUSY;
+
+	if ( NULL == p_slip )
+	{
+		ret = NRF_ERROR_NULL;
+	}
+	else if ( p_slip->current_index == p_slip->buffer_len )
+	{
+		ret = NRF_ERROR_NO_MEM;
+	}
+	else if ( SLIP_STATE_DECODING == p_slip->state )
+	{
+		if ( SLIP_BYTE_END == c )
+		{
+			ret = NRF_SUCCESS;
+		}
+		else if ( SLIP_BYTE_ESC == c )
+		{
+			p_slip->state = SLIP_STATE_ESC_RECEIVED;
+		}
+		else
+		{
+			p_slip->p_buffer[p_slip->current_index++] = c;
+		}
+	}
+	else if ( SLIP_STATE_ESC_RECEIVED == p_slip->state )
+	{
+		if ( SLIP_BYTE_ESC_END == c )
+		{
+			p_slip->p_buffer[p_slip->current_index++] = SLIP_BYTE_END;
+			p_slip->state = SLIP_STATE_DECODING;
+		}
+		else if ( SLIP_BYTE_ESC_ESC == c )
+		{
+			p_slip->p_buffer[p_slip->current_index++] = SLIP_BYTE_ESC;
+			p_slip->state = SLIP_STATE_DECODING;
+		}
+		else
+		{
+			p_slip->state = SLIP_STATE_CLEARING_INVALID_PACKET;
+			ret = NRF_ERROR_INVALID_DATA;
+		}
+	}
+	else
+	{
+		if ( SLIP_BYTE_END == c )
+		{
+			p_slip->state			= SLIP_STATE_DECODING;
+			p_slip->current_index	= 0;
+		}
+	}
+
+	return ret;
+}
+
+#endif // __SLIP_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
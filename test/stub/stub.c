@@ -0,0 +1,77 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      stub.c
+*@brief     State of SDK stand-in headers
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "app_util_platform.h"
+#include "app_error.h"
+#include "nrf.h"
+#include "nrf_drv_pwm.h"
+#include "nrf_drv_timer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Critical region nesting
+ */
+volatile uint32_t gu32_stub_critical_nest = 0;
+
+/**
+ * 	Number of APP_ERROR_HANDLER calls
+ */
+volatile uint32_t gu32_stub_app_error = 0;
+
+/**
+ * 	Peripheral registers
+ */
+NRF_POWER_Type	g_stub_nrf_power	= {0};
+NRF_FICR_Type	g_stub_nrf_ficr		= {0};
+SCB_Type		g_stub_scb			= {0};
+NRF_PWM_Type	g_stub_nrf_pwm0		= {0};
+
+/**
+ * 	Timer event handlers
+ */
+nrfx_timer_event_handler_t g_stub_timer_hndl[NRF_DRV_TIMER_STUB_NUM_OF] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Wait for event, does not sleep
+ */
+__attribute__((weak)) void __WFE(void)
+{
+}
+
+/**
+ * 	Send event
+ */
+__attribute__((weak)) void __SEV(void)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
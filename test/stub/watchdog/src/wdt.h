@@ -0,0 +1,51 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      wdt.h
+*@brief     Watchdog core stand-in
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host stand-in for watchdog submodule header, only types and functions
+* 	used by watchdog configuration and supervisor. Functions are
+* 	implemented by test.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __WDT_STUB_H
+#define __WDT_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "middleware/watchdog/wdt_cfg.h"
+
+typedef enum
+{
+	eWDT_OK		= 0x00,
+	eWDT_ERROR	= 0x01,
+} wdt_status_t;
+
+typedef struct
+{
+	const char *	p_name;
+	uint32_t		timeout;
+	bool			enable;
+} wdt_cfg_t;
+
+wdt_status_t wdt_task_report(const wdt_task_t task);
+
+#endif // __WDT_STUB_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
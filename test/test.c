@@ -0,0 +1,223 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test.c
+*@brief     Host test and benchmark helpers
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup TEST
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <time.h>
+
+#include "test.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of checks and failed checks
+ */
+static uint32_t gu32_test_checks	= 0;
+static uint32_t gu32_test_fails		= 0;
+
+/**
+ * 	Number of firmware assertions hit
+ */
+static uint32_t gu32_test_asserts	= 0;
+
+/**
+ * 	Benchmarks enabled
+ */
+static bool gb_test_bench = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Init test, parse arguments
+*
+* @param[in]	argc	- Number of arguments
+* @param[in]	argv	- Arguments
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void test_init(const int argc, char ** const argv)
+{
+	for ( int i = 1; i < argc; i++ )
+	{
+		if ( 0 == strcmp( argv[i], "-b" ))
+		{
+			gb_test_bench = true;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Are benchmarks enabled
+*
+* @return		true when started with "-b"
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool test_bench_en(void)
+{
+	return gb_test_bench;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check condition
+*
+* @param[in]	cond	- Condition
+* @param[in]	p_expr	- Condition as text
+* @param[in]	p_file	- Source file
+* @param[in]	line	- Source line
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void test_check(const bool cond, const char * const p_expr, const char * const p_file, const int line)
+{
+	gu32_test_checks++;
+
+	if ( false == cond )
+	{
+		gu32_test_fails++;
+		printf( "  FAIL %s:%d: %s\n", p_file, line, p_expr );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check integer equality
+*
+* @param[in]	a		- Actual value
+* @param[in]	b		- Expected value
+* @param[in]	p_expr	- Check as text
+* @param[in]	p_file	- Source file
+* @param[in]	line	- Source line
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void test_check_eq(const int64_t a, const int64_t b, const char * const p_expr, const char * const p_file, const int line)
+{
+	gu32_test_checks++;
+
+	if ( a != b )
+	{
+		gu32_test_fails++;
+		printf( "  FAIL %s:%d: %s (%lld != %lld)\n", p_file, line, p_expr, (long long) a, (long long) b );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Report test result
+*
+* @return		exit code, 0 when all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int test_result(void)
+{
+	printf( "  %u checks, %u failed\n", (unsigned) gu32_test_checks, (unsigned) gu32_test_fails );
+
+	return ( 0 == gu32_test_fails ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get monotonic host time
+*
+* @return		time - Unit: ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t test_now_ns(void)
+{
+	struct timespec ts;
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (( (uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get host cycle counter
+*
+* @note	On x86 this is time stamp counter, which runs at nominal
+* 		core clock. Other hosts fall back to nanoseconds.
+*
+* @return		time - Unit: cycle
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t test_now_cycles(void)
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+	return __builtin_ia32_rdtsc();
+#else
+	return test_now_ns();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of failed checks
+*
+* @return		number of failed checks so far
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t test_fail_count(void)
+{
+	return gu32_test_fails;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of firmware assertions hit
+*
+* @return		number of PROJECT_CONFIG_ASSERT failures
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t test_assert_hits(void)
+{
+	return gu32_test_asserts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Firmware assertion handler
+*
+* @note	Replaces target implementation from project_config.c, assertion
+* 		is only counted so tests can check for it.
+*
+* @param[in]	p_file	- Source file
+* @param[in]	line	- Source line
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void project_config_assert_fail(const char * const p_file, const uint32_t line)
+{
+	gu32_test_asserts++;
+	printf( "  assert %s:%u\n", p_file, (unsigned) line );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,72 @@
+// Copyright (c) 2022 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      test.h
+*@brief     Host test and benchmark helpers
+*@author    Ziga Miklosic
+*@date      14.12.2022
+*@version   V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup TEST
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host test and benchmark helpers
+*
+* 	Every test is single executable. Failed checks are reported with
+* 	source location and counted, test_result() gives exit code. When
+* 	executable is started with "-b" argument benchmarks are run as well.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __TEST_H
+#define __TEST_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Check condition
+ */
+#define TEST_ASSERT(x)				test_check(( x ), #x, __FILE__, __LINE__ )
+
+/**
+ * 	Check integer equality, both values are reported on failure
+ */
+#define TEST_ASSERT_EQ(a,b)			test_check_eq((int64_t)( a ), (int64_t)( b ), #a " == " #b, __FILE__, __LINE__ )
+
+/**
+ * 	Benchmark result line
+ */
+#define TEST_BENCH(...)				do { printf( "  bench: " ); printf( __VA_ARGS__ ); printf( "\n" ); } while(0)
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void		test_init			(const int argc, char ** const argv);
+bool		test_bench_en		(void);
+void		test_check			(const bool cond, const char * const p_expr, const char * const p_file, const int line);
+void		test_check_eq		(const int64_t a, const int64_t b, const char * const p_expr, const char * const p_file, const int line);
+int			test_result			(void);
+uint64_t	test_now_ns			(void);
+uint64_t	test_now_cycles		(void);
+uint32_t	test_fail_count		(void);
+uint32_t	test_assert_hits	(void);
+
+#endif // __TEST_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////